@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Arm Limited.
+ * Copyright (c) 2016-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,6 +29,8 @@
 #include "arm_compute/core/IKernel.h"
 #include "arm_compute/core/Types.h"
 
+#include <cstdint>
+
 namespace arm_compute
 {
 class Window;
@@ -104,6 +106,24 @@ public:
         return default_mws;
     }
 
+    /** Estimate the execution time of the kernel on a single thread
+     *
+     * The scheduler uses this estimate to decide whether a dispatch runs inline on the calling thread, on a subset of
+     * the threads or on all of them. Kernels without a cost model return 0 and are only split according to
+     * @ref get_mws.
+     *
+     * @param[in] platform The CPU platform used to create the context.
+     * @param[in] window   Region on which the kernel is going to be executed.
+     *
+     * @return Estimated execution time in nanoseconds, 0 if unknown.
+     */
+    virtual uint64_t estimate_cost(const CPUInfo &platform, const Window &window) const
+    {
+        ARM_COMPUTE_UNUSED(platform, window);
+
+        return 0;
+    }
+
     /** Name of the kernel
      *
      * @return Kernel name
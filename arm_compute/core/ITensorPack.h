@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,6 +53,8 @@ public:
         ITensor       *tensor{nullptr};
         const ITensor *ctensor{nullptr};
     };
+    /** Iterator over the packed tensors */
+    using const_iterator = std::unordered_map<int, PackElement>::const_iterator;
 
 public:
     /** Default Constructor */
@@ -108,6 +110,18 @@ public:
      * @return True if empty else false
      */
     bool empty() const;
+    /** Iterator to the first packed tensor
+     *
+     * @note The order of iteration is unspecified.
+     *
+     * @return Constant iterator to the first element of the pack
+     */
+    const_iterator begin() const;
+    /** Iterator past the last packed tensor
+     *
+     * @return Constant iterator past the last element of the pack
+     */
+    const_iterator end() const;
 
 private:
     std::unordered_map<int, PackElement> _pack{}; /**< Container with the packed tensors */
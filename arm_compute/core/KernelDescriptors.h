@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 /** Descriptor for FFT scale kernels */
@@ -174,6 +176,30 @@ struct InstanceNormalizationLayerKernelInfo
     bool  use_mixed_precision; /**< Use mixed precision in case of FP16 execution. Defaults to true */
 };
 
+struct GroupNormalizationLayerKernelInfo
+{
+    /** Default constructor */
+    GroupNormalizationLayerKernelInfo() : GroupNormalizationLayerKernelInfo(1U, 1.f, 0.f, 1e-5f)
+    {
+    }
+    /** Constructor
+     *
+     * @param[in] num_groups Number of groups the channels are divided into.
+     * @param[in] gamma      The scale scalar value applied to the normalized tensor when no per-channel scale is given.
+     * @param[in] beta       The offset scalar value applied to the normalized tensor when no per-channel offset is given.
+     * @param[in] epsilon    Lower bound value for the normalization.
+     */
+    GroupNormalizationLayerKernelInfo(unsigned int num_groups, float gamma, float beta, float epsilon)
+        : num_groups(num_groups), gamma(gamma), beta(beta), epsilon(epsilon)
+    {
+    }
+
+    unsigned int num_groups; /**< Number of groups the channels are divided into. Defaults to 1 */
+    float        gamma;      /**< The scale scalar value applied to the normalized tensor. Defaults to 1.0 */
+    float        beta;       /**< The offset scalar value applied to the normalized tensor. Defaults to 0.0 */
+    float        epsilon;    /**< Lower bound value for the normalization. Defaults to 1e-5 */
+};
+
 struct GEMMLowpReductionKernelInfo
 {
     /** Default constructor */
@@ -232,6 +258,12 @@ struct ScaleKernelInfo
     bool                use_padding;           /**< Indication of using padding */
     bool                align_corners;         /**< Align corners of input and output */
     DataLayout          data_layout;           /**< Data layout to use */
+    /** Per-channel mean subtracted from the resized values. A single value applies to all the channels.
+     *  Only supported on CPU for F16/F32 destinations, which may then be fed from a U8 source. */
+    std::vector<float> norm_mean{};
+    /** Per-channel standard deviation dividing the resized values once the mean is subtracted.
+     *  A single value applies to all the channels. */
+    std::vector<float> norm_std{};
 };
 
 struct MatMulKernelInfo
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -186,11 +186,7 @@ public:
         ARM_COMPUTE_ERROR_ON(_parent == nullptr);
         return _parent->padding();
     }
-    bool has_padding() const override
-    {
-        ARM_COMPUTE_ERROR_ON(_parent == nullptr);
-        return _parent->has_padding();
-    }
+    bool has_padding() const override;
     bool is_resizable() const override
     {
         ARM_COMPUTE_ERROR_ON(_parent == nullptr);
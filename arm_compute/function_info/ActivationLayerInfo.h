@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,8 +77,13 @@ public:
      * @param[in] a (Optional) The alpha parameter used by some activation functions
      *              (@ref ActivationFunction::BOUNDED_RELU, @ref ActivationFunction::LU_BOUNDED_RELU, @ref ActivationFunction::LINEAR, @ref ActivationFunction::TANH).
      * @param[in] b (Optional) The beta parameter used by some activation functions (@ref ActivationFunction::LINEAR, @ref ActivationFunction::LU_BOUNDED_RELU, @ref ActivationFunction::TANH).
+     * @param[in] fast_math (Optional) Allow faster, lower accuracy approximations of e^x and tanh(x) in
+     *                      @ref ActivationFunction::LOGISTIC, @ref ActivationFunction::TANH,
+     *                      @ref ActivationFunction::SOFT_RELU, @ref ActivationFunction::ELU and
+     *                      @ref ActivationFunction::SWISH. Defaults to false.
      */
-    ActivationLayerInfo(ActivationFunction f, float a = 0.0f, float b = 0.0f) : _act(f), _a(a), _b(b), _enabled(true)
+    ActivationLayerInfo(ActivationFunction f, float a = 0.0f, float b = 0.0f, bool fast_math = false)
+        : _act(f), _a(a), _b(b), _enabled(true), _fast_math(fast_math)
     {
     }
     /** Get the type of activation function */
@@ -101,6 +106,11 @@ public:
     {
         return _enabled;
     }
+    /** Check if lower accuracy approximations are allowed */
+    bool fast_math() const
+    {
+        return _fast_math;
+    }
 
 #ifdef __aarch64__
     const LookupTable256 &lut() const
@@ -126,14 +136,15 @@ public:
     // The < and == are added to be able to use this data type as an attribute for LUTInfo
     friend bool operator<(const ActivationLayerInfo &l, const ActivationLayerInfo &r)
     {
-        const auto l_tup = std::make_tuple(l._act, l._a, l._b, l._enabled);
-        const auto r_tup = std::make_tuple(r._act, r._a, r._b, r._enabled);
+        const auto l_tup = std::make_tuple(l._act, l._a, l._b, l._enabled, l._fast_math);
+        const auto r_tup = std::make_tuple(r._act, r._a, r._b, r._enabled, r._fast_math);
 
         return l_tup < r_tup;
     }
     bool operator==(const ActivationLayerInfo &l) const
     {
-        return this->_act == l._act && this->_a == l._a && this->_b == l._b && this->_enabled == l._enabled;
+        return this->_act == l._act && this->_a == l._a && this->_b == l._b && this->_enabled == l._enabled &&
+               this->_fast_math == l._fast_math;
     }
     bool operator!=(const ActivationLayerInfo &l) const
     {
@@ -141,10 +152,11 @@ public:
     }
 
 private:
-    ActivationFunction _act     = {ActivationLayerInfo::ActivationFunction::IDENTITY};
-    float              _a       = {};
-    float              _b       = {};
-    bool               _enabled = {false};
+    ActivationFunction _act       = {ActivationLayerInfo::ActivationFunction::IDENTITY};
+    float              _a         = {};
+    float              _b         = {};
+    bool               _enabled   = {false};
+    bool               _fast_math = {false};
 
 #ifdef __aarch64__
     LookupTable256                    _lut = {};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,15 +36,21 @@ struct ConvolutionInfo
     ConvolutionInfo(const PadStrideInfo       &pad_stride_info,
                     unsigned int               depth_multiplier,
                     const ActivationLayerInfo &act_info,
-                    const Size2D              &dilation)
-        : pad_stride_info(pad_stride_info), depth_multiplier(depth_multiplier), act_info(act_info), dilation(dilation)
+                    const Size2D              &dilation,
+                    bool                       enable_fast_math = false)
+        : pad_stride_info(pad_stride_info),
+          depth_multiplier(depth_multiplier),
+          act_info(act_info),
+          dilation(dilation),
+          enable_fast_math(enable_fast_math)
     {
     }
     PadStrideInfo pad_stride_info{}; /**< Convolution info (Pads, strides,...) */
     unsigned int  depth_multiplier{
         1}; /**< Multiplier to apply to input's depth to retrieve the output depth. Defaults to 1 */
-    ActivationLayerInfo act_info{};             /**< Fused activation to apply after convolution. */
-    Size2D              dilation{Size2D(1, 1)}; /**< Dilation, in elements, across x and y. Defaults to (1, 1). */
+    ActivationLayerInfo act_info{};              /**< Fused activation to apply after convolution. */
+    Size2D              dilation{Size2D(1, 1)};  /**< Dilation, in elements, across x and y. Defaults to (1, 1). */
+    bool                enable_fast_math{false}; /**< Allow BF16 arithmetic in FP32 kernels. Defaults to false. */
 };
 } // namespace arm_compute
 #endif /* ACL_ARM_COMPUTE_FUNCTION_INFO_CONVOLUTIONINFO */
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_FUSEDELEMENTWISEINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_FUSEDELEMENTWISEINFO_H
+
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+/** Maximum number of nodes of an @ref ElementwiseExpression */
+constexpr size_t elementwise_expression_max_nodes = 32;
+/** Maximum number of inputs read by an @ref ElementwiseExpression */
+constexpr size_t elementwise_expression_max_inputs = 8;
+
+/** Operations of an @ref ElementwiseExpression */
+enum class ElementwiseExpressionOp
+{
+    INPUT,        /**< Value of one of the inputs of the expression */
+    ADD,          /**< Addition of two values */
+    SUB,          /**< Subtraction of two values */
+    MUL,          /**< Multiplication of two values */
+    DIV,          /**< Division of two values */
+    MAX,          /**< Maximum of two values */
+    MIN,          /**< Minimum of two values */
+    SQUARED_DIFF, /**< Squared difference of two values */
+    NEG,          /**< Negation of a value */
+    ABS,          /**< Absolute value */
+    EXP,          /**< Exponential */
+    RSQRT,        /**< Reciprocal square root */
+    ACTIVATION,   /**< Activation function */
+};
+
+/** Node of an @ref ElementwiseExpression */
+struct ElementwiseExpressionNode
+{
+    ElementwiseExpressionOp op{ElementwiseExpressionOp::INPUT}; /**< Operation of the node */
+    int32_t                 lhs{-1};    /**< First operand node, or input index for ElementwiseExpressionOp::INPUT */
+    int32_t                 rhs{-1};    /**< Second operand node for binary operations */
+    ActivationLayerInfo     act_info{}; /**< Activation function for ElementwiseExpressionOp::ACTIVATION */
+};
+
+/** Small DAG of pointwise operations evaluated in a single pass over its inputs
+ *
+ * Nodes are appended in topological order and are referenced by the index returned when they are added.
+ * The value of the last node is the result of the expression. For example (x * scale + bias) followed by a
+ * ReLU and a residual addition is described as:
+ *
+ * @code
+ * ElementwiseExpression expr;
+ * const auto x   = expr.input(0);
+ * const auto mul = expr.binary(ElementwiseExpressionOp::MUL, x, expr.input(1));
+ * const auto add = expr.binary(ElementwiseExpressionOp::ADD, mul, expr.input(2));
+ * const auto act = expr.activation(add, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+ * expr.binary(ElementwiseExpressionOp::ADD, act, x);
+ * @endcode
+ */
+class ElementwiseExpression
+{
+public:
+    /** Default constructor */
+    ElementwiseExpression() = default;
+    /** Add a node reading one of the inputs
+     *
+     * @param[in] idx Index of the input
+     *
+     * @return Index of the new node
+     */
+    int32_t input(uint32_t idx)
+    {
+        ElementwiseExpressionNode node;
+        node.op  = ElementwiseExpressionOp::INPUT;
+        node.lhs = static_cast<int32_t>(idx);
+        return add_node(node);
+    }
+    /** Add a binary operation node
+     *
+     * @param[in] op  Binary operation. Supported: ADD/SUB/MUL/DIV/MAX/MIN/SQUARED_DIFF
+     * @param[in] lhs Index of the first operand node
+     * @param[in] rhs Index of the second operand node
+     *
+     * @return Index of the new node
+     */
+    int32_t binary(ElementwiseExpressionOp op, int32_t lhs, int32_t rhs)
+    {
+        ElementwiseExpressionNode node;
+        node.op  = op;
+        node.lhs = lhs;
+        node.rhs = rhs;
+        return add_node(node);
+    }
+    /** Add a unary operation node
+     *
+     * @param[in] op  Unary operation. Supported: NEG/ABS/EXP/RSQRT
+     * @param[in] src Index of the operand node
+     *
+     * @return Index of the new node
+     */
+    int32_t unary(ElementwiseExpressionOp op, int32_t src)
+    {
+        ElementwiseExpressionNode node;
+        node.op  = op;
+        node.lhs = src;
+        return add_node(node);
+    }
+    /** Add an activation node
+     *
+     * @param[in] src      Index of the operand node
+     * @param[in] act_info Activation function to apply
+     *
+     * @return Index of the new node
+     */
+    int32_t activation(int32_t src, const ActivationLayerInfo &act_info)
+    {
+        ElementwiseExpressionNode node;
+        node.op       = ElementwiseExpressionOp::ACTIVATION;
+        node.lhs      = src;
+        node.act_info = act_info;
+        return add_node(node);
+    }
+    /** Nodes of the expression in topological order
+     *
+     * @return The nodes of the expression
+     */
+    const std::vector<ElementwiseExpressionNode> &nodes() const
+    {
+        return _nodes;
+    }
+    /** Number of inputs read by the expression
+     *
+     * @return One more than the highest input index read by the expression
+     */
+    uint32_t num_inputs() const
+    {
+        int32_t max_idx = -1;
+        for (const auto &node : _nodes)
+        {
+            if (node.op == ElementwiseExpressionOp::INPUT)
+            {
+                max_idx = std::max(max_idx, node.lhs);
+            }
+        }
+        return static_cast<uint32_t>(max_idx + 1);
+    }
+
+private:
+    int32_t add_node(const ElementwiseExpressionNode &node)
+    {
+        _nodes.push_back(node);
+        return static_cast<int32_t>(_nodes.size() - 1);
+    }
+
+    std::vector<ElementwiseExpressionNode> _nodes{};
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_FUSEDELEMENTWISEINFO_H
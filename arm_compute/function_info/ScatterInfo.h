@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,13 +41,16 @@ enum class ScatterFunction
 /** Scatter operator information */
 struct ScatterInfo
 {
-    ScatterInfo(ScatterFunction f, bool zero) : func(f), zero_initialization(zero)
+    ScatterInfo(ScatterFunction f, bool zero, bool unique = false)
+        : func(f), zero_initialization(zero), unique_indices(unique)
     {
         ARM_COMPUTE_ERROR_ON_MSG(f != ScatterFunction::Add && zero,
                                  "Zero initialisation is only supported with Add Scatter Function.");
     }
     ScatterFunction func;            /**< Type of scatter function to use with scatter operator*/
     bool zero_initialization{false}; /**< Fill output tensors with 0. Only available with add scatter function. */
+    bool unique_indices{false};      /**< All the in-bounds indices are known to address distinct elements. Lets
+                                          the updates be applied without ordering them by destination first. */
 };
 } // namespace arm_compute
 
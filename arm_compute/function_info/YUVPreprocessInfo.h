@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_FUNCTION_INFO_YUVPREPROCESSINFO_H
+#define ACL_ARM_COMPUTE_FUNCTION_INFO_YUVPREPROCESSINFO_H
+
+#include "arm_compute/core/Types.h"
+
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+/** Colour standard used to convert YUV samples to RGB */
+enum class YUVColorStandard
+{
+    BT601, /**< ITU-R BT.601 */
+    BT709  /**< ITU-R BT.709 */
+};
+
+/** Fused YUV preprocessing information
+ *
+ * Describes how a camera frame is turned into a network input: the frame is cropped, resampled bilinearly to the
+ * destination size, converted to RGB, clamped to [0, 255] and normalised per channel as (value - mean) / std.
+ */
+struct YUVPreprocessInfo
+{
+    /** Default constructor */
+    YUVPreprocessInfo() = default;
+    /** Constructor
+     *
+     * @param[in] format          Format of the frame. Supported: NV12/NV21/IYUV
+     * @param[in] color_standard  (Optional) Colour standard of the frame
+     * @param[in] full_range      (Optional) True if luma and chroma use the full [0, 255] range instead of the video range
+     * @param[in] crop            (Optional) Region of the frame to resize to the destination. A zero width or height means the whole frame
+     * @param[in] sampling_policy (Optional) Sampling policy of the resize
+     * @param[in] bgr             (Optional) True to write the channels in BGR order instead of RGB
+     * @param[in] norm_mean       (Optional) Mean subtracted from each output channel. Either empty, a single value or one value per output channel
+     * @param[in] norm_std        (Optional) Standard deviation dividing each output channel. Either empty, a single value or one value per output channel
+     */
+    YUVPreprocessInfo(Format             format,
+                      YUVColorStandard   color_standard  = YUVColorStandard::BT601,
+                      bool               full_range      = false,
+                      Rectangle          crop            = Rectangle{0, 0, 0, 0},
+                      SamplingPolicy     sampling_policy = SamplingPolicy::CENTER,
+                      bool               bgr             = false,
+                      std::vector<float> norm_mean       = {},
+                      std::vector<float> norm_std        = {})
+        : format(format),
+          color_standard(color_standard),
+          full_range(full_range),
+          crop(crop),
+          sampling_policy(sampling_policy),
+          bgr(bgr),
+          norm_mean(std::move(norm_mean)),
+          norm_std(std::move(norm_std))
+    {
+    }
+
+    Format             format{Format::NV12};                   /**< Format of the frame */
+    YUVColorStandard   color_standard{YUVColorStandard::BT601}; /**< Colour standard of the frame */
+    bool               full_range{false};                      /**< True if samples use the full range */
+    Rectangle          crop{0, 0, 0, 0};                       /**< Region of the frame to resize */
+    SamplingPolicy     sampling_policy{SamplingPolicy::CENTER}; /**< Sampling policy of the resize */
+    bool               bgr{false};                             /**< True to write the channels in BGR order */
+    std::vector<float> norm_mean{};                            /**< Per output channel mean */
+    std::vector<float> norm_std{};                             /**< Per output channel standard deviation */
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_FUNCTION_INFO_YUVPREPROCESSINFO_H
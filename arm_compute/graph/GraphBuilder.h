@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -240,6 +240,7 @@ public:
      * @param[in] bias_accessor         (Optional) Accessor of the bias node data
      * @param[in] quant_info            (Optional) Weights quantization info
      * @param[in] out_quant_info        (Optional) Output quantization info
+     * @param[in] fast_math_hint        (Optional) Fast math hint
      *
      * @return Node ID of the created node, EmptyNodeID in case of error
      */
@@ -254,7 +255,8 @@ public:
                                    ITensorAccessorUPtr        weights_accessor = nullptr,
                                    ITensorAccessorUPtr        bias_accessor    = nullptr,
                                    const QuantizationInfo    &quant_info       = QuantizationInfo(),
-                                   const QuantizationInfo    &out_quant_info   = QuantizationInfo());
+                                   const QuantizationInfo    &out_quant_info   = QuantizationInfo(),
+                                   FastMathHint               fast_math_hint   = FastMathHint::Disabled);
     /** Adds an element-wise layer node to the graph
      *
      * @param[in] g         Graph to add the node to
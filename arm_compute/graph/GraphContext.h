@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -120,6 +120,17 @@ public:
      * @return Weights manager contexts
      */
     std::map<Target, WeightsManagerContext> &weights_managers();
+    /** Shares the weights managers of another context
+     *
+     * Graphs of the same model finalized with contexts sharing their weights managers hold their prepared weights
+     * once, while each context keeps its own transition and function memory. The graphs can then execute
+     * concurrently.
+     *
+     * @note Targets that already have a weights manager in this context are left untouched
+     *
+     * @param[in] ctx Context to share the weights managers of
+     */
+    void share_weights_managers(const GraphContext &ctx);
     /** Finalizes memory managers in graph context */
     void finalize();
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,6 +77,13 @@ public:
      * @param[in] graph Graph to invalidate
      */
     void invalidate_graph(Graph &graph);
+    /** Reports the memory held by a finalized graph
+     *
+     * @param[in] graph Graph to inspect
+     *
+     * @return The memory footprint of the graph
+     */
+    MemoryFootprint memory_footprint(Graph &graph);
 
 private:
     std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -171,6 +171,7 @@ enum class NodeType
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
+    FusedElementwiseLayer,
     GenerateProposalsLayer,
     L2NormalizeLayer,
     NormalizationLayer,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -450,9 +450,10 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
     const ActivationLayerInfo fused_act      = node.fused_activation();
 
     // Create and configure function (we assume that functions have been validated before creation)
-    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
-    std::unique_ptr<IFunction>      func;
-    std::string                     func_name;
+    std::shared_ptr<IMemoryManager>  mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::shared_ptr<IWeightsManager> wm = get_weights_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>       func;
+    std::string                      func_name;
 
     if (conv_algorithm == ConvolutionMethod::Winograd)
     {
@@ -471,16 +472,16 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
     else if (conv_algorithm == ConvolutionMethod::GEMM)
     {
         std::tie(func, func_name) =
-            create_named_memory_managed_function<typename ConvolutionLayerFunctions::GEMMConvolutionLayer>(
-                std::string("GEMMConvolutionLayer"), mm, input, weights, biases, output, conv_info, WeightsInfo(),
-                Size2D(1U, 1U), fused_act, num_groups);
+            create_named_weights_managed_function<typename ConvolutionLayerFunctions::GEMMConvolutionLayer>(
+                std::string("GEMMConvolutionLayer"), mm, wm.get(), input, weights, biases, output, conv_info,
+                WeightsInfo(), Size2D(1U, 1U), fused_act, num_groups);
     }
     else
     {
         std::tie(func, func_name) =
-            create_named_memory_managed_function<typename ConvolutionLayerFunctions::GenericConvolutionLayer>(
-                std::string("GenericConvolutionLayer"), mm, input, weights, biases, output, conv_info, WeightsInfo(),
-                Size2D(1U, 1U), fused_act, fast_math, num_groups);
+            create_named_weights_managed_function<typename ConvolutionLayerFunctions::GenericConvolutionLayer>(
+                std::string("GenericConvolutionLayer"), mm, wm.get(), input, weights, biases, output, conv_info,
+                WeightsInfo(), Size2D(1U, 1U), fused_act, fast_math, num_groups);
     }
 
     // Log info
@@ -955,6 +956,45 @@ std::unique_ptr<IFunction> create_fully_connected_layer(FullyConnectedLayerNode
     return func;
 }
 
+/** Create a backend fused elementwise layer function
+ *
+ * @tparam FusedElementwiseLayerFunction Backend fused elementwise function
+ * @tparam TargetInfo                    Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ *
+ * @return Backend fused elementwise layer function
+ */
+template <typename FusedElementwiseLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_elementwise_layer(FusedElementwiseLayerNode &node)
+{
+    validate_node<TargetInfo>(node, node.expression().num_inputs() /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    std::vector<typename TargetInfo::SrcTensorType *> inputs;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        inputs.push_back(get_backing_tensor<TargetInfo>(node.input(i)));
+        ARM_COMPUTE_ERROR_ON(inputs.back() == nullptr);
+    }
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    // Create and configure function
+    auto func = std::make_unique<FusedElementwiseLayerFunction>();
+    func->configure(inputs, output, node.expression());
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << node.name() << " Type: " << node.type()
+                                               << " Target: " << TargetInfo::TargetType
+                                               << " Data Type: " << output->info()->data_type()
+                                               << " Num Inputs: " << inputs.size() << " Num Operations: "
+                                               << node.expression().nodes().size()
+                                               << " Output shape: " << output->info()->tensor_shape() << std::endl);
+
+    return func;
+}
+
 /** Create a backend generate proposals layer function
  *
  * @tparam GenerateProposalsLayerFunction Backend generate proposals function
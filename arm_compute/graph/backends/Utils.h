@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,10 +24,14 @@
 #ifndef ARM_COMPUTE_GRAPH_BACKENDS_UTILS_H
 #define ARM_COMPUTE_GRAPH_BACKENDS_UTILS_H
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include <memory>
+#include <type_traits>
+
 namespace arm_compute
 {
 namespace graph
@@ -67,6 +71,43 @@ create_named_memory_managed_function(FunctionNameType name, MemoryManagerType mm
     return std::make_pair(std::move(f), name);
 }
 
+namespace detail
+{
+template <typename FunctionType, typename MemoryManagerType>
+std::unique_ptr<FunctionType> make_weights_managed_function(MemoryManagerType mm, IWeightsManager *wm, std::true_type)
+{
+    return std::make_unique<FunctionType>(mm, wm);
+}
+
+template <typename FunctionType, typename MemoryManagerType>
+std::unique_ptr<FunctionType> make_weights_managed_function(MemoryManagerType mm, IWeightsManager *wm, std::false_type)
+{
+    ARM_COMPUTE_UNUSED(wm);
+    return std::make_unique<FunctionType>(mm);
+}
+} // namespace detail
+
+/** Creates and configures a named function
+ *
+ * @note The weights manager is ignored by functions that can't be constructed with one
+ *
+ * @param[in] name Name of the function
+ * @param[in] mm   Memory manager to use
+ * @param[in] wm   Weights manager to use
+ * @param[in] args Function arguments
+ *
+ * @return  A configured backend function
+ */
+template <typename FunctionType, typename FunctionNameType, typename MemoryManagerType, typename... ParameterType>
+std::tuple<std::unique_ptr<arm_compute::IFunction>, FunctionNameType> create_named_weights_managed_function(
+    FunctionNameType name, MemoryManagerType mm, IWeightsManager *wm, ParameterType... args)
+{
+    auto f = detail::make_weights_managed_function<FunctionType>(
+        mm, wm, std::is_constructible<FunctionType, MemoryManagerType, IWeightsManager *>());
+    f->configure(std::forward<ParameterType>(args)...);
+    return std::make_pair(std::move(f), name);
+}
+
 /** Checks if an operation is in place
  *
  * @param[in] input  Pointer to input
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -328,6 +328,33 @@ Status validate_detection_post_process_layer(DetectionPostProcessLayerNode &node
     return DetectionPostProcessLayer::validate(input0, input1, input2, output0, output1, output2, output3, detect_info);
 }
 
+/** Validates a Fused Elementwise layer node
+ *
+ * @tparam FusedElementwiseLayer Fused Elementwise layer type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename FusedElementwiseLayer>
+Status validate_fused_elementwise_layer(FusedElementwiseLayerNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE(
+        "Validating FusedElementwiseLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != node.expression().num_inputs());
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    std::vector<const arm_compute::ITensorInfo *> inputs;
+    for (unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        inputs.push_back(detail::get_backing_tensor_info(node.input(i)));
+    }
+    arm_compute::ITensorInfo *output = get_backing_tensor_info(node.output(0));
+
+    return FusedElementwiseLayer::validate(inputs, output, node.expression());
+}
+
 /** Validates a Generate Proposals layer node
  *
  * @tparam GenerateProposalsLayer Generate Proposals layer type
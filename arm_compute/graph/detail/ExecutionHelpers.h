@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #define ARM_COMPUTE_GRAPH_DETAIL_EXECUTION_HELPERS_H
 
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/runtime/MemoryFootprint.h"
 
 namespace arm_compute
 {
@@ -108,6 +109,8 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload);
  */
 bool call_all_output_node_accessors(ExecutionWorkload &workload);
 /** Prepares all tasks for execution
+ *
+ * Constant tensors are released as soon as all their consumers are prepared and hold a transformed copy of them.
  *
  * @param[in] workload Workload to prepare
  */
@@ -117,6 +120,16 @@ void prepare_all_tasks(ExecutionWorkload &workload);
  * @param[in] workload Workload to execute
  */
 void call_all_tasks(ExecutionWorkload &workload);
+/** Reports the memory held by a finalized workload
+ *
+ * Constant tensors and transition buffers are accounted from the graph, and prepared weights and workspaces from
+ * the functions of the workload. Memory pools shared by the functions or the transition buffers are accounted once.
+ *
+ * @param[in] workload Workload to inspect
+ *
+ * @return The memory footprint of the workload
+ */
+MemoryFootprint memory_footprint(ExecutionWorkload &workload);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -60,8 +60,25 @@ public:
      * @param[in] config (Optional) Graph configuration to use
      */
     void finalize(Target target, const GraphConfig &config);
+    /** Finalizes the stream as a replica of another stream of the same model
+     *
+     * The replica shares the prepared weights of @p model and only owns its transition buffers and function
+     * workspaces, so that several replicas can run concurrently from different threads.
+     *
+     * @note @p config must enable the function weights manager
+     *
+     * @param[in] target Execution target
+     * @param[in] config Graph configuration to use
+     * @param[in] model  Finalized stream holding the same graph
+     */
+    void finalize(Target target, const GraphConfig &config, const Stream &model);
     /** Executes the stream **/
     void run();
+    /** Reports the memory held by the finalized stream
+     *
+     * @return The memory footprint of the stream
+     */
+    MemoryFootprint memory_footprint();
 
     // Inherited overridden methods
     void         add_layer(ILayer &layer) override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,11 +40,13 @@ public:
      * @param[in] depth_multiplier (Optional) Depth multiplier parameter.
      * @param[in] method           (Optional) Depthwise convolution method to use
      * @param[in] out_quant_info   (Optional) Output quantization info
+     * @param[in] fast_math_hint   (Optional) Fast math hint
      */
     DepthwiseConvolutionLayerNode(PadStrideInfo              info,
                                   int                        depth_multiplier = 1,
                                   DepthwiseConvolutionMethod method           = DepthwiseConvolutionMethod::Default,
-                                  QuantizationInfo           out_quant_info   = QuantizationInfo());
+                                  QuantizationInfo           out_quant_info   = QuantizationInfo(),
+                                  FastMathHint               fast_math_hint   = FastMathHint::Disabled);
     /** Sets the depthwise convolution method to use
      *
      * @param[in] method Depthwise convolution method to use
@@ -58,6 +60,16 @@ public:
      * @return Depthwise convolution layer method do be used by the node
      */
     DepthwiseConvolutionMethod depthwise_convolution_method() const;
+    /** Sets the fast math hint
+     *
+     * @param[in] hint Hint to use for depthwise convolution
+     */
+    void set_fast_math_hint(FastMathHint hint);
+    /** Fast math hint accessor
+     *
+     * @return Fast math hint to be used by the node
+     */
+    FastMathHint fast_math_hint() const;
     /** Depth multiplier accessor
      *
      * @return Depth multiplier
@@ -111,6 +123,7 @@ private:
     int                        _depth_multiplier;
     DepthwiseConvolutionMethod _method;
     QuantizationInfo           _out_quant_info;
+    FastMathHint               _fast_math_hint;
     ActivationLayerInfo        _fused_activation;
 };
 } // namespace graph
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,7 @@ class FlattenLayerNode;
 class FullyConnectedLayerNode;
 class FusedConvolutionBatchNormalizationNode;
 class FusedDepthwiseConvolutionBatchNormalizationNode;
+class FusedElementwiseLayerNode;
 class GenerateProposalsLayerNode;
 class InputNode;
 class L2NormalizeLayerNode;
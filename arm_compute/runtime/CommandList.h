@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_COMMANDLIST_H
+#define ACL_ARM_COMPUTE_RUNTIME_COMMANDLIST_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace arm_compute
+{
+/** Pre-recorded list of the kernels dispatched by a sequence of functions
+ *
+ * Running a function goes through tensor pack and window construction, workload creation and the scheduler's
+ * splitting logic on every call. For networks made of many small layers this overhead can be comparable to the cost
+ * of the kernels themselves. A command list runs the functions once while recording every kernel dispatched through
+ * the scheduler, together with its tensors and the sub-windows it is split into. Replaying the list then only runs
+ * the recorded kernels, without allocating memory.
+ *
+ * @note Functions must be configured, allocated and prepared (see @ref IFunction::prepare) before being recorded so
+ *       that one-off work such as weights reshaping is not part of the list.
+ * @note The recorded tensors are frozen: the tensors used by the functions must keep the same shapes and buffers
+ *       between the recording and the replays.
+ * @note Only the kernels dispatched with @ref IScheduler::schedule or @ref IScheduler::schedule_op are recorded. If a
+ *       function dispatches workloads directly with @ref IScheduler::run_tagged_workloads the list is not replayable
+ *       and @ref replay calls the recorded callable instead. Functions doing work on the calling thread outside of the
+ *       scheduler must not be recorded.
+ * @note Auxiliary memory must outlive the recording. If a host buffer is freed while recording, e.g. a temporary
+ *       workspace an operator allocates in run() because its caller did not provide one, the recorded commands may
+ *       point to freed memory: the list is then not replayable and @ref replay calls the recorded callable instead.
+ *       Functions allocating their workspaces at configure time, as the NEON functions do, can be replayed.
+ * @note Memory managed functions do not acquire their memory group on replay: replays must not overlap with the
+ *       execution of other functions sharing the same memory manager.
+ * @note Recording temporarily replaces the active scheduler, which must not be a custom one, and must not run
+ *       concurrently with other functions.
+ */
+class CommandList
+{
+public:
+    /** Default constructor */
+    CommandList();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CommandList(const CommandList &) = delete;
+    /** Default move constructor */
+    CommandList(CommandList &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CommandList &operator=(const CommandList &) = delete;
+    /** Default move assignment operator */
+    CommandList &operator=(CommandList &&);
+    /** Default destructor */
+    ~CommandList();
+    /** Run a sequence of functions and record the kernels they dispatch
+     *
+     * Any previously recorded command is discarded.
+     *
+     * @param[in] func Callable running the functions to record.
+     */
+    void record(std::function<void()> func);
+    /** Run the recorded kernels in the order they were dispatched */
+    void replay();
+    /** Check whether @ref replay runs the recorded kernels or falls back to the recorded callable
+     *
+     * @return True if the recorded kernels can be replayed
+     */
+    bool is_replayable() const;
+    /** Number of recorded kernel dispatches
+     *
+     * @return The number of recorded commands
+     */
+    size_t size() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_COMMANDLIST_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -109,5 +109,28 @@ struct Conv3dInfo
     bool                  enable_fast_math{false};
 };
 
+/** Type of cell computed at each timestep of a recurrent sequence */
+enum class RecurrentCellType
+{
+    RNN, /**< Fully connected cell: h = act(x * W + b + h * R + rb) */
+    GRU  /**< Gated recurrent unit with the gates stored in the order update, reset and hidden */
+};
+
+/** Descriptor used by the recurrent sequence functions */
+struct RecurrentSequenceInfo
+{
+    RecurrentSequenceInfo() = default;
+
+    RecurrentSequenceInfo(RecurrentCellType cell_type, const ActivationLayerInfo &act_info, bool bidirectional)
+        : cell_type(cell_type), act_info(act_info), bidirectional(bidirectional)
+    {
+    }
+
+    RecurrentCellType   cell_type{RecurrentCellType::RNN}; /**< Type of cell */
+    ActivationLayerInfo act_info{ActivationLayerInfo::ActivationFunction::TANH, 1.f,
+                                 1.f};  /**< Activation of the RNN cell, ignored by the GRU cell */
+    bool                bidirectional{false}; /**< Also process the sequence backward and concatenate the outputs */
+};
+
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_FUNCTIONDESCRIPTORS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021 Arm Limited.
+ * Copyright (c) 2016-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,8 @@
 #ifndef ARM_COMPUTE_IFUNCTION_H
 #define ARM_COMPUTE_IFUNCTION_H
 
+#include "arm_compute/runtime/MemoryFootprint.h"
+
 namespace arm_compute
 {
 /** Base class for all functions */
@@ -57,6 +59,19 @@ public:
     virtual void prepare()
     {
     }
+    /** Report the memory held by the function
+     *
+     * Only the buffers owned by the function and the constant inputs it consumes are accounted,
+     * source and destination tensors are left to the caller.
+     *
+     * @note Functions that do not hold significant memory report an empty footprint.
+     *
+     * @return The memory footprint of the function
+     */
+    virtual MemoryFootprint memory_footprint() const
+    {
+        return MemoryFootprint{};
+    }
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_IFUNCTION_H */
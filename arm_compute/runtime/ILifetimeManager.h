@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019 Arm Limited.
+ * Copyright (c) 2017-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -85,6 +85,16 @@ public:
      * @return Mapping type of the lifetime manager
      */
     virtual MappingType mapping_type() const = 0;
+    /** Returns the size of a single memory pool created by the lifetime manager
+     *
+     * @note Lifetime managers that do not track the size of their pools report 0
+     *
+     * @return Size in bytes of a pool, 0 until the lifetime of all the registered objects is finalized
+     */
+    virtual size_t pool_size() const
+    {
+        return 0;
+    }
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_ILIFETIMEMANAGER_H */
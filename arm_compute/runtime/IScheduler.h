@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,8 +28,10 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/Types.h"
 
+#include <atomic>
 #include <functional>
 #include <limits>
+#include <utility>
 
 namespace arm_compute
 {
@@ -215,6 +217,24 @@ protected:
      */
     void schedule_common(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors);
 
+    /** Work out the number of sub-windows a kernel's execution window is split into along the hinted dimension
+     *
+     * @param[in] kernel Kernel to execute.
+     * @param[in] hints  Hints for the scheduler. The split dimension must not be @ref split_dimensions_all.
+     * @param[in] window Window to use for kernel execution.
+     *
+     * @return Number of sub-windows. 0 if there is nothing to execute, 1 if the kernel must run on the calling thread.
+     */
+    unsigned int num_windows_1d(const ICPPKernel &kernel, const Hints &hints, const Window &window);
+
+    /** Work out the number of sub-windows in X and Y used to split a kernel's execution window along all dimensions
+     *
+     * @param[in] window Window to use for kernel execution.
+     *
+     * @return Pair containing the number of sub-windows in X and in Y
+     */
+    std::pair<unsigned int, unsigned int> num_windows_2d(const Window &window);
+
     /** Adjust the number of windows to the optimize performance
      * (used for small workloads where smaller number of threads might improve the performance)
      *
@@ -232,8 +252,25 @@ protected:
                                       const ICPPKernel &kernel,
                                       const CPUInfo    &cpu_info);
 
+    /** Reduce the number of windows according to the estimated execution time of the kernel
+     *
+     * Small workloads run on fewer threads, or inline on the calling thread, and consecutive small workloads keep the
+     * thread count of the previous dispatch unless the gain of waking more workers up is significant.
+     *
+     * @note Kernels not providing an estimate through @ref ICPPKernel::estimate_cost are not affected.
+     *
+     * @param[in] kernel      Kernel to execute
+     * @param[in] window      Window to use for kernel execution
+     * @param[in] num_windows Number of sub-windows selected so far
+     *
+     * @return Adjusted number of windows
+     */
+    unsigned int
+    adjust_num_of_windows_by_cost(const ICPPKernel &kernel, const Window &window, unsigned int num_windows);
+
 private:
-    unsigned int _num_threads_hint = {};
+    unsigned int              _num_threads_hint = {};
+    std::atomic<unsigned int> _previous_num_windows{0};
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_ISCHEDULER_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,26 +28,37 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/runtime/ITransformWeights.h"
 
-#include <map>
+#include "support/Mutex.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace arm_compute
 {
-/** Weights manager interface to handle weights transformations */
+/** Weights manager interface to handle weights transformations
+ *
+ * The manager is thread-safe, so a single instance can be shared by the functions of several graph instances
+ * of the same model. Weights prepared by the functions themselves can be shared between the instances through
+ * @ref share_prepared_weights.
+ */
 class IWeightsManager
 {
 public:
     /** Constructor */
     IWeightsManager();
-    /** Default Destructor */
-    virtual ~IWeightsManager() = default;
+    /** Destructor */
+    virtual ~IWeightsManager();
     /** Prevent instances of this class to be copy constructed */
     IWeightsManager(const IWeightsManager &) = delete;
     /** Prevent instances of this class to be copied */
     IWeightsManager &operator=(const IWeightsManager &) = delete;
-    /** Allow instances of this class to be move constructed */
-    IWeightsManager(IWeightsManager &&) = default;
-    /** Allow instances of this class to be moved */
-    IWeightsManager &operator=(IWeightsManager &&) = default;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    IWeightsManager(IWeightsManager &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    IWeightsManager &operator=(IWeightsManager &&) = delete;
 
     /** Start managing a weights tensor
      *
@@ -86,6 +97,23 @@ public:
      * @param weights Weights to mark unused
      */
     void pre_mark_as_unused(const ITensor *weights);
+    /** Share prepared weights with the functions holding prepared weights of identical content
+     *
+     * Functions call it once their weights are prepared so that several instances of the same model keep a single
+     * copy of them: the first caller gets a new copy of @p weights, later callers passing identical bytes get the
+     * same copy. The copy is read-only and freed once its last user drops it.
+     *
+     * @param[in] weights   Prepared weights. Must be an allocated tensor accessible by the host
+     * @param[in] alignment Alignment in bytes of the shared copy
+     *
+     * @return A tensor holding the content of @p weights
+     */
+    std::shared_ptr<ITensor> share_prepared_weights(const ITensor *weights, size_t alignment = 0);
+    /** Number of prepared weights tensors currently shared by the manager
+     *
+     * @return The number of shared prepared weights
+     */
+    size_t num_shared_prepared_weights() const;
 
 private:
     struct CounterElement
@@ -95,9 +123,14 @@ private:
     };
 
 private:
-    std::map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;
-    std::map<const ITensor *, CounterElement>                   _managed_counter;
-    std::map<const ITensor *, ITransformWeights *>              _managed_weights_parents;
+    void manage_unlocked(const ITensor *weights, ITransformWeights *parent);
+    bool are_weights_managed_unlocked(const ITensor *weights) const;
+
+    std::unordered_map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;
+    std::unordered_map<const ITensor *, CounterElement>                   _managed_counter;
+    std::unordered_map<const ITensor *, ITransformWeights *>              _managed_weights_parents;
+    std::unordered_multimap<uint64_t, std::weak_ptr<ITensor>>             _prepared_weights;
+    mutable arm_compute::Mutex                                            _mtx;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_IWEIGHTSMANAGER_H */
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_MEMORYFOOTPRINT_H
+#define ACL_ARM_COMPUTE_RUNTIME_MEMORYFOOTPRINT_H
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Breakdown of the memory held by a function or a graph, in bytes */
+struct MemoryFootprint
+{
+    size_t const_weights{0};     /**< Original constant tensors (weights, biases) still resident */
+    size_t prepared_weights{0};  /**< Transformed copies of the weights produced by prepare() */
+    size_t transition{0};        /**< Intermediate tensors passed between functions */
+    size_t workspace{0};         /**< Auxiliary memory needed during run() */
+    size_t prepare_workspace{0}; /**< Auxiliary memory only needed during prepare() */
+    size_t padding{0};           /**< Part of the above spent on tensor padding */
+    size_t num_allocations{0};   /**< Number of distinct buffers making up the footprint */
+
+    /** Memory resident once the function or graph is prepared
+     *
+     * @return Sum of all the resident buffers in bytes
+     */
+    size_t total() const
+    {
+        return const_weights + prepared_weights + transition + workspace;
+    }
+    /** Upper bound of the memory needed while preparing, when original and prepared weights coexist
+     *
+     * @return Resident memory plus the prepare-only workspace in bytes
+     */
+    size_t peak() const
+    {
+        return total() + prepare_workspace;
+    }
+    /** Accumulate another footprint into this one
+     *
+     * @param[in] other Footprint to add
+     *
+     * @return A reference to the updated footprint
+     */
+    MemoryFootprint &operator+=(const MemoryFootprint &other)
+    {
+        const_weights += other.const_weights;
+        prepared_weights += other.prepared_weights;
+        transition += other.transition;
+        workspace += other.workspace;
+        prepare_workspace += other.prepare_workspace;
+        padding += other.padding;
+        num_allocations += other.num_allocations;
+        return *this;
+    }
+};
+
+/** Snapshot of the host memory owned by @ref MemoryRegion objects across the whole process */
+struct AllocationCounters
+{
+    size_t live_bytes{0};        /**< Bytes currently allocated */
+    size_t live_allocations{0};  /**< Number of buffers currently allocated */
+    size_t peak_bytes{0};        /**< Highest value reached by live_bytes since the last reset */
+    size_t total_allocations{0}; /**< Number of buffers allocated since the start of the process */
+};
+
+/** Read the process-wide allocation counters
+ *
+ * @note The counters are updated atomically and can be read from any thread.
+ *
+ * @return A snapshot of the counters
+ */
+AllocationCounters allocation_counters();
+/** Reset the peak of the allocation counters to the current live bytes */
+void reset_allocation_peak();
+
+namespace detail
+{
+/** Record the allocation of a host buffer
+ *
+ * @param[in] size Size of the buffer in bytes
+ */
+void on_allocate(size_t size);
+/** Record the release of a host buffer previously recorded by @ref on_allocate
+ *
+ * @param[in] size Size of the buffer in bytes
+ */
+void on_free(size_t size);
+} // namespace detail
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_MEMORYFOOTPRINT_H
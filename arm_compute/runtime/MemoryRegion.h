@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2024 Arm Limited.
+ * Copyright (c) 2018-2020, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/IMemoryRegion.h"
+#include "arm_compute/runtime/MemoryFootprint.h"
 
 #include <cstddef>
 #include <cstdint>
@@ -47,8 +48,14 @@ public:
         {
             // Allocate backing memory
             size_t space = size + alignment;
-            _mem         = std::shared_ptr<uint8_t>(new uint8_t[space](), [](uint8_t *ptr) { delete[] ptr; });
+            _mem         = std::shared_ptr<uint8_t>(new uint8_t[space](),
+                                                    [space](uint8_t *ptr)
+                                                    {
+                                                        delete[] ptr;
+                                                        detail::on_free(space);
+                                                    });
             _ptr         = _mem.get();
+            detail::on_allocate(space);
 
             // Calculate alignment offset
             if (alignment != 0)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,7 +37,6 @@ class ITensor;
  *  This function calls the following kernels:
  *
  * -# NEReductionOperationKernel
- * -# NEFillBorderKernel
  *
  * @note The default data type for an uninitialized output tensor is
  *       signed 32-bit integer (S32). It is the user's responsibility to check
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024 Arm Limited.
+ * Copyright (c) 2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@ namespace arm_compute
 class ITensor;
 
 /** Basic function to simulate a 3d convolution. This function calls one of the following functions:
+ * -# cpu::CpuGemmConv3d (if the weights are constant and the convolution is supported by the assembly GEMM)
  * -# cpu::CpuDirectConv3d
  *
  */
@@ -90,7 +91,9 @@ public:
                            const Conv3dInfo  &conv_info);
 
     // Inherited methods overridden:
-    void run() override;
+    void            run() override;
+    void            prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
     struct Impl;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ActivationLayerInfo.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 
 #include <memory>
@@ -72,8 +73,13 @@ class ITensor;
 class NEConvolutionLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Constructor
+     *
+     * @param[in] memory_manager  (Optional) Memory manager of the auxiliary memory
+     * @param[in] weights_manager (Optional) Weights manager sharing the prepared weights with other functions
+     */
+    NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager  = nullptr,
+                       IWeightsManager                *weights_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEConvolutionLayer(const NEConvolutionLayer &) = delete;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
@@ -189,8 +195,9 @@ public:
                                                     const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
                                                     bool                       enable_fast_math = false);
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void            run() override;
+    void            prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
     struct Impl;
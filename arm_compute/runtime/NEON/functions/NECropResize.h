@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,18 +24,23 @@
 #ifndef ARM_COMPUTE_NEON_CROP_RESIZE_H
 #define ARM_COMPUTE_NEON_CROP_RESIZE_H
 
-#include "arm_compute/runtime/NEON/functions/NEScale.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
 
 #include <memory>
 
 namespace arm_compute
 {
 // Forward Declarations
-class Tensor;
 class ITensor;
-class NECropKernel;
+class ITensorInfo;
+class NECropResizeKernel;
 
-/** Function to perform cropping and resizing */
+/** Function to perform cropping and resizing
+ *
+ * All the boxes are cropped and resized by a single kernel dispatch which samples the output
+ * directly from the input image (see @ref NECropResizeKernel).
+ */
 class NECropResize : public IFunction
 {
 public:
@@ -45,10 +50,10 @@ public:
     NECropResize(const NECropResize &) = delete;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NECropResize &operator=(const NECropResize &) = delete;
-    /** Allow instances of this class to be moved */
-    NECropResize(NECropResize &&) = default;
-    /** Allow instances of this class to be moved */
-    NECropResize &operator=(NECropResize &&) = default;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NECropResize(NECropResize &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NECropResize &operator=(NECropResize &&) = delete;
     /** Default destructor */
     ~NECropResize();
 
@@ -64,12 +69,13 @@ public:
      *
      * @note Supported tensor rank: up to 4
      * @note Box indices may be outside of the bounds, in which case @p extrapolation_value is used.
+     * @note A box whose batch index in @p box_ind does not exist in @p input is filled with @p extrapolation_value.
      * @note Start and end indices of boxes are inclusive.
      *
      * @param[in]  input               Source tensor containing N batches of 3D images to be cropped. Data type supported: U8/U16/S16/U32/S32/F16/F32
      * @param[in]  boxes               Tensor containing the boxes used to crop the images. Data type supported: F32
      * @param[in]  box_ind             One dimensional tensor containing the batch index of the 3D image in @p input that the corresponding
-     *                                 box in @p boxes will be applied to. Data type supported: F32
+     *                                 box in @p boxes will be applied to. Data type supported: S32
      * @param[out] output              Destination tensor containing a cropped and resized image for each box in @p boxes. Data type supported: F32
      * @param[in]  crop_size           The dimensions that each cropped image will be resized to.
      * @param[in]  method              The policy to be used when resizing image. Default is bilinear.
@@ -87,12 +93,13 @@ public:
      *
      * @note Supported tensor rank: up to 4
      * @note Box indices may be outside of the bounds, in which case @p extrapolation_value is used.
+     * @note A box whose batch index in @p box_ind does not exist in @p input is filled with @p extrapolation_value.
      * @note Start and end indices of boxes are inclusive.
      *
      * @param[in] input               Source tensor containing N batches of 3D images to be cropped. Data type supported: U8/U16/S16/U32/S32/F16/F32
      * @param[in] boxes               Tensor info for the tensor containing the boxes used to crop the images. Data type supported: F32
      * @param[in] box_ind             Tensor info for the one dimensional tensor containing the batch index of the 3D image in @p input
-     *                                that the corresponding box in @p boxes will be applied to. Data type supported: F32
+     *                                that the corresponding box in @p boxes will be applied to. Data type supported: S32
      * @param[in] output              Tensor info for the destination tensor containing a cropped and resized image for each box in @p boxes.
      *                                Data type supported: F32
      * @param[in] crop_size           The dimensions that each cropped image will be resized to.
@@ -109,17 +116,11 @@ public:
                            InterpolationPolicy method,
                            float               extrapolation_value);
 
+    // Inherited methods overridden:
     void run() override;
 
-    ITensor            *_output;
-    size_t              _num_boxes;
-    InterpolationPolicy _method;
-    float               _extrapolation_value;
-
-    std::vector<std::unique_ptr<NECropKernel>> _crop;
-    std::vector<std::unique_ptr<NEScale>>      _scale;
-    std::vector<std::unique_ptr<Tensor>>       _crop_results;
-    std::vector<std::unique_ptr<Tensor>>       _scaled_results;
+private:
+    std::unique_ptr<NECropResizeKernel> _crop_resize_kernel;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_NEON_CROP_RESIZE_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,8 @@
 
 namespace arm_compute
 {
+class NEDeconvolutionPhaseInterleaveKernel;
+
 /** Function to run the deconvolution layer.
  *
  * Deconvolution Layer is the backward pass of Convolution Layer. First we transform the input depending on the stride and pad info and then perfrom a 1x1
@@ -63,11 +65,17 @@ namespace arm_compute
  * The weights used by Deconvolution are supposed to be the same as the ones used for Convolution. Therefore, it will be necessary to use the weights in the
  * reverse order to perform an actual convolution. This is achieved by using @ref NEReverse.
  *
+ * When the stride is greater than 1 and the padding does not exceed the kernel size, the upsampling is skipped and the deconvolution
+ * is decomposed into stride_x * stride_y phases instead: each output phase only depends on a sub-kernel of ceil(kernel_x / stride_x) x ceil(kernel_y / stride_y)
+ * taps applied to the original input. The sub-kernels are stacked along the output feature maps so that a single convolution on the original input computes
+ * all the phases, which are then interleaved into the output. This avoids multiplying the inserted zeros and the stride_x * stride_y times larger upsampled tensor.
+ *
  * This function calls the following kernels/functions:
  *
  * -# @ref CPPUpsample
  * -# @ref NEConvolutionLayer
  * -# @ref NEReverse
+ * -# NEDeconvolutionPhaseInterleaveKernel
  *
  */
 class NEDeconvolutionLayer : public IFunction
@@ -77,14 +85,14 @@ public:
     NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEDeconvolutionLayer(const NEDeconvolutionLayer &) = delete;
-    /** Default move constructor */
-    NEDeconvolutionLayer(NEDeconvolutionLayer &&) = default;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEDeconvolutionLayer(NEDeconvolutionLayer &&) = delete;
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEDeconvolutionLayer &operator=(const NEDeconvolutionLayer &) = delete;
-    /** Default move assignment operator */
-    NEDeconvolutionLayer &operator=(NEDeconvolutionLayer &&) = default;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEDeconvolutionLayer &operator=(NEDeconvolutionLayer &&) = delete;
     /** Default destructor */
-    ~NEDeconvolutionLayer() = default;
+    ~NEDeconvolutionLayer();
 
     /** Set the input, weights, biases and output tensors.
      *
@@ -152,18 +160,24 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup        _memory_group;
-    NEConvolutionLayer _conv_f;
-    CPPUpsample        _upsample_f;
-    NEReverse          _flip_weights;
-    Tensor             _scaled_output;
-    Tensor             _weights_flipped;
-    Tensor             _flip_axis;
-    const ITensor     *_original_weights;
-    ITensor           *_input;
-    PadStrideInfo      _info;
-    bool               _is_prepared;
-    bool               _do_upsampling;
+    MemoryGroup                                           _memory_group;
+    NEConvolutionLayer                                    _conv_f;
+    CPPUpsample                                           _upsample_f;
+    NEReverse                                             _flip_weights;
+    std::unique_ptr<NEDeconvolutionPhaseInterleaveKernel> _interleave_kernel;
+    Tensor                                                _scaled_output;
+    Tensor                                                _weights_flipped;
+    Tensor                                                _flip_axis;
+    Tensor                                                _phase_weights;
+    Tensor                                                _phase_bias;
+    Tensor                                                _phase_output;
+    const ITensor                                        *_original_weights;
+    const ITensor                                        *_original_bias;
+    ITensor                                              *_input;
+    PadStrideInfo                                         _info;
+    bool                                                  _is_prepared;
+    bool                                                  _do_upsampling;
+    bool                                                  _use_phase_decomposition;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEDECONVOLUTIONLAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,8 @@ public:
      * @param[in]      depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
      * @param[in]      act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in]      dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in]      enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+     *                                  available which may introduce a drop of accuracy as well. Default is false
      */
     void configure(ITensor                   *input,
                    const ITensor             *weights,
@@ -88,7 +90,8 @@ public:
                    const PadStrideInfo       &conv_info,
                    unsigned int               depth_multiplier = 1,
                    const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
-                   const Size2D              &dilation         = Size2D(1U, 1U));
+                   const Size2D              &dilation         = Size2D(1U, 1U),
+                   bool                       enable_fast_math = false);
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseConvolutionLayer
      *
@@ -102,6 +105,8 @@ public:
      * @param[in] depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
      * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+     *                             available which may introduce a drop of accuracy as well. Default is false
      *
      * @return a status
      */
@@ -112,7 +117,8 @@ public:
                            const PadStrideInfo       &conv_info,
                            unsigned int               depth_multiplier = 1,
                            const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
-                           const Size2D              &dilation         = Size2D(1U, 1U));
+                           const Size2D              &dilation         = Size2D(1U, 1U),
+                           bool                       enable_fast_math = false);
 
     // Inherited methods overriden:
     void run() override;
@@ -123,7 +129,6 @@ private:
     *
     * @note At the moment 3x3 and 5x5 convolution of stride 1, 2 are supported
     *
-    * -# NEFillBorderKernel (if pad_x or pad_y > 0) and no assembly kernel implementation is present
     * -# NEDepthwiseConvolutionLayer3x3Kernel if 3x3 and no assembly kernel implementation is present
     * -# cpu::CpuDepthwiseConvolutionAssemblyDispatch if assembly kernel implementation is present
     * -# NEDirectConvolutionLayerOutputStageKernel if re-quantization of output is required
@@ -158,6 +163,8 @@ private:
          * @param[in]      depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
          * @param[in]      act_info         (Optional) Activation layer information in case of a fused activation.
          * @param[in]      dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+         * @param[in]      enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+         *                                  available which may introduce a drop of accuracy as well. Default is false
          */
         void configure(ITensor                   *input,
                        const ITensor             *weights,
@@ -166,7 +173,8 @@ private:
                        const PadStrideInfo       &conv_info,
                        unsigned int               depth_multiplier = 1,
                        const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
-                       const Size2D              &dilation         = Size2D(1U, 1U));
+                       const Size2D              &dilation         = Size2D(1U, 1U),
+                       bool                       enable_fast_math = false);
 
         /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseConvolutionLayer3x3
          *
@@ -179,6 +187,8 @@ private:
          * @param[in] depth_multiplier (Optional) Multiplier to apply to the input's depth in order to retrieve the output's depth. Defaults to 1.
          * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
          * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+         * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
+         *                             available which may introduce a drop of accuracy as well. Default is false
          *
          * @return a status
          */
@@ -189,7 +199,8 @@ private:
                                const PadStrideInfo       &conv_info,
                                unsigned int               depth_multiplier = 1,
                                const ActivationLayerInfo &act_info         = ActivationLayerInfo(),
-                               const Size2D              &dilation         = Size2D(1U, 1U));
+                               const Size2D              &dilation         = Size2D(1U, 1U),
+                               bool                       enable_fast_math = false);
 
         // Inherited methods overriden:
         void run() override;
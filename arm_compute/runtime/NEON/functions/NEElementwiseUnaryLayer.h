@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -64,18 +64,21 @@ public:
      * |F32            |F32            |
      * |S32            |S32            |
      *
-     * @param[in]  input  Input tensor. Data types supported: F16/F32, F16/F32/S32 for NEG/ABS operations.
-     * @param[out] output Output tensor. Data types supported: Same as @p input.
+     * @param[in]  input     Input tensor. Data types supported: F16/F32, F16/F32/S32 for NEG/ABS operations.
+     * @param[out] output    Output tensor. Data types supported: Same as @p input.
+     * @param[in]  fast_math (Optional) Allow a faster, lower accuracy approximation of @ref ElementWiseUnary::EXP
+     *                       for F16/F32. Defaults to false.
      */
-    void configure(const ITensor *input, ITensor *output);
+    void configure(const ITensor *input, ITensor *output, bool fast_math = false);
     /** Static function to check if given info will lead to a valid configuration
      *
-     * @param[in] input  Input tensor info. Data types supported: F16/F32, F16/F32/S32 for NEG/ABS operations.
-     * @param[in] output Output tensor info. Data types supported: Same as @p input.
+     * @param[in] input     Input tensor info. Data types supported: F16/F32, F16/F32/S32 for NEG/ABS operations.
+     * @param[in] output    Output tensor info. Data types supported: Same as @p input.
+     * @param[in] fast_math (Optional) Allow a faster, lower accuracy approximation of @ref ElementWiseUnary::EXP.
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *output);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, bool fast_math = false);
     // Inherited methods overridden:
     void run() override;
 
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFUSEDELEMENTWISE_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFUSEDELEMENTWISE_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/function_info/FusedElementwiseInfo.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+
+/** Basic function to evaluate a chain of pointwise operations over N broadcastable inputs in a single pass
+ *
+ * The operations are described by an @ref ElementwiseExpression and are evaluated together on small blocks of the
+ * output, so intermediate results are never written to memory. This replaces sequences such as scale, bias,
+ * activation, gating and residual addition that would otherwise run as separate functions.
+ */
+class NEFusedElementwise : public IFunction
+{
+public:
+    /** Default constructor */
+    NEFusedElementwise();
+    /** Destructor */
+    ~NEFusedElementwise();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedElementwise(const NEFusedElementwise &) = delete;
+    /** Default move constructor */
+    NEFusedElementwise(NEFusedElementwise &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedElementwise &operator=(const NEFusedElementwise &) = delete;
+    /** Default move assignment operator */
+    NEFusedElementwise &operator=(NEFusedElementwise &&);
+    /** Initialise the kernel's inputs and output
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |F16            |F16            |
+     * |F32            |F32            |
+     *
+     * @param[in]  inputs Input tensors, one per input of @p expr. Data types supported: F16/F32.
+     *                    The shapes must be broadcast compatible.
+     * @param[out] output Output tensor with the broadcast shape of the inputs. Data types supported: Same as @p inputs.
+     * @param[in]  expr   Expression to evaluate. It can have up to 32 nodes and read up to 8 inputs.
+     */
+    void configure(const std::vector<const ITensor *> &inputs, ITensor *output, const ElementwiseExpression &expr);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFusedElementwise
+     *
+     * Similar to @ref NEFusedElementwise::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &inputs,
+                           const ITensorInfo                      *output,
+                           const ElementwiseExpression            &expr);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEFUSEDELEMENTWISE_H
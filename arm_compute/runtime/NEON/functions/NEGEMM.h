@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,8 +115,9 @@ public:
                                const GEMMInfo            &gemm_info = GEMMInfo());
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void            run() override;
+    void            prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
     struct Impl;
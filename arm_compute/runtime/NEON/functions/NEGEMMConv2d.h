@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2020-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -110,8 +110,9 @@ public:
                            const Conv2dInfo  &info);
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void            run() override;
+    void            prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
     struct Impl;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,14 +37,20 @@
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
 class NEComputeAllAnchorsKernel;
+class NEDecodeProposalsKernel;
 
 /** Basic function to generate proposals for a RPN (Region Proposal Network)
  *
- * This function calls the following Arm(R) Neon(TM) layers/kernels:
+ * For F32, the anchors are computed and the deltas are applied in a single pass by:
+ * -# NEDecodeProposalsKernel
+ *
+ * Otherwise, this function calls the following Arm(R) Neon(TM) layers/kernels:
  * -# NEComputeAllAnchorsKernel
  * -# @ref NEPermute x 2
  * -# @ref NEReshapeLayer x 2
@@ -52,7 +58,8 @@ class NEComputeAllAnchorsKernel;
  * -# NEPadLayerKernel
  * -# @ref NEDequantizationLayer x 2
  * -# @ref NEQuantizationLayer
- * And the following CPP kernels:
+ *
+ * The best pre_nms_topN boxes are then selected with a partial sort and fed to the following CPP kernels:
  * -# @ref CPPBoxWithNonMaximaSuppressionLimit
  */
 class NEGenerateProposalsLayer : public IFunction
@@ -129,6 +136,12 @@ public:
     void run() override;
 
 private:
+    /** Configure the anchors computation and the bounding box transform for the data types not supported by NEDecodeProposalsKernel */
+    void configure_unfused(const ITensor               *scores,
+                           const ITensor               *deltas,
+                           const ITensor               *anchors,
+                           const GenerateProposalsInfo &info);
+
     // Memory group manager
     MemoryGroup _memory_group;
 
@@ -138,6 +151,7 @@ private:
     NEPermute                                  _permute_scores;
     NEReshapeLayer                             _flatten_scores;
     std::unique_ptr<NEComputeAllAnchorsKernel> _compute_anchors;
+    std::unique_ptr<NEDecodeProposalsKernel>   _decode_proposals;
     NEBoundingBoxTransform                     _bounding_box;
     NEPadLayer                                 _pad;
     NEDequantizationLayer                      _dequantize_anchors;
@@ -149,6 +163,8 @@ private:
 
     bool _is_nhwc;
     bool _is_qasymm8;
+    bool _is_fused;
+    bool _select_top_proposals;
 
     // Temporary tensors
     Tensor _deltas_permuted;
@@ -163,6 +179,11 @@ private:
     Tensor _keeps_nms_unused;
     Tensor _classes_nms_unused;
     Tensor _proposals_4_roi_values;
+    Tensor _scores_selected;
+    Tensor _proposals_selected;
+
+    // Scratch buffer used to select the best boxes
+    std::vector<unsigned int> _selection_indices;
 
     // Temporary tensor pointers
     Tensor *_all_proposals_to_use;
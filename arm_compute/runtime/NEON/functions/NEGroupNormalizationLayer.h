@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGROUPNORMALIZATIONLAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGROUPNORMALIZATIONLAYER_H
+
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+class NEGroupNormalizationStatisticsKernel;
+class NEGroupNormalizationLayerKernel;
+
+/** Basic function to perform a Group normalization.
+ *
+ * The channels are divided into @p num_groups groups, each normalized with the mean and variance of its elements
+ * within a batch, then scaled and shifted per channel. A single group gives a layer normalization over C, H and W,
+ * as many groups as channels gives an instance normalization with per-channel affine parameters.
+ *
+ * This function runs the following kernels:
+ * -# NEGroupNormalizationStatisticsKernel
+ * -# NEGroupNormalizationLayerKernel
+ */
+class NEGroupNormalizationLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEGroupNormalizationLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupNormalizationLayer(const NEGroupNormalizationLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupNormalizationLayer &operator=(const NEGroupNormalizationLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGroupNormalizationLayer(NEGroupNormalizationLayer &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGroupNormalizationLayer &operator=(NEGroupNormalizationLayer &&) = delete;
+    /** Default destructor */
+    ~NEGroupNormalizationLayer();
+    /** Set the input and output tensors.
+     *
+     * Valid data layouts:
+     * - NHWC
+     * - NCHW
+     *
+     * Valid data type configurations:
+     * |src      |dst       |
+     * |:--------|:---------|
+     * |F16      |F16       |
+     * |F32      |F32       |
+     *
+     * @param[in, out] input      Source tensor with at most 4 dimensions. In case of @p output tensor = nullptr this tensor will store the result of the normalization.
+     *                            Data types supported: F16/F32. Data layout supported: NHWC, NCHW
+     * @param[out]     output     Destination tensor. Data types and data layouts supported: same as @p input.
+     * @param[in]      gamma      (Optional) 1D tensor of per-channel scales. Defaults to 1.0 if nullptr. Data types supported: same as @p input.
+     * @param[in]      beta       (Optional) 1D tensor of per-channel offsets. Defaults to 0.0 if nullptr. Data types supported: same as @p input.
+     * @param[in]      num_groups Number of groups the channels are divided into. It must divide the number of channels.
+     * @param[in]      epsilon    (Optional) Lower bound value for the normalization. Defaults to 1e-5
+     */
+    void configure(ITensor       *input,
+                   ITensor       *output,
+                   const ITensor *gamma,
+                   const ITensor *beta,
+                   unsigned int   num_groups,
+                   float          epsilon = 1e-5f);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGroupNormalizationLayer.
+     *
+     * @param[in] input      Source tensor info. Data types supported: F16/F32. Data layout supported: NHWC, NCHW
+     * @param[in] output     Destination tensor info. Data types and data layouts supported: same as @p input.
+     * @param[in] gamma      (Optional) Per-channel scales tensor info. Data types supported: same as @p input.
+     * @param[in] beta       (Optional) Per-channel offsets tensor info. Data types supported: same as @p input.
+     * @param[in] num_groups Number of groups the channels are divided into.
+     * @param[in] epsilon    (Optional) Lower bound value for the normalization. Defaults to 1e-5
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *output,
+                           const ITensorInfo *gamma,
+                           const ITensorInfo *beta,
+                           unsigned int       num_groups,
+                           float              epsilon = 1e-5f);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    MemoryGroup                                           _memory_group;
+    std::unique_ptr<NEGroupNormalizationStatisticsKernel> _statistics_kernel;
+    std::unique_ptr<NEGroupNormalizationLayerKernel>      _normalization_kernel;
+    Tensor                                                _statistics;
+    Tensor                                                _workspace;
+    size_t                                                _split_dimension;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEGROUPNORMALIZATIONLAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2019-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,7 +27,6 @@
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/NEON/functions/NEPermute.h"
 #include "arm_compute/runtime/NEON/functions/NEReductionOperation.h"
 #include "arm_compute/runtime/Tensor.h"
 
@@ -36,12 +35,17 @@
 namespace arm_compute
 {
 class ITensor;
-class NEInstanceNormalizationLayerKernel;
+class NEGroupNormalizationStatisticsKernel;
+class NEGroupNormalizationLayerKernel;
 
 /** Basic function to perform a Instance normalization.
+ *
+ * Instance normalization is run as a group normalization with one group per channel, directly in the data layout
+ * of the input.
  *
  * This function runs the following kernels:
- * -# NEInstanceNormalizationLayerKernel
+ * -# NEGroupNormalizationStatisticsKernel
+ * -# NEGroupNormalizationLayerKernel
  */
 class NEInstanceNormalizationLayer : public IFunction
 {
@@ -99,13 +103,12 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                                         _memory_group;
-    std::unique_ptr<NEInstanceNormalizationLayerKernel> _normalization_kernel;
-    bool                                                _is_nchw;
-    NEPermute                                           _permute_input;
-    NEPermute                                           _permute_output;
-    Tensor                                              _permuted_input;
-    Tensor                                              _permuted_output;
+    MemoryGroup                                           _memory_group;
+    std::unique_ptr<NEGroupNormalizationStatisticsKernel> _statistics_kernel;
+    std::unique_ptr<NEGroupNormalizationLayerKernel>      _normalization_kernel;
+    Tensor                                                _statistics;
+    Tensor                                                _workspace;
+    size_t                                                _split_dimension;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEINSTANCENORMALIZATIONLAYER_H
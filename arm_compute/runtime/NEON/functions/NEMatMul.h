@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2025 Arm Limited.
+ * Copyright (c) 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -135,7 +135,8 @@ public:
                            const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden
-    void run() override;
+    void            run() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
     struct Impl;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,13 +24,10 @@
 #ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPADLAYER_H
 #define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPADLAYER_H
 
+#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEConcatenateLayer.h"
 #include "arm_compute/runtime/NEON/functions/NECopy.h"
-#include "arm_compute/runtime/NEON/functions/NEStridedSlice.h"
-#include "arm_compute/runtime/SubTensor.h"
-#include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
 
@@ -40,12 +37,10 @@ class NEPadLayerKernel;
 
 /** Basic function to pad a tensor. This function calls the following functions/kernels:
  *
- *  - For padding mode = PaddingMode::CONSTANT:
- *      -# NEPadLayerKernel
+ *  - If any padding is applied:
+ *      -# NEPadLayerKernel (all padding modes are computed in a single pass)
  *  - Otherwise:
  *      -# @ref NECopy
- *      -# @ref NEStridedSlice
- *      -# @ref NEConcatenateLayer
  *
  */
 class NEPadLayer : public IFunction
@@ -108,36 +103,10 @@ public:
     // Inherited methods overridden:
     void run() override;
 
-private:
-    /** Configure kernels for when constant padding is used.
-     *
-     * @param[in]  input          Source tensor. Data types supported: All.
-     * @param[out] output         Output tensor. Data type supported: same as @p input
-     * @param[in]  padding        The padding for each spatial dimension of the input tensor. The pair padding[i]
-     *                            specifies the front and the end padding in the i-th dimension.
-     * @param[in]  constant_value Constant value to be used for the padding
-     */
-    void configure_constant_mode(ITensor           *input,
-                                 ITensor           *output,
-                                 const PaddingList &padding,
-                                 const PixelValue   constant_value);
-    /** Configure functions for when reflect or symmetric padding is used.
-     *
-     * @param[in]  input  Source tensor. Data types supported: All.
-     * @param[out] output Output tensor. Data type supported: same as @p input
-     */
-    void configure_reflect_symmetric_mode(ITensor *input, ITensor *output);
-
 private:
     NECopy                            _copy_function;
     std::unique_ptr<NEPadLayerKernel> _pad_kernel;
-    PaddingMode                       _mode;
-    PaddingList                       _padding;
     uint32_t                          _num_dimensions;
-    std::vector<NEStridedSlice>       _slice_functions;
-    std::vector<NEConcatenateLayer>   _concat_functions;
-    std::vector<Tensor>               _slice_results;
-    std::vector<Tensor>               _concat_results;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEPADLAYER_H
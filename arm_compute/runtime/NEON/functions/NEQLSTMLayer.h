@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, 2024 Arm Limited.
+ * Copyright (c) 2020-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,7 @@ namespace arm_compute
 // Forward declarations
 class ITensor;
 class ITensorInfo;
+class NEQLSTMCellKernel;
 class NEQLSTMLayerNormalizationKernel;
 namespace cpu
 {
@@ -65,6 +66,13 @@ class CpuGemmLowpMatrixAReductionKernel;
  * -# cpu::kernels::CpuGemmLowpMatrixAReductionKernel            For precomputing effective biases to use
  * -# @ref NEPixelWiseMultiplication                             Elementwise multiplication
  * -# @ref NETranspose                                           Transpose function for reshaping the weights
+ * -# @ref NEQLSTMCellKernel                                     Fused gates and cell update
+ *
+ * When neither peephole connections nor cell clipping are used and the weights of all the gates share the same zero
+ * point, the weights of the gates are concatenated at prepare() time so that each input only needs a single matrix
+ * multiplication. The output stages, layer normalizations, activations and cell update are then fused in
+ * @ref NEQLSTMCellKernel, which keeps the intermediate gates in cache instead of going through memory between
+ * each elementwise function.
  * */
 class NEQLSTMLayer : public IFunction
 {
@@ -248,6 +256,36 @@ private:
                       const TensorInfo             &mm_res_info,
                       const TensorInfo             &outstage_tensor_info);
 
+    /** Internal method to configure the matrix multiplications of the concatenated gates and the fused cell update.
+     *
+     * @param[in]  input           Input tensor to the matrix multiplication of the input contributions.
+     * @param[in]  cell_state_in   Cell state input tensor.
+     * @param[in]  output_state_in Input tensor to the matrix multiplication of the recurrent contributions.
+     * @param[out] cell_state_out  Cell state output tensor.
+     * @param[out] hidden          Tensor to be used for storing the hidden state.
+     * @param[in]  lstm_params     Weights tensors and quantization information of the layer.
+     */
+    void configure_fused_cell(const ITensor             *input,
+                              const ITensor             *cell_state_in,
+                              const ITensor             *output_state_in,
+                              ITensor                   *cell_state_out,
+                              ITensor                   *hidden,
+                              const LSTMParams<ITensor> &lstm_params);
+
+    /** Internal method to configure the projection of the hidden state and the copy to the output.
+     *
+     * @param[in]  hidden           Hidden state tensor.
+     * @param[in]  output_state_in  Output state input tensor.
+     * @param[out] output_state_out Output state output tensor.
+     * @param[out] output           Destination tensor.
+     * @param[in]  lstm_params      Weights tensors and quantization information of the layer.
+     */
+    void configure_projection(ITensor                   *hidden,
+                              ITensor                   *output_state_in,
+                              ITensor                   *output_state_out,
+                              ITensor                   *output,
+                              const LSTMParams<ITensor> &lstm_params);
+
     MemoryGroup _memory_group;
 
     /** A small internel kernel do the copy between two tensors */
@@ -357,6 +395,10 @@ private:
 
     std::array<std::unique_ptr<NEQLSTMLayerNormalizationKernel>, _layer_norm_count> _layer_norms;
 
+    NEGEMMLowpMatrixMultiplyCore       _mm_input_to_gates;
+    NEGEMMLowpMatrixMultiplyCore       _mm_recurrent_to_gates;
+    std::unique_ptr<NEQLSTMCellKernel> _qlstm_cell;
+
     NECopy _copy_output;
 
     // Tensor pointers
@@ -464,6 +506,13 @@ private:
     Tensor                                _projection_out_res{nullptr};
     Tensor                                _projection_accumulate_res{nullptr};
     Tensor                                _ones{nullptr};
+    Tensor                                _input_to_gates_weights{nullptr};
+    Tensor                                _recurrent_to_gates_weights{nullptr};
+    Tensor                                _input_to_gates_eff_bias{nullptr};
+    Tensor                                _recurrent_to_gates_eff_bias{nullptr};
+    Tensor                                _mm_input_to_gates_res{nullptr};
+    Tensor                                _mm_recurrent_to_gates_res{nullptr};
+    Tensor                                _gates_res{nullptr};
     std::array<Tensor, _layer_norm_count> _layer_norm_output{};
 
     inline Tensor &get_layer_norm_output(LayerNormGate g)
@@ -478,6 +527,7 @@ private:
     bool _has_projection_clipping{false};
     bool _has_peephole{false};
     bool _has_layer_norm{false};
+    bool _fuse_gates{false};
     bool _projection_tensor_copy_required{false};
     bool _convert_input_to_forget_weights_to_qsymm8{false};
 };
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERNNSEQUENCELAYER_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERNNSEQUENCELAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class ITensorInfo;
+class NERecurrentCellKernel;
+
+/** Basic function to run a recurrent layer over a whole sequence
+ *
+ * This function computes every timestep of a RNN or GRU layer, optionally in both directions, by calling:
+ *
+ * -# @ref NEGEMM                Input contribution of all the timesteps and directions at once
+ * -# @ref NERecurrentCellKernel Recurrent contribution, gates and activation of one timestep for all the directions
+ *
+ * The weights of the directions are transposed and concatenated at prepare() time, so that the input projection of
+ * the whole sequence is computed by a single matrix multiplication. The hidden state of each timestep is then read
+ * directly from the output of the previous timestep.
+ */
+class NERNNSequenceLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    NERNNSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERNNSequenceLayer(const NERNNSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains pointers) */
+    NERNNSequenceLayer(NERNNSequenceLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERNNSequenceLayer &operator=(const NERNNSequenceLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains pointers) */
+    NERNNSequenceLayer &operator=(NERNNSequenceLayer &&) = delete;
+    /** Default destructor */
+    ~NERNNSequenceLayer();
+    /** Initialize the function
+     *
+     * num_gates is 1 for @ref RecurrentCellType::RNN and 3 for @ref RecurrentCellType::GRU, in which case the gates are
+     * stored in the order update, reset and hidden. num_directions is 2 if @p info is bidirectional, 1 otherwise.
+     *
+     * Valid data layouts:
+     * - All
+     *
+     * Valid data type configurations:
+     * |src0   |src1   |src2   |src3   |src4   |src5   |dst    |
+     * |:------|:------|:------|:------|:------|:------|:------|
+     * |F32    |F32    |F32    |F32    |F32    |F32    |F32    |
+     *
+     * @param[in]     input             Input sequence. 3D tensor of shape [input_size, batch_size, seq_len] without padding. Data types supported: F32
+     * @param[in]     weights           Weights tensor of shape [input_size, num_gates * num_units, num_directions] that multiplies the input. Data types supported: Same as @p input
+     * @param[in]     recurrent_weights Weights tensor of shape [num_gates * num_units, num_units, num_directions] that multiplies the hidden state. Data types supported: Same as @p input
+     * @param[in]     bias              Bias tensor of shape [num_gates * num_units, num_directions] added to the input contribution. Data types supported: Same as @p input
+     * @param[in]     recurrent_bias    (Optional) Bias tensor of shape [num_gates * num_units, num_directions] added to the recurrent contribution. Data types supported: Same as @p input
+     * @param[in,out] hidden_state      Hidden state tensor of shape [num_units, batch_size, num_directions]. Holds the initial state on input and the final state of each direction on output.
+     *                                  Data types supported: Same as @p input
+     * @param[out]    output            Hidden state of all the timesteps. 3D tensor of shape [num_directions * num_units, batch_size, seq_len]. Data types supported: Same as @p input
+     * @param[in]     info              Recurrent sequence information.
+     */
+    void configure(const ITensor               *input,
+                   const ITensor               *weights,
+                   const ITensor               *recurrent_weights,
+                   const ITensor               *bias,
+                   const ITensor               *recurrent_bias,
+                   ITensor                     *hidden_state,
+                   ITensor                     *output,
+                   const RecurrentSequenceInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NERNNSequenceLayer
+     *
+     * Similar to @ref NERNNSequenceLayer::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo           *input,
+                           const ITensorInfo           *weights,
+                           const ITensorInfo           *recurrent_weights,
+                           const ITensorInfo           *bias,
+                           const ITensorInfo           *recurrent_bias,
+                           const ITensorInfo           *hidden_state,
+                           const ITensorInfo           *output,
+                           const RecurrentSequenceInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                            _memory_group;
+    NEGEMM                                 _input_projection;
+    std::unique_ptr<NERecurrentCellKernel> _recurrent_cell;
+    Tensor                                 _input_2d;
+    Tensor                                 _weights_transposed;
+    Tensor                                 _bias_concatenated;
+    Tensor                                 _projection;
+    const ITensor                         *_input;
+    const ITensor                         *_weights;
+    const ITensor                         *_bias;
+    ITensor                               *_hidden_state;
+    ITensor                               *_output;
+    bool                                   _is_prepared;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NERNNSEQUENCELAYER_H
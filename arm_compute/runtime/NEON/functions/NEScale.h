@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Arm Limited.
+ * Copyright (c) 2016-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,20 +65,24 @@ public:
      * |F16            |F16            |
      * |F32            |F32            |
      * |U8             |U8             |
+     * |U8             |F16            |
+     * |U8             |F32            |
      * |S8             |S8             |
      * |S16            |S16            |
      *
      * @param[in, out] input  Source tensor. Data type supported: QASYMM8/QASYMM8_SIGNED/U8/S8/S16/F16/F32. (Written to only for @p border_mode != UNDEFINED)
-     * @param[out]     output Destination tensor. Data type supported: Same as @p input. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
+     * @param[out]     output Destination tensor. Data type supported: Same as @p input, or F16/F32 if @p input is U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in]      info   @ref ScaleKernelInfo to be used for configuration
      *
      * @note Using S8 data type only supports NHWC, @p border_mode Replicate, and @p policy Bilinear
+     * @note NHWC U8/F16/F32 resizes with @p border_mode Replicate and @p policy Bilinear or Area use a separable
+     *       implementation, which also converts U8 to F16/F32 and applies the normalisation of @p info.
      */
     void configure(ITensor *input, ITensor *output, const ScaleKernelInfo &info);
     /** Static function to check if given info will lead to a valid configuration of @ref NEScale
      *
      * @param[in] input  Source tensor. Data type supported: QASYMM8/QASYMM8_SIGNED/U8/S8/S16/F16/F32. (Written to only for @p border_mode != UNDEFINED)
-     * @param[in] output Destination tensor. Data type supported: Same as @p input. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
+     * @param[in] output Destination tensor. Data type supported: Same as @p input, or F16/F32 if @p input is U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in] info   @ref ScaleKernelInfo to be used for validation
      *
      * @return a status
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -65,26 +65,34 @@ public:
      * |F16            |F16            |
      * |F32            |F32            |
      *
-     * @param[in,out] input  Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32. If the width is not a
-     *                       multiple of the internal processing block size, @ref NEFillBorder replicates the
-     *                       last value of each row to the nearest multiple.
-     * @param[out]    output Destination tensor. Data types supported: same as @p input.
-     * @param[in]     beta   (Optional) A scaling factor for the exponent.
-     * @param[in]     axis   (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6 and
-     *                       axis=1, softmax will be applied to 4x6=24 vectors of size 5. Defaults to 0
+     * @param[in,out] input     Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32. If the width is
+     *                          not a multiple of the internal processing block size, @ref NEFillBorder replicates the
+     *                          last value of each row to the nearest multiple.
+     * @param[out]    output    Destination tensor. Data types supported: same as @p input.
+     * @param[in]     beta      (Optional) A scaling factor for the exponent.
+     * @param[in]     axis      (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6
+     *                          and axis=1, softmax will be applied to 4x6=24 vectors of size 5. Defaults to 0
+     * @param[in]     fast_math (Optional) Allow a faster, lower accuracy approximation of the exponential for F16/F32.
+     *                          Defaults to false.
      */
-    void configure(ITensor *input, ITensor *output, float beta = 1.0f, int32_t axis = 0);
+    void configure(ITensor *input, ITensor *output, float beta = 1.0f, int32_t axis = 0, bool fast_math = false);
     /** Static function to check if given info will lead to a valid configuration of @ref NESoftmaxLayer
      *
-     * @param[in] input  Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
-     * @param[in] output Destination tensor info. Data types supported: same as @p input
-     * @param[in] beta   (Optional) A scaling factor for the exponent.
-     * @param[in] axis   (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6 and
+     * @param[in] input     Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] output    Destination tensor info. Data types supported: same as @p input
+     * @param[in] beta      (Optional) A scaling factor for the exponent.
+     * @param[in] axis      (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6 and
      *                       axis=1, softmax will be applied to 4x6=24 vectors of size 5. Defaults to 0
+     * @param[in] fast_math (Optional) Allow a faster, lower accuracy approximation of the exponential.
+     *                      Defaults to false.
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *output, float beta = 1.0f, int32_t axis = 0);
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *output,
+                           float              beta      = 1.0f,
+                           int32_t            axis      = 0,
+                           bool               fast_math = false);
 
     // Inherited methods overridden:
     void run() override;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,8 @@ public:
      * |:--------------|:--------------|
      * |All            |All            |
      *
+     * @note Outputs that are @ref SubTensor views of the input at their split coordinates are not copied at run time.
+     *
      */
 
     // Inherited methods overridden:
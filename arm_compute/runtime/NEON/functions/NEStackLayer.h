@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,11 +34,10 @@ namespace arm_compute
 {
 class ITensor;
 class ITensorInfo;
-class NEStackLayerKernel;
 
 /** Basic function to stack tensors along an axis. This function calls the following kernel:
  *
- * -# NEStackLayerKernel
+ * -# cpu::kernels::CpuConcatenateKernel
  *
  */
 class NEStackLayer : public IFunction
@@ -74,7 +73,7 @@ public:
      * @param[out] output Output tensor. Data types supported: Same as @p input.
      */
     void configure(const std::vector<ITensor *> &input, int axis, ITensor *output);
-    /** Static function to check if given info will lead to a valid configuration of NEStackLayerKernel
+    /** Static function to check if given info will lead to a valid configuration of @ref NEStackLayer
      *
      * @note Supported input tensor rank: up to 4
      *
@@ -91,8 +90,8 @@ public:
     void run() override;
 
 private:
-    std::unique_ptr<NEStackLayerKernel> _stack_kernel;
-    bool                                _is_prepared;
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
 };
 } // namespace arm_compute
 #endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NESTACKLAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -100,8 +100,9 @@ public:
                    bool                       enable_fast_math = false);
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void            run() override;
+    void            prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradConvolutionLayer
      *
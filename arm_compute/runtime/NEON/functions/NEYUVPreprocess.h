@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEYUVPREPROCESS_H
+#define ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEYUVPREPROCESS_H
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+class ITensorInfo;
+struct YUVPreprocessInfo;
+
+/** Function to turn a NV12/NV21/IYUV camera frame into a normalised NHWC network input
+ *
+ * Cropping, bilinear resizing, colour conversion to RGB, (value - mean) / std normalisation and quantization are
+ * performed in a single pass, multi-threaded over the destination rows.
+ */
+class NEYUVPreprocess : public IFunction
+{
+public:
+    /** Default Constructor */
+    NEYUVPreprocess();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEYUVPreprocess(const NEYUVPreprocess &) = delete;
+    /** Default move constructor */
+    NEYUVPreprocess(NEYUVPreprocess &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEYUVPreprocess &operator=(const NEYUVPreprocess &) = delete;
+    /** Default move assignment operator */
+    NEYUVPreprocess &operator=(NEYUVPreprocess &&);
+    /** Default destructor */
+    ~NEYUVPreprocess();
+    /** Initialise the kernel's inputs and output
+     *
+     * Valid data layouts:
+     * - NHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1           |src2           |dst            |
+     * |:--------------|:--------------|:--------------|:--------------|
+     * |U8             |U8             |U8             |F32            |
+     * |U8             |U8             |U8             |F16            |
+     * |U8             |U8             |U8             |QASYMM8        |
+     * |U8             |U8             |U8             |QASYMM8_SIGNED |
+     *
+     * Each plane is a separate tensor, with the samples of a row contiguous. A frame of width W and height H has
+     * chroma planes subsampled by two in both directions.
+     *
+     * @param[in]  luma    Luma plane of shape [W, H, N]. Data type supported: U8.
+     * @param[in]  chroma0 Chroma plane. For NV12/NV21 the interleaved plane of shape [2 * ceil(W / 2), ceil(H / 2), N],
+     *                     for IYUV the Cb plane of shape [ceil(W / 2), ceil(H / 2), N]. Data type supported: U8.
+     * @param[in]  chroma1 Cr plane of shape [ceil(W / 2), ceil(H / 2), N] for IYUV, nullptr otherwise. Data type supported: U8.
+     * @param[out] dst     Destination tensor of shape [3, W_out, H_out, N]. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     *                     Quantized destinations are quantized with their own quantization information after normalisation.
+     * @param[in]  info    Preprocessing information described in @ref YUVPreprocessInfo.
+     */
+    void configure(const ITensor           *luma,
+                   const ITensor           *chroma0,
+                   const ITensor           *chroma1,
+                   ITensor                 *dst,
+                   const YUVPreprocessInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEYUVPreprocess
+     *
+     * Similar to @ref NEYUVPreprocess::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo       *luma,
+                           const ITensorInfo       *chroma0,
+                           const ITensorInfo       *chroma1,
+                           const ITensorInfo       *dst,
+                           const YUVPreprocessInfo &info);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+} // namespace arm_compute
+#endif // ACL_ARM_COMPUTE_RUNTIME_NEON_FUNCTIONS_NEYUVPREPROCESS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, 2025 Arm Limited.
+ * Copyright (c) 2021-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -493,6 +493,16 @@
  *
  */
 
+/** FusedElementwise
+ *
+ * Description:
+ * Function to evaluate a DAG of elementwise operations in a single pass over its inputs.
+ *
+ * Equivalent Android NNAPI Op:
+ * n/a
+ *
+ */
+
 /** Gather
  *
  * Description:
@@ -1059,4 +1069,15 @@
  *
  */
 
+/** YUVPreprocess
+ *
+ * Description:
+ * Function to turn a NV12/NV21/IYUV frame into a normalised NHWC network input (crop, resize, colour conversion,
+ * normalisation and quantization).
+ *
+ * Equivalent Android NNAPI Op:
+ * n/a
+ *
+ */
+
 #endif // ACL_ARM_COMPUTE_RUNTIME_OPERATORLIST_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited.
+ * Copyright (c) 2020-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,4 +80,14 @@ bool ITensorPack::empty() const
 {
     return _pack.empty();
 }
+
+ITensorPack::const_iterator ITensorPack::begin() const
+{
+    return _pack.cbegin();
+}
+
+ITensorPack::const_iterator ITensorPack::end() const
+{
+    return _pack.cend();
+}
 } // namespace arm_compute
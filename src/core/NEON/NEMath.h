@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022, 2024 Arm Limited.
+ * Copyright (c) 2016-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -124,6 +124,41 @@ float32x4_t vlogq_f32(float32x4_t x);
  */
 float32x4_t vtanhq_f32(float32x4_t val);
 
+/** Calculate exponential with reduced accuracy
+ *
+ * Fast tier of @ref vexpq_f32: the range reduction uses a single ln(2) constant and e^r is approximated
+ * by a degree-3 minimax polynomial. The maximum relative error is about 1e-4, i.e. F16-level precision.
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated exponent.
+ */
+float32x4_t vexpq_fast_f32(float32x4_t x);
+
+/** Calculate e^x - 1 with reduced accuracy
+ *
+ * Same approximation as @ref vexpq_fast_f32 but keeps its relative accuracy for x close to 0,
+ * where subtracting 1 from e^x would cancel out.
+ *
+ * @param[in] x Input vector value in F32 format.
+ *
+ * @return The calculated e^x - 1.
+ */
+float32x4_t vexpm1q_fast_f32(float32x4_t x);
+
+/** Calculate hyperbolic tangent with reduced accuracy
+ *
+ * tanh(x) = (e^2x - 1)/(e^2x - 1 + 2)
+ *
+ * Fast tier of @ref vtanhq_f32 built on @ref vexpm1q_fast_f32 and a single Newton-Raphson reciprocal step.
+ * The maximum relative error is about 1e-3.
+ *
+ * @param[in] val Input vector value in F32 format.
+ *
+ * @return The calculated Hyperbolic Tangent.
+ */
+float32x4_t vtanhq_fast_f32(float32x4_t val);
+
 /** Calculate n power of a number.
  *
  * pow(x,n) = e^(n*log(x))
@@ -323,6 +358,27 @@ float16x8_t vinvsqrtq_f16(float16x8_t x);
  */
 float16x8_t vexpq_f16(float16x8_t x);
 
+/** Calculate exponential with reduced accuracy
+ *
+ * Computed natively in F16 with the polynomial of @ref vexpq_fast_f32. The error is within 1 F16 ULP over the
+ * normal range.
+ *
+ * @param[in] x Input vector value in F16 format.
+ *
+ * @return The calculated exponent.
+ */
+float16x8_t vexpq_fast_f16(float16x8_t x);
+
+/** Calculate e^x - 1 with reduced accuracy
+ *
+ * Computed natively in F16, like @ref vexpq_fast_f16. The error is within 2 F16 ULP over the normal range.
+ *
+ * @param[in] x Input vector value in F16 format.
+ *
+ * @return The calculated e^x - 1.
+ */
+float16x8_t vexpm1q_fast_f16(float16x8_t x);
+
 /** Calculate error function
  *
  * @param[in] x Input vector in F16 format.
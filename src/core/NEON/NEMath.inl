@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -228,6 +228,89 @@ inline float32x4_t vexpq_f32(float32x4_t x)
     return poly;
 }
 
+static const uint32_t exp_fast_f32_coeff[] = {
+    0x3f80066c, // x^1: 0x1.000cd8p+0f
+    0x3f010e9e, // x^2: 0x1.021d3cp-1f
+    0x3e2924a4, // x^3: 0x1.524948p-3f
+};
+
+/** Range reduction shared by the fast exponential functions.
+ *
+ * Returns p(r) ~= e^r - 1 and sets @p scale to 2^n, where e^x = 2^n * e^r.
+ */
+inline float32x4_t vexpq_fast_reduce_f32(float32x4_t x, float32x4_t &scale)
+{
+    const auto c1 = vreinterpretq_f32_u32(vdupq_n_u32(exp_fast_f32_coeff[0]));
+    const auto c2 = vreinterpretq_f32_u32(vdupq_n_u32(exp_fast_f32_coeff[1]));
+    const auto c3 = vreinterpretq_f32_u32(vdupq_n_u32(exp_fast_f32_coeff[2]));
+
+    const auto shift   = vreinterpretq_f32_u32(vdupq_n_u32(0x4b00007f)); // 2^23 + 127 = 0x1.0000fep23f
+    const auto inv_ln2 = vreinterpretq_f32_u32(vdupq_n_u32(0x3fb8aa3b)); // 1 / ln(2) = 0x1.715476p+0f
+    const auto neg_ln2 = vreinterpretq_f32_u32(vdupq_n_u32(0xbf317218)); // -ln(2) = -0x1.62e430p-1f
+
+    // Same reduction as vexpq_f32, but n * ln(2) is subtracted in a single step: the rounding error
+    // of ln(2) stays well below the error of the degree-3 polynomial.
+    const auto z = prefer_vfmaq_f32(shift, x, inv_ln2);
+    const auto n = z - shift;
+    const auto r = prefer_vfmaq_f32(x, n, neg_ln2);
+
+    scale = vreinterpretq_f32_u32(vreinterpretq_u32_f32(z) << 23); // 2^n
+
+    // p = c1 * r + c2 * r^2 + c3 * r^3
+    return prefer_vfmaq_f32(c1, prefer_vfmaq_f32(c2, c3, r), r) * r;
+}
+
+inline float32x4_t vexpq_fast_f32(float32x4_t x)
+{
+    const auto inf       = vdupq_n_f32(std::numeric_limits<float>::infinity());
+    const auto max_input = vdupq_n_f32(88.37f); // Approximately ln(2^127.5)
+    const auto zero      = vdupq_n_f32(0.f);
+    const auto min_input = vdupq_n_f32(-86.64f); // Approximately ln(2^-125)
+
+    float32x4_t scale;
+    const auto  p = vexpq_fast_reduce_f32(x, scale);
+
+    auto poly = prefer_vfmaq_f32(scale, p, scale);
+
+    // Handle underflow and overflow.
+    poly = vbslq_f32(vcltq_f32(x, min_input), zero, poly);
+    poly = vbslq_f32(vcgtq_f32(x, max_input), inf, poly);
+
+    return poly;
+}
+
+inline float32x4_t vexpm1q_fast_f32(float32x4_t x)
+{
+    const auto inf       = vdupq_n_f32(std::numeric_limits<float>::infinity());
+    const auto max_input = vdupq_n_f32(88.37f); // Approximately ln(2^127.5)
+    const auto min_input = vdupq_n_f32(-86.64f); // Approximately ln(2^-125), e^x - 1 is already -1 here
+    const auto one       = vdupq_n_f32(1.f);
+
+    float32x4_t scale;
+    const auto  p = vexpq_fast_reduce_f32(vmaxq_f32(x, min_input), scale);
+
+    // e^x - 1 = (2^n - 1) + 2^n * p, which is exact for n = 0 and so does not cancel out around 0.
+    const auto res = prefer_vfmaq_f32(scale - one, p, scale);
+
+    return vbslq_f32(vcgtq_f32(x, max_input), inf, res);
+}
+
+inline float32x4_t vtanhq_fast_f32(float32x4_t val)
+{
+    const auto max_tanh = vdupq_n_f32(9.f); // tanh(9) rounds to 1 in F32
+    const auto two      = vdupq_n_f32(2.f);
+
+    const auto x   = vminq_f32(vmaxq_f32(val, -max_tanh), max_tanh);
+    const auto num = vexpm1q_fast_f32(two * x);
+    const auto den = num + two;
+
+    // One Newton-Raphson step on the reciprocal estimate is enough for the accuracy of this tier.
+    auto inv = vrecpeq_f32(den);
+    inv      = vmulq_f32(vrecpsq_f32(den, inv), inv);
+
+    return num * inv;
+}
+
 #ifdef __aarch64__
 inline float32x4_t verfq_f32(float32x4_t x)
 {
@@ -707,6 +790,74 @@ inline float16x8_t vexpq_f16(float16x8_t x)
     return res;
 }
 
+/** Range reduction shared by the fast F16 exponential functions.
+ *
+ * Returns p(r) ~= e^r - 1 and sets @p scale_lo and @p scale_hi to 2^n1 and 2^n2, where e^x = 2^(n1 + n2) * e^r.
+ * 2^n is split in two factors so that both stay normal F16 numbers over the whole F16 range of e^x.
+ */
+inline float16x8_t vexpq_fast_reduce_f16(float16x8_t x, float16x8_t &scale_lo, float16x8_t &scale_hi)
+{
+    // Coefficients of vexpq_fast_reduce_f32 rounded to F16
+    const auto c1 = vreinterpretq_f16_u16(vdupq_n_u16(0x3c00)); // x^1: 0x1.000p+0
+    const auto c2 = vreinterpretq_f16_u16(vdupq_n_u16(0x3808)); // x^2: 0x1.020p-1
+    const auto c3 = vreinterpretq_f16_u16(vdupq_n_u16(0x3149)); // x^3: 0x1.524p-3
+
+    const auto shift      = vreinterpretq_f16_u16(vdupq_n_u16(0x6600)); // 2^10 + 2^9 = 0x1.8p+10
+    const auto inv_ln2    = vreinterpretq_f16_u16(vdupq_n_u16(0x3dc5)); // 1 / ln(2) = 0x1.714p+0
+    const auto neg_ln2_hi = vreinterpretq_f16_u16(vdupq_n_u16(0xb980)); // -ln(2) high part = -0x1.6p-1
+    const auto neg_ln2_lo = vreinterpretq_f16_u16(vdupq_n_u16(0x9dc8)); // -ln(2) low part = -0x1.72p-8
+    const auto bias       = vdupq_n_s16(15);
+
+    // n = round(x / ln(2)) is read back from the mantissa bits of z.
+    const auto z = vfmaq_f16(shift, x, inv_ln2);
+    const auto n = vsubq_s16(vreinterpretq_s16_f16(z), vreinterpretq_s16_f16(shift));
+
+    // ln(2) is split in two so that n * ln(2)_hi is exact for every n this function can produce.
+    const auto nf = vsubq_f16(z, shift);
+    auto       r  = vfmaq_f16(x, nf, neg_ln2_hi);
+    r             = vfmaq_f16(r, nf, neg_ln2_lo);
+
+    const auto n1 = vshrq_n_s16(n, 1);
+    const auto n2 = vsubq_s16(n, n1);
+    scale_lo      = vreinterpretq_f16_s16(vshlq_n_s16(vaddq_s16(n1, bias), 10)); // 2^n1
+    scale_hi      = vreinterpretq_f16_s16(vshlq_n_s16(vaddq_s16(n2, bias), 10)); // 2^n2
+
+    // p = c1 * r + c2 * r^2 + c3 * r^3
+    return vmulq_f16(vfmaq_f16(c1, vfmaq_f16(c2, c3, r), r), r);
+}
+
+inline float16x8_t vexpq_fast_f16(float16x8_t x)
+{
+    // e^x is 0 below ln(2^-25) and overflows above ln(2^16): clamping keeps n1 and n2 in range.
+    const auto min_input = vreinterpretq_f16_u16(vdupq_n_u16(0xcc55)); // -0x1.154p+4
+    const auto max_input = vreinterpretq_f16_u16(vdupq_n_u16(0x49c0)); // 0x1.7p+3
+
+    float16x8_t scale_lo;
+    float16x8_t scale_hi;
+    const auto  p = vexpq_fast_reduce_f16(vminq_f16(vmaxq_f16(x, min_input), max_input), scale_lo, scale_hi);
+
+    // 2^n1 * (1 + p) * 2^n2 underflows and overflows like e^x does.
+    return vmulq_f16(vfmaq_f16(scale_lo, p, scale_lo), scale_hi);
+}
+
+inline float16x8_t vexpm1q_fast_f16(float16x8_t x)
+{
+    // e^x - 1 rounds to -1 below -10 in F16
+    const auto min_input = vreinterpretq_f16_u16(vdupq_n_u16(0xc900)); // -0x1.4p+3
+    const auto max_input = vreinterpretq_f16_u16(vdupq_n_u16(0x49c0)); // 0x1.7p+3
+    const auto bias      = vdupq_n_s16(15);
+
+    float16x8_t scale_lo;
+    float16x8_t scale_hi;
+    const auto  p = vexpq_fast_reduce_f16(vminq_f16(vmaxq_f16(x, min_input), max_input), scale_lo, scale_hi);
+
+    // e^x - 1 = 2^n1 * ((2^n2 - 2^-n1) + 2^n2 * p), which is exact for n = 0 and so does not cancel out around 0.
+    const auto n1           = vsubq_s16(vshrq_n_s16(vreinterpretq_s16_f16(scale_lo), 10), bias);
+    const auto inv_scale_lo = vreinterpretq_f16_s16(vshlq_n_s16(vsubq_s16(bias, n1), 10)); // 2^-n1
+
+    return vmulq_f16(scale_lo, vfmaq_f16(vsubq_f16(scale_hi, inv_scale_lo), p, scale_hi));
+}
+
 #ifdef __aarch64__
 inline float16x8_t verfq_f16(float16x8_t x)
 {
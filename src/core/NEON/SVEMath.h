@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2020-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,6 +74,39 @@ svfloat32_t svlog_f32_z(svbool_t pg, svfloat32_t x);
  */
 svfloat32_t svtanh_f32_z(svbool_t pg, svfloat32_t val);
 
+/** Calculate exponent with reduced accuracy.
+ *
+ * SVE counterpart of @ref vexpq_fast_f32. The maximum relative error is about 1e-4.
+ *
+ * @param[in] pg  Input predicate.
+ * @param[in] val Input vector value in F32 format.
+ *
+ * @return The calculated exponent.
+ */
+svfloat32_t svexp_fast_f32_z(svbool_t pg, svfloat32_t val);
+
+/** Calculate e^x - 1 with reduced accuracy.
+ *
+ * SVE counterpart of @ref vexpm1q_fast_f32.
+ *
+ * @param[in] pg  Input predicate.
+ * @param[in] val Input vector value in F32 format.
+ *
+ * @return The calculated e^x - 1.
+ */
+svfloat32_t svexpm1_fast_f32_z(svbool_t pg, svfloat32_t val);
+
+/** Calculate hyperbolic tangent with reduced accuracy.
+ *
+ * SVE counterpart of @ref vtanhq_fast_f32. The maximum relative error is about 1e-3.
+ *
+ * @param[in] pg  Input predicate.
+ * @param[in] val Input vector value in F32 format.
+ *
+ * @return The calculated Hyperbolic Tangent.
+ */
+svfloat32_t svtanh_fast_f32_z(svbool_t pg, svfloat32_t val);
+
 /** Calculate hyperbolic tangent.
  *
  * tanh(x) = (e^2x - 1)/(e^2x + 1)
@@ -96,6 +129,28 @@ svfloat16_t svtanh_f16_z(svbool_t pg, svfloat16_t val);
  */
 svfloat16_t svexp_f16_z(svbool_t pg, svfloat16_t x);
 
+/** Calculate exponent with reduced accuracy.
+ *
+ * SVE counterpart of @ref vexpq_fast_f16, computed natively in F16.
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F16 format.
+ *
+ * @return The calculated exponent.
+ */
+svfloat16_t svexp_fast_f16_z(svbool_t pg, svfloat16_t x);
+
+/** Calculate e^x - 1 with reduced accuracy.
+ *
+ * SVE counterpart of @ref vexpm1q_fast_f16, computed natively in F16.
+ *
+ * @param[in] pg Input predicate.
+ * @param[in] x  Input vector value in F16 format.
+ *
+ * @return The calculated e^x - 1.
+ */
+svfloat16_t svexpm1_fast_f16_z(svbool_t pg, svfloat16_t x);
+
 /** Calculate reciprocal.
  *
  * @param[in] pg Input predicate.
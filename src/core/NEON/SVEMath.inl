@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024 Arm Limited.
+ * Copyright (c) 2020-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -164,6 +164,88 @@ inline svfloat32_t svexp_f32_z(svbool_t pg, svfloat32_t x)
     return poly;
 }
 
+static const uint32_t svexp_fast_f32_coeff[] = {
+    0x3f80066c, // x^1: 0x1.000cd8p+0f
+    0x3f010e9e, // x^2: 0x1.021d3cp-1f
+    0x3e2924a4, // x^3: 0x1.524948p-3f
+};
+
+/** Range reduction shared by the fast exponential functions.
+ *
+ * Returns p(r) ~= e^r - 1 and sets @p scale to 2^n, where e^x = 2^n * e^r.
+ */
+inline svfloat32_t svexp_fast_reduce_f32_z(svbool_t pg, svfloat32_t x, svfloat32_t &scale)
+{
+    const auto c1 = svreinterpret_f32_u32(svdup_n_u32(svexp_fast_f32_coeff[0]));
+    const auto c2 = svreinterpret_f32_u32(svdup_n_u32(svexp_fast_f32_coeff[1]));
+    const auto c3 = svreinterpret_f32_u32(svdup_n_u32(svexp_fast_f32_coeff[2]));
+
+    const auto shift   = svreinterpret_f32_u32(svdup_n_u32(0x4b00007f)); // 2^23 + 127 = 0x1.0000fep23f
+    const auto inv_ln2 = svreinterpret_f32_u32(svdup_n_u32(0x3fb8aa3b)); // 1 / ln(2) = 0x1.715476p+0f
+    const auto neg_ln2 = svreinterpret_f32_u32(svdup_n_u32(0xbf317218)); // -ln(2) = -0x1.62e430p-1f
+
+    // Same reduction as svexp_f32_z, with n * ln(2) subtracted in a single step.
+    const auto z = svmla_f32_z(pg, shift, x, inv_ln2);
+    const auto n = svsub_f32_z(pg, z, shift);
+    const auto r = svmla_f32_z(pg, x, n, neg_ln2);
+
+    scale = svreinterpret_f32_u32(svlsl_n_u32_z(pg, svreinterpret_u32_f32(z), 23)); // 2^n
+
+    // p = c1 * r + c2 * r^2 + c3 * r^3
+    return svmul_f32_z(pg, svmla_f32_z(pg, c1, svmla_f32_z(pg, c2, c3, r), r), r);
+}
+
+inline svfloat32_t svexp_fast_f32_z(svbool_t pg, svfloat32_t x)
+{
+    const auto inf       = svdup_n_f32(std::numeric_limits<float>::infinity());
+    const auto max_input = svdup_n_f32(88.37f); // Approximately ln(2^127.5)
+    const auto zero      = svdup_n_f32(0.f);
+    const auto min_input = svdup_n_f32(-86.64f); // Approximately ln(2^-125)
+
+    svfloat32_t scale;
+    const auto  p = svexp_fast_reduce_f32_z(pg, x, scale);
+
+    auto poly = svmla_f32_z(pg, scale, p, scale);
+
+    // Handle underflow and overflow.
+    poly = svsel_f32(svcmplt_f32(pg, x, min_input), zero, poly);
+    poly = svsel_f32(svcmpgt_f32(pg, x, max_input), inf, poly);
+
+    return poly;
+}
+
+inline svfloat32_t svexpm1_fast_f32_z(svbool_t pg, svfloat32_t x)
+{
+    const auto inf       = svdup_n_f32(std::numeric_limits<float>::infinity());
+    const auto max_input = svdup_n_f32(88.37f);  // Approximately ln(2^127.5)
+    const auto min_input = svdup_n_f32(-86.64f); // Approximately ln(2^-125), e^x - 1 is already -1 here
+    const auto one       = svdup_n_f32(1.f);
+
+    svfloat32_t scale;
+    const auto  p = svexp_fast_reduce_f32_z(pg, svmax_f32_z(pg, x, min_input), scale);
+
+    // e^x - 1 = (2^n - 1) + 2^n * p, which is exact for n = 0 and so does not cancel out around 0.
+    const auto res = svmla_f32_z(pg, svsub_f32_z(pg, scale, one), p, scale);
+
+    return svsel_f32(svcmpgt_f32(pg, x, max_input), inf, res);
+}
+
+inline svfloat32_t svtanh_fast_f32_z(svbool_t pg, svfloat32_t val)
+{
+    const auto max_tanh = svdup_n_f32(9.f); // tanh(9) rounds to 1 in F32
+    const auto two      = svdup_n_f32(2.f);
+
+    const auto x   = svmin_f32_z(pg, svmax_f32_z(pg, val, svneg_f32_z(pg, max_tanh)), max_tanh);
+    const auto num = svexpm1_fast_f32_z(pg, svmul_f32_z(pg, two, x));
+    const auto den = svadd_f32_z(pg, num, two);
+
+    // One Newton-Raphson step on the reciprocal estimate is enough for the accuracy of this tier.
+    auto inv = svrecpe_f32(den);
+    inv      = svmul_f32_z(pg, svrecps_f32(den, inv), inv);
+
+    return svmul_f32_z(pg, num, inv);
+}
+
 inline svfloat16_t svexp_f16_z(svbool_t pg, svfloat16_t x)
 {
     auto bottom = svcvt_f32_z(pg, x);
@@ -176,6 +258,66 @@ inline svfloat16_t svexp_f16_z(svbool_t pg, svfloat16_t x)
     return svtrn1(svcvt_f16_z(pg, bottom), svcvt_f16_z(pg_top, top));
 }
 
+/** Range reduction shared by the fast F16 exponential functions.
+ *
+ * SVE counterpart of vexpq_fast_reduce_f16: e^x = 2^n1 * 2^n2 * (1 + p(r)), with both scales normal F16 numbers.
+ */
+inline svfloat16_t svexp_fast_reduce_f16_z(svbool_t pg, svfloat16_t x, svfloat16_t &scale_lo, svfloat16_t &scale_hi)
+{
+    const auto c1 = svreinterpret_f16_u16(svdup_n_u16(0x3c00)); // x^1: 0x1.000p+0
+    const auto c2 = svreinterpret_f16_u16(svdup_n_u16(0x3808)); // x^2: 0x1.020p-1
+    const auto c3 = svreinterpret_f16_u16(svdup_n_u16(0x3149)); // x^3: 0x1.524p-3
+
+    const auto shift      = svreinterpret_f16_u16(svdup_n_u16(0x6600)); // 2^10 + 2^9 = 0x1.8p+10
+    const auto inv_ln2    = svreinterpret_f16_u16(svdup_n_u16(0x3dc5)); // 1 / ln(2) = 0x1.714p+0
+    const auto neg_ln2_hi = svreinterpret_f16_u16(svdup_n_u16(0xb980)); // -ln(2) high part = -0x1.6p-1
+    const auto neg_ln2_lo = svreinterpret_f16_u16(svdup_n_u16(0x9dc8)); // -ln(2) low part = -0x1.72p-8
+
+    const auto z  = svmla_f16_z(pg, shift, x, inv_ln2);
+    const auto n  = svsub_s16_z(pg, svreinterpret_s16_f16(z), svreinterpret_s16_f16(shift));
+    const auto nf = svsub_f16_z(pg, z, shift);
+    auto       r  = svmla_f16_z(pg, x, nf, neg_ln2_hi);
+    r             = svmla_f16_z(pg, r, nf, neg_ln2_lo);
+
+    const auto n1 = svasr_n_s16_z(pg, n, 1);
+    const auto n2 = svsub_s16_z(pg, n, n1);
+    scale_lo      = svreinterpret_f16_s16(svlsl_n_s16_z(pg, svadd_n_s16_z(pg, n1, 15), 10)); // 2^n1
+    scale_hi      = svreinterpret_f16_s16(svlsl_n_s16_z(pg, svadd_n_s16_z(pg, n2, 15), 10)); // 2^n2
+
+    // p = c1 * r + c2 * r^2 + c3 * r^3
+    return svmul_f16_z(pg, svmla_f16_z(pg, c1, svmla_f16_z(pg, c2, c3, r), r), r);
+}
+
+inline svfloat16_t svexp_fast_f16_z(svbool_t pg, svfloat16_t x)
+{
+    const auto min_input = svreinterpret_f16_u16(svdup_n_u16(0xcc55)); // -0x1.154p+4, about ln(2^-25)
+    const auto max_input = svreinterpret_f16_u16(svdup_n_u16(0x49c0)); // 0x1.7p+3, above ln(2^16)
+
+    svfloat16_t scale_lo;
+    svfloat16_t scale_hi;
+    const auto  p = svexp_fast_reduce_f16_z(pg, svmin_f16_z(pg, svmax_f16_z(pg, x, min_input), max_input), scale_lo,
+                                            scale_hi);
+
+    return svmul_f16_z(pg, svmla_f16_z(pg, scale_lo, p, scale_lo), scale_hi);
+}
+
+inline svfloat16_t svexpm1_fast_f16_z(svbool_t pg, svfloat16_t x)
+{
+    const auto min_input = svreinterpret_f16_u16(svdup_n_u16(0xc900)); // -0x1.4p+3, e^x - 1 rounds to -1 below
+    const auto max_input = svreinterpret_f16_u16(svdup_n_u16(0x49c0)); // 0x1.7p+3
+
+    svfloat16_t scale_lo;
+    svfloat16_t scale_hi;
+    const auto  p = svexp_fast_reduce_f16_z(pg, svmin_f16_z(pg, svmax_f16_z(pg, x, min_input), max_input), scale_lo,
+                                            scale_hi);
+
+    // e^x - 1 = 2^n1 * ((2^n2 - 2^-n1) + 2^n2 * p), which is exact for n = 0.
+    const auto n1           = svsub_n_s16_z(pg, svasr_n_s16_z(pg, svreinterpret_s16_f16(scale_lo), 10), 15);
+    const auto inv_scale_lo = svreinterpret_f16_s16(svlsl_n_s16_z(pg, svsubr_n_s16_z(pg, n1, 15), 10)); // 2^-n1
+
+    return svmul_f16_z(pg, scale_lo, svmla_f16_z(pg, svsub_f16_z(pg, scale_hi, inv_scale_lo), p, scale_hi));
+}
+
 inline svfloat32_t svtanh_f32_z(svbool_t pg, svfloat32_t val)
 {
     const svfloat32_t CONST_1        = svdup_n_f32(1.f);
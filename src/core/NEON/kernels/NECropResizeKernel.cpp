@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NECropResizeKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/cpu/kernels/crop/list.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace arm_compute
+{
+namespace
+{
+struct CropResizeSelectorData
+{
+    DataType dt;
+};
+
+using CropResizeSelectorPtr = std::add_pointer<bool(const CropResizeSelectorData &data)>::type;
+using CropResizeUKernelPtr =
+    std::add_pointer<void(const cpu::CropResizeRow &, float *, size_t, InterpolationPolicy, float)>::type;
+
+struct CropResizeUKernel
+{
+    const char                 *name;
+    const CropResizeSelectorPtr is_selected;
+    CropResizeUKernelPtr        ukernel;
+};
+
+static const CropResizeUKernel available_kernels[] = {
+    {"fp16_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::F16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::fp16_crop_resize_row)},
+    {"f32_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::fp32_crop_resize_row)},
+    {"u8_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::U8; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u8_crop_resize_row)},
+    {"u16_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::U16; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u16_crop_resize_row)},
+    {"u32_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::U32; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u32_crop_resize_row)},
+    {"s16_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::S16; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::s16_crop_resize_row)},
+    {"s32_neon_crop_resize", [](const CropResizeSelectorData &data) { return data.dt == DataType::S32; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::s32_crop_resize_row)},
+};
+
+/** Micro-kernel selector
+ *
+ * @param[in] data Selection data passed to help pick the appropriate micro-kernel
+ *
+ * @return A matching micro-kernel else nullptr
+ */
+const CropResizeUKernel *get_implementation(const CropResizeSelectorData &data)
+{
+    for (const auto &uk : available_kernels)
+    {
+        if (uk.is_selected(data))
+        {
+            return &uk;
+        }
+    }
+
+    return nullptr;
+}
+} // namespace
+
+NECropResizeKernel::NECropResizeKernel()
+    : _input(nullptr),
+      _boxes(nullptr),
+      _box_ind(nullptr),
+      _output(nullptr),
+      _crop_size(),
+      _method(InterpolationPolicy::BILINEAR),
+      _extrapolation_value(0)
+{
+}
+
+void NECropResizeKernel::configure(const ITensor      *input,
+                                   const ITensor      *boxes,
+                                   const ITensor      *box_ind,
+                                   ITensor            *output,
+                                   Coordinates2D       crop_size,
+                                   InterpolationPolicy method,
+                                   float               extrapolation_value)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, boxes, box_ind, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate(input->info(), boxes->info(), box_ind->info(), output->info(), crop_size,
+                                        method, extrapolation_value));
+
+    _input               = input;
+    _boxes               = boxes;
+    _box_ind             = box_ind;
+    _output              = output;
+    _crop_size           = crop_size;
+    _method              = method;
+    _extrapolation_value = extrapolation_value;
+
+    // The window iterates over all the (box, output row) pairs so that threads are balanced across boxes
+    const size_t num_boxes = boxes->info()->dimension(1);
+    Window       win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_boxes * crop_size.y, 1));
+    INEKernel::configure(win);
+}
+
+Status NECropResizeKernel::validate(const ITensorInfo  *input,
+                                    const ITensorInfo  *boxes,
+                                    const ITensorInfo  *box_ind,
+                                    const ITensorInfo  *output,
+                                    Coordinates2D       crop_size,
+                                    InterpolationPolicy method,
+                                    float               extrapolation_value)
+{
+    ARM_COMPUTE_UNUSED(extrapolation_value);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, boxes, box_ind, output);
+    const auto *uk = get_implementation(CropResizeSelectorData{input->data_type()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::U16, DataType::S16,
+                                                         DataType::F16, DataType::U32, DataType::S32, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape().num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(boxes, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(boxes->tensor_shape()[0] != 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(box_ind, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(boxes->tensor_shape()[1] != box_ind->tensor_shape()[0]);
+    ARM_COMPUTE_RETURN_ERROR_ON(crop_size.x <= 0 || crop_size.y <= 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(method != InterpolationPolicy::BILINEAR &&
+                                method != InterpolationPolicy::NEAREST_NEIGHBOR);
+    if (output->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(output, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        const TensorShape out_shape(input->tensor_shape()[0], crop_size.x, crop_size.y, boxes->tensor_shape()[1]);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), out_shape);
+    }
+    return Status{};
+}
+
+void NECropResizeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const auto *uk = get_implementation(CropResizeSelectorData{_input->info()->data_type()});
+
+    const ITensorInfo *src_info     = _input->info();
+    const int32_t      input_width  = static_cast<int32_t>(src_info->dimension(1));
+    const int32_t      input_height = static_cast<int32_t>(src_info->dimension(2));
+    const int32_t      num_batches  = static_cast<int32_t>(src_info->dimension(3));
+    const size_t       out_stride_x = _output->info()->strides_in_bytes()[1];
+
+    cpu::CropResizeRow row{};
+    row.stride_x     = src_info->strides_in_bytes()[1];
+    row.stride_y     = src_info->strides_in_bytes()[2];
+    row.num_channels = static_cast<int32_t>(src_info->dimension(0));
+    row.output_width = _crop_size.x;
+
+    for (int32_t r = window.y().start(); r < window.y().end(); ++r)
+    {
+        const uint32_t box = r / _crop_size.y;
+        const int32_t  oy  = r % _crop_size.y;
+
+        // The crop box is specified by normalized coordinates [y0, x0, y1, x1] which are scaled
+        // to the image size and rounded to integers.
+        const float y0 = *reinterpret_cast<const float *>(_boxes->ptr_to_element(Coordinates(0, box)));
+        const float x0 = *reinterpret_cast<const float *>(_boxes->ptr_to_element(Coordinates(1, box)));
+        const float y1 = *reinterpret_cast<const float *>(_boxes->ptr_to_element(Coordinates(2, box)));
+        const float x1 = *reinterpret_cast<const float *>(_boxes->ptr_to_element(Coordinates(3, box)));
+
+        const int32_t start_x = static_cast<int32_t>(std::floor(x0 * (input_width - 1) + 0.5f));
+        const int32_t start_y = static_cast<int32_t>(std::floor(y0 * (input_height - 1) + 0.5f));
+        const int32_t end_x   = static_cast<int32_t>(std::floor(x1 * (input_width - 1) + 0.5f));
+        const int32_t end_y   = static_cast<int32_t>(std::floor(y1 * (input_height - 1) + 0.5f));
+        const int32_t batch   = *reinterpret_cast<const int32_t *>(_box_ind->ptr_to_element(Coordinates(box)));
+
+        // A box applied to a batch that does not exist lies entirely outside of the input: an empty image
+        // makes every tap fall back to the extrapolation value without dereferencing the input.
+        const bool valid_batch = batch >= 0 && batch < num_batches;
+
+        row.batch_ptr    = _input->buffer() + src_info->offset_first_element_in_bytes() +
+                         (valid_batch ? batch : 0) * src_info->strides_in_bytes()[3];
+        row.input_width  = valid_batch ? input_width : 0;
+        row.input_height = valid_batch ? input_height : 0;
+        row.start_x      = start_x;
+        row.start_y      = start_y;
+        row.dir_x        = end_x < start_x ? -1 : 1;
+        row.dir_y        = end_y < start_y ? -1 : 1;
+        row.crop_width   = std::abs(end_x - start_x) + 1;
+        row.crop_height  = std::abs(end_y - start_y) + 1;
+        row.scale_x      = static_cast<float>(row.crop_width) / static_cast<float>(_crop_size.x);
+        row.src_y        = oy * (static_cast<float>(row.crop_height) / static_cast<float>(_crop_size.y));
+
+        float *output_ptr = reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(0, 0, oy, box)));
+        uk->ukernel(row, output_ptr, out_stride_x, _method, _extrapolation_value);
+    }
+}
+} // namespace arm_compute
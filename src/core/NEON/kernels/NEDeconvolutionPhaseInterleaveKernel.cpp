@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEDeconvolutionPhaseInterleaveKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input,
+                          const ITensorInfo *output,
+                          unsigned int       stride_x,
+                          unsigned int       stride_y,
+                          unsigned int       offset_x,
+                          unsigned int       offset_y)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() == DataType::UNKNOWN);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->total_size() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(stride_x < 1 || stride_y < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(offset_x >= stride_x || offset_y >= stride_y);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+
+    const DataLayout data_layout = input->data_layout();
+    const size_t     idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const size_t     idx_b       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(idx_c) != output->dimension(idx_c) * stride_x * stride_y);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(idx_b) != output->dimension(idx_b));
+    // Every output pixel must map to a valid position of the phase tensor
+    ARM_COMPUTE_RETURN_ERROR_ON((output->dimension(idx_w) - 1 + offset_x) / stride_x >= input->dimension(idx_w));
+    ARM_COMPUTE_RETURN_ERROR_ON((output->dimension(idx_h) - 1 + offset_y) / stride_y >= input->dimension(idx_h));
+
+    return Status{};
+}
+
+template <typename T>
+void interleave_nchw(const ITensor *src,
+                     ITensor       *dst,
+                     const Window  &window,
+                     unsigned int   stride_x,
+                     unsigned int   stride_y,
+                     unsigned int   offset_x,
+                     unsigned int   offset_y)
+{
+    const Strides     &in_strides   = src->info()->strides_in_bytes();
+    const uint8_t     *in_base      = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const unsigned int out_width    = dst->info()->dimension(0);
+    const unsigned int out_channels = dst->info()->dimension(2);
+
+    Iterator out(dst, window);
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const unsigned int ty      = id.y() + offset_y;
+            const uint8_t     *in_row  = in_base + (ty / stride_y) * in_strides[1] + id[3] * in_strides[3];
+            T                 *out_ptr = reinterpret_cast<T *>(out.ptr());
+
+            // Each horizontal phase reads a contiguous run of the phase tensor and writes every stride_x-th element
+            for (unsigned int rx = 0; rx < stride_x; ++rx)
+            {
+                const unsigned int phase  = (ty % stride_y) * stride_x + rx;
+                const unsigned int x0     = (rx + stride_x - offset_x) % stride_x;
+                const uint8_t     *in_ptr = in_row + (phase * out_channels + id.z()) * in_strides[2] +
+                                        ((x0 + offset_x) / stride_x) * in_strides[0];
+                for (unsigned int x = x0; x < out_width; x += stride_x, in_ptr += in_strides[0])
+                {
+                    out_ptr[x] = *reinterpret_cast<const T *>(in_ptr);
+                }
+            }
+        },
+        out);
+}
+
+void interleave_nhwc(const ITensor *src,
+                     ITensor       *dst,
+                     const Window  &window,
+                     unsigned int   stride_x,
+                     unsigned int   stride_y,
+                     unsigned int   offset_x,
+                     unsigned int   offset_y)
+{
+    const Strides &in_strides = src->info()->strides_in_bytes();
+    const uint8_t *in_base    = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const size_t   row_bytes  = dst->info()->dimension(0) * dst->info()->element_size();
+
+    Iterator out(dst, window);
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const unsigned int tx    = id.y() + offset_x;
+            const unsigned int ty    = id.z() + offset_y;
+            const unsigned int phase = (ty % stride_y) * stride_x + (tx % stride_x);
+
+            // The channels of a phase are contiguous in NHWC so a whole pixel is moved at once
+            const uint8_t *in_ptr = in_base + phase * row_bytes + (tx / stride_x) * in_strides[1] +
+                                    (ty / stride_y) * in_strides[2] + id[3] * in_strides[3];
+            std::memcpy(out.ptr(), in_ptr, row_bytes);
+        },
+        out);
+}
+} // namespace
+
+NEDeconvolutionPhaseInterleaveKernel::NEDeconvolutionPhaseInterleaveKernel()
+    : _input(nullptr),
+      _output(nullptr),
+      _stride_x(1),
+      _stride_y(1),
+      _offset_x(0),
+      _offset_y(0),
+      _split_dimension(Window::DimY)
+{
+}
+
+void NEDeconvolutionPhaseInterleaveKernel::configure(const ITensor *input,
+                                                     ITensor       *output,
+                                                     unsigned int   stride_x,
+                                                     unsigned int   stride_y,
+                                                     unsigned int   offset_x,
+                                                     unsigned int   offset_y)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(
+        validate_arguments(input->info(), output->info(), stride_x, stride_y, offset_x, offset_y));
+
+    _input    = input;
+    _output   = output;
+    _stride_x = stride_x;
+    _stride_y = stride_y;
+    _offset_x = offset_x;
+    _offset_y = offset_y;
+
+    _split_dimension = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::HEIGHT);
+
+    // The innermost dimension (width for NCHW, channels for NHWC) is processed in a single step
+    Window win = calculate_max_window(*output->info(), Steps(output->info()->dimension(0)));
+    ICPPKernel::configure(win);
+}
+
+Status NEDeconvolutionPhaseInterleaveKernel::validate(const ITensorInfo *input,
+                                                      const ITensorInfo *output,
+                                                      unsigned int       stride_x,
+                                                      unsigned int       stride_y,
+                                                      unsigned int       offset_x,
+                                                      unsigned int       offset_y)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, stride_x, stride_y, offset_x, offset_y));
+    return Status{};
+}
+
+size_t NEDeconvolutionPhaseInterleaveKernel::get_split_dimension() const
+{
+    return _split_dimension;
+}
+
+void NEDeconvolutionPhaseInterleaveKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICPPKernel::window(), window);
+
+    if (_input->info()->data_layout() == DataLayout::NHWC)
+    {
+        interleave_nhwc(_input, _output, window, _stride_x, _stride_y, _offset_x, _offset_y);
+        return;
+    }
+
+    switch (_input->info()->element_size())
+    {
+        case 1:
+            interleave_nchw<uint8_t>(_input, _output, window, _stride_x, _stride_y, _offset_x, _offset_y);
+            break;
+        case 2:
+            interleave_nchw<uint16_t>(_input, _output, window, _stride_x, _stride_y, _offset_x, _offset_y);
+            break;
+        case 4:
+            interleave_nchw<uint32_t>(_input, _output, window, _stride_x, _stride_y, _offset_x, _offset_y);
+            break;
+        case 8:
+            interleave_nchw<uint64_t>(_input, _output, window, _stride_x, _stride_y, _offset_x, _offset_y);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Element size not supported");
+    }
+}
+} // namespace arm_compute
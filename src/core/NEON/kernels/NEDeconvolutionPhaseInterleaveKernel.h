@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEDECONVOLUTIONPHASEINTERLEAVEKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEDECONVOLUTIONPHASEINTERLEAVEKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Kernel to scatter the phase outputs of a sub-pixel deconvolution into the final output.
+ *
+ * The input holds, for each of the stride_x * stride_y phases, the output of the phase sub-kernel
+ * evaluated on the original (non upsampled) input. Phase p = ry * stride_x + rx is stored in channels
+ * [p * C, (p + 1) * C) where C is the number of output channels. The output pixel at (x, y) is read
+ * from the phase ((x + offset_x) % stride_x, (y + offset_y) % stride_y) at the spatial position
+ * ((x + offset_x) / stride_x, (y + offset_y) / stride_y).
+ */
+class NEDeconvolutionPhaseInterleaveKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDeconvolutionPhaseInterleaveKernel";
+    }
+    /** Default constructor */
+    NEDeconvolutionPhaseInterleaveKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionPhaseInterleaveKernel(const NEDeconvolutionPhaseInterleaveKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionPhaseInterleaveKernel &operator=(const NEDeconvolutionPhaseInterleaveKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDeconvolutionPhaseInterleaveKernel(NEDeconvolutionPhaseInterleaveKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDeconvolutionPhaseInterleaveKernel &operator=(NEDeconvolutionPhaseInterleaveKernel &&) = default;
+    /** Default destructor */
+    ~NEDeconvolutionPhaseInterleaveKernel() = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input    Phase tensor. Supported tensor rank: up to 4. Data types supported: All
+     * @param[out] output   Destination tensor. Data types supported: same as @p input
+     * @param[in]  stride_x Deconvolution stride along the width.
+     * @param[in]  stride_y Deconvolution stride along the height.
+     * @param[in]  offset_x Phase offset along the width. Must be less than @p stride_x.
+     * @param[in]  offset_y Phase offset along the height. Must be less than @p stride_y.
+     */
+    void configure(const ITensor *input,
+                   ITensor       *output,
+                   unsigned int   stride_x,
+                   unsigned int   stride_y,
+                   unsigned int   offset_x,
+                   unsigned int   offset_y);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDeconvolutionPhaseInterleaveKernel
+     *
+     * @param[in] input    Phase tensor info. Supported tensor rank: up to 4. Data types supported: All
+     * @param[in] output   Destination tensor info. Data types supported: same as @p input
+     * @param[in] stride_x Deconvolution stride along the width.
+     * @param[in] stride_y Deconvolution stride along the height.
+     * @param[in] offset_x Phase offset along the width. Must be less than @p stride_x.
+     * @param[in] offset_y Phase offset along the height. Must be less than @p stride_y.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input,
+                           const ITensorInfo *output,
+                           unsigned int       stride_x,
+                           unsigned int       stride_y,
+                           unsigned int       offset_x,
+                           unsigned int       offset_y);
+
+    /** Get the dimension the scheduler should use to split. */
+    size_t get_split_dimension() const;
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    unsigned int   _stride_x;
+    unsigned int   _stride_y;
+    unsigned int   _offset_x;
+    unsigned int   _offset_y;
+    size_t         _split_dimension;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEDECONVOLUTIONPHASEINTERLEAVEKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, 2024 Arm Limited.
+ * Copyright (c) 2019-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -112,6 +112,92 @@ Status validate_arguments(const ITensorInfo *anchors, const ITensorInfo *all_anc
     return Status{};
 }
 
+using DecodeProposalsUKernelPtr = std::add_pointer<void(const ITensor                  *scores,
+                                                        const ITensor                  *deltas,
+                                                        const ITensor                  *anchors,
+                                                        ITensor                        *proposals,
+                                                        ITensor                        *scores_out,
+                                                        const ComputeAnchorsInfo       &anchors_info,
+                                                        const BoundingBoxTransformInfo &bbox_info,
+                                                        const Window                   &window)>::type;
+
+struct DecodeProposalsKernel
+{
+    const char                        *name;
+    const ComputeAllAnchorsSelectorPtr is_selected;
+    DecodeProposalsUKernelPtr          ukernel;
+};
+
+static const DecodeProposalsKernel available_decode_kernels[] = {
+    {"neon_fp32_decodeproposals", [](const ComputeAllAnchorsData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_decodeproposals)},
+};
+
+/** Micro-kernel selector for the proposals decoding
+ *
+ * @param[in] data Selection data passed to help pick the appropriate micro-kernel
+ *
+ * @return A matching micro-kernel else nullptr
+ */
+const DecodeProposalsKernel *get_decode_implementation(const ComputeAllAnchorsData &data)
+{
+    for (const auto &uk : available_decode_kernels)
+    {
+        if (uk.is_selected(data))
+        {
+            return &uk;
+        }
+    }
+    return nullptr;
+}
+
+Status validate_decode_arguments(const ITensorInfo           *scores,
+                                 const ITensorInfo           *deltas,
+                                 const ITensorInfo           *anchors,
+                                 const ITensorInfo           *proposals,
+                                 const ITensorInfo           *scores_out,
+                                 const GenerateProposalsInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(scores, deltas, anchors, proposals, scores_out);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(scores, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(scores, DataLayout::NCHW, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(scores, deltas);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(scores, deltas, anchors);
+    ARM_COMPUTE_RETURN_ERROR_ON(get_decode_implementation(ComputeAllAnchorsData{scores->data_type()}) == nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.values_per_roi() != 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(anchors->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(anchors->dimension(0) != info.values_per_roi());
+
+    const DataLayout data_layout = scores->data_layout();
+    const size_t     width_idx   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const size_t     height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const size_t     channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const size_t     num_anchors = anchors->dimension(1);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(scores->dimension(channel_idx) != num_anchors);
+    ARM_COMPUTE_RETURN_ERROR_ON(deltas->dimension(channel_idx) != info.values_per_roi() * num_anchors);
+    ARM_COMPUTE_RETURN_ERROR_ON(deltas->dimension(width_idx) != scores->dimension(width_idx));
+    ARM_COMPUTE_RETURN_ERROR_ON(deltas->dimension(height_idx) != scores->dimension(height_idx));
+
+    const size_t total_num_anchors = num_anchors * scores->dimension(width_idx) * scores->dimension(height_idx);
+    if (proposals->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(scores, proposals);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(proposals->tensor_shape(),
+                                                           TensorShape(info.values_per_roi(), total_num_anchors));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!proposals->padding().empty(), "Padding on the proposals is not supported");
+    }
+    if (scores_out->total_size() > 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(scores, scores_out);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(scores_out->tensor_shape(),
+                                                           TensorShape(1, total_num_anchors));
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!scores_out->padding().empty(), "Padding on the scores is not supported");
+    }
+
+    return Status{};
+}
+
 } // namespace
 
 NEComputeAllAnchorsKernel::NEComputeAllAnchorsKernel()
@@ -164,4 +250,78 @@ void NEComputeAllAnchorsKernel::run(const Window &window, const ThreadInfo &info
 
     uk->ukernel(_anchors, _all_anchors, _anchors_info, window);
 }
+
+NEDecodeProposalsKernel::NEDecodeProposalsKernel()
+    : _scores(nullptr),
+      _deltas(nullptr),
+      _anchors(nullptr),
+      _proposals(nullptr),
+      _scores_out(nullptr),
+      _anchors_info(0.f, 0.f, 0.f),
+      _bbox_info(0.f, 0.f, 1.f)
+{
+}
+
+void NEDecodeProposalsKernel::configure(const ITensor               *scores,
+                                        const ITensor               *deltas,
+                                        const ITensor               *anchors,
+                                        ITensor                     *proposals,
+                                        ITensor                     *scores_out,
+                                        const GenerateProposalsInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(scores, deltas, anchors, proposals, scores_out);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_decode_arguments(scores->info(), deltas->info(), anchors->info(),
+                                                         proposals->info(), scores_out->info(), info));
+
+    // Metadata
+    const DataLayout data_layout = scores->info()->data_layout();
+    const size_t     feat_width =
+        scores->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH));
+    const size_t feat_height =
+        scores->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT));
+    const size_t total_num_anchors = anchors->info()->dimension(1) * feat_width * feat_height;
+
+    // Initialize the outputs if empty
+    auto_init_if_empty(*proposals->info(), TensorShape(info.values_per_roi(), total_num_anchors), 1,
+                       scores->info()->data_type());
+    auto_init_if_empty(*scores_out->info(), TensorShape(1, total_num_anchors), 1, scores->info()->data_type());
+
+    // Set instance variables
+    _scores       = scores;
+    _deltas       = deltas;
+    _anchors      = anchors;
+    _proposals    = proposals;
+    _scores_out   = scores_out;
+    _anchors_info = ComputeAnchorsInfo(feat_width, feat_height, info.spatial_scale());
+    _bbox_info    = BoundingBoxTransformInfo(info.im_width(), info.im_height(), 1.f);
+
+    // Each window iteration decodes a whole row of the feature map
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, feat_height, 1));
+    INEKernel::configure(win);
+}
+
+Status NEDecodeProposalsKernel::validate(const ITensorInfo           *scores,
+                                         const ITensorInfo           *deltas,
+                                         const ITensorInfo           *anchors,
+                                         const ITensorInfo           *proposals,
+                                         const ITensorInfo           *scores_out,
+                                         const GenerateProposalsInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_decode_arguments(scores, deltas, anchors, proposals, scores_out, info));
+    return Status{};
+}
+
+void NEDecodeProposalsKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const auto *uk = get_decode_implementation(ComputeAllAnchorsData{_scores->info()->data_type()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    uk->ukernel(_scores, _deltas, _anchors, _proposals, _scores_out, _anchors_info, _bbox_info, window);
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022 Arm Limited.
+ * Copyright (c) 2019-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,5 +78,75 @@ private:
     ITensor           *_all_anchors;
     ComputeAnchorsInfo _anchors_info;
 };
+
+/** Interface for the kernel to decode the proposals of a Region Proposal Network
+ *
+ * The anchors of every location of the feature map are computed on the fly, the bounding box deltas are applied to them
+ * and the scores are gathered in the same order as the boxes. Scores and deltas are read in their original layout, so
+ * that no permutation or reshape is needed before the decoding. The work is split across the rows of the feature map.
+ */
+class NEDecodeProposalsKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDecodeProposalsKernel";
+    }
+
+    /** Default constructor */
+    NEDecodeProposalsKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDecodeProposalsKernel(const NEDecodeProposalsKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDecodeProposalsKernel &operator=(const NEDecodeProposalsKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDecodeProposalsKernel(NEDecodeProposalsKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDecodeProposalsKernel &operator=(NEDecodeProposalsKernel &&) = default;
+    /** Default destructor */
+    ~NEDecodeProposalsKernel() = default;
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  scores     Scores from convolution layer of size (W, H, A), where H and W are the height and width of the feature map, and A is the number of anchors.
+     *                        Data types supported: F32
+     * @param[in]  deltas     Bounding box deltas from convolution layer of size (W, H, 4*A). Data types supported: Same as @p scores
+     * @param[in]  anchors    Anchors tensor of size (4, A). Data types supported: Same as @p scores
+     * @param[out] proposals  Decoded boxes of size (4, H*W*A), clipped to the image. Data types supported: Same as @p scores
+     * @param[out] scores_out Scores of the decoded boxes of size (1, H*W*A). Data types supported: Same as @p scores
+     * @param[in]  info       Contains GenerateProposals operation information described in @ref GenerateProposalsInfo
+     */
+    void configure(const ITensor               *scores,
+                   const ITensor               *deltas,
+                   const ITensor               *anchors,
+                   ITensor                     *proposals,
+                   ITensor                     *scores_out,
+                   const GenerateProposalsInfo &info);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDecodeProposalsKernel
+     *
+     * Similar to @ref NEDecodeProposalsKernel::configure()
+     *
+     * @return a Status
+     */
+    static Status validate(const ITensorInfo           *scores,
+                           const ITensorInfo           *deltas,
+                           const ITensorInfo           *anchors,
+                           const ITensorInfo           *proposals,
+                           const ITensorInfo           *scores_out,
+                           const GenerateProposalsInfo &info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor           *_scores;
+    const ITensor           *_deltas;
+    const ITensor           *_anchors;
+    ITensor                 *_proposals;
+    ITensor                 *_scores_out;
+    ComputeAnchorsInfo       _anchors_info;
+    BoundingBoxTransformInfo _bbox_info;
+};
 } // namespace arm_compute
 #endif // ARM_COMPUTE_NEGENERATEPROPOSALSLAYERKERNEL_H
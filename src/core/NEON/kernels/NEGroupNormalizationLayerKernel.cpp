@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEGroupNormalizationLayerKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/groupnorm/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+struct GroupNormSelectorData
+{
+    DataType dt;
+};
+
+using GroupNormSelectorPtr = std::add_pointer<bool(const GroupNormSelectorData &data)>::type;
+using GroupNormUKernelPtr  = std::add_pointer<void(const ITensor                           *input,
+                                                  ITensor                                 *output,
+                                                  const ITensor                           *stats,
+                                                  const ITensor                           *gamma,
+                                                  const ITensor                           *beta,
+                                                  float                                   *scratch,
+                                                  const GroupNormalizationLayerKernelInfo &info,
+                                                  const Window                            &window)>::type;
+
+struct GroupNormKernel
+{
+    const char                *name;
+    const GroupNormSelectorPtr is_selected;
+    GroupNormUKernelPtr        ukernel;
+};
+
+static const GroupNormKernel available_kernels[] = {
+    {"fp32_neon_groupnorm", [](const GroupNormSelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_groupnorm)},
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    {"fp16_neon_groupnorm", [](const GroupNormSelectorData &data) { return data.dt == DataType::F16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_groupnorm)},
+#endif // ARM_COMPUTE_ENABLE_FP16
+};
+
+/** Micro-kernel selector
+ *
+ * @param[in] data Selection data passed to help pick the appropriate micro-kernel
+ *
+ * @return A matching micro-kernel else nullptr
+ */
+const GroupNormKernel *get_implementation(const GroupNormSelectorData &data)
+{
+    for (const auto &uk : available_kernels)
+    {
+        if (uk.is_selected(data))
+        {
+            return &uk;
+        }
+    }
+    return nullptr;
+}
+
+Status validate_arguments(const ITensorInfo                       *input,
+                          const ITensorInfo                       *output,
+                          const ITensorInfo                       *stats,
+                          const ITensorInfo                       *gamma,
+                          const ITensorInfo                       *beta,
+                          const GroupNormalizationLayerKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, stats);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.epsilon == 0.f, "Epsilon must be different than 0");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 4);
+
+    const size_t channels =
+        input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_groups == 0 || channels % info.num_groups != 0,
+                                    "The number of channels must be a multiple of the number of groups");
+
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(stats, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(stats->dimension(0) != 2 || stats->dimension(2) != info.num_groups ||
+                                stats->dimension(3) != input->dimension(3));
+
+    for (const ITensorInfo *param : {gamma, beta})
+    {
+        if (param != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, param);
+            ARM_COMPUTE_RETURN_ERROR_ON(param->num_dimensions() > 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(param->dimension(0) != channels);
+        }
+    }
+
+    if (output != nullptr && output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->num_channels() != output->num_channels(),
+                                        "Input and output have different number of channels");
+    }
+    return Status{};
+}
+} // namespace
+
+NEGroupNormalizationLayerKernel::NEGroupNormalizationLayerKernel()
+    : _input(nullptr),
+      _output(nullptr),
+      _stats(nullptr),
+      _workspace(nullptr),
+      _scratch_size(0),
+      _gamma(nullptr),
+      _beta(nullptr),
+      _info()
+{
+}
+
+void NEGroupNormalizationLayerKernel::configure(ITensor                                 *input,
+                                                ITensor                                 *output,
+                                                const ITensor                           *stats,
+                                                ITensor                                 *workspace,
+                                                const ITensor                           *gamma,
+                                                const ITensor                           *beta,
+                                                const GroupNormalizationLayerKernelInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, stats);
+
+    _input     = input;
+    _output    = output == nullptr ? input : output;
+    _stats     = stats;
+    _workspace = workspace;
+    _gamma     = gamma;
+    _beta      = beta;
+    _info      = info;
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*_output->info(), *input->info()->clone());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(_input->info(), _output->info(), stats->info(),
+                                                  gamma != nullptr ? gamma->info() : nullptr,
+                                                  beta != nullptr ? beta->info() : nullptr, info));
+
+    // The per-channel scale and offset of the current batch
+    const size_t channels = input->info()->dimension(
+        get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL));
+    _scratch_size = 2 * channels * sizeof(float);
+
+    // Rows are processed entirely by the micro-kernel, so the window only iterates over the outer dimensions
+    Window win = calculate_max_window(*_input->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    INEKernel::configure(win);
+}
+
+Status NEGroupNormalizationLayerKernel::validate(const ITensorInfo                       *input,
+                                                 const ITensorInfo                       *output,
+                                                 const ITensorInfo                       *stats,
+                                                 const ITensorInfo                       *gamma,
+                                                 const ITensorInfo                       *beta,
+                                                 const GroupNormalizationLayerKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, stats, gamma, beta, info));
+    return Status{};
+}
+
+size_t NEGroupNormalizationLayerKernel::split_dimension() const
+{
+    size_t dimension = Window::DimY;
+    for (size_t d = Window::DimZ; d <= 3; ++d)
+    {
+        if (window().num_iterations(d) > window().num_iterations(dimension))
+        {
+            dimension = d;
+        }
+    }
+    return dimension;
+}
+
+size_t NEGroupNormalizationLayerKernel::get_scratch_size_per_thread() const
+{
+    return _scratch_size;
+}
+
+void NEGroupNormalizationLayerKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const auto *uk = get_implementation(GroupNormSelectorData{_input->info()->data_type()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Threads beyond the ones the workspace was sized for at configure time fall back to a buffer of their own
+    std::vector<float> fallback_scratch{};
+    float             *scratch = nullptr;
+    if (_scratch_size != 0)
+    {
+        if (_workspace != nullptr && _workspace->info()->total_size() >= (info.thread_id + 1) * _scratch_size)
+        {
+            scratch = reinterpret_cast<float *>(_workspace->buffer() + info.thread_id * _scratch_size);
+        }
+        else
+        {
+            fallback_scratch.resize(_scratch_size / sizeof(float));
+            scratch = fallback_scratch.data();
+        }
+    }
+
+    uk->ukernel(_input, _output, _stats, _gamma, _beta, scratch, _info, window);
+}
+} // namespace arm_compute
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEGROUPNORMALIZATIONLAYERKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEGROUPNORMALIZATIONLAYERKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for normalizing a tensor with the group statistics computed by @ref NEGroupNormalizationStatisticsKernel
+ *
+ * The statistics of the splits are merged per group, then folded with the affine parameters into
+ * a per-channel scale and offset so that the normalization is a single multiply-add per element.
+ */
+class NEGroupNormalizationLayerKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGroupNormalizationLayerKernel";
+    }
+    /** Default constructor */
+    NEGroupNormalizationLayerKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupNormalizationLayerKernel(const NEGroupNormalizationLayerKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupNormalizationLayerKernel &operator=(const NEGroupNormalizationLayerKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGroupNormalizationLayerKernel(NEGroupNormalizationLayerKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGroupNormalizationLayerKernel &operator=(NEGroupNormalizationLayerKernel &&) = default;
+    /** Default destructor */
+    ~NEGroupNormalizationLayerKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in, out] input     Source tensor. In case of @p output tensor = nullptr this tensor will store the result of the normalization.
+     *                           Data types supported: F16/F32. Data layout supported: NCHW, NHWC
+     * @param[out]     output    Destination tensor. Data types and data layouts supported: same as @p input.
+     * @param[in]      stats     Statistics computed by @ref NEGroupNormalizationStatisticsKernel. Data type supported: F32
+     * @param[in]      workspace Working space holding @ref get_scratch_size_per_thread bytes per thread. It can be allocated after configure().
+     * @param[in]      gamma     (Optional) 1D tensor of per-channel scales. If nullptr, @p info.gamma is used. Data types supported: same as @p input.
+     * @param[in]      beta      (Optional) 1D tensor of per-channel offsets. If nullptr, @p info.beta is used. Data types supported: same as @p input.
+     * @param[in]      info      Kernel meta-data descriptor
+     */
+    void configure(ITensor                                 *input,
+                   ITensor                                 *output,
+                   const ITensor                           *stats,
+                   ITensor                                 *workspace,
+                   const ITensor                           *gamma,
+                   const ITensor                           *beta,
+                   const GroupNormalizationLayerKernelInfo &info);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGroupNormalizationLayerKernel.
+     *
+     * @param[in] input  Source tensor info. Data types supported: F16/F32. Data layout supported: NCHW, NHWC
+     * @param[in] output Destination tensor info. Data types and data layouts supported: same as @p input.
+     * @param[in] stats  Statistics tensor info. Data type supported: F32
+     * @param[in] gamma  (Optional) Per-channel scales tensor info. Data types supported: same as @p input.
+     * @param[in] beta   (Optional) Per-channel offsets tensor info. Data types supported: same as @p input.
+     * @param[in] info   Kernel meta-data descriptor
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                       *input,
+                           const ITensorInfo                       *output,
+                           const ITensorInfo                       *stats,
+                           const ITensorInfo                       *gamma,
+                           const ITensorInfo                       *beta,
+                           const GroupNormalizationLayerKernelInfo &info);
+
+    /** Dimension of the window with the most iterations, to be used to split the workload among threads
+     *
+     * @return The split dimension
+     */
+    size_t split_dimension() const;
+
+    /** Size in bytes of the working space needed by each thread running the kernel
+     *
+     * @return The size in bytes
+     */
+    size_t get_scratch_size_per_thread() const;
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    ITensor                          *_input;
+    ITensor                          *_output;
+    const ITensor                    *_stats;
+    ITensor                          *_workspace;
+    size_t                            _scratch_size;
+    const ITensor                    *_gamma;
+    const ITensor                    *_beta;
+    GroupNormalizationLayerKernelInfo _info;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEGROUPNORMALIZATIONLAYERKERNEL_H
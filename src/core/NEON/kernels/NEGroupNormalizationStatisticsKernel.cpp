@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEGroupNormalizationStatisticsKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/cpu/kernels/groupnorm/list.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Minimum number of elements reduced by a split */
+constexpr size_t min_split_size = 4096;
+
+struct GroupNormStatisticsSelectorData
+{
+    DataType dt;
+};
+
+using GroupNormStatisticsSelectorPtr = std::add_pointer<bool(const GroupNormStatisticsSelectorData &data)>::type;
+using GroupNormStatisticsUKernelPtr  = std::add_pointer<void(const ITensor *input,
+                                                            ITensor       *stats,
+                                                            float         *scratch,
+                                                            unsigned int   num_groups,
+                                                            unsigned int   num_splits,
+                                                            const Window  &window)>::type;
+
+struct GroupNormStatisticsKernel
+{
+    const char                          *name;
+    const GroupNormStatisticsSelectorPtr is_selected;
+    GroupNormStatisticsUKernelPtr        ukernel;
+};
+
+static const GroupNormStatisticsKernel available_kernels[] = {
+    {"fp32_neon_groupnorm_statistics",
+     [](const GroupNormStatisticsSelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::neon_fp32_groupnorm_statistics)},
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    {"fp16_neon_groupnorm_statistics",
+     [](const GroupNormStatisticsSelectorData &data) { return data.dt == DataType::F16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::neon_fp16_groupnorm_statistics)},
+#endif // ARM_COMPUTE_ENABLE_FP16
+};
+
+/** Micro-kernel selector
+ *
+ * @param[in] data Selection data passed to help pick the appropriate micro-kernel
+ *
+ * @return A matching micro-kernel else nullptr
+ */
+const GroupNormStatisticsKernel *get_implementation(const GroupNormStatisticsSelectorData &data)
+{
+    for (const auto &uk : available_kernels)
+    {
+        if (uk.is_selected(data))
+        {
+            return &uk;
+        }
+    }
+    return nullptr;
+}
+
+TensorShape compute_statistics_shape(const ITensorInfo *input, unsigned int num_groups, unsigned int num_splits)
+{
+    return TensorShape(2U, num_splits, num_groups, input->dimension(3));
+}
+
+/** Number of independent reductions: one per group in NCHW, one per batch covering all the groups in NHWC */
+size_t num_work_items(const ITensorInfo *input, unsigned int num_groups, unsigned int num_splits)
+{
+    const size_t groups = input->data_layout() == DataLayout::NCHW ? num_groups : 1U;
+    return input->dimension(3) * groups * num_splits;
+}
+
+Status
+validate_arguments(const ITensorInfo *input, const ITensorInfo *stats, unsigned int num_groups, unsigned int num_splits)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, stats);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->num_channels() != 1, "Input must have a single channel");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 4);
+
+    const size_t channels =
+        input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups == 0 || channels % num_groups != 0,
+                                    "The number of channels must be a multiple of the number of groups");
+    ARM_COMPUTE_RETURN_ERROR_ON(num_splits == 0);
+
+    if (stats->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(stats, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(stats->tensor_shape(),
+                                                           compute_statistics_shape(input, num_groups, num_splits));
+    }
+    return Status{};
+}
+} // namespace
+
+NEGroupNormalizationStatisticsKernel::NEGroupNormalizationStatisticsKernel()
+    : _input(nullptr), _stats(nullptr), _workspace(nullptr), _scratch_size(0), _num_groups(1), _num_splits(1)
+{
+}
+
+void NEGroupNormalizationStatisticsKernel::configure(const ITensor *input,
+                                                     ITensor       *stats,
+                                                     ITensor       *workspace,
+                                                     unsigned int   num_groups,
+                                                     unsigned int   num_splits)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, stats);
+
+    // Statistics auto initialization if not yet initialized
+    auto_init_if_empty(*stats->info(), compute_statistics_shape(input->info(), num_groups, num_splits), 1,
+                       DataType::F32);
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), stats->info(), num_groups, num_splits));
+
+    _input      = input;
+    _stats      = stats;
+    _workspace  = workspace;
+    _num_groups = num_groups;
+    _num_splits = num_splits;
+
+    // The NHWC reduction accumulates the shift, sum and sum of squares of every channel side by side
+    _scratch_size = input->info()->data_layout() == DataLayout::NHWC ? 3 * input->info()->dimension(0) * sizeof(float)
+                                                                     : 0;
+
+    // Each step of the window reduces one split
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_work_items(input->info(), num_groups, num_splits), 1));
+    INEKernel::configure(win);
+}
+
+Status NEGroupNormalizationStatisticsKernel::validate(const ITensorInfo *input,
+                                                      const ITensorInfo *stats,
+                                                      unsigned int       num_groups,
+                                                      unsigned int       num_splits)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, stats, num_groups, num_splits));
+    return Status{};
+}
+
+unsigned int NEGroupNormalizationStatisticsKernel::compute_num_splits(const ITensorInfo *input,
+                                                                      unsigned int       num_groups,
+                                                                      unsigned int       num_threads)
+{
+    const bool   is_nchw   = input->data_layout() == DataLayout::NCHW;
+    const size_t num_items = num_work_items(input, num_groups, 1U);
+
+    // Rows of the channel planes of a group in NCHW, spatial positions in NHWC
+    const size_t num_units =
+        is_nchw ? input->dimension(1) * (input->dimension(2) / num_groups) : input->dimension(1) * input->dimension(2);
+    const size_t item_size = input->tensor_shape().total_size_lower(3) / (is_nchw ? num_groups : 1U);
+
+    const size_t max_splits    = std::max<size_t>(1U, std::min(num_units, item_size / min_split_size));
+    const size_t wanted_splits = (num_threads + num_items - 1) / num_items;
+    return static_cast<unsigned int>(std::max<size_t>(1U, std::min(wanted_splits, max_splits)));
+}
+
+size_t NEGroupNormalizationStatisticsKernel::get_scratch_size_per_thread() const
+{
+    return _scratch_size;
+}
+
+void NEGroupNormalizationStatisticsKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const auto *uk = get_implementation(GroupNormStatisticsSelectorData{_input->info()->data_type()});
+    ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    // Threads beyond the ones the workspace was sized for at configure time fall back to a buffer of their own
+    std::vector<float> fallback_scratch{};
+    float             *scratch = nullptr;
+    if (_scratch_size != 0)
+    {
+        if (_workspace != nullptr && _workspace->info()->total_size() >= (info.thread_id + 1) * _scratch_size)
+        {
+            scratch = reinterpret_cast<float *>(_workspace->buffer() + info.thread_id * _scratch_size);
+        }
+        else
+        {
+            fallback_scratch.resize(_scratch_size / sizeof(float));
+            scratch = fallback_scratch.data();
+        }
+    }
+
+    uk->ukernel(_input, _stats, scratch, _num_groups, _num_splits, window);
+}
+} // namespace arm_compute
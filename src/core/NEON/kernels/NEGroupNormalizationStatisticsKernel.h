@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEGROUPNORMALIZATIONSTATISTICSKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEGROUPNORMALIZATIONSTATISTICSKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for computing the partial statistics of a group normalization
+ *
+ * Each group of each batch is divided into a number of splits which are reduced in parallel in a single pass.
+ * The statistics tensor holds the mean and the sum of squared deviations of every split and is
+ * of shape [2, num_splits, num_groups, batches].
+ */
+class NEGroupNormalizationStatisticsKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGroupNormalizationStatisticsKernel";
+    }
+    /** Default constructor */
+    NEGroupNormalizationStatisticsKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupNormalizationStatisticsKernel(const NEGroupNormalizationStatisticsKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGroupNormalizationStatisticsKernel &operator=(const NEGroupNormalizationStatisticsKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGroupNormalizationStatisticsKernel(NEGroupNormalizationStatisticsKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGroupNormalizationStatisticsKernel &operator=(NEGroupNormalizationStatisticsKernel &&) = default;
+    /** Default destructor */
+    ~NEGroupNormalizationStatisticsKernel() = default;
+    /** Set the input and statistics tensors.
+     *
+     * @param[in]  input      Source tensor with at most 4 dimensions. Data types supported: F16/F32. Data layout supported: NCHW, NHWC
+     * @param[out] stats      Statistics tensor. Data type supported: F32
+     * @param[in]  workspace  Working space holding @ref get_scratch_size_per_thread bytes per thread. It can be allocated after configure().
+     * @param[in]  num_groups Number of groups the channels are divided into. It must divide the number of channels.
+     * @param[in]  num_splits Number of chunks each group is reduced in.
+     */
+    void configure(
+        const ITensor *input, ITensor *stats, ITensor *workspace, unsigned int num_groups, unsigned int num_splits);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGroupNormalizationStatisticsKernel.
+     *
+     * @param[in] input      Source tensor info. Data types supported: F16/F32. Data layout supported: NCHW, NHWC
+     * @param[in] stats      Statistics tensor info. Data type supported: F32
+     * @param[in] num_groups Number of groups the channels are divided into.
+     * @param[in] num_splits Number of chunks each group is reduced in.
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *input, const ITensorInfo *stats, unsigned int num_groups, unsigned int num_splits);
+
+    /** Number of chunks to reduce each group in so that all the threads are busy
+     *
+     * Splits are only introduced when there are fewer groups than threads and are kept large enough
+     * to amortize the combination of their statistics.
+     *
+     * @param[in] input       Source tensor info.
+     * @param[in] num_groups  Number of groups the channels are divided into.
+     * @param[in] num_threads Number of threads the kernel is going to be scheduled on.
+     *
+     * @return The number of splits
+     */
+    static unsigned int
+    compute_num_splits(const ITensorInfo *input, unsigned int num_groups, unsigned int num_threads);
+
+    /** Size in bytes of the working space needed by each thread running the kernel
+     *
+     * @return The size in bytes
+     */
+    size_t get_scratch_size_per_thread() const;
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_stats;
+    ITensor       *_workspace;
+    size_t         _scratch_size;
+    unsigned int   _num_groups;
+    unsigned int   _num_splits;
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEGROUPNORMALIZATIONSTATISTICSKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022 Arm Limited.
+ * Copyright (c) 2019-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,9 @@
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 
+#include <algorithm>
+#include <type_traits>
+
 namespace arm_compute
 {
 namespace
@@ -46,8 +49,26 @@ Status validate_arguments(const ITensorInfo *input,
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() == DataType::UNKNOWN);
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(mode != PaddingMode::CONSTANT, "Only constant padding mode is supported");
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(paddings.size() > 4, "Padding list bigger than 4 dimensions");
+    if (mode == PaddingMode::CONSTANT)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(paddings.size() > 4, "Padding list bigger than 4 dimensions");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(mode != PaddingMode::REFLECT && mode != PaddingMode::SYMMETRIC,
+                                        "Padding mode not supported");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(paddings.size() > Coordinates::num_max_dimensions,
+                                        "Padding list bigger than the maximum number of dimensions");
+        ARM_COMPUTE_RETURN_ERROR_ON(input->element_size() != 1 && input->element_size() != 2 &&
+                                    input->element_size() != 4 && input->element_size() != 8);
+        // The padding can only reflect the input once
+        for (size_t i = 0; i < paddings.size(); ++i)
+        {
+            const size_t max_padding = mode == PaddingMode::REFLECT ? input->dimension(i) - 1 : input->dimension(i);
+            ARM_COMPUTE_RETURN_ERROR_ON(paddings[i].first > max_padding);
+            ARM_COMPUTE_RETURN_ERROR_ON(paddings[i].second > max_padding);
+        }
+    }
     if (output->total_size() != 0)
     {
         const TensorShape expected_output_shape =
@@ -58,6 +79,53 @@ Status validate_arguments(const ITensorInfo *input,
     }
     return Status{};
 }
+
+/** Map a coordinate of the padded tensor to the input coordinate it mirrors
+ *
+ * @param[in] idx        Coordinate relative to the first input element, can be negative.
+ * @param[in] size       Size of the input along the dimension.
+ * @param[in] is_reflect 1 for PaddingMode::REFLECT, which does not repeat the border values,
+ *                       0 for PaddingMode::SYMMETRIC.
+ *
+ * @return The input coordinate
+ */
+inline int mirror_index(int idx, int size, int is_reflect)
+{
+    if (idx < 0)
+    {
+        return -idx - 1 + is_reflect;
+    }
+    if (idx >= size)
+    {
+        return 2 * size - 1 - idx - is_reflect;
+    }
+    return idx;
+}
+
+/** Copy the @p n elements preceding @p src_end to @p dst in reverse order */
+template <typename T, typename std::enable_if<sizeof(T) <= 4, int>::type = 0>
+void reverse_copy_n(T *dst, const T *src_end, int n)
+{
+    constexpr int vec_size = 16 / sizeof(T);
+
+    int x = 0;
+    for (; x <= n - vec_size; x += vec_size)
+    {
+        // Reverse the lanes of each 64-bit half, then swap the halves
+        const auto v = wrapper::vrev64(wrapper::vloadq(src_end - x - vec_size));
+        wrapper::vstore(dst + x, wrapper::vcombine(wrapper::vgethigh(v), wrapper::vgetlow(v)));
+    }
+    for (; x < n; ++x)
+    {
+        dst[x] = src_end[-1 - x];
+    }
+}
+
+template <typename T, typename std::enable_if<(sizeof(T) > 4), int>::type = 0>
+void reverse_copy_n(T *dst, const T *src_end, int n)
+{
+    std::reverse_copy(src_end - n, src_end, dst);
+}
 } // namespace
 
 template <typename T>
@@ -189,8 +257,50 @@ void NEPadLayerKernel::run_pad_constant_uint8_3Dinput_3Dpad(const Window &window
     }
 }
 
+template <typename T>
+void NEPadLayerKernel::run_pad_reflect(const Window &window)
+{
+    Window output_window{window};
+    output_window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    const ITensorInfo &input_info = *_input->info();
+    const int          width      = input_info.dimension(0);
+    const int          pad_left   = _padding.empty() ? 0 : _padding[0].first;
+    const int          pad_right  = _padding.empty() ? 0 : _padding[0].second;
+    const int          is_reflect = _mode == PaddingMode::REFLECT ? 1 : 0;
+
+    // Each output row is the copy of a single input row, mirrored along the outer dimensions
+    Iterator output_it(_output, output_window);
+    execute_window_loop(
+        output_window,
+        [&](const Coordinates &id)
+        {
+            Coordinates idin{id};
+            for (size_t dim = 1; dim < _padding.size(); ++dim)
+            {
+                idin.set(dim, mirror_index(id[dim] - static_cast<int>(_padding[dim].first),
+                                           input_info.dimension(dim), is_reflect));
+            }
+            idin.set(Window::DimX, 0);
+
+            const T *input_row  = reinterpret_cast<const T *>(_input->ptr_to_element(idin));
+            T       *output_row = reinterpret_cast<T *>(output_it.ptr());
+
+            reverse_copy_n(output_row, input_row + pad_left + is_reflect, pad_left);
+            memcpy(output_row + pad_left, input_row, width * sizeof(T));
+            reverse_copy_n(output_row + pad_left + width, input_row + width - is_reflect, pad_right);
+        },
+        output_it);
+}
+
 NEPadLayerKernel::NEPadLayerKernel()
-    : _func(), _input(nullptr), _output(nullptr), _padding(), _constant_value(), _mode()
+    : _func(),
+      _input(nullptr),
+      _output(nullptr),
+      _padding(),
+      _constant_value(),
+      _mode(),
+      _split_dimension(Window::DimZ)
 {
 }
 
@@ -210,11 +320,12 @@ void NEPadLayerKernel::configure(ITensor           *input,
     // Perform validation step
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), padding, mode));
 
-    _input          = input;
-    _output         = output;
-    _padding        = padding;
-    _constant_value = constant_value;
-    _mode           = mode;
+    _input           = input;
+    _output          = output;
+    _padding         = padding;
+    _constant_value  = constant_value;
+    _mode            = mode;
+    _split_dimension = Window::DimZ;
 
     if (_mode == PaddingMode::CONSTANT)
     {
@@ -245,7 +356,33 @@ void NEPadLayerKernel::configure(ITensor           *input,
     }
     else
     {
-        ARM_COMPUTE_ERROR("Padding mode not supported");
+        switch (_input->info()->element_size())
+        {
+            case 1:
+                _func = &NEPadLayerKernel::run_pad_reflect<uint8_t>;
+                break;
+            case 2:
+                _func = &NEPadLayerKernel::run_pad_reflect<uint16_t>;
+                break;
+            case 4:
+                _func = &NEPadLayerKernel::run_pad_reflect<uint32_t>;
+                break;
+            case 8:
+                _func = &NEPadLayerKernel::run_pad_reflect<uint64_t>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Element size not supported");
+                break;
+        }
+
+        // Rows are independent: split along the largest outer dimension
+        for (size_t dim = Window::DimY; dim <= Window::DimW; ++dim)
+        {
+            if (output->info()->dimension(dim) > output->info()->dimension(_split_dimension))
+            {
+                _split_dimension = dim;
+            }
+        }
     }
 
     // Configure kernel window
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2023 Arm Limited.
+ * Copyright (c) 2019-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,7 +32,10 @@ namespace arm_compute
 {
 class ITensor;
 
-/** Basic kernel to pad the input tensor given padding information. */
+/** Basic kernel to pad the input tensor given padding information.
+ *
+ * All the padding modes are computed in a single pass over the output tensor.
+ */
 class NEPadLayerKernel : public INEKernel
 {
 public:
@@ -60,8 +63,8 @@ public:
      * @param[in]  padding        The padding for each spatial dimension of the input tensor. The pair padding[i]
      *                            specifies the front and the end padding in the i-th dimension.
      * @param[in]  constant_value (Optional) Constant value to be used for the padding
-     * @param[in]  mode           (Optional) Controls whether the padding should be filled with @p constant_value using CONSTANT.
-     *                           Only CONSTANT padding mode is currently supported
+     * @param[in]  mode           (Optional) Controls whether the padding should be filled with @p constant_value using CONSTANT,
+     *                            or reflect the input, either including the border values (SYMMETRIC) or not (REFLECT).
      */
     void configure(ITensor           *input,
                    ITensor           *output,
@@ -75,8 +78,8 @@ public:
      * @param[in] padding        The padding for each spatial dimension of the input tensor. The pair padding[i]
      *                           specifies the front and the end padding in the i-th dimension.
      * @param[in] constant_value (Optional) Constant value to be used for the padding
-     * @param[in] mode           (Optional) Controls whether the padding should be filled with @p constant_value using CONSTANT.
-     *                           Only CONSTANT padding mode is currently supported
+     * @param[in] mode           (Optional) Controls whether the padding should be filled with @p constant_value using CONSTANT,
+     *                           or reflect the input, either including the border values (SYMMETRIC) or not (REFLECT).
      *
      * @return a status
      */
@@ -86,6 +89,15 @@ public:
                            const PixelValue   constant_value = PixelValue(),
                            const PaddingMode  mode           = PaddingMode::CONSTANT);
 
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension hint.
+     */
+    size_t get_split_dimension() const
+    {
+        return _split_dimension;
+    }
+
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
@@ -112,6 +124,13 @@ private:
      */
     void run_pad_constant_uint8_3Dinput_3Dpad(const Window &window);
 
+    /** Template function to run the padding function with reflect or symmetric padding
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     */
+    template <typename T>
+    void run_pad_reflect(const Window &window);
+
     /** Common signature for all the specialised permute functions
      *
      * @param[in] window Region on which to execute the kernel.
@@ -124,6 +143,7 @@ private:
     PaddingList    _padding;
     PixelValue     _constant_value;
     PaddingMode    _mode;
+    size_t         _split_dimension;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEPADLAYERKERNEL_H */
@@ -0,0 +1,523 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEQLSTMCellKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/NEAsymm.h"
+#include "src/core/NEON/NEMath.h"
+#include "src/core/NEON/NESymm.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+
+#include <cmath>
+#include <limits>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr size_t forget_gate = 0;
+constexpr size_t cell_gate   = 1;
+constexpr size_t input_gate  = 2;
+constexpr size_t output_gate = 3;
+
+// Quantization scales of the layer normalization output and of the activated gates
+constexpr float layer_norm_scale = 1.f / 4096;
+constexpr float gate_scale       = 1.f / 32768;
+
+size_t num_stored_gates(bool has_cifg)
+{
+    return has_cifg ? QLSTMCellKernelInfo::num_gates - 1 : QLSTMCellKernelInfo::num_gates;
+}
+
+/** Position of @p gate along X in the tensors holding all the gates */
+size_t gate_position(size_t gate, bool has_cifg)
+{
+    return (has_cifg && gate == output_gate) ? input_gate : gate;
+}
+
+Status validate_arguments(const ITensorInfo                                     *input_to_gates,
+                          const ITensorInfo                                     *recurrent_to_gates,
+                          const ITensorInfo                                     *input_to_gates_bias,
+                          const ITensorInfo                                     *recurrent_to_gates_bias,
+                          const ITensorInfo                                     *cell_state_in,
+                          const ITensorInfo                                     *gates,
+                          const ITensorInfo                                     *cell_state_out,
+                          const ITensorInfo                                     *hidden,
+                          const NEQLSTMCellKernel::GateArray<const ITensorInfo> &layer_norm_weights,
+                          const NEQLSTMCellKernel::GateArray<const ITensorInfo> &layer_norm_bias,
+                          const QLSTMCellKernelInfo                             &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input_to_gates, recurrent_to_gates, input_to_gates_bias,
+                                        recurrent_to_gates_bias, cell_state_in, gates, cell_state_out, hidden);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input_to_gates, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(cell_state_in, 1, DataType::QSYMM16);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(hidden, 1, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input_to_gates, recurrent_to_gates, input_to_gates_bias,
+                                                       recurrent_to_gates_bias);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(cell_state_in, gates, cell_state_out);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->num_dimensions() > 2);
+
+    const size_t num_units  = cell_state_in->dimension(0);
+    const size_t batch_size = cell_state_in->dimension(1);
+    const TensorShape gates_shape(num_stored_gates(info.has_cifg) * num_units, batch_size);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input_to_gates->tensor_shape(), gates_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(recurrent_to_gates->tensor_shape(), gates_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(gates->tensor_shape(), gates_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_to_gates_bias->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_to_gates_bias->dimension(0) != gates_shape.x());
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input_to_gates_bias, recurrent_to_gates_bias);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state_in, cell_state_out, hidden);
+
+    for (size_t gate = 0; gate < QLSTMCellKernelInfo::num_gates; ++gate)
+    {
+        if (info.has_cifg && gate == input_gate)
+        {
+            continue;
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON(info.intermediate_scales[gate] <= 0.f);
+        if (info.has_layer_norm)
+        {
+            const ITensorInfo *weight = layer_norm_weights[gate];
+            const ITensorInfo *bias   = layer_norm_bias[gate];
+            ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weight, bias);
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weight, 1, DataType::QSYMM16);
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::S32);
+            ARM_COMPUTE_RETURN_ERROR_ON(weight->num_dimensions() > 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(weight->dimension(0) != num_units);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(weight, bias);
+        }
+    }
+
+    return Status{};
+}
+
+inline int64x2x2_t mul_add(const int32x4_t &a, const int32x4_t &b, const int32x4_t &bias)
+{
+    using namespace wrapper;
+    const int64x2_t a_low  = vmovl(vgetlow(a));
+    const int64x2_t a_high = vmovl(vgethigh(a));
+    const int64x2_t b_low  = vmovl(vgetlow(b));
+    const int64x2_t b_high = vmovl(vgethigh(b));
+
+    const int64x2_t result_0{vgetlane(a_low, 0) * vgetlane(b_low, 0), vgetlane(a_low, 1) * vgetlane(b_low, 1)};
+    const int64x2_t result_1{vgetlane(a_high, 0) * vgetlane(b_high, 0), vgetlane(a_high, 1) * vgetlane(b_high, 1)};
+
+    int64x2x2_t result;
+    result.val[0] = vadd(vmovl(vgetlow(bias)), result_0);
+    result.val[1] = vadd(vmovl(vgethigh(bias)), result_1);
+    return result;
+}
+
+/** Requantize the input and recurrent contributions of a gate to QSYMM16 and accumulate them */
+void accumulate_gate(const int32_t *input_acc,
+                     const int32_t *recurrent_acc,
+                     const int32_t *input_bias,
+                     const int32_t *recurrent_bias,
+                     int16_t       *dst,
+                     int            len,
+                     int32_t        input_multiplier,
+                     int32_t        input_shift,
+                     int32_t        recurrent_multiplier,
+                     int32_t        recurrent_shift)
+{
+    const int16x8_t min_s16 = vdupq_n_s16(std::numeric_limits<int16_t>::lowest());
+    const int16x8_t max_s16 = vdupq_n_s16(std::numeric_limits<int16_t>::max());
+
+    int x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        int32x4x2_t input_s32 = {{vaddq_s32(vld1q_s32(input_acc + x), vld1q_s32(input_bias + x)),
+                                  vaddq_s32(vld1q_s32(input_acc + x + 4), vld1q_s32(input_bias + x + 4))}};
+        int32x4x2_t recurrent_s32 = {
+            {vaddq_s32(vld1q_s32(recurrent_acc + x), vld1q_s32(recurrent_bias + x)),
+             vaddq_s32(vld1q_s32(recurrent_acc + x + 4), vld1q_s32(recurrent_bias + x + 4))}};
+
+        const int16x8_t input_s16 =
+            finalize_quantization_int16<false>(input_s32, input_multiplier, input_shift, min_s16, max_s16);
+        const int16x8_t recurrent_s16 = finalize_quantization_int16<false>(recurrent_s32, recurrent_multiplier,
+                                                                           recurrent_shift, min_s16, max_s16);
+        vst1q_s16(dst + x, vqaddq_s16(input_s16, recurrent_s16));
+    }
+
+    for (; x < len; ++x)
+    {
+        const int16_t input_s16     = finalize_quantization_int16<false>(input_acc[x] + input_bias[x],
+                                                                         input_multiplier, input_shift, 0, 0);
+        const int16_t recurrent_s16 = finalize_quantization_int16<false>(
+            recurrent_acc[x] + recurrent_bias[x], recurrent_multiplier, recurrent_shift, 0, 0);
+        dst[x] = utility::clamp<int32_t, int16_t>(static_cast<int32_t>(input_s16) + recurrent_s16);
+    }
+}
+
+/** Normalize a gate in-place, matching NEQLSTMLayerNormalizationKernel */
+void layer_norm_gate(int16_t       *ptr,
+                     int            len,
+                     const int16_t *weight_ptr,
+                     const int32_t *bias_ptr,
+                     int32_t        output_multiplier,
+                     int32_t        output_shift)
+{
+    using namespace wrapper;
+
+    int64_t sum{0};
+    int64_t sum_sq{0};
+
+    int x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        const int16x8_t val      = vloadq(ptr + x);
+        const int32x4_t val_low  = vmovl(vgetlow(val));
+        const int32x4_t val_high = vmovl(vgethigh(val));
+
+#if defined(__aarch64__)
+        sum += static_cast<int64_t>(vaddv(val_low));
+        sum += static_cast<int64_t>(vaddv(val_high));
+
+        sum_sq += static_cast<int64_t>(vaddv(vmul(val_low, val_low)));
+        sum_sq += static_cast<int64_t>(vaddv(vmul(val_high, val_high)));
+#else  // __aarch64__
+        const int64x2_t pair_sum = vadd(vpaddl(val_low), vpaddl(val_high));
+        sum += vgetlane(pair_sum, 0) + vgetlane(pair_sum, 1);
+
+        const int64x2_t pair_sum_sq = vadd(vpaddl(vmul(val_low, val_low)), vpaddl(vmul(val_high, val_high)));
+        sum_sq += vgetlane(pair_sum_sq, 0) + vgetlane(pair_sum_sq, 1);
+#endif // __aarch64__
+    }
+    for (; x < len; ++x)
+    {
+        sum += static_cast<int64_t>(ptr[x]);
+        sum_sq += static_cast<int64_t>(ptr[x] * ptr[x]);
+    }
+
+    const int64_t temp     = static_cast<int64_t>(0x100000) / len;
+    const int64_t mean     = sum * 1024 / static_cast<int64_t>(len);
+    const int64_t variance = ((sum_sq * temp) - (mean * mean)) / 0x100000;
+
+    int32_t inv_std_mul{};
+    int32_t inv_std_shift{};
+    quantization::get_invsqrt_quantized_multiplier_exp(static_cast<int32_t>(variance), -1, inv_std_mul, inv_std_shift);
+
+    const int32x4_t mean_vec = vdup_n(static_cast<int32_t>(mean), wrapper::traits::vector_128_tag{});
+
+    x = 0;
+    for (; x <= len - 8; x += 8)
+    {
+        const int16x8_t val = vloadq(ptr + x);
+        int32x4x2_t     shifted;
+        shifted.val[0] = vsub(vshlq_n_s32(vmovl(vgetlow(val)), 10), mean_vec);
+        shifted.val[1] = vsub(vshlq_n_s32(vmovl(vgethigh(val)), 10), mean_vec);
+
+        const int32x4x2_t rescaled = multiply_by_quantized_multiplier_2row(shifted, inv_std_mul, inv_std_shift);
+
+        const int16x8_t weight_val = vloadq(weight_ptr + x);
+
+        const int64x2x2_t result_0 = mul_add(rescaled.val[0], vmovl(vgetlow(weight_val)), vloadq(bias_ptr + x));
+        const int64x2x2_t result_1 = mul_add(rescaled.val[1], vmovl(vgethigh(weight_val)), vloadq(bias_ptr + x + 4));
+
+        int32x4x2_t combined;
+        combined.val[0] = vcombine(vmovn(vrshrq_n_s64(result_0.val[0], 10)), vmovn(vrshrq_n_s64(result_0.val[1], 10)));
+        combined.val[1] = vcombine(vmovn(vrshrq_n_s64(result_1.val[0], 10)), vmovn(vrshrq_n_s64(result_1.val[1], 10)));
+
+        const int32x4x2_t out_val =
+            multiply_by_quantized_multiplier_2row(combined, output_multiplier, output_shift + 12);
+
+        vstore(ptr + x, vqmovn(out_val.val[0]));
+        vstore(ptr + x + 4, vqmovn(out_val.val[1]));
+    }
+    for (; x < len; ++x)
+    {
+        const int32_t shifted  = (static_cast<int32_t>(ptr[x]) << 10) - static_cast<int32_t>(mean);
+        const int32_t rescaled = quantization::multiply_by_quantized_multiplier(shifted, inv_std_mul, inv_std_shift);
+        const int64_t weighted = static_cast<int64_t>(rescaled) * weight_ptr[x] + bias_ptr[x];
+        const int32_t out_val  = quantization::multiply_by_quantized_multiplier(
+            static_cast<int32_t>((weighted + 512) >> 10), output_multiplier, output_shift + 12);
+        ptr[x] = utility::clamp<int32_t, int16_t>(out_val);
+    }
+}
+
+inline int16x8_t vsigmoid_qsymm16(const int16x8_t &in, float in_scale)
+{
+    const float32x4_t   vconst_1 = vdupq_n_f32(1.f);
+    const float32x4x2_t in_f32   = vdequantize_int16(in, in_scale);
+    const float32x4x2_t out_f32  = {{
+        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(in_f32.val[0])))),
+        wrapper::vdiv(vconst_1, wrapper::vadd(vconst_1, wrapper::vexpq(wrapper::vneg(in_f32.val[1])))),
+    }};
+    return vquantize_int16(out_f32, gate_scale);
+}
+
+inline int16x8_t vtanh_qsymm16(const int16x8_t &in, float in_scale)
+{
+    const float32x4x2_t in_f32  = vdequantize_int16(in, in_scale);
+    const float32x4x2_t out_f32 = {{wrapper::vtanh(in_f32.val[0]), wrapper::vtanh(in_f32.val[1])}};
+    return vquantize_int16(out_f32, gate_scale);
+}
+
+inline int16x8_t vmul_qsymm16(const int16x8_t &a, float a_scale, const int16x8_t &b, float b_scale, float out_scale)
+{
+    const float32x4x2_t a_f32 = vdequantize_int16(a, a_scale);
+    const float32x4x2_t b_f32 = vdequantize_int16(b, b_scale);
+    return vquantize_int16({{vmulq_f32(a_f32.val[0], b_f32.val[0]), vmulq_f32(a_f32.val[1], b_f32.val[1])}},
+                           out_scale);
+}
+
+inline int16x8_t vadd_qsymm16(const int16x8_t &a, float a_scale, const int16x8_t &b, float b_scale, float out_scale)
+{
+    const float32x4x2_t a_f32 = vdequantize_int16(a, a_scale);
+    const float32x4x2_t b_f32 = vdequantize_int16(b, b_scale);
+    return vquantize_int16({{vaddq_f32(a_f32.val[0], b_f32.val[0]), vaddq_f32(a_f32.val[1], b_f32.val[1])}},
+                           out_scale);
+}
+} // namespace
+
+void NEQLSTMCellKernel::configure(const ITensor                  *input_to_gates,
+                                  const ITensor                  *recurrent_to_gates,
+                                  const ITensor                  *input_to_gates_bias,
+                                  const ITensor                  *recurrent_to_gates_bias,
+                                  const ITensor                  *cell_state_in,
+                                  ITensor                        *gates,
+                                  ITensor                        *cell_state_out,
+                                  ITensor                        *hidden,
+                                  const GateArray<const ITensor> &layer_norm_weights,
+                                  const GateArray<const ITensor> &layer_norm_bias,
+                                  const QLSTMCellKernelInfo      &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input_to_gates, recurrent_to_gates, input_to_gates_bias, recurrent_to_gates_bias,
+                                 cell_state_in, gates, cell_state_out, hidden);
+
+    GateArray<const ITensorInfo> layer_norm_weights_info{};
+    GateArray<const ITensorInfo> layer_norm_bias_info{};
+    for (size_t gate = 0; gate < QLSTMCellKernelInfo::num_gates; ++gate)
+    {
+        const ITensor *weight         = layer_norm_weights[gate];
+        const ITensor *bias           = layer_norm_bias[gate];
+        layer_norm_weights_info[gate] = weight != nullptr ? weight->info() : nullptr;
+        layer_norm_bias_info[gate]    = bias != nullptr ? bias->info() : nullptr;
+    }
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input_to_gates->info(), recurrent_to_gates->info(),
+                                                  input_to_gates_bias->info(), recurrent_to_gates_bias->info(),
+                                                  cell_state_in->info(), gates->info(), cell_state_out->info(),
+                                                  hidden->info(), layer_norm_weights_info, layer_norm_bias_info,
+                                                  info));
+
+    _input_to_gates          = input_to_gates;
+    _recurrent_to_gates      = recurrent_to_gates;
+    _input_to_gates_bias     = input_to_gates_bias;
+    _recurrent_to_gates_bias = recurrent_to_gates_bias;
+    _cell_state_in           = cell_state_in;
+    _gates                   = gates;
+    _cell_state_out          = cell_state_out;
+    _hidden                  = hidden;
+    _info                    = info;
+
+    for (size_t gate = 0; _info.has_layer_norm && gate < QLSTMCellKernelInfo::num_gates; ++gate)
+    {
+        if (_info.has_cifg && gate == input_gate)
+        {
+            continue;
+        }
+
+        const ITensor *weight     = layer_norm_weights[gate];
+        _layer_norm_weights[gate] = weight;
+        _layer_norm_bias[gate]    = layer_norm_bias[gate];
+
+        // Activations read the normalized gates
+        _info.intermediate_scales[gate] = layer_norm_scale;
+
+        const float  weight_scale = weight->info()->quantization_info().uniform().scale;
+        const Status s            = quantization::calculate_quantized_multiplier(
+            weight_scale, &_layer_norm_multipliers[gate], &_layer_norm_shifts[gate]);
+        _layer_norm_shifts[gate] *= -1;
+
+        if (!bool(s))
+        {
+            _layer_norm_multipliers[gate] = 0;
+            _layer_norm_shifts[gate]      = 0;
+        }
+    }
+
+    // Each batch is computed by a single thread
+    Window win = calculate_max_window(*cell_state_out->info(), Steps(cell_state_out->info()->dimension(0)));
+    INEKernel::configure(win);
+}
+
+Status NEQLSTMCellKernel::validate(const ITensorInfo                  *input_to_gates,
+                                   const ITensorInfo                  *recurrent_to_gates,
+                                   const ITensorInfo                  *input_to_gates_bias,
+                                   const ITensorInfo                  *recurrent_to_gates_bias,
+                                   const ITensorInfo                  *cell_state_in,
+                                   const ITensorInfo                  *gates,
+                                   const ITensorInfo                  *cell_state_out,
+                                   const ITensorInfo                  *hidden,
+                                   const GateArray<const ITensorInfo> &layer_norm_weights,
+                                   const GateArray<const ITensorInfo> &layer_norm_bias,
+                                   const QLSTMCellKernelInfo          &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input_to_gates, recurrent_to_gates, input_to_gates_bias,
+                                                   recurrent_to_gates_bias, cell_state_in, gates, cell_state_out,
+                                                   hidden, layer_norm_weights, layer_norm_bias, info));
+    return Status{};
+}
+
+void NEQLSTMCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int  num_units      = static_cast<int>(_cell_state_in->info()->dimension(0));
+    const bool has_cifg       = _info.has_cifg;
+    const bool has_layer_norm = _info.has_layer_norm;
+
+    const float cell_scale = _cell_state_in->info()->quantization_info().uniform().scale;
+    const float scale_f    = _info.intermediate_scales[forget_gate];
+    const float scale_g    = _info.intermediate_scales[cell_gate];
+    const float scale_i    = _info.intermediate_scales[input_gate];
+    const float scale_o    = _info.intermediate_scales[output_gate];
+
+    const UniformQuantizationInfo qcell(cell_scale, 0);
+    const UniformQuantizationInfo qgate(gate_scale, 0);
+
+    const auto input_bias = reinterpret_cast<const int32_t *>(_input_to_gates_bias->ptr_to_element(Coordinates(0)));
+    const auto recurrent_bias =
+        reinterpret_cast<const int32_t *>(_recurrent_to_gates_bias->ptr_to_element(Coordinates(0)));
+
+    const int16x8_t ones_s16      = vdupq_n_s16(std::numeric_limits<int16_t>::max());
+    const int32x4_t hidden_offset = vdupq_n_s32(_info.hidden_offset);
+    const int8x16_t min_s8        = vdupq_n_s8(std::numeric_limits<int8_t>::lowest());
+    const int8x16_t max_s8        = vdupq_n_s8(std::numeric_limits<int8_t>::max());
+
+    const auto sigmoid = [&](int16_t v, float scale)
+    { return quantize_qsymm16(1.f / (1.f + std::exp(-v * scale)), qgate); };
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            const Coordinates row(0, id.y());
+
+            const auto input_acc     = reinterpret_cast<const int32_t *>(_input_to_gates->ptr_to_element(row));
+            const auto recurrent_acc = reinterpret_cast<const int32_t *>(_recurrent_to_gates->ptr_to_element(row));
+            const auto gates         = reinterpret_cast<int16_t *>(_gates->ptr_to_element(row));
+            const auto cell_in       = reinterpret_cast<const int16_t *>(_cell_state_in->ptr_to_element(row));
+            const auto cell_out      = reinterpret_cast<int16_t *>(_cell_state_out->ptr_to_element(row));
+            const auto hidden        = reinterpret_cast<int8_t *>(_hidden->ptr_to_element(row));
+
+            // Gate pre-activations
+            for (size_t gate = 0; gate < QLSTMCellKernelInfo::num_gates; ++gate)
+            {
+                if (has_cifg && gate == input_gate)
+                {
+                    continue;
+                }
+
+                const size_t offset = gate_position(gate, has_cifg) * num_units;
+                accumulate_gate(input_acc + offset, recurrent_acc + offset, input_bias + offset,
+                                recurrent_bias + offset, gates + offset, num_units, _info.input_multipliers[gate],
+                                _info.input_shifts[gate], _info.recurrent_multipliers[gate],
+                                _info.recurrent_shifts[gate]);
+
+                if (has_layer_norm)
+                {
+                    const ITensor *weight = _layer_norm_weights[gate];
+                    const ITensor *bias   = _layer_norm_bias[gate];
+                    layer_norm_gate(
+                        gates + offset, num_units,
+                        reinterpret_cast<const int16_t *>(weight->ptr_to_element(Coordinates(0))),
+                        reinterpret_cast<const int32_t *>(bias->ptr_to_element(Coordinates(0))),
+                        _layer_norm_multipliers[gate], _layer_norm_shifts[gate]);
+                }
+            }
+
+            const int16_t *forget_ptr = gates + gate_position(forget_gate, has_cifg) * num_units;
+            const int16_t *cell_ptr   = gates + gate_position(cell_gate, has_cifg) * num_units;
+            const int16_t *input_ptr  = gates + gate_position(input_gate, has_cifg) * num_units;
+            const int16_t *output_ptr = gates + gate_position(output_gate, has_cifg) * num_units;
+
+            // Activations, cell state update and hidden state product on 8 elements
+            const auto compute_8 = [&](int x) -> int32x4x2_t
+            {
+                const int16x8_t f = vsigmoid_qsymm16(vld1q_s16(forget_ptr + x), scale_f);
+                const int16x8_t g = vtanh_qsymm16(vld1q_s16(cell_ptr + x), scale_g);
+                const int16x8_t i = has_cifg ? vqsubq_s16(ones_s16, f)
+                                             : vsigmoid_qsymm16(vld1q_s16(input_ptr + x), scale_i);
+                const int16x8_t o = vsigmoid_qsymm16(vld1q_s16(output_ptr + x), scale_o);
+
+                // The forget contribution is kept in the gate scale as done by NEQLSTMLayer
+                const int16x8_t forget_cell =
+                    vmul_qsymm16(f, gate_scale, vld1q_s16(cell_in + x), cell_scale, gate_scale);
+                const int16x8_t input_cell = vmul_qsymm16(i, gate_scale, g, gate_scale, cell_scale);
+                const int16x8_t c = vadd_qsymm16(forget_cell, gate_scale, input_cell, cell_scale, cell_scale);
+                vst1q_s16(cell_out + x, c);
+
+                const int16x8_t h = vtanh_qsymm16(c, cell_scale);
+                return {{vmull_s16(vget_low_s16(o), vget_low_s16(h)),
+                         vmull_s16(vget_high_s16(o), vget_high_s16(h))}};
+            };
+
+            int x = 0;
+            for (; x <= num_units - 16; x += 16)
+            {
+                const int32x4x2_t lo = compute_8(x);
+                const int32x4x2_t hi = compute_8(x + 8);
+
+                int32x4x4_t hidden_s32 = {{lo.val[0], lo.val[1], hi.val[0], hi.val[1]}};
+                vst1q_s8(hidden + x, finalize_quantization(hidden_s32, _info.hidden_multiplier, _info.hidden_shift,
+                                                           hidden_offset, min_s8, max_s8, false));
+            }
+
+            for (; x < num_units; ++x)
+            {
+                const int16_t f = sigmoid(forget_ptr[x], scale_f);
+                const int16_t g = quantize_qsymm16(std::tanh(cell_ptr[x] * scale_g), qgate);
+                const int16_t i = has_cifg ? static_cast<int16_t>(std::numeric_limits<int16_t>::max() - f)
+                                           : sigmoid(input_ptr[x], scale_i);
+                const int16_t o = sigmoid(output_ptr[x], scale_o);
+
+                const int16_t forget_cell =
+                    quantize_qsymm16(dequantize_qsymm16(f, qgate) * dequantize_qsymm16(cell_in[x], qcell), qgate);
+                const int16_t input_cell =
+                    quantize_qsymm16(dequantize_qsymm16(i, qgate) * dequantize_qsymm16(g, qgate), qcell);
+                const int16_t c = quantize_qsymm16(
+                    dequantize_qsymm16(forget_cell, qgate) + dequantize_qsymm16(input_cell, qcell), qcell);
+                cell_out[x] = c;
+
+                const int16_t h = quantize_qsymm16(std::tanh(dequantize_qsymm16(c, qcell)), qgate);
+                hidden[x] = finalize_quantization(static_cast<int32_t>(o) * h, _info.hidden_multiplier,
+                                                  _info.hidden_shift, _info.hidden_offset, 0, 0, false);
+            }
+        });
+}
+} // namespace arm_compute
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NEQLSTMCELLKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NEQLSTMCELLKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+#include <array>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Descriptor of the quantized LSTM cell computed by @ref NEQLSTMCellKernel
+ *
+ * Per-gate parameters are indexed in the order forget, cell, input and output. The gates are stored next to each
+ * other along X in the same order, the input gate being skipped when CIFG is used.
+ */
+struct QLSTMCellKernelInfo
+{
+    static constexpr size_t num_gates{4}; /**< Maximum number of gates */
+
+    bool                           has_cifg{false};         /**< True if the input gate is coupled to the forget gate */
+    bool                           has_layer_norm{false};   /**< True if the gates are normalized */
+    std::array<int32_t, num_gates> input_multipliers{};     /**< Per-gate multipliers of the input contribution */
+    std::array<int32_t, num_gates> input_shifts{};          /**< Per-gate shifts of the input contribution */
+    std::array<int32_t, num_gates> recurrent_multipliers{}; /**< Per-gate multipliers of the recurrent contribution */
+    std::array<int32_t, num_gates> recurrent_shifts{};      /**< Per-gate shifts of the recurrent contribution */
+    std::array<float, num_gates>   intermediate_scales{};   /**< Per-gate scales of the gate pre-activations */
+    int32_t                        hidden_multiplier{0};    /**< Multiplier of the hidden state output stage */
+    int32_t                        hidden_shift{0};         /**< Shift of the hidden state output stage */
+    int32_t                        hidden_offset{0};        /**< Zero point of the hidden state */
+};
+
+/** Kernel to compute a quantized LSTM cell in a single pass over each batch
+ *
+ * Starting from the 32-bit accumulators of the input and recurrent matrix multiplications of all the gates,
+ * for each batch the kernel:
+ *
+ * -# Requantizes and accumulates the input and recurrent contributions of each gate to QSYMM16
+ * -# Optionally applies the layer normalization of each gate
+ * -# Applies the gate activations and updates the cell state
+ * -# Computes the hidden state and quantizes it to QASYMM8_SIGNED
+ *
+ * The arithmetic matches the one of the functions used by @ref NEQLSTMLayer when run separately.
+ */
+class NEQLSTMCellKernel : public INEKernel
+{
+public:
+    /** Per-gate array of pointers */
+    template <typename T>
+    using GateArray = std::array<T *, QLSTMCellKernelInfo::num_gates>;
+
+    const char *name() const override
+    {
+        return "NEQLSTMCellKernel";
+    }
+    /** Default constructor */
+    NEQLSTMCellKernel() = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEQLSTMCellKernel(const NEQLSTMCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEQLSTMCellKernel &operator=(const NEQLSTMCellKernel &) = delete;
+    /** Default Move Constructor. */
+    NEQLSTMCellKernel(NEQLSTMCellKernel &&) = default;
+    /** Default move assignment operator */
+    NEQLSTMCellKernel &operator=(NEQLSTMCellKernel &&) = default;
+    /** Default destructor */
+    ~NEQLSTMCellKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input_to_gates          Accumulators of the input matrix multiplication of all the gates.
+     *                                     2D tensor with dimensions [num_gates * num_units, batch_size]. Data type supported: S32.
+     * @param[in]  recurrent_to_gates      Accumulators of the recurrent matrix multiplication of all the gates.
+     *                                     Same shape as @p input_to_gates. Data type supported: S32.
+     * @param[in]  input_to_gates_bias     Effective bias of the input contribution. 1D tensor with dimensions [num_gates * num_units].
+     *                                     Data type supported: S32.
+     * @param[in]  recurrent_to_gates_bias Effective bias of the recurrent contribution. Same shape as @p input_to_gates_bias.
+     *                                     Data type supported: S32.
+     * @param[in]  cell_state_in           2D tensor with dimensions [num_units, batch_size]. Data type supported: QSYMM16.
+     * @param[out] gates                   Scratch tensor used to store the gates. Same shape as @p input_to_gates.
+     *                                     Data type supported: QSYMM16.
+     * @param[out] cell_state_out          Destination cell state. Same shape and data type as @p cell_state_in.
+     * @param[out] hidden                  Destination hidden state. 2D tensor with dimensions [num_units, batch_size].
+     *                                     Data type supported: QASYMM8_SIGNED.
+     * @param[in]  layer_norm_weights      Per-gate layer normalization weights. Only used if @p info has layer normalization.
+     *                                     1D tensors with dimensions [num_units]. Data type supported: QSYMM16.
+     * @param[in]  layer_norm_bias         Per-gate layer normalization bias. Only used if @p info has layer normalization.
+     *                                     1D tensors with dimensions [num_units]. Data type supported: S32.
+     * @param[in]  info                    Quantization and layout information of the cell.
+     */
+    void configure(const ITensor                  *input_to_gates,
+                   const ITensor                  *recurrent_to_gates,
+                   const ITensor                  *input_to_gates_bias,
+                   const ITensor                  *recurrent_to_gates_bias,
+                   const ITensor                  *cell_state_in,
+                   ITensor                        *gates,
+                   ITensor                        *cell_state_out,
+                   ITensor                        *hidden,
+                   const GateArray<const ITensor> &layer_norm_weights,
+                   const GateArray<const ITensor> &layer_norm_bias,
+                   const QLSTMCellKernelInfo      &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEQLSTMCellKernel
+     *
+     * Similar to @ref NEQLSTMCellKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo                  *input_to_gates,
+                           const ITensorInfo                  *recurrent_to_gates,
+                           const ITensorInfo                  *input_to_gates_bias,
+                           const ITensorInfo                  *recurrent_to_gates_bias,
+                           const ITensorInfo                  *cell_state_in,
+                           const ITensorInfo                  *gates,
+                           const ITensorInfo                  *cell_state_out,
+                           const ITensorInfo                  *hidden,
+                           const GateArray<const ITensorInfo> &layer_norm_weights,
+                           const GateArray<const ITensorInfo> &layer_norm_bias,
+                           const QLSTMCellKernelInfo          &info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor                                      *_input_to_gates{nullptr};
+    const ITensor                                      *_recurrent_to_gates{nullptr};
+    const ITensor                                      *_input_to_gates_bias{nullptr};
+    const ITensor                                      *_recurrent_to_gates_bias{nullptr};
+    const ITensor                                      *_cell_state_in{nullptr};
+    ITensor                                            *_gates{nullptr};
+    ITensor                                            *_cell_state_out{nullptr};
+    ITensor                                            *_hidden{nullptr};
+    GateArray<const ITensor>                            _layer_norm_weights{};
+    GateArray<const ITensor>                            _layer_norm_bias{};
+    QLSTMCellKernelInfo                                 _info{};
+    std::array<int32_t, QLSTMCellKernelInfo::num_gates> _layer_norm_multipliers{};
+    std::array<int32_t, QLSTMCellKernelInfo::num_gates> _layer_norm_shifts{};
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NEQLSTMCELLKERNEL_H
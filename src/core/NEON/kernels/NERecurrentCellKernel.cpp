@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NERecurrentCellKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/math/Math.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+using ActFunc = ActivationLayerInfo::ActivationFunction;
+
+// Number of units computed by each window iteration
+constexpr size_t units_per_iteration = 16;
+constexpr size_t max_num_gates       = 3;
+
+size_t num_gates(RecurrentCellType cell_type)
+{
+    return cell_type == RecurrentCellType::GRU ? 3 : 1;
+}
+
+bool is_activation_supported(const ActivationLayerInfo &act)
+{
+    if (!act.enabled())
+    {
+        return true;
+    }
+
+    switch (act.activation())
+    {
+        case ActFunc::LOGISTIC:
+        case ActFunc::TANH:
+        case ActFunc::RELU:
+        case ActFunc::BOUNDED_RELU:
+        case ActFunc::LU_BOUNDED_RELU:
+        case ActFunc::IDENTITY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Status validate_arguments(const ITensorInfo           *input_projection,
+                          const ITensorInfo           *recurrent_weights,
+                          const ITensorInfo           *recurrent_bias,
+                          const ITensorInfo           *hidden_state,
+                          const ITensorInfo           *output,
+                          const RecurrentSequenceInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input_projection, recurrent_weights, hidden_state, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input_projection, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input_projection, recurrent_weights, hidden_state, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.cell_type == RecurrentCellType::RNN && !is_activation_supported(info.act_info),
+                                    "Activation function not supported by the RNN cell");
+
+    const size_t num_directions = info.bidirectional ? 2 : 1;
+    const size_t num_units      = hidden_state->dimension(0);
+    const size_t batch_size     = hidden_state->dimension(1);
+    const size_t seq_len        = output->dimension(2);
+    const size_t gates_units    = num_gates(info.cell_type) * num_units;
+
+    ARM_COMPUTE_RETURN_ERROR_ON(hidden_state->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(hidden_state->dimension(2) != num_directions);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(recurrent_weights->tensor_shape(),
+                                                       TensorShape(gates_units, num_units, num_directions));
+    if (recurrent_bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input_projection, recurrent_bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(recurrent_bias->num_dimensions() > 2);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(recurrent_bias->tensor_shape(),
+                                                           TensorShape(gates_units, num_directions));
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                       TensorShape(num_directions * num_units, batch_size, seq_len));
+    ARM_COMPUTE_RETURN_ERROR_ON(input_projection->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input_projection->tensor_shape(),
+                                                       TensorShape(num_directions * gates_units, batch_size * seq_len));
+
+    return Status{};
+}
+
+inline float32x4_t vsigmoid(float32x4_t x)
+{
+    return vinvq_f32(vaddq_f32(vdupq_n_f32(1.f), vexpq_f32(vnegq_f32(x))));
+}
+
+inline float sigmoid(float x)
+{
+    return 1.f / (1.f + std::exp(-x));
+}
+
+inline float32x4_t vactivate(float32x4_t x, const ActivationLayerInfo &act)
+{
+    if (!act.enabled())
+    {
+        return x;
+    }
+
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    switch (act.activation())
+    {
+        case ActFunc::LOGISTIC:
+            return vsigmoid(x);
+        case ActFunc::TANH:
+            return vmulq_f32(vdupq_n_f32(act.a()), vtanhq_f32(vmulq_f32(vdupq_n_f32(act.b()), x)));
+        case ActFunc::RELU:
+            return vmaxq_f32(zero, x);
+        case ActFunc::BOUNDED_RELU:
+            return vminq_f32(vdupq_n_f32(act.a()), vmaxq_f32(zero, x));
+        case ActFunc::LU_BOUNDED_RELU:
+            return vminq_f32(vdupq_n_f32(act.a()), vmaxq_f32(vdupq_n_f32(act.b()), x));
+        default:
+            return x;
+    }
+}
+
+inline float activate(float x, const ActivationLayerInfo &act)
+{
+    if (!act.enabled())
+    {
+        return x;
+    }
+
+    switch (act.activation())
+    {
+        case ActFunc::LOGISTIC:
+            return sigmoid(x);
+        case ActFunc::TANH:
+            return act.a() * std::tanh(act.b() * x);
+        case ActFunc::RELU:
+            return std::max(0.f, x);
+        case ActFunc::BOUNDED_RELU:
+            return std::min(act.a(), std::max(0.f, x));
+        case ActFunc::LU_BOUNDED_RELU:
+            return std::min(act.a(), std::max(act.b(), x));
+        default:
+            return x;
+    }
+}
+
+/** Compute the new hidden state of 4 units from the input contribution @p x and the recurrent contribution @p acc */
+template <bool is_gru>
+inline float32x4_t vfinalize(
+    const float *x, const float32x4_t *acc, float32x4_t h_prev, size_t num_units, const ActivationLayerInfo &act)
+{
+    if (!is_gru)
+    {
+        return vactivate(vaddq_f32(vld1q_f32(x), acc[0]), act);
+    }
+
+    const float32x4_t z = vsigmoid(vaddq_f32(vld1q_f32(x), acc[0]));
+    const float32x4_t r = vsigmoid(vaddq_f32(vld1q_f32(x + num_units), acc[1]));
+    const float32x4_t n = vtanhq_f32(vmlaq_f32(vld1q_f32(x + 2 * num_units), r, acc[2]));
+    return vmlaq_f32(n, z, vsubq_f32(h_prev, n));
+}
+
+template <bool is_gru>
+inline float finalize(const float *x, const float *acc, float h_prev, size_t num_units, const ActivationLayerInfo &act)
+{
+    if (!is_gru)
+    {
+        return activate(x[0] + acc[0], act);
+    }
+
+    const float z = sigmoid(x[0] + acc[0]);
+    const float r = sigmoid(x[num_units] + acc[1]);
+    const float n = std::tanh(x[2 * num_units] + r * acc[2]);
+    return n + z * (h_prev - n);
+}
+
+template <bool is_gru>
+void recurrent_cell_fp32(const ITensor             *input_projection,
+                         const ITensor             *recurrent_weights,
+                         const ITensor             *recurrent_bias,
+                         const ITensor             *hidden_state,
+                         ITensor                   *output,
+                         const ActivationLayerInfo &act,
+                         unsigned int               step,
+                         const Window              &window)
+{
+    constexpr size_t gates = is_gru ? 3 : 1;
+
+    const size_t num_units   = hidden_state->info()->dimension(0);
+    const size_t batch_size  = hidden_state->info()->dimension(1);
+    const size_t seq_len     = output->info()->dimension(2);
+    const size_t gates_units = gates * num_units;
+
+    const size_t weights_stride_y = recurrent_weights->info()->strides_in_bytes()[1];
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const size_t unit_start = id.x();
+            const size_t unit_end   = std::min(unit_start + units_per_iteration, num_units);
+            const size_t dir        = id.y();
+
+            // The backward direction walks the sequence in reverse order
+            const size_t t      = (dir == 0) ? step : seq_len - 1 - step;
+            const size_t t_prev = (dir == 0) ? t - 1 : t + 1;
+
+            const uint8_t *weights_ptr = recurrent_weights->ptr_to_element(Coordinates(0, 0, dir));
+            const float   *bias        = nullptr;
+            if (recurrent_bias != nullptr)
+            {
+                bias = reinterpret_cast<const float *>(recurrent_bias->ptr_to_element(Coordinates(0, dir)));
+            }
+
+            for (size_t b = 0; b < batch_size; ++b)
+            {
+                const auto *x = reinterpret_cast<const float *>(
+                    input_projection->ptr_to_element(Coordinates(dir * gates_units, t * batch_size + b)));
+                const auto *h_prev = reinterpret_cast<const float *>(
+                    (step == 0) ? hidden_state->ptr_to_element(Coordinates(0, b, dir))
+                                : output->ptr_to_element(Coordinates(dir * num_units, b, t_prev)));
+                auto *h_out = reinterpret_cast<float *>(output->ptr_to_element(Coordinates(dir * num_units, b, t)));
+
+                size_t u = unit_start;
+                for (; u + 4 <= unit_end; u += 4)
+                {
+                    float32x4_t acc[max_num_gates];
+                    for (size_t g = 0; g < gates; ++g)
+                    {
+                        acc[g] = (bias != nullptr) ? vld1q_f32(bias + g * num_units + u) : vdupq_n_f32(0.f);
+                    }
+
+                    for (size_t k = 0; k < num_units; ++k)
+                    {
+                        const auto       *w = reinterpret_cast<const float *>(weights_ptr + k * weights_stride_y) + u;
+                        const float32x4_t h = vdupq_n_f32(h_prev[k]);
+                        for (size_t g = 0; g < gates; ++g)
+                        {
+                            acc[g] = vmlaq_f32(acc[g], h, vld1q_f32(w + g * num_units));
+                        }
+                    }
+
+                    vst1q_f32(h_out + u, vfinalize<is_gru>(x + u, acc, vld1q_f32(h_prev + u), num_units, act));
+                }
+
+                // Left-over units
+                for (; u < unit_end; ++u)
+                {
+                    float acc[max_num_gates];
+                    for (size_t g = 0; g < gates; ++g)
+                    {
+                        acc[g] = (bias != nullptr) ? bias[g * num_units + u] : 0.f;
+                    }
+
+                    for (size_t k = 0; k < num_units; ++k)
+                    {
+                        const auto *w = reinterpret_cast<const float *>(weights_ptr + k * weights_stride_y) + u;
+                        for (size_t g = 0; g < gates; ++g)
+                        {
+                            acc[g] += h_prev[k] * w[g * num_units];
+                        }
+                    }
+
+                    h_out[u] = finalize<is_gru>(x + u, acc, h_prev[u], num_units, act);
+                }
+            }
+        });
+}
+} // namespace
+
+void NERecurrentCellKernel::configure(const ITensor               *input_projection,
+                                      const ITensor               *recurrent_weights,
+                                      const ITensor               *recurrent_bias,
+                                      const ITensor               *hidden_state,
+                                      ITensor                     *output,
+                                      const RecurrentSequenceInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input_projection, recurrent_weights, hidden_state, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input_projection->info(), recurrent_weights->info(),
+                                                  (recurrent_bias != nullptr) ? recurrent_bias->info() : nullptr,
+                                                  hidden_state->info(), output->info(), info));
+
+    _input_projection  = input_projection;
+    _recurrent_weights = recurrent_weights;
+    _recurrent_bias    = recurrent_bias;
+    _hidden_state      = hidden_state;
+    _output            = output;
+    _info              = info;
+    _step              = 0;
+
+    // Each window iteration computes a block of units of one direction for all the batches
+    const size_t num_units = hidden_state->info()->dimension(0);
+    Window       win;
+    win.set(Window::DimX,
+            Window::Dimension(0, ceil_to_multiple(num_units, units_per_iteration), units_per_iteration));
+    win.set(Window::DimY, Window::Dimension(0, info.bidirectional ? 2 : 1, 1));
+    INEKernel::configure(win);
+}
+
+Status NERecurrentCellKernel::validate(const ITensorInfo           *input_projection,
+                                       const ITensorInfo           *recurrent_weights,
+                                       const ITensorInfo           *recurrent_bias,
+                                       const ITensorInfo           *hidden_state,
+                                       const ITensorInfo           *output,
+                                       const RecurrentSequenceInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        validate_arguments(input_projection, recurrent_weights, recurrent_bias, hidden_state, output, info));
+    return Status{};
+}
+
+void NERecurrentCellKernel::set_step(unsigned int step)
+{
+    ARM_COMPUTE_ERROR_ON(_output == nullptr || step >= _output->info()->dimension(2));
+    _step = step;
+}
+
+void NERecurrentCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    if (_info.cell_type == RecurrentCellType::GRU)
+    {
+        recurrent_cell_fp32<true>(_input_projection, _recurrent_weights, _recurrent_bias, _hidden_state, _output,
+                                  _info.act_info, _step, window);
+    }
+    else
+    {
+        recurrent_cell_fp32<false>(_input_projection, _recurrent_weights, _recurrent_bias, _hidden_state, _output,
+                                   _info.act_info, _step, window);
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CORE_NEON_KERNELS_NERECURRENTCELLKERNEL_H
+#define ACL_SRC_CORE_NEON_KERNELS_NERECURRENTCELLKERNEL_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Kernel to compute one timestep of a recurrent sequence for all the batches and directions
+ *
+ * The input contribution of every timestep is expected to be precomputed, so that only the recurrent matrix
+ * multiplication, the gates and the activation are left for each step. The previous hidden state is read from the
+ * output of the previous timestep, which removes any copy between steps. When the sequence is bidirectional, the
+ * forward direction computes timestep t while the backward direction computes timestep (seq_len - 1 - t) in the same
+ * run.
+ *
+ * For the GRU cell, with the gates stored in the order update (z), reset (r) and hidden (n):
+ * @f[
+ *   z = \sigma(x_z + h R_z + rb_z), \quad r = \sigma(x_r + h R_r + rb_r),
+ *   \quad n = \tanh(x_n + r \odot (h R_n + rb_n)), \quad h' = (1 - z) \odot n + z \odot h
+ * @f]
+ */
+class NERecurrentCellKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NERecurrentCellKernel";
+    }
+    /** Default constructor */
+    NERecurrentCellKernel() = default;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERecurrentCellKernel(const NERecurrentCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERecurrentCellKernel &operator=(const NERecurrentCellKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NERecurrentCellKernel(NERecurrentCellKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NERecurrentCellKernel &operator=(NERecurrentCellKernel &&) = default;
+    /** Default destructor */
+    ~NERecurrentCellKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input_projection  Input contribution of all the timesteps, bias included. 2D tensor with dimensions
+     *                               [num_directions * num_gates * num_units, batch_size * seq_len]. Data type supported: F32.
+     * @param[in]  recurrent_weights Recurrent weights. 3D tensor with dimensions [num_gates * num_units, num_units, num_directions].
+     *                               Data type supported: Same as @p input_projection.
+     * @param[in]  recurrent_bias    (Optional) Recurrent bias. 2D tensor with dimensions [num_gates * num_units, num_directions].
+     *                               Data type supported: Same as @p input_projection.
+     * @param[in]  hidden_state      Initial hidden state. 3D tensor with dimensions [num_units, batch_size, num_directions].
+     *                               Data type supported: Same as @p input_projection.
+     * @param[out] output            Hidden state of all the timesteps. 3D tensor with dimensions
+     *                               [num_directions * num_units, batch_size, seq_len]. Data type supported: Same as @p input_projection.
+     * @param[in]  info              Recurrent sequence information.
+     */
+    void configure(const ITensor               *input_projection,
+                   const ITensor               *recurrent_weights,
+                   const ITensor               *recurrent_bias,
+                   const ITensor               *hidden_state,
+                   ITensor                     *output,
+                   const RecurrentSequenceInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NERecurrentCellKernel
+     *
+     * Similar to @ref NERecurrentCellKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo           *input_projection,
+                           const ITensorInfo           *recurrent_weights,
+                           const ITensorInfo           *recurrent_bias,
+                           const ITensorInfo           *hidden_state,
+                           const ITensorInfo           *output,
+                           const RecurrentSequenceInfo &info);
+    /** Set the step of the sequence computed by the next run
+     *
+     * @param[in] step Step of the sequence. Must be lower than seq_len.
+     */
+    void set_step(unsigned int step);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor        *_input_projection{nullptr};
+    const ITensor        *_recurrent_weights{nullptr};
+    const ITensor        *_recurrent_bias{nullptr};
+    const ITensor        *_hidden_state{nullptr};
+    ITensor              *_output{nullptr};
+    RecurrentSequenceInfo _info{};
+    unsigned int          _step{0};
+};
+} // namespace arm_compute
+#endif // ACL_SRC_CORE_NEON_KERNELS_NERECURRENTCELLKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -95,6 +95,24 @@ std::pair<Status, Window> validate_and_configure_window(const ITensorInfo *input
 }
 } // namespace
 
+bool NEStridedSliceKernel::is_aliased_slice(const ITensor *input, const ITensor *output) const
+{
+    if (_shrink_mask != 0)
+    {
+        return false;
+    }
+    for (unsigned int i = 0; i < input->info()->num_dimensions(); ++i)
+    {
+        if (_final_strides[i] != 1 ||
+            (output->info()->dimension(i) > 1 &&
+             output->info()->strides_in_bytes()[i] != input->info()->strides_in_bytes()[i]))
+        {
+            return false;
+        }
+    }
+    return output->ptr_to_element(Coordinates()) == input->ptr_to_element(_starts_abs);
+}
+
 NEStridedSliceKernel::NEStridedSliceKernel() : _starts_abs(), _final_strides(), _shrink_mask()
 {
 }
@@ -151,6 +169,13 @@ void NEStridedSliceKernel::run_op(ITensorPack &tensors, const Window &window, co
     const ITensor *input  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
     const ITensor *output = tensors.get_tensor(TensorType::ACL_DST);
 
+    // Unit-step slices whose destination is already a view of the source region (e.g. a sub-tensor of the
+    // source) only need the metadata, so skip the copy
+    if (is_aliased_slice(input, output))
+    {
+        return;
+    }
+
     size_t width_size = input->info()->element_size();
 
     const bool is_shrink_x = arm_compute::helpers::bit_ops::is_bit_set(_shrink_mask, 0);
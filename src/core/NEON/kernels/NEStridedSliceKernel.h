@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -105,6 +105,15 @@ public:
     void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
 
 private:
+    /** Check whether the output is a view of the sliced region of the input, so that no copy is needed
+     *
+     * @param[in] input  Source tensor.
+     * @param[in] output Destination tensor.
+     *
+     * @return True if the output already aliases the slice of the input
+     */
+    bool is_aliased_slice(const ITensor *input, const ITensor *output) const;
+
     Coordinates _starts_abs;    /**< Absolute start coordinates */
     Coordinates _final_strides; /**< Final strides */
     int32_t     _shrink_mask;   /**< Shrink axis mask */
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "bfloat.hpp"
+#include "depthwise_depthfirst.hpp"
+
+#include <algorithm>
+
+namespace arm_conv {
+namespace depthwise {
+
+/* Strategy for FP32 depthwise kernels which multiply in BF16 and accumulate
+ * in FP32.
+ *
+ * The weights are narrowed to BF16 when they are packed. Each pack covers two
+ * vectors of channels and holds the FP32 bias for those channels followed by
+ * one vector of BF16 weights per kernel point. The NEON kernels narrow their
+ * inputs with BFCVTN/BFCVTN2, so the weights are stored in channel order. The
+ * SVE kernels place the first half of the pack in the even lanes (BFCVT) and
+ * the second half in the odd lanes (BFCVTNT), so the weights are interleaved
+ * in the same way.
+ */
+class DepthwiseDepthfirstFp32Bf16Fp32Strategy : public DepthwiseDepthfirstStrategy<float, float, float, float>
+{
+  using Parent = DepthwiseDepthfirstStrategy<float, float, float, float>;
+
+  unsigned int get_pack_channels(void) const
+  {
+    return 2 * arm_gemm::utils::get_vector_length<float>(this->get_vl_type());
+  }
+
+  public:
+  using Parent::Parent;
+
+  size_t get_storage_size(const DepthwiseArgs &args) const override
+  {
+    const unsigned int pack_channels = this->get_pack_channels();
+    const unsigned int n_packs = arm_gemm::iceildiv(args.input_channels * args.channel_multiplier, pack_channels);
+    const size_t pack_size = pack_channels * (sizeof(float) + this->get_n_kernel_points() * sizeof(arm_gemm::bfloat16));
+    return n_packs * pack_size;
+  }
+
+  void pack_parameters(
+    const DepthwiseArgs &args, void *buffer_raw,
+    const void *biases_raw, const Nothing &,
+    const void *weights_raw, size_t ld_weight_col, size_t ld_weight_row
+  ) const override
+  {
+    const unsigned int n_channels = args.input_channels * args.channel_multiplier;
+    const unsigned int pack_channels = this->get_pack_channels();
+    const bool interleave_halves = (this->get_vl_type() == arm_gemm::VLType::SVE);
+
+    ld_weight_col = (ld_weight_col == 0) ? n_channels : ld_weight_col;
+    ld_weight_row = (ld_weight_row == 0) ? this->get_kernel_cols() * ld_weight_col : ld_weight_row;
+
+    auto buffer = static_cast<uint8_t *>(buffer_raw);
+    auto biases = static_cast<const float *>(biases_raw);
+    auto weights = static_cast<const float *>(weights_raw);
+
+    for (unsigned int n = 0; n < n_channels; n += pack_channels)
+    {
+      const unsigned int todo = std::min(pack_channels, n_channels - n);
+
+      auto bias_out = reinterpret_cast<float *>(buffer);
+      for (unsigned int i = 0; i < pack_channels; i++)
+      {
+        bias_out[i] = (biases != nullptr && i < todo) ? biases[n + i] : 0.0f;
+      }
+      buffer += pack_channels * sizeof(float);
+
+      unsigned int kx, ky;
+      for (unsigned int kindex = 0; this->get_kernel_packing_point(kindex, kx, ky); kindex++)
+      {
+        auto weights_out = reinterpret_cast<arm_gemm::bfloat16 *>(buffer);
+        std::fill_n(weights_out, pack_channels, arm_gemm::bfloat16());
+
+        const float *weights_in = weights + kx * ld_weight_row + ky * ld_weight_col + n;
+        for (unsigned int i = 0; i < todo; i++)
+        {
+          const unsigned int half = pack_channels / 2;
+          const unsigned int pos = !interleave_halves ? i : (i < half ? 2 * i : 2 * (i - half) + 1);
+          weights_out[pos] = arm_gemm::bfloat16(weights_in[i]);
+        }
+        buffer += pack_channels * sizeof(arm_gemm::bfloat16);
+      }
+    }
+  }
+};
+
+/* Compute the channels in [channel_start, n_channels) of one tile, where
+ * `params` points at the (partially filled) NEON pack which contains them.
+ * Inputs are rounded to BF16 to match the vector path.
+ */
+template <unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+void depthfirst_fp32bf16fp32_oddments(
+  const float *const *const input_ptrs,
+  float *const *const outptrs,
+  const void *params,
+  const unsigned int channel_start,
+  const unsigned int n_channels,
+  const float activation_min,
+  const float activation_max
+)
+{
+  constexpr unsigned int pack_channels = 8;
+  constexpr unsigned int input_cols = KernelCols + (OutputCols - 1) * StrideCols;
+
+  const auto pack = static_cast<const uint8_t *>(params) +
+                    (channel_start / pack_channels) * pack_channels *
+                    (sizeof(float) + KernelRows * KernelCols * sizeof(arm_gemm::bfloat16));
+  const auto bias = reinterpret_cast<const float *>(pack);
+  const auto weights = reinterpret_cast<const arm_gemm::bfloat16 *>(pack + pack_channels * sizeof(float));
+
+  for (unsigned int c = channel_start; c < n_channels; c++)
+  {
+    const unsigned int i = c % pack_channels;
+    for (unsigned int oi = 0; oi < OutputRows; oi++)
+    {
+      for (unsigned int oj = 0; oj < OutputCols; oj++)
+      {
+        float acc = bias[i];
+        for (unsigned int kr = 0; kr < KernelRows; kr++)
+        {
+          for (unsigned int kc = 0; kc < KernelCols; kc++)
+          {
+            const float *inptr = input_ptrs[(oi * StrideRows + kr) * input_cols + oj * StrideCols + kc];
+            const float x = arm_gemm::bfloat16(inptr[c]);
+            const float w = weights[(kr * KernelCols + kc) * pack_channels + i];
+            acc += x * w;
+          }
+        }
+        outptrs[oi * OutputCols + oj][c] = std::min(std::max(acc, activation_min), activation_max);
+      }
+    }
+  }
+}
+
+/* Implement the direct (dense tile) interface by building the pointer arrays
+ * for each tile and invoking the indirect kernel.
+ */
+template <unsigned int KernelRows, unsigned int KernelCols,
+          unsigned int StrideRows, unsigned int StrideCols,
+          unsigned int OutputRows, unsigned int OutputCols>
+void depthfirst_fp32bf16fp32_direct(
+  void (*indirect_kernel)(const float *const *, float *const *, const void *, unsigned int, float, float),
+  const unsigned int n_tile_rows, const unsigned int n_tile_cols,
+  const float *inptr, int64_t ld_input_row, int64_t ld_input_col,
+  float *outptr, int64_t ld_output_row, int64_t ld_output_col,
+  const void *params, unsigned int n_channels,
+  const float activation_min, const float activation_max
+)
+{
+  constexpr unsigned int input_rows = KernelRows + (OutputRows - 1) * StrideRows;
+  constexpr unsigned int input_cols = KernelCols + (OutputCols - 1) * StrideCols;
+
+  const float *input_ptrs[input_rows * input_cols];
+  float *output_ptrs[OutputRows * OutputCols];
+
+  for (unsigned int tile_i = 0; tile_i < n_tile_rows; tile_i++)
+  {
+    for (unsigned int tile_j = 0; tile_j < n_tile_cols; tile_j++)
+    {
+      const float *tile_inptr = inptr + tile_i * OutputRows * StrideRows * ld_input_row +
+                                tile_j * OutputCols * StrideCols * ld_input_col;
+      for (unsigned int i = 0; i < input_rows; i++)
+      {
+        for (unsigned int j = 0; j < input_cols; j++)
+        {
+          input_ptrs[i * input_cols + j] = tile_inptr + i * ld_input_row + j * ld_input_col;
+        }
+      }
+
+      float *tile_outptr = outptr + tile_i * OutputRows * ld_output_row + tile_j * OutputCols * ld_output_col;
+      for (unsigned int i = 0; i < OutputRows; i++)
+      {
+        for (unsigned int j = 0; j < OutputCols; j++)
+        {
+          output_ptrs[i * OutputCols + j] = tile_outptr + i * ld_output_row + j * ld_output_col;
+        }
+      }
+
+      indirect_kernel(input_ptrs, output_ptrs, params, n_channels, activation_min, activation_max);
+    }
+  }
+}
+
+}  // namespace depthwise
+}  // namespace arm_conv
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "depthwise_implementation.hpp"
 #include "depthwise_depthfirst.hpp"
 #include "depthwise_depthfirst_generic.hpp"
+#include "depthwise_depthfirst_fp32bf16fp32.hpp"
 #include "depthwise_depthfirst_multiplier.hpp"
 #include "depthwise_planar.hpp"
 
@@ -62,6 +63,12 @@
 #include "kernels/sve_fp32_packed_to_nhwc_3x3_s2_with_multiplier_output3x3_mla_depthfirst.hpp"
 #include "kernels/sve_fp32_packed_to_nhwc_5x5_s1_with_multiplier_output2x4_mla_depthfirst.hpp"
 #include "kernels/sve_fp32_packed_to_nhwc_generic_with_multiplier_output2x8_mla_depthfirst.hpp"
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+#include "kernels/sve_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/sve_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst.hpp"
+#include "kernels/sve_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/sve_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst.hpp"
+#endif  // defined(ARM_COMPUTE_ENABLE_BF16)
 #endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 #include "kernels/a64_fp32_nhwc_3x3_s1_output4x4_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_3x3_s1_output3x3_mla_depthfirst.hpp"
@@ -72,6 +79,12 @@
 #include "kernels/a64_fp32_packed_to_nhwc_3x3_s2_with_multiplier_output3x3_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_packed_to_nhwc_5x5_s1_with_multiplier_output2x4_mla_depthfirst.hpp"
 #include "kernels/a64_fp32_packed_to_nhwc_generic_with_multiplier_output2x8_mla_depthfirst.hpp"
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+#include "kernels/a64_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/a64_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst.hpp"
+#include "kernels/a64_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst.hpp"
+#include "kernels/a64_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst.hpp"
+#endif  // defined(ARM_COMPUTE_ENABLE_BF16)
 #endif  // defined(__aarch64__)
 
 namespace arm_conv {
@@ -143,6 +156,7 @@ namespace
   template <class Strategy>
   unsigned int fast_mode_cycle_estimate(const DepthwiseArgs &args, const Nothing &)
   {
+    // BF16 kernels are preferred over FP32 kernels computing the same number of output pixels.
     // First-pass: compute the number of output pixels which will be computed.
     return arm_gemm::roundup(args.output_rows, Strategy::output_rows) *
            arm_gemm::roundup(args.output_cols, Strategy::output_cols) *
@@ -383,6 +397,60 @@ static const DepthwiseImplementation<float, float> depthwise_fp32_methods[] = {
       return new DepthwiseDepthfirst<float>(strat, args);
     },
   },
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "sve_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst",
+    constraint(fast_mode_enabled,
+               is_supported<sve_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst>,
+               cpu_has_sve, cpu_has_sve_bf16,
+               has_no_channel_multiplier),
+    fast_mode_cycle_estimate<sve_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new sve_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "sve_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst",
+    constraint(fast_mode_enabled,
+               is_supported<sve_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst>,
+               cpu_has_sve, cpu_has_sve_bf16,
+               has_no_channel_multiplier),
+    fast_mode_cycle_estimate<sve_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new sve_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "sve_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst",
+    constraint(fast_mode_enabled,
+               is_supported<sve_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst>,
+               cpu_has_sve, cpu_has_sve_bf16,
+               has_no_channel_multiplier),
+    fast_mode_cycle_estimate<sve_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new sve_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "sve_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst",
+    constraint(fast_mode_enabled,
+               is_supported<sve_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst>,
+               cpu_has_sve, cpu_has_sve_bf16,
+               has_no_channel_multiplier),
+    fast_mode_cycle_estimate<sve_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new sve_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+#endif  // defined(ARM_COMPUTE_ENABLE_BF16)
   {
     DepthwiseMethod::DEPTHFIRST,
     "sve_fp32_nhwc_generic_output3x3_mla_depthfirst",
@@ -478,6 +546,60 @@ static const DepthwiseImplementation<float, float> depthwise_fp32_methods[] = {
       return new DepthwiseDepthfirst<float>(strat, args);
     },
   },
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst",
+    constraint(fast_mode_enabled,
+               is_supported<a64_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst>,
+               cpu_has_bf16,
+               has_no_channel_multiplier),
+    fast_mode_cycle_estimate<a64_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new a64_fp32bf16fp32_nhwc_3x3_s1_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst",
+    constraint(fast_mode_enabled,
+               is_supported<a64_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst>,
+               cpu_has_bf16,
+               has_no_channel_multiplier),
+    fast_mode_cycle_estimate<a64_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new a64_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst",
+    constraint(fast_mode_enabled,
+               is_supported<a64_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst>,
+               cpu_has_bf16,
+               has_no_channel_multiplier),
+    fast_mode_cycle_estimate<a64_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new a64_fp32bf16fp32_nhwc_5x5_s1_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    DepthwiseMethod::DEPTHFIRST,
+    "a64_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst",
+    constraint(fast_mode_enabled,
+               is_supported<a64_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst>,
+               cpu_has_bf16,
+               has_no_channel_multiplier),
+    fast_mode_cycle_estimate<a64_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst>,
+    [] (const DepthwiseArgs &args, const Nothing &) -> DepthwiseCommon<float, float, float> * {
+      auto strat = new a64_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst(args.cpu_info);
+      return new DepthwiseDepthfirst<float>(strat, args);
+    },
+  },
+#endif  // defined(ARM_COMPUTE_ENABLE_BF16)
   {
     DepthwiseMethod::DEPTHFIRST,
     "a64_fp32_nhwc_generic_output3x3_mla_depthfirst",
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,6 +115,18 @@ bool cpu_has_fp16(const DepthwiseArgs &args, const void *)
   return args.cpu_info->has_fp16();
 }
 
+bool cpu_has_bf16(const DepthwiseArgs &args, const void *) __attribute__ ((unused));
+bool cpu_has_bf16(const DepthwiseArgs &args, const void *)
+{
+  return args.cpu_info->has_bf16();
+}
+
+bool cpu_has_sve_bf16(const DepthwiseArgs &args, const void *) __attribute__ ((unused));
+bool cpu_has_sve_bf16(const DepthwiseArgs &args, const void *)
+{
+  return args.cpu_info->has_svebf16();
+}
+
 bool has_no_channel_multiplier(const DepthwiseArgs &args, const void *) __attribute__ ((unused));
 bool has_no_channel_multiplier(const DepthwiseArgs &args, const void *)
 {
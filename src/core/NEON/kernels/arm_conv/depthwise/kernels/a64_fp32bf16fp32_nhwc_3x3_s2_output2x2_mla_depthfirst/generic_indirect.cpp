@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "depthwise_depthfirst_fp32bf16fp32.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_BF16)
+
+namespace arm_conv {
+namespace depthwise {
+
+void a64_fp32bf16fp32_nhwc_3x3_s2_output2x2_mla_depthfirst_indirect_impl(
+  const float *const *const input_ptrs,
+  float *const *const outptrs,
+  const void *params,
+  unsigned int n_channels,
+  const float activation_min,
+  const float activation_max
+)
+{
+  struct Args
+  {
+    const float *const *inptrs;
+    float *const *outptrs;
+    const void *params;
+    const float min, max;
+
+    Args(
+      const float *const *const input_ptrs,
+      float *const *const outptrs,
+      const void *const params,
+      const float min,
+      const float max
+    ) : inptrs(input_ptrs), outptrs(outptrs), params(params), min(min), max(max)
+    {
+    }
+  };
+
+  Args params_struct(input_ptrs, outptrs, params,
+                     activation_min, activation_max);
+
+  __asm__ __volatile__(
+    "ldr x9, [%x[params_struct], %[offsetof_args_outptrs]]\n"
+    "ldr x14, [%x[params_struct], %[offsetof_args_inptrs]]\n"
+    "ldr x15, [%x[params_struct], %[offsetof_args_params]]\n"
+    "lsr x16, %x[n_channels], #0x3\n"
+    "mov x13, #0x0\n"
+    "ldp x10, x11, [x9, #0x0]\n"
+    "ldp x12, x9, [x9, #0x10]\n"
+    "cbz x16, 2f\n"
+    "1:"  // Channel loop
+    "movi v0.16b, #0x0\n"
+    "movi v1.16b, #0x0\n"
+    "movi v2.16b, #0x0\n"
+    "movi v3.16b, #0x0\n"
+    "movi v4.16b, #0x0\n"
+    "movi v5.16b, #0x0\n"
+    "movi v6.16b, #0x0\n"
+    "movi v7.16b, #0x0\n"
+    "ldr q8, [x15, #0x20]\n"
+    "ldr q9, [x15, #0x30]\n"
+    "ldr q10, [x15, #0x40]\n"
+    "ldr q11, [x15, #0x50]\n"
+    "ldr q12, [x15, #0x60]\n"
+    "ldr q13, [x15, #0x70]\n"
+    "ldr q14, [x15, #0x80]\n"
+    "ldr q15, [x15, #0x90]\n"
+    "ldr q16, [x15, #0xa0]\n"
+    "ldr x17, [x14, #0x0]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ec8ffe0  // bfmlalb v0.4s, v31.8h, v8.8h\n"
+    ".inst 0x6ec8ffe1  // bfmlalt v1.4s, v31.8h, v8.8h\n"
+    "ldr x17, [x14, #0x8]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ec9ffe0  // bfmlalb v0.4s, v31.8h, v9.8h\n"
+    ".inst 0x6ec9ffe1  // bfmlalt v1.4s, v31.8h, v9.8h\n"
+    "ldr x17, [x14, #0x10]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecaffe0  // bfmlalb v0.4s, v31.8h, v10.8h\n"
+    ".inst 0x6ecaffe1  // bfmlalt v1.4s, v31.8h, v10.8h\n"
+    ".inst 0x2ec8ffe2  // bfmlalb v2.4s, v31.8h, v8.8h\n"
+    ".inst 0x6ec8ffe3  // bfmlalt v3.4s, v31.8h, v8.8h\n"
+    "ldr x17, [x14, #0x18]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ec9ffe2  // bfmlalb v2.4s, v31.8h, v9.8h\n"
+    ".inst 0x6ec9ffe3  // bfmlalt v3.4s, v31.8h, v9.8h\n"
+    "ldr x17, [x14, #0x20]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecaffe2  // bfmlalb v2.4s, v31.8h, v10.8h\n"
+    ".inst 0x6ecaffe3  // bfmlalt v3.4s, v31.8h, v10.8h\n"
+    "ldr x17, [x14, #0x28]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecbffe0  // bfmlalb v0.4s, v31.8h, v11.8h\n"
+    ".inst 0x6ecbffe1  // bfmlalt v1.4s, v31.8h, v11.8h\n"
+    "ldr x17, [x14, #0x30]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2eccffe0  // bfmlalb v0.4s, v31.8h, v12.8h\n"
+    ".inst 0x6eccffe1  // bfmlalt v1.4s, v31.8h, v12.8h\n"
+    "ldr x17, [x14, #0x38]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecdffe0  // bfmlalb v0.4s, v31.8h, v13.8h\n"
+    ".inst 0x6ecdffe1  // bfmlalt v1.4s, v31.8h, v13.8h\n"
+    ".inst 0x2ecbffe2  // bfmlalb v2.4s, v31.8h, v11.8h\n"
+    ".inst 0x6ecbffe3  // bfmlalt v3.4s, v31.8h, v11.8h\n"
+    "ldr x17, [x14, #0x40]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2eccffe2  // bfmlalb v2.4s, v31.8h, v12.8h\n"
+    ".inst 0x6eccffe3  // bfmlalt v3.4s, v31.8h, v12.8h\n"
+    "ldr x17, [x14, #0x48]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecdffe2  // bfmlalb v2.4s, v31.8h, v13.8h\n"
+    ".inst 0x6ecdffe3  // bfmlalt v3.4s, v31.8h, v13.8h\n"
+    "ldr x17, [x14, #0x50]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2eceffe0  // bfmlalb v0.4s, v31.8h, v14.8h\n"
+    ".inst 0x6eceffe1  // bfmlalt v1.4s, v31.8h, v14.8h\n"
+    ".inst 0x2ec8ffe4  // bfmlalb v4.4s, v31.8h, v8.8h\n"
+    ".inst 0x6ec8ffe5  // bfmlalt v5.4s, v31.8h, v8.8h\n"
+    "ldr x17, [x14, #0x58]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecfffe0  // bfmlalb v0.4s, v31.8h, v15.8h\n"
+    ".inst 0x6ecfffe1  // bfmlalt v1.4s, v31.8h, v15.8h\n"
+    ".inst 0x2ec9ffe4  // bfmlalb v4.4s, v31.8h, v9.8h\n"
+    ".inst 0x6ec9ffe5  // bfmlalt v5.4s, v31.8h, v9.8h\n"
+    "ldr x17, [x14, #0x60]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ed0ffe0  // bfmlalb v0.4s, v31.8h, v16.8h\n"
+    ".inst 0x6ed0ffe1  // bfmlalt v1.4s, v31.8h, v16.8h\n"
+    ".inst 0x2eceffe2  // bfmlalb v2.4s, v31.8h, v14.8h\n"
+    ".inst 0x6eceffe3  // bfmlalt v3.4s, v31.8h, v14.8h\n"
+    ".inst 0x2ecaffe4  // bfmlalb v4.4s, v31.8h, v10.8h\n"
+    ".inst 0x6ecaffe5  // bfmlalt v5.4s, v31.8h, v10.8h\n"
+    ".inst 0x2ec8ffe6  // bfmlalb v6.4s, v31.8h, v8.8h\n"
+    ".inst 0x6ec8ffe7  // bfmlalt v7.4s, v31.8h, v8.8h\n"
+    "ldr x17, [x14, #0x68]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecfffe2  // bfmlalb v2.4s, v31.8h, v15.8h\n"
+    ".inst 0x6ecfffe3  // bfmlalt v3.4s, v31.8h, v15.8h\n"
+    ".inst 0x2ec9ffe6  // bfmlalb v6.4s, v31.8h, v9.8h\n"
+    ".inst 0x6ec9ffe7  // bfmlalt v7.4s, v31.8h, v9.8h\n"
+    "ldr x17, [x14, #0x70]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ed0ffe2  // bfmlalb v2.4s, v31.8h, v16.8h\n"
+    ".inst 0x6ed0ffe3  // bfmlalt v3.4s, v31.8h, v16.8h\n"
+    ".inst 0x2ecaffe6  // bfmlalb v6.4s, v31.8h, v10.8h\n"
+    ".inst 0x6ecaffe7  // bfmlalt v7.4s, v31.8h, v10.8h\n"
+    "ldr x17, [x14, #0x78]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecbffe4  // bfmlalb v4.4s, v31.8h, v11.8h\n"
+    ".inst 0x6ecbffe5  // bfmlalt v5.4s, v31.8h, v11.8h\n"
+    "ldr x17, [x14, #0x80]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2eccffe4  // bfmlalb v4.4s, v31.8h, v12.8h\n"
+    ".inst 0x6eccffe5  // bfmlalt v5.4s, v31.8h, v12.8h\n"
+    "ldr x17, [x14, #0x88]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecdffe4  // bfmlalb v4.4s, v31.8h, v13.8h\n"
+    ".inst 0x6ecdffe5  // bfmlalt v5.4s, v31.8h, v13.8h\n"
+    ".inst 0x2ecbffe6  // bfmlalb v6.4s, v31.8h, v11.8h\n"
+    ".inst 0x6ecbffe7  // bfmlalt v7.4s, v31.8h, v11.8h\n"
+    "ldr x17, [x14, #0x90]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2eccffe6  // bfmlalb v6.4s, v31.8h, v12.8h\n"
+    ".inst 0x6eccffe7  // bfmlalt v7.4s, v31.8h, v12.8h\n"
+    "ldr x17, [x14, #0x98]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecdffe6  // bfmlalb v6.4s, v31.8h, v13.8h\n"
+    ".inst 0x6ecdffe7  // bfmlalt v7.4s, v31.8h, v13.8h\n"
+    "ldr x17, [x14, #0xa0]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2eceffe4  // bfmlalb v4.4s, v31.8h, v14.8h\n"
+    ".inst 0x6eceffe5  // bfmlalt v5.4s, v31.8h, v14.8h\n"
+    "ldr x17, [x14, #0xa8]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecfffe4  // bfmlalb v4.4s, v31.8h, v15.8h\n"
+    ".inst 0x6ecfffe5  // bfmlalt v5.4s, v31.8h, v15.8h\n"
+    "ldr x17, [x14, #0xb0]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ed0ffe4  // bfmlalb v4.4s, v31.8h, v16.8h\n"
+    ".inst 0x6ed0ffe5  // bfmlalt v5.4s, v31.8h, v16.8h\n"
+    ".inst 0x2eceffe6  // bfmlalb v6.4s, v31.8h, v14.8h\n"
+    ".inst 0x6eceffe7  // bfmlalt v7.4s, v31.8h, v14.8h\n"
+    "ldr x17, [x14, #0xb8]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ecfffe6  // bfmlalb v6.4s, v31.8h, v15.8h\n"
+    ".inst 0x6ecfffe7  // bfmlalt v7.4s, v31.8h, v15.8h\n"
+    "ldr x17, [x14, #0xc0]\n"
+    "add x17, x17, x13\n"
+    "ldp q29, q30, [x17, #0x0]\n"
+    ".inst 0x0ea16bbf  // bfcvtn v31.4h, v29.4s\n"
+    ".inst 0x4ea16bdf  // bfcvtn2 v31.8h, v30.4s\n"
+    ".inst 0x2ed0ffe6  // bfmlalb v6.4s, v31.8h, v16.8h\n"
+    ".inst 0x6ed0ffe7  // bfmlalt v7.4s, v31.8h, v16.8h\n"
+    "add x20, %x[params_struct], %[offsetof_args_min]\n"
+    "add x21, %x[params_struct], %[offsetof_args_max]\n"
+    "ld1r { v30.4s }, [x20]\n"
+    "ld1r { v31.4s }, [x21]\n"
+    "ldp q28, q29, [x15, #0x0]\n"
+    "zip1 v8.4s, v0.4s, v1.4s\n"
+    "zip2 v9.4s, v0.4s, v1.4s\n"
+    "fadd v8.4s, v8.4s, v28.4s\n"
+    "fadd v9.4s, v9.4s, v29.4s\n"
+    "fmax v8.4s, v8.4s, v30.4s\n"
+    "fmax v9.4s, v9.4s, v30.4s\n"
+    "fmin v8.4s, v8.4s, v31.4s\n"
+    "fmin v9.4s, v9.4s, v31.4s\n"
+    "add x17, x10, x13\n"
+    "stp q8, q9, [x17, #0x0]\n"
+    "zip1 v10.4s, v2.4s, v3.4s\n"
+    "zip2 v11.4s, v2.4s, v3.4s\n"
+    "fadd v10.4s, v10.4s, v28.4s\n"
+    "fadd v11.4s, v11.4s, v29.4s\n"
+    "fmax v10.4s, v10.4s, v30.4s\n"
+    "fmax v11.4s, v11.4s, v30.4s\n"
+    "fmin v10.4s, v10.4s, v31.4s\n"
+    "fmin v11.4s, v11.4s, v31.4s\n"
+    "add x17, x11, x13\n"
+    "stp q10, q11, [x17, #0x0]\n"
+    "zip1 v12.4s, v4.4s, v5.4s\n"
+    "zip2 v13.4s, v4.4s, v5.4s\n"
+    "fadd v12.4s, v12.4s, v28.4s\n"
+    "fadd v13.4s, v13.4s, v29.4s\n"
+    "fmax v12.4s, v12.4s, v30.4s\n"
+    "fmax v13.4s, v13.4s, v30.4s\n"
+    "fmin v12.4s, v12.4s, v31.4s\n"
+    "fmin v13.4s, v13.4s, v31.4s\n"
+    "add x17, x12, x13\n"
+    "stp q12, q13, [x17, #0x0]\n"
+    "zip1 v14.4s, v6.4s, v7.4s\n"
+    "zip2 v15.4s, v6.4s, v7.4s\n"
+    "fadd v14.4s, v14.4s, v28.4s\n"
+    "fadd v15.4s, v15.4s, v29.4s\n"
+    "fmax v14.4s, v14.4s, v30.4s\n"
+    "fmax v15.4s, v15.4s, v30.4s\n"
+    "fmin v14.4s, v14.4s, v31.4s\n"
+    "fmin v15.4s, v15.4s, v31.4s\n"
+    "add x17, x9, x13\n"
+    "stp q14, q15, [x17, #0x0]\n"
+    "add x13, x13, #0x20\n"
+    "add x15, x15, #0xb0\n"
+    "subs x16, x16, #0x1\n"
+    "bgt 1b\n"
+    "2:"  // End
+    :
+    : [n_channels] "r" ((unsigned long) n_channels), [offsetof_args_inptrs] "I" (offsetof(Args, inptrs)), [offsetof_args_max] "I" (offsetof(Args, max)), [offsetof_args_min] "I" (offsetof(Args, min)), [offsetof_args_outptrs] "I" (offsetof(Args, outptrs)), [offsetof_args_params] "I" (offsetof(Args, params)), [params_struct] "r" (&params_struct)
+    : "cc", "memory", "x9", "x10", "x11", "x12", "x13", "x14", "x15", "x16", "x17", "x20", "x21", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15", "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31"
+  );
+
+  // Channels which do not fill a pack of eight are computed here
+  const unsigned int n_channels_done = n_channels & ~7u;
+  if (n_channels_done < n_channels)
+  {
+    depthfirst_fp32bf16fp32_oddments<3, 3, 2, 2, 2, 2>(
+      input_ptrs, outptrs, params, n_channels_done, n_channels, activation_min, activation_max
+    );
+  }
+}
+
+}  // namespace depthwise
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__) && defined(ARM_COMPUTE_ENABLE_BF16)
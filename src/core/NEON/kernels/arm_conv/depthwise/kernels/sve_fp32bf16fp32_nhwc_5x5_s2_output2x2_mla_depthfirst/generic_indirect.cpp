@@ -0,0 +1,710 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "depthwise_depthfirst_fp32bf16fp32.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(ARM_COMPUTE_ENABLE_SVE) && defined(ARM_COMPUTE_ENABLE_BF16)
+
+namespace arm_conv {
+namespace depthwise {
+
+void sve_fp32bf16fp32_nhwc_5x5_s2_output2x2_mla_depthfirst_indirect_impl(
+  const float *const *const input_ptrs,
+  float *const *const outptrs,
+  const void *params,
+  unsigned int n_channels,
+  const float activation_min,
+  const float activation_max
+)
+{
+  struct Args
+  {
+    const float *const *inptrs;
+    float *const *outptrs;
+    const void *params;
+    const float min, max;
+
+    Args(
+      const float *const *const input_ptrs,
+      float *const *const outptrs,
+      const void *const params,
+      const float min,
+      const float max
+    ) : inptrs(input_ptrs), outptrs(outptrs), params(params), min(min), max(max)
+    {
+    }
+  };
+
+  Args params_struct(input_ptrs, outptrs, params,
+                     activation_min, activation_max);
+
+  __asm__ __volatile__(
+    "ldr x9, [%x[params_struct], %[offsetof_args_outptrs]]\n"
+    "ldr x14, [%x[params_struct], %[offsetof_args_inptrs]]\n"
+    "ldr x15, [%x[params_struct], %[offsetof_args_params]]\n"
+    "ptrue p2.b\n"
+    "mov x13, #0x0\n"
+    "ldp x10, x11, [x9, #0x0]\n"
+    "ldp x12, x9, [x9, #0x10]\n"
+    "1:"  // Channel loop
+    "whilelt p0.s, x13, %x[n_channels]\n"
+    "b.none 2f\n"
+    "mov x16, x13\n"
+    "incw x16\n"
+    "whilelt p1.s, x16, %x[n_channels]\n"
+    "mov z0.b, #0x0\n"
+    "mov z1.b, #0x0\n"
+    "mov z2.b, #0x0\n"
+    "mov z3.b, #0x0\n"
+    "mov z4.b, #0x0\n"
+    "mov z5.b, #0x0\n"
+    "mov z6.b, #0x0\n"
+    "mov z7.b, #0x0\n"
+    "ld1h { z8.h }, p2/Z, [x15, #2, MUL VL]\n"
+    "ld1h { z9.h }, p2/Z, [x15, #3, MUL VL]\n"
+    "ld1h { z10.h }, p2/Z, [x15, #4, MUL VL]\n"
+    "ld1h { z11.h }, p2/Z, [x15, #5, MUL VL]\n"
+    "ld1h { z12.h }, p2/Z, [x15, #6, MUL VL]\n"
+    "ld1h { z13.h }, p2/Z, [x15, #7, MUL VL]\n"
+    "addvl x16, x15, #8\n"
+    "ld1h { z14.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #9\n"
+    "ld1h { z15.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #10\n"
+    "ld1h { z16.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #11\n"
+    "ld1h { z17.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #12\n"
+    "ld1h { z18.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #13\n"
+    "ld1h { z19.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #14\n"
+    "ld1h { z20.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #15\n"
+    "ld1h { z21.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #16\n"
+    "ld1h { z22.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #17\n"
+    "ld1h { z23.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #18\n"
+    "ld1h { z24.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #19\n"
+    "ld1h { z25.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #20\n"
+    "ld1h { z26.h }, p2/Z, [x16]\n"
+    "addvl x16, x15, #21\n"
+    "ld1h { z27.h }, p2/Z, [x16]\n"
+    "ldr x17, [x14, #0x0]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64e883e0  // bfmlalb z0.s, z31.h, z8.h\n"
+    ".inst 0x64e887e1  // bfmlalt z1.s, z31.h, z8.h\n"
+    "ldr x17, [x14, #0x8]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64e983e0  // bfmlalb z0.s, z31.h, z9.h\n"
+    ".inst 0x64e987e1  // bfmlalt z1.s, z31.h, z9.h\n"
+    "ldr x17, [x14, #0x10]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64ea83e0  // bfmlalb z0.s, z31.h, z10.h\n"
+    ".inst 0x64ea87e1  // bfmlalt z1.s, z31.h, z10.h\n"
+    ".inst 0x64e883e2  // bfmlalb z2.s, z31.h, z8.h\n"
+    ".inst 0x64e887e3  // bfmlalt z3.s, z31.h, z8.h\n"
+    "ldr x17, [x14, #0x18]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64eb83e0  // bfmlalb z0.s, z31.h, z11.h\n"
+    ".inst 0x64eb87e1  // bfmlalt z1.s, z31.h, z11.h\n"
+    ".inst 0x64e983e2  // bfmlalb z2.s, z31.h, z9.h\n"
+    ".inst 0x64e987e3  // bfmlalt z3.s, z31.h, z9.h\n"
+    "ldr x17, [x14, #0x20]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64ec83e0  // bfmlalb z0.s, z31.h, z12.h\n"
+    ".inst 0x64ec87e1  // bfmlalt z1.s, z31.h, z12.h\n"
+    ".inst 0x64ea83e2  // bfmlalb z2.s, z31.h, z10.h\n"
+    ".inst 0x64ea87e3  // bfmlalt z3.s, z31.h, z10.h\n"
+    "ldr x17, [x14, #0x28]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64eb83e2  // bfmlalb z2.s, z31.h, z11.h\n"
+    ".inst 0x64eb87e3  // bfmlalt z3.s, z31.h, z11.h\n"
+    "ldr x17, [x14, #0x30]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64ec83e2  // bfmlalb z2.s, z31.h, z12.h\n"
+    ".inst 0x64ec87e3  // bfmlalt z3.s, z31.h, z12.h\n"
+    "ldr x17, [x14, #0x38]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64ed83e0  // bfmlalb z0.s, z31.h, z13.h\n"
+    ".inst 0x64ed87e1  // bfmlalt z1.s, z31.h, z13.h\n"
+    "ldr x17, [x14, #0x40]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64ee83e0  // bfmlalb z0.s, z31.h, z14.h\n"
+    ".inst 0x64ee87e1  // bfmlalt z1.s, z31.h, z14.h\n"
+    "ldr x17, [x14, #0x48]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64ef83e0  // bfmlalb z0.s, z31.h, z15.h\n"
+    ".inst 0x64ef87e1  // bfmlalt z1.s, z31.h, z15.h\n"
+    ".inst 0x64ed83e2  // bfmlalb z2.s, z31.h, z13.h\n"
+    ".inst 0x64ed87e3  // bfmlalt z3.s, z31.h, z13.h\n"
+    "ldr x17, [x14, #0x50]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f083e0  // bfmlalb z0.s, z31.h, z16.h\n"
+    ".inst 0x64f087e1  // bfmlalt z1.s, z31.h, z16.h\n"
+    ".inst 0x64ee83e2  // bfmlalb z2.s, z31.h, z14.h\n"
+    ".inst 0x64ee87e3  // bfmlalt z3.s, z31.h, z14.h\n"
+    "ldr x17, [x14, #0x58]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f183e0  // bfmlalb z0.s, z31.h, z17.h\n"
+    ".inst 0x64f187e1  // bfmlalt z1.s, z31.h, z17.h\n"
+    ".inst 0x64ef83e2  // bfmlalb z2.s, z31.h, z15.h\n"
+    ".inst 0x64ef87e3  // bfmlalt z3.s, z31.h, z15.h\n"
+    "ldr x17, [x14, #0x60]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f083e2  // bfmlalb z2.s, z31.h, z16.h\n"
+    ".inst 0x64f087e3  // bfmlalt z3.s, z31.h, z16.h\n"
+    "ldr x17, [x14, #0x68]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f183e2  // bfmlalb z2.s, z31.h, z17.h\n"
+    ".inst 0x64f187e3  // bfmlalt z3.s, z31.h, z17.h\n"
+    "ldr x17, [x14, #0x70]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f283e0  // bfmlalb z0.s, z31.h, z18.h\n"
+    ".inst 0x64f287e1  // bfmlalt z1.s, z31.h, z18.h\n"
+    ".inst 0x64e883e4  // bfmlalb z4.s, z31.h, z8.h\n"
+    ".inst 0x64e887e5  // bfmlalt z5.s, z31.h, z8.h\n"
+    "ldr x17, [x14, #0x78]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f383e0  // bfmlalb z0.s, z31.h, z19.h\n"
+    ".inst 0x64f387e1  // bfmlalt z1.s, z31.h, z19.h\n"
+    ".inst 0x64e983e4  // bfmlalb z4.s, z31.h, z9.h\n"
+    ".inst 0x64e987e5  // bfmlalt z5.s, z31.h, z9.h\n"
+    "ldr x17, [x14, #0x80]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f483e0  // bfmlalb z0.s, z31.h, z20.h\n"
+    ".inst 0x64f487e1  // bfmlalt z1.s, z31.h, z20.h\n"
+    ".inst 0x64f283e2  // bfmlalb z2.s, z31.h, z18.h\n"
+    ".inst 0x64f287e3  // bfmlalt z3.s, z31.h, z18.h\n"
+    ".inst 0x64ea83e4  // bfmlalb z4.s, z31.h, z10.h\n"
+    ".inst 0x64ea87e5  // bfmlalt z5.s, z31.h, z10.h\n"
+    ".inst 0x64e883e6  // bfmlalb z6.s, z31.h, z8.h\n"
+    ".inst 0x64e887e7  // bfmlalt z7.s, z31.h, z8.h\n"
+    "ldr x17, [x14, #0x88]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f583e0  // bfmlalb z0.s, z31.h, z21.h\n"
+    ".inst 0x64f587e1  // bfmlalt z1.s, z31.h, z21.h\n"
+    ".inst 0x64f383e2  // bfmlalb z2.s, z31.h, z19.h\n"
+    ".inst 0x64f387e3  // bfmlalt z3.s, z31.h, z19.h\n"
+    ".inst 0x64eb83e4  // bfmlalb z4.s, z31.h, z11.h\n"
+    ".inst 0x64eb87e5  // bfmlalt z5.s, z31.h, z11.h\n"
+    ".inst 0x64e983e6  // bfmlalb z6.s, z31.h, z9.h\n"
+    ".inst 0x64e987e7  // bfmlalt z7.s, z31.h, z9.h\n"
+    "ldr x17, [x14, #0x90]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f683e0  // bfmlalb z0.s, z31.h, z22.h\n"
+    ".inst 0x64f687e1  // bfmlalt z1.s, z31.h, z22.h\n"
+    ".inst 0x64f483e2  // bfmlalb z2.s, z31.h, z20.h\n"
+    ".inst 0x64f487e3  // bfmlalt z3.s, z31.h, z20.h\n"
+    ".inst 0x64ec83e4  // bfmlalb z4.s, z31.h, z12.h\n"
+    ".inst 0x64ec87e5  // bfmlalt z5.s, z31.h, z12.h\n"
+    ".inst 0x64ea83e6  // bfmlalb z6.s, z31.h, z10.h\n"
+    ".inst 0x64ea87e7  // bfmlalt z7.s, z31.h, z10.h\n"
+    "ldr x17, [x14, #0x98]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f583e2  // bfmlalb z2.s, z31.h, z21.h\n"
+    ".inst 0x64f587e3  // bfmlalt z3.s, z31.h, z21.h\n"
+    ".inst 0x64eb83e6  // bfmlalb z6.s, z31.h, z11.h\n"
+    ".inst 0x64eb87e7  // bfmlalt z7.s, z31.h, z11.h\n"
+    "ldr x17, [x14, #0xa0]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f683e2  // bfmlalb z2.s, z31.h, z22.h\n"
+    ".inst 0x64f687e3  // bfmlalt z3.s, z31.h, z22.h\n"
+    ".inst 0x64ec83e6  // bfmlalb z6.s, z31.h, z12.h\n"
+    ".inst 0x64ec87e7  // bfmlalt z7.s, z31.h, z12.h\n"
+    "ldr x17, [x14, #0xa8]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f783e0  // bfmlalb z0.s, z31.h, z23.h\n"
+    ".inst 0x64f787e1  // bfmlalt z1.s, z31.h, z23.h\n"
+    ".inst 0x64ed83e4  // bfmlalb z4.s, z31.h, z13.h\n"
+    ".inst 0x64ed87e5  // bfmlalt z5.s, z31.h, z13.h\n"
+    "ldr x17, [x14, #0xb0]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f883e0  // bfmlalb z0.s, z31.h, z24.h\n"
+    ".inst 0x64f887e1  // bfmlalt z1.s, z31.h, z24.h\n"
+    ".inst 0x64ee83e4  // bfmlalb z4.s, z31.h, z14.h\n"
+    ".inst 0x64ee87e5  // bfmlalt z5.s, z31.h, z14.h\n"
+    "ldr x17, [x14, #0xb8]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f983e0  // bfmlalb z0.s, z31.h, z25.h\n"
+    ".inst 0x64f987e1  // bfmlalt z1.s, z31.h, z25.h\n"
+    ".inst 0x64f783e2  // bfmlalb z2.s, z31.h, z23.h\n"
+    ".inst 0x64f787e3  // bfmlalt z3.s, z31.h, z23.h\n"
+    ".inst 0x64ef83e4  // bfmlalb z4.s, z31.h, z15.h\n"
+    ".inst 0x64ef87e5  // bfmlalt z5.s, z31.h, z15.h\n"
+    ".inst 0x64ed83e6  // bfmlalb z6.s, z31.h, z13.h\n"
+    ".inst 0x64ed87e7  // bfmlalt z7.s, z31.h, z13.h\n"
+    "ldr x17, [x14, #0xc0]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64fa83e0  // bfmlalb z0.s, z31.h, z26.h\n"
+    ".inst 0x64fa87e1  // bfmlalt z1.s, z31.h, z26.h\n"
+    ".inst 0x64f883e2  // bfmlalb z2.s, z31.h, z24.h\n"
+    ".inst 0x64f887e3  // bfmlalt z3.s, z31.h, z24.h\n"
+    ".inst 0x64f083e4  // bfmlalb z4.s, z31.h, z16.h\n"
+    ".inst 0x64f087e5  // bfmlalt z5.s, z31.h, z16.h\n"
+    ".inst 0x64ee83e6  // bfmlalb z6.s, z31.h, z14.h\n"
+    ".inst 0x64ee87e7  // bfmlalt z7.s, z31.h, z14.h\n"
+    "ldr x17, [x14, #0xc8]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64fb83e0  // bfmlalb z0.s, z31.h, z27.h\n"
+    ".inst 0x64fb87e1  // bfmlalt z1.s, z31.h, z27.h\n"
+    ".inst 0x64f983e2  // bfmlalb z2.s, z31.h, z25.h\n"
+    ".inst 0x64f987e3  // bfmlalt z3.s, z31.h, z25.h\n"
+    ".inst 0x64f183e4  // bfmlalb z4.s, z31.h, z17.h\n"
+    ".inst 0x64f187e5  // bfmlalt z5.s, z31.h, z17.h\n"
+    ".inst 0x64ef83e6  // bfmlalb z6.s, z31.h, z15.h\n"
+    ".inst 0x64ef87e7  // bfmlalt z7.s, z31.h, z15.h\n"
+    "ldr x17, [x14, #0xd0]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64fa83e2  // bfmlalb z2.s, z31.h, z26.h\n"
+    ".inst 0x64fa87e3  // bfmlalt z3.s, z31.h, z26.h\n"
+    ".inst 0x64f083e6  // bfmlalb z6.s, z31.h, z16.h\n"
+    ".inst 0x64f087e7  // bfmlalt z7.s, z31.h, z16.h\n"
+    "ldr x17, [x14, #0xd8]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64fb83e2  // bfmlalb z2.s, z31.h, z27.h\n"
+    ".inst 0x64fb87e3  // bfmlalt z3.s, z31.h, z27.h\n"
+    ".inst 0x64f183e6  // bfmlalb z6.s, z31.h, z17.h\n"
+    ".inst 0x64f187e7  // bfmlalt z7.s, z31.h, z17.h\n"
+    "ldr x17, [x14, #0xe0]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #22\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e0  // bfmlalb z0.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e1  // bfmlalt z1.s, z31.h, z28.h\n"
+    ".inst 0x64f283e4  // bfmlalb z4.s, z31.h, z18.h\n"
+    ".inst 0x64f287e5  // bfmlalt z5.s, z31.h, z18.h\n"
+    "ldr x17, [x14, #0xe8]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #23\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e0  // bfmlalb z0.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e1  // bfmlalt z1.s, z31.h, z28.h\n"
+    ".inst 0x64f383e4  // bfmlalb z4.s, z31.h, z19.h\n"
+    ".inst 0x64f387e5  // bfmlalt z5.s, z31.h, z19.h\n"
+    "ldr x17, [x14, #0xf0]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #24\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e0  // bfmlalb z0.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e1  // bfmlalt z1.s, z31.h, z28.h\n"
+    "addvl x16, x15, #22\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e2  // bfmlalb z2.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e3  // bfmlalt z3.s, z31.h, z28.h\n"
+    ".inst 0x64f483e4  // bfmlalb z4.s, z31.h, z20.h\n"
+    ".inst 0x64f487e5  // bfmlalt z5.s, z31.h, z20.h\n"
+    ".inst 0x64f283e6  // bfmlalb z6.s, z31.h, z18.h\n"
+    ".inst 0x64f287e7  // bfmlalt z7.s, z31.h, z18.h\n"
+    "ldr x17, [x14, #0xf8]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #25\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e0  // bfmlalb z0.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e1  // bfmlalt z1.s, z31.h, z28.h\n"
+    "addvl x16, x15, #23\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e2  // bfmlalb z2.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e3  // bfmlalt z3.s, z31.h, z28.h\n"
+    ".inst 0x64f583e4  // bfmlalb z4.s, z31.h, z21.h\n"
+    ".inst 0x64f587e5  // bfmlalt z5.s, z31.h, z21.h\n"
+    ".inst 0x64f383e6  // bfmlalb z6.s, z31.h, z19.h\n"
+    ".inst 0x64f387e7  // bfmlalt z7.s, z31.h, z19.h\n"
+    "ldr x17, [x14, #0x100]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #26\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e0  // bfmlalb z0.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e1  // bfmlalt z1.s, z31.h, z28.h\n"
+    "addvl x16, x15, #24\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e2  // bfmlalb z2.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e3  // bfmlalt z3.s, z31.h, z28.h\n"
+    ".inst 0x64f683e4  // bfmlalb z4.s, z31.h, z22.h\n"
+    ".inst 0x64f687e5  // bfmlalt z5.s, z31.h, z22.h\n"
+    ".inst 0x64f483e6  // bfmlalb z6.s, z31.h, z20.h\n"
+    ".inst 0x64f487e7  // bfmlalt z7.s, z31.h, z20.h\n"
+    "ldr x17, [x14, #0x108]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #25\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e2  // bfmlalb z2.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e3  // bfmlalt z3.s, z31.h, z28.h\n"
+    ".inst 0x64f583e6  // bfmlalb z6.s, z31.h, z21.h\n"
+    ".inst 0x64f587e7  // bfmlalt z7.s, z31.h, z21.h\n"
+    "ldr x17, [x14, #0x110]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #26\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e2  // bfmlalb z2.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e3  // bfmlalt z3.s, z31.h, z28.h\n"
+    ".inst 0x64f683e6  // bfmlalb z6.s, z31.h, z22.h\n"
+    ".inst 0x64f687e7  // bfmlalt z7.s, z31.h, z22.h\n"
+    "ldr x17, [x14, #0x118]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f783e4  // bfmlalb z4.s, z31.h, z23.h\n"
+    ".inst 0x64f787e5  // bfmlalt z5.s, z31.h, z23.h\n"
+    "ldr x17, [x14, #0x120]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f883e4  // bfmlalb z4.s, z31.h, z24.h\n"
+    ".inst 0x64f887e5  // bfmlalt z5.s, z31.h, z24.h\n"
+    "ldr x17, [x14, #0x128]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64f983e4  // bfmlalb z4.s, z31.h, z25.h\n"
+    ".inst 0x64f987e5  // bfmlalt z5.s, z31.h, z25.h\n"
+    ".inst 0x64f783e6  // bfmlalb z6.s, z31.h, z23.h\n"
+    ".inst 0x64f787e7  // bfmlalt z7.s, z31.h, z23.h\n"
+    "ldr x17, [x14, #0x130]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64fa83e4  // bfmlalb z4.s, z31.h, z26.h\n"
+    ".inst 0x64fa87e5  // bfmlalt z5.s, z31.h, z26.h\n"
+    ".inst 0x64f883e6  // bfmlalb z6.s, z31.h, z24.h\n"
+    ".inst 0x64f887e7  // bfmlalt z7.s, z31.h, z24.h\n"
+    "ldr x17, [x14, #0x138]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64fb83e4  // bfmlalb z4.s, z31.h, z27.h\n"
+    ".inst 0x64fb87e5  // bfmlalt z5.s, z31.h, z27.h\n"
+    ".inst 0x64f983e6  // bfmlalb z6.s, z31.h, z25.h\n"
+    ".inst 0x64f987e7  // bfmlalt z7.s, z31.h, z25.h\n"
+    "ldr x17, [x14, #0x140]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64fa83e6  // bfmlalb z6.s, z31.h, z26.h\n"
+    ".inst 0x64fa87e7  // bfmlalt z7.s, z31.h, z26.h\n"
+    "ldr x17, [x14, #0x148]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    ".inst 0x64fb83e6  // bfmlalb z6.s, z31.h, z27.h\n"
+    ".inst 0x64fb87e7  // bfmlalt z7.s, z31.h, z27.h\n"
+    "ldr x17, [x14, #0x150]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #22\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e4  // bfmlalb z4.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e5  // bfmlalt z5.s, z31.h, z28.h\n"
+    "ldr x17, [x14, #0x158]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #23\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e4  // bfmlalb z4.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e5  // bfmlalt z5.s, z31.h, z28.h\n"
+    "ldr x17, [x14, #0x160]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #24\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e4  // bfmlalb z4.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e5  // bfmlalt z5.s, z31.h, z28.h\n"
+    "addvl x16, x15, #22\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e6  // bfmlalb z6.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e7  // bfmlalt z7.s, z31.h, z28.h\n"
+    "ldr x17, [x14, #0x168]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #25\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e4  // bfmlalb z4.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e5  // bfmlalt z5.s, z31.h, z28.h\n"
+    "addvl x16, x15, #23\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e6  // bfmlalb z6.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e7  // bfmlalt z7.s, z31.h, z28.h\n"
+    "ldr x17, [x14, #0x170]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #26\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e4  // bfmlalb z4.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e5  // bfmlalt z5.s, z31.h, z28.h\n"
+    "addvl x16, x15, #24\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e6  // bfmlalb z6.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e7  // bfmlalt z7.s, z31.h, z28.h\n"
+    "ldr x17, [x14, #0x178]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #25\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e6  // bfmlalb z6.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e7  // bfmlalt z7.s, z31.h, z28.h\n"
+    "ldr x17, [x14, #0x180]\n"
+    "add x17, x17, x13, LSL #2\n"
+    "ld1w { z29.s }, p0/Z, [x17]\n"
+    "ld1w { z30.s }, p1/Z, [x17, #1, MUL VL]\n"
+    ".inst 0x658aabbf  // bfcvt z31.h, p2/m, z29.s\n"
+    ".inst 0x648aabdf  // bfcvtnt z31.h, p2/m, z30.s\n"
+    "addvl x16, x15, #26\n"
+    "ld1h { z28.h }, p2/Z, [x16]\n"
+    ".inst 0x64fc83e6  // bfmlalb z6.s, z31.h, z28.h\n"
+    ".inst 0x64fc87e7  // bfmlalt z7.s, z31.h, z28.h\n"
+    "add x20, %x[params_struct], %[offsetof_args_min]\n"
+    "add x21, %x[params_struct], %[offsetof_args_max]\n"
+    "ld1rw { z30.s }, p2/Z, [x20]\n"
+    "ld1rw { z31.s }, p2/Z, [x21]\n"
+    "ld1w { z28.s }, p2/Z, [x15]\n"
+    "ld1w { z29.s }, p2/Z, [x15, #1, MUL VL]\n"
+    "fadd z0.s, z0.s, z28.s\n"
+    "fadd z1.s, z1.s, z29.s\n"
+    "fmax z0.s, p2/M, z0.s, z30.s\n"
+    "fmax z1.s, p2/M, z1.s, z30.s\n"
+    "fmin z0.s, p2/M, z0.s, z31.s\n"
+    "fmin z1.s, p2/M, z1.s, z31.s\n"
+    "add x17, x10, x13, LSL #2\n"
+    "st1w { z0.s }, p0, [x17]\n"
+    "st1w { z1.s }, p1, [x17, #1, MUL VL]\n"
+    "fadd z2.s, z2.s, z28.s\n"
+    "fadd z3.s, z3.s, z29.s\n"
+    "fmax z2.s, p2/M, z2.s, z30.s\n"
+    "fmax z3.s, p2/M, z3.s, z30.s\n"
+    "fmin z2.s, p2/M, z2.s, z31.s\n"
+    "fmin z3.s, p2/M, z3.s, z31.s\n"
+    "add x17, x11, x13, LSL #2\n"
+    "st1w { z2.s }, p0, [x17]\n"
+    "st1w { z3.s }, p1, [x17, #1, MUL VL]\n"
+    "fadd z4.s, z4.s, z28.s\n"
+    "fadd z5.s, z5.s, z29.s\n"
+    "fmax z4.s, p2/M, z4.s, z30.s\n"
+    "fmax z5.s, p2/M, z5.s, z30.s\n"
+    "fmin z4.s, p2/M, z4.s, z31.s\n"
+    "fmin z5.s, p2/M, z5.s, z31.s\n"
+    "add x17, x12, x13, LSL #2\n"
+    "st1w { z4.s }, p0, [x17]\n"
+    "st1w { z5.s }, p1, [x17, #1, MUL VL]\n"
+    "fadd z6.s, z6.s, z28.s\n"
+    "fadd z7.s, z7.s, z29.s\n"
+    "fmax z6.s, p2/M, z6.s, z30.s\n"
+    "fmax z7.s, p2/M, z7.s, z30.s\n"
+    "fmin z6.s, p2/M, z6.s, z31.s\n"
+    "fmin z7.s, p2/M, z7.s, z31.s\n"
+    "add x17, x9, x13, LSL #2\n"
+    "st1w { z6.s }, p0, [x17]\n"
+    "st1w { z7.s }, p1, [x17, #1, MUL VL]\n"
+    "incw x13, ALL, MUL #2\n"
+    "addvl x15, x15, #27\n"
+    "b 1b\n"
+    "2:"  // End
+    :
+    : [n_channels] "r" ((unsigned long) n_channels), [offsetof_args_inptrs] "I" (offsetof(Args, inptrs)), [offsetof_args_max] "I" (offsetof(Args, max)), [offsetof_args_min] "I" (offsetof(Args, min)), [offsetof_args_outptrs] "I" (offsetof(Args, outptrs)), [offsetof_args_params] "I" (offsetof(Args, params)), [params_struct] "r" (&params_struct)
+    : "cc", "memory", "p0", "p1", "p2", "x9", "x10", "x11", "x12", "x13", "x14", "x15", "x16", "x17", "x20", "x21", "z0", "z1", "z2", "z3", "z4", "z5", "z6", "z7", "z8", "z9", "z10", "z11", "z12", "z13", "z14", "z15", "z16", "z17", "z18", "z19", "z20", "z21", "z22", "z23", "z24", "z25", "z26", "z27", "z28", "z29", "z30", "z31"
+  );
+}
+
+}  // namespace depthwise
+}  // namespace arm_conv
+
+#endif  // defined(ARM_COMPUTE_ENABLE_SVE) && defined(ARM_COMPUTE_ENABLE_BF16)
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__aarch64__) && defined(__ARM_FP16_ARGS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+namespace arm_conv {
+namespace pooling {
+
+void a64_fp16_nhwc_max_3x3_s2_output2x2_depthfirst_impl(
+  const unsigned int n_channels,
+  const __fp16 *const *const inptrs,
+  __fp16 *const *const outptrs,
+  const bool,
+  const unsigned int,
+  const unsigned int,
+  const unsigned int,
+  const unsigned int
+)
+{
+  // Each row of the 5x5 input patch is first reduced over the two horizontal
+  // windows; the centre column of a row is shared by both windows and the
+  // centre row of the patch is shared by both output rows.
+  unsigned int c = 0;
+  for (; c + 8 <= n_channels; c += 8)
+  {
+    float16x8_t rows[5][2];
+    for (unsigned int i = 0; i < 5; i++)
+    {
+      const __fp16 *const *const row = inptrs + i * 5;
+      const float16x8_t mid = vld1q_f16(row[2] + c);
+      rows[i][0] = vmaxq_f16(vmaxq_f16(vld1q_f16(row[0] + c), vld1q_f16(row[1] + c)), mid);
+      rows[i][1] = vmaxq_f16(vmaxq_f16(mid, vld1q_f16(row[3] + c)), vld1q_f16(row[4] + c));
+    }
+
+    for (unsigned int i = 0; i < 2; i++)
+    {
+      for (unsigned int j = 0; j < 2; j++)
+      {
+        const float16x8_t res = vmaxq_f16(vmaxq_f16(rows[2 * i][j], rows[2 * i + 1][j]), rows[2 * i + 2][j]);
+        vst1q_f16(outptrs[i * 2 + j] + c, res);
+      }
+    }
+  }
+
+  for (; c < n_channels; c++)
+  {
+    __fp16 rows[5][2];
+    for (unsigned int i = 0; i < 5; i++)
+    {
+      const __fp16 *const *const row = inptrs + i * 5;
+      const __fp16 mid = row[2][c];
+      rows[i][0] = std::max(std::max(row[0][c], row[1][c]), mid);
+      rows[i][1] = std::max(std::max(mid, row[3][c]), row[4][c]);
+    }
+
+    for (unsigned int i = 0; i < 2; i++)
+    {
+      for (unsigned int j = 0; j < 2; j++)
+      {
+        const __fp16 res = std::max(std::max(rows[2 * i][j], rows[2 * i + 1][j]), rows[2 * i + 2][j]);
+        outptrs[i * 2 + j][c] = res;
+      }
+    }
+  }
+}
+
+}  // namespace pooling
+}  // namespace arm_conv
+
+#endif  // defined(__aarch64__) && defined(__ARM_FP16_ARGS) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <arm_sve.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(ARM_COMPUTE_ENABLE_SVE) && defined(__ARM_FP16_ARGS)
+
+namespace arm_conv {
+namespace pooling {
+
+void sve_fp16_nhwc_avg_3x3_s2_output2x2_depthfirst_impl(
+  const unsigned int n_channels,
+  const __fp16 *const *const inptrs,
+  __fp16 *const *const outptrs,
+  const bool exclude_padding,
+  const unsigned int pad_left,
+  const unsigned int pad_top,
+  const unsigned int pad_right,
+  const unsigned int pad_bottom
+)
+{
+  // The input patch is 5x5; compute the divisor of each of the 2x2 outputs
+  // from the number of valid cells in its window.
+  __fp16 rescale_vals[4];
+  for (unsigned int i = 0; i < 2; i++)
+  {
+    const int start_i = static_cast<int>(2 * i) - static_cast<int>(pad_top);
+    const int end_i = std::min<int>(start_i + 3, 5 - pad_top - pad_bottom);
+    const int valid_rows = end_i - std::max<int>(0, start_i);
+
+    for (unsigned int j = 0; j < 2; j++)
+    {
+      const int start_j = static_cast<int>(2 * j) - static_cast<int>(pad_left);
+      const int end_j = std::min<int>(start_j + 3, 5 - pad_left - pad_right);
+      const int valid_cols = end_j - std::max<int>(0, start_j);
+
+      rescale_vals[i*2 + j] = static_cast<__fp16>(1.0f / static_cast<float>(
+        exclude_padding ? valid_rows * valid_cols : 9
+      ));
+    }
+  }
+
+  // Each row of the 5x5 input patch is first reduced over the two horizontal
+  // windows; the centre column of a row is shared by both windows and the
+  // centre row of the patch is shared by both output rows.
+  for (uint64_t c = 0; c < n_channels; c += svcnth())
+  {
+    const svbool_t pg = svwhilelt_b16(c, static_cast<uint64_t>(n_channels));
+
+    const svfloat16_t mid0 = svld1(pg, inptrs[2] + c);
+    const svfloat16_t row0_0 = svadd_x(pg, svadd_x(pg, svld1(pg, inptrs[0] + c), svld1(pg, inptrs[1] + c)), mid0);
+    const svfloat16_t row0_1 = svadd_x(pg, svadd_x(pg, mid0, svld1(pg, inptrs[3] + c)), svld1(pg, inptrs[4] + c));
+    const svfloat16_t mid1 = svld1(pg, inptrs[7] + c);
+    const svfloat16_t row1_0 = svadd_x(pg, svadd_x(pg, svld1(pg, inptrs[5] + c), svld1(pg, inptrs[6] + c)), mid1);
+    const svfloat16_t row1_1 = svadd_x(pg, svadd_x(pg, mid1, svld1(pg, inptrs[8] + c)), svld1(pg, inptrs[9] + c));
+    const svfloat16_t mid2 = svld1(pg, inptrs[12] + c);
+    const svfloat16_t row2_0 = svadd_x(pg, svadd_x(pg, svld1(pg, inptrs[10] + c), svld1(pg, inptrs[11] + c)), mid2);
+    const svfloat16_t row2_1 = svadd_x(pg, svadd_x(pg, mid2, svld1(pg, inptrs[13] + c)), svld1(pg, inptrs[14] + c));
+    const svfloat16_t mid3 = svld1(pg, inptrs[17] + c);
+    const svfloat16_t row3_0 = svadd_x(pg, svadd_x(pg, svld1(pg, inptrs[15] + c), svld1(pg, inptrs[16] + c)), mid3);
+    const svfloat16_t row3_1 = svadd_x(pg, svadd_x(pg, mid3, svld1(pg, inptrs[18] + c)), svld1(pg, inptrs[19] + c));
+    const svfloat16_t mid4 = svld1(pg, inptrs[22] + c);
+    const svfloat16_t row4_0 = svadd_x(pg, svadd_x(pg, svld1(pg, inptrs[20] + c), svld1(pg, inptrs[21] + c)), mid4);
+    const svfloat16_t row4_1 = svadd_x(pg, svadd_x(pg, mid4, svld1(pg, inptrs[23] + c)), svld1(pg, inptrs[24] + c));
+
+    svst1(pg, outptrs[0] + c, svmul_x(pg, svadd_x(pg, svadd_x(pg, row0_0, row1_0), row2_0), rescale_vals[0]));
+    svst1(pg, outptrs[1] + c, svmul_x(pg, svadd_x(pg, svadd_x(pg, row0_1, row1_1), row2_1), rescale_vals[1]));
+    svst1(pg, outptrs[2] + c, svmul_x(pg, svadd_x(pg, svadd_x(pg, row2_0, row3_0), row4_0), rescale_vals[2]));
+    svst1(pg, outptrs[3] + c, svmul_x(pg, svadd_x(pg, svadd_x(pg, row2_1, row3_1), row4_1), rescale_vals[3]));
+  }
+}
+
+}  // namespace pooling
+}  // namespace arm_conv
+
+#endif  // defined(ARM_COMPUTE_ENABLE_SVE) && defined(__ARM_FP16_ARGS)
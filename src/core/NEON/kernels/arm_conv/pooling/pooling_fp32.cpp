@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "pooling_implementation.hpp"
 #include "pooling_depthfirst.hpp"
 #include "pooling_depthfirst_generic.hpp"
+#include "pooling_global_parallel.hpp"
 
 #include "kernels/cpp_nhwc_1x1_stride_any_depthfirst.hpp"
 #if defined(__aarch64__)
@@ -38,11 +39,15 @@
 #endif  // defined(ARM_COMPUTE_ENABLE_SME)
 #if defined(ARM_COMPUTE_ENABLE_SVE)
 #include "kernels/sve_fp32_nhwc_max_2x2_s1_output2x2_depthfirst.hpp"
+#include "kernels/sve_fp32_nhwc_max_3x3_s2_output2x2_depthfirst.hpp"
+#include "kernels/sve_fp32_nhwc_avg_3x3_s2_output2x2_depthfirst.hpp"
 #include "kernels/sve_fp32_nhwc_avg_3x3_s1_output2x2_depthfirst.hpp"
 #include "kernels/sve_fp32_nhwc_avg_generic_depthfirst.hpp"
 #include "kernels/sve_fp32_nhwc_max_generic_depthfirst.hpp"
 #endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 #include "kernels/a64_fp32_nhwc_max_2x2_s1_output2x2_depthfirst.hpp"
+#include "kernels/a64_fp32_nhwc_max_3x3_s2_output2x2_depthfirst.hpp"
+#include "kernels/a64_fp32_nhwc_avg_3x3_s2_output2x2_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_avg_3x3_s1_output2x2_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_avg_generic_depthfirst.hpp"
 #include "kernels/a64_fp32_nhwc_max_generic_depthfirst.hpp"
@@ -64,6 +69,17 @@ static const PoolingImplementation<float, float> pooling_fp32_methods[] = {
       return new PoolingDepthfirstGeneric<float, float, Nothing>(strat, args);
     },
   },
+  {
+    PoolingMethod::DEPTHFIRST,
+    "cpp_fp32_nhwc_global_parallel",
+    [] (const PoolingArgs &args, const Nothing &) -> bool {
+      return is_supported_global_parallel(args);
+    },
+    nullptr,
+    [] (const PoolingArgs &args, const Nothing &) -> PoolingCommon<float, float> * {
+      return new PoolingGlobalParallel<float, float>(args);
+    },
+  },
 #if defined(__aarch64__)
 #if defined(ARM_COMPUTE_ENABLE_SME)
   {
@@ -144,6 +160,33 @@ static const PoolingImplementation<float, float> pooling_fp32_methods[] = {
       return new PoolingDepthfirst<float>(strat, args);
     },
   },
+  {
+    PoolingMethod::DEPTHFIRST,
+    "sve_fp32_nhwc_max_3x3_s2_output2x2_depthfirst",
+    [] (const PoolingArgs &args, const Nothing &os) -> bool {
+      return args.cpu_info->has_sve() &&
+             is_supported<sve_fp32_nhwc_max_3x3_s2_output2x2_depthfirst>(args, os);
+    },
+    nullptr,
+    [] (const PoolingArgs &args, const Nothing &) -> PoolingCommon<float, float> * {
+      auto strat = new sve_fp32_nhwc_max_3x3_s2_output2x2_depthfirst(args.cpu_info);
+      return new PoolingDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    PoolingMethod::DEPTHFIRST,
+    "sve_fp32_nhwc_avg_3x3_s2_output2x2_depthfirst",
+    [] (const PoolingArgs &args, const Nothing &os) -> bool {
+      return args.cpu_info->has_sve() &&
+             is_supported<sve_fp32_nhwc_avg_3x3_s2_output2x2_depthfirst>(args, os) &&
+             is_window_within_padded_input(args);
+    },
+    nullptr,
+    [] (const PoolingArgs &args, const Nothing &) -> PoolingCommon<float, float> * {
+      auto strat = new sve_fp32_nhwc_avg_3x3_s2_output2x2_depthfirst(args.cpu_info);
+      return new PoolingDepthfirst<float>(strat, args);
+    },
+  },
   {
     PoolingMethod::DEPTHFIRST,
     "sve_fp32_nhwc_avg_generic_depthfirst",
@@ -189,6 +232,29 @@ static const PoolingImplementation<float, float> pooling_fp32_methods[] = {
       return new PoolingDepthfirst<float>(strat, args);
     },
   },
+  {
+    PoolingMethod::DEPTHFIRST,
+    "a64_fp32_nhwc_max_3x3_s2_output2x2_depthfirst",
+    is_supported<a64_fp32_nhwc_max_3x3_s2_output2x2_depthfirst>,
+    nullptr,
+    [] (const PoolingArgs &args, const Nothing &) -> PoolingCommon<float, float> * {
+      auto strat = new a64_fp32_nhwc_max_3x3_s2_output2x2_depthfirst(args.cpu_info);
+      return new PoolingDepthfirst<float>(strat, args);
+    },
+  },
+  {
+    PoolingMethod::DEPTHFIRST,
+    "a64_fp32_nhwc_avg_3x3_s2_output2x2_depthfirst",
+    [] (const PoolingArgs &args, const Nothing &os) -> bool {
+      return is_supported<a64_fp32_nhwc_avg_3x3_s2_output2x2_depthfirst>(args, os) &&
+             is_window_within_padded_input(args);
+    },
+    nullptr,
+    [] (const PoolingArgs &args, const Nothing &) -> PoolingCommon<float, float> * {
+      auto strat = new a64_fp32_nhwc_avg_3x3_s2_output2x2_depthfirst(args.cpu_info);
+      return new PoolingDepthfirst<float>(strat, args);
+    },
+  },
   {
     PoolingMethod::DEPTHFIRST,
     "a64_fp32_nhwc_avg_generic_depthfirst",
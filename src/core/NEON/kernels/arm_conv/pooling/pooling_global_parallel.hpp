@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "pooling.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+namespace arm_conv {
+namespace pooling {
+
+/* Global pooling which can split the spatial reduction across threads.
+ *
+ * If there are enough channels every thread reduces a slice of the channels
+ * over the whole input. Otherwise, rather than leaving most threads idle,
+ * every thread reduces a band of input rows into a partial result held in its
+ * working space; the last thread to publish its partial result combines them
+ * all and writes the output.
+ *
+ * The caller must run every thread_id in [0, n_threads) exactly once per
+ * execution, and call prepare_execution() before starting them.
+ */
+template <typename TInput, typename TAccum>
+class PoolingGlobalParallel : public PoolingCommon<TInput, TInput>
+{
+  // Minimum number of channels worth handing to a thread
+  static constexpr unsigned int min_channels_per_thread = 16;
+
+  // Number of workloads which have published their partial result in the
+  // current execution.
+  mutable std::atomic<unsigned int> m_n_arrived;
+
+  TAccum initial_value(void) const
+  {
+    if (this->m_args.pool_type == PoolingType::MAX)
+    {
+      using limits = std::numeric_limits<TAccum>;
+      return limits::has_infinity ? -limits::infinity() : limits::lowest();
+    }
+    return static_cast<TAccum>(0);
+  }
+
+  void accumulate(
+    const TInput *input, size_t ld_input_col, size_t ld_input_row,
+    unsigned int start_row, unsigned int end_row, unsigned int width,
+    unsigned int channel_start, unsigned int channel_end,
+    TAccum *acc
+  ) const
+  {
+    for (unsigned int i = start_row; i < end_row; i++)
+    {
+      for (unsigned int j = 0; j < width; j++)
+      {
+        const TInput *inptr = input + i * ld_input_row + j * ld_input_col;
+        if (this->m_args.pool_type == PoolingType::MAX)
+        {
+          for (unsigned int c = channel_start; c < channel_end; c++)
+          {
+            acc[c] = std::max(acc[c], static_cast<TAccum>(inptr[c]));
+          }
+        }
+        else
+        {
+          for (unsigned int c = channel_start; c < channel_end; c++)
+          {
+            acc[c] += static_cast<TAccum>(inptr[c]);
+          }
+        }
+      }
+    }
+  }
+
+  void combine(const TAccum *partial, unsigned int n_channels, TAccum *acc) const
+  {
+    if (this->m_args.pool_type == PoolingType::MAX)
+    {
+      for (unsigned int c = 0; c < n_channels; c++)
+      {
+        acc[c] = std::max(acc[c], partial[c]);
+      }
+    }
+    else
+    {
+      for (unsigned int c = 0; c < n_channels; c++)
+      {
+        acc[c] += partial[c];
+      }
+    }
+  }
+
+  void finalise(
+    const TAccum *acc, unsigned int n_cells,
+    unsigned int channel_start, unsigned int channel_end,
+    TInput *output
+  ) const
+  {
+    if (this->m_args.pool_type == PoolingType::MAX)
+    {
+      for (unsigned int c = channel_start; c < channel_end; c++)
+      {
+        output[c] = static_cast<TInput>(acc[c]);
+      }
+    }
+    else
+    {
+      const TAccum rescale = static_cast<TAccum>(1) / static_cast<TAccum>(n_cells);
+      for (unsigned int c = channel_start; c < channel_end; c++)
+      {
+        output[c] = static_cast<TInput>(acc[c] * rescale);
+      }
+    }
+  }
+
+  protected:
+  void execute_internal(
+    unsigned int n_batches,
+    unsigned int input_height,
+    unsigned int input_width,
+    unsigned int n_channels,
+    const PaddingValues &,
+    const void *input,
+    size_t ld_input_col,
+    size_t ld_input_row,
+    size_t ld_input_batch,
+    unsigned int,
+    unsigned int,
+    void *output,
+    size_t,
+    size_t,
+    size_t ld_output_batch,
+    void *working_space,
+    unsigned int thread_id,
+    unsigned int n_threads
+  ) const override
+  {
+    auto inptr = static_cast<const TInput *>(input);
+    auto outptr = static_cast<TInput *>(output);
+    auto partials = static_cast<TAccum *>(working_space);
+    const auto n_cells = input_height * input_width;
+    const auto n_channel_blocks = arm_gemm::iceildiv(n_channels, min_channels_per_thread);
+
+    if (n_threads == 1 || n_channel_blocks >= n_threads)
+    {
+      // Split over channels; every thread computes complete outputs.
+      const auto channels_per_thread = arm_gemm::roundup(
+        arm_gemm::roundup(n_channels, min_channels_per_thread), n_threads) / n_threads;
+      const auto start_channel = std::min(thread_id * channels_per_thread, n_channels);
+      const auto end_channel = std::min(start_channel + channels_per_thread, n_channels);
+
+      TAccum *acc = partials + thread_id * n_channels;
+      for (unsigned int batch = 0; batch < n_batches; batch++)
+      {
+        std::fill(acc + start_channel, acc + end_channel, initial_value());
+        accumulate(inptr + batch * ld_input_batch, ld_input_col, ld_input_row,
+                   0, input_height, input_width, start_channel, end_channel, acc);
+        finalise(acc, n_cells, start_channel, end_channel, outptr + batch * ld_output_batch);
+      }
+      return;
+    }
+
+    // Split over rows; each thread publishes a partial result for every batch.
+    const size_t partial_size = static_cast<size_t>(n_batches) * n_channels;
+    const auto rows_per_thread = arm_gemm::iceildiv(input_height, n_threads);
+    const auto start_row = std::min(thread_id * rows_per_thread, input_height);
+    const auto end_row = std::min(start_row + rows_per_thread, input_height);
+
+    TAccum *acc = partials + thread_id * partial_size;
+    std::fill(acc, acc + partial_size, initial_value());
+    for (unsigned int batch = 0; batch < n_batches; batch++)
+    {
+      accumulate(inptr + batch * ld_input_batch, ld_input_col, ld_input_row,
+                 start_row, end_row, input_width, 0, n_channels, acc + batch * n_channels);
+    }
+
+    // Every one of the n_threads workloads runs exactly once per execution,
+    // so only the last to arrive reduces the partial results; the
+    // acquire-release ordering makes the other workloads' partials visible.
+    if (m_n_arrived.fetch_add(1, std::memory_order_acq_rel) + 1 < n_threads)
+    {
+      return;
+    }
+
+    for (unsigned int t = 0; t < n_threads; t++)
+    {
+      if (t != thread_id)
+      {
+        combine(partials + t * partial_size, partial_size, acc);
+      }
+    }
+    for (unsigned int batch = 0; batch < n_batches; batch++)
+    {
+      finalise(acc + batch * n_channels, n_cells, 0, n_channels, outptr + batch * ld_output_batch);
+    }
+  }
+
+  public:
+  PoolingGlobalParallel(const PoolingArgs &args)
+  : PoolingCommon<TInput, TInput>(args), m_n_arrived(0)
+  {
+  }
+
+  void prepare_execution(void) const override
+  {
+    m_n_arrived.store(0, std::memory_order_relaxed);
+  }
+
+  size_t get_working_size(unsigned int n_threads) const override
+  {
+    return this->get_working_size(n_threads, this->m_args.n_channels);
+  }
+
+  size_t get_working_size(unsigned int n_threads, unsigned int n_channels) const override
+  {
+    return sizeof(TAccum) * n_threads * this->m_args.n_batches * n_channels;
+  }
+};
+
+/* Global pooling over an unpadded input with few enough channels that
+ * splitting over channels alone would leave threads idle.
+ */
+inline bool is_supported_global_parallel(const PoolingArgs &args)
+{
+  constexpr unsigned int max_channels = 128;
+  return args.pool_window.rows == args.input_rows && args.pool_window.cols == args.input_cols &&
+         args.output_rows == 1 && args.output_cols == 1 &&
+         args.padding.left == 0 && args.padding.right == 0 &&
+         args.padding.top == 0 && args.padding.bottom == 0 &&
+         args.n_channels <= max_channels;
+}
+
+}  // namespace pooling
+}  // namespace arm_conv
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -112,5 +112,18 @@ bool is_supported(const PoolingArgs &args, const Nothing &)
           (args.pool_stride.cols == Strategy::stride_cols));
 }
 
+/* Average pooling kernels with a fixed window count every cell of the window
+ * when padding is included; this is only correct if no window extends past
+ * the padded input.
+ */
+inline bool is_window_within_padded_input(const PoolingArgs &args)
+{
+  return args.exclude_padding ||
+         ((args.output_rows - 1) * args.pool_stride.rows + args.pool_window.rows <=
+            args.padding.top + args.input_rows + args.padding.bottom &&
+          (args.output_cols - 1) * args.pool_stride.cols + args.pool_window.cols <=
+            args.padding.left + args.input_cols + args.padding.right);
+}
+
 }  //  namespace pooling
 }  //  namespace arm_conv
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "pooling_implementation.hpp"
 #include "pooling_depthfirst.hpp"
 #include "pooling_depthfirst_generic.hpp"
+#include "pooling_global_parallel.hpp"
 
 #include "kernels/cpp_nhwc_1x1_stride_any_depthfirst.hpp"
 #if defined(__aarch64__)
@@ -38,9 +39,11 @@
 #if defined(ARM_COMPUTE_ENABLE_SVE)
 #include "kernels/sve_s8_nhwc_avg_generic_depthfirst.hpp"
 #include "kernels/sve_s8_nhwc_max_2x2_s1_output2x2_depthfirst.hpp"
+#include "kernels/sve_s8_nhwc_max_3x3_s2_output2x2_depthfirst.hpp"
 #include "kernels/sve_s8_nhwc_max_generic_depthfirst.hpp"
 #endif  // defined(ARM_COMPUTE_ENABLE_SVE)
 #include "kernels/a64_s8_nhwc_max_2x2_s1_output2x2_depthfirst.hpp"
+#include "kernels/a64_s8_nhwc_max_3x3_s2_output2x2_depthfirst.hpp"
 #include "kernels/a64_s8_nhwc_avg_generic_depthfirst.hpp"
 #include "kernels/a64_s8_nhwc_max_generic_depthfirst.hpp"
 #endif  // defined(__aarch64__)
@@ -63,6 +66,17 @@ static const PoolingImplementation<int8_t, int8_t> pooling_s8_methods[] = {
       return new PoolingDepthfirstGeneric<int8_t>(strat, args);
     },
   },
+  {
+    PoolingMethod::DEPTHFIRST,
+    "cpp_s8_nhwc_global_parallel",
+    [] (const PoolingArgs &args, const Nothing &) -> bool {
+      return args.pool_type == PoolingType::MAX && is_supported_global_parallel(args);
+    },
+    nullptr,
+    [] (const PoolingArgs &args, const Nothing &) -> PoolingCommon<int8_t, int8_t> * {
+      return new PoolingGlobalParallel<int8_t, int8_t>(args);
+    },
+  },
 #if defined(__aarch64__)
 #if defined(ARM_COMPUTE_ENABLE_SME)
   {
@@ -117,6 +131,19 @@ static const PoolingImplementation<int8_t, int8_t> pooling_s8_methods[] = {
       return new PoolingDepthfirst<int8_t>(strat, args);
     },
   },
+  {
+    PoolingMethod::DEPTHFIRST,
+    "sve_s8_nhwc_max_3x3_s2_output2x2_depthfirst",
+    [] (const PoolingArgs &args, const Nothing &os) -> bool {
+      return args.cpu_info->has_sve() &&
+             is_supported<sve_s8_nhwc_max_3x3_s2_output2x2_depthfirst>(args, os);
+    },
+    nullptr,
+    [] (const PoolingArgs &args, const Nothing &) -> PoolingCommon<int8_t, int8_t> * {
+      auto strat = new sve_s8_nhwc_max_3x3_s2_output2x2_depthfirst(args.cpu_info);
+      return new PoolingDepthfirst<int8_t>(strat, args);
+    },
+  },
   {
     PoolingMethod::DEPTHFIRST,
     "sve_s8_nhwc_avg_generic_depthfirst",
@@ -152,6 +179,16 @@ static const PoolingImplementation<int8_t, int8_t> pooling_s8_methods[] = {
       return new PoolingDepthfirst<int8_t>(strat, args);
     },
   },
+  {
+    PoolingMethod::DEPTHFIRST,
+    "a64_s8_nhwc_max_3x3_s2_output2x2_depthfirst",
+    is_supported<a64_s8_nhwc_max_3x3_s2_output2x2_depthfirst>,
+    nullptr,
+    [] (const PoolingArgs &args, const Nothing &) -> PoolingCommon<int8_t, int8_t> * {
+      auto strat = new a64_s8_nhwc_max_3x3_s2_output2x2_depthfirst(args.cpu_info);
+      return new PoolingDepthfirst<int8_t>(strat, args);
+    },
+  },
   {
     PoolingMethod::DEPTHFIRST,
     "a64_s8_nhwc_avg_generic_depthfirst",
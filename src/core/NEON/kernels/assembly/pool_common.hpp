@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -71,6 +71,11 @@ public:
     virtual size_t get_working_size(unsigned int num_threads) const                          = 0;
     virtual size_t get_working_size(unsigned int num_threads, unsigned int n_channels) const = 0;
 
+    // Reset any state shared between the threads of an execution; called once before the threads start.
+    virtual void prepare_execution() const
+    {
+    }
+
     // Execute pooling over the specified area of memory.
     virtual void execute(const void *const input,
                          void *const       output,
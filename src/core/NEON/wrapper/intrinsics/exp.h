@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,14 +43,32 @@ namespace wrapper
     {                                       \
         ARM_COMPUTE_UNUSED(a);              \
         ARM_COMPUTE_ERROR("Not supported"); \
+    }                                       \
+    inline vtype vexpq_fast(const vtype &a) \
+    {                                       \
+        ARM_COMPUTE_UNUSED(a);              \
+        ARM_COMPUTE_ERROR("Not supported"); \
+    }
+
+#define VEXPQ_FAST_IMPL(vtype, postfix)       \
+    inline vtype vexpq_fast(const vtype &a)   \
+    {                                         \
+        return vexpq_fast_##postfix(a);       \
+    }                                         \
+    inline vtype vexpm1q_fast(const vtype &a) \
+    {                                         \
+        return vexpm1q_fast_##postfix(a);     \
     }
 
 VEXPQ_IMPL(float32x4_t, f32)
+VEXPQ_FAST_IMPL(float32x4_t, f32)
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 VEXPQ_IMPL(float16x8_t, f16)
+VEXPQ_FAST_IMPL(float16x8_t, f16)
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 VEXPQ_IMPL_INT(int32x4_t, s32)
 #undef VEXPQ_IMPL
+#undef VEXPQ_FAST_IMPL
 
 } // namespace wrapper
 } // namespace arm_compute
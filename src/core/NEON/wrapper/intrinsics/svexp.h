@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,10 +33,14 @@ namespace arm_compute
 {
 namespace wrapper
 {
-#define SVEXP_IMPL(vtype, postfix)                    \
-    inline vtype svexp_z(svbool_t pg, const vtype &a) \
-    {                                                 \
-        return svexp_##postfix##_z(pg, a);            \
+#define SVEXP_IMPL(vtype, postfix)                         \
+    inline vtype svexp_z(svbool_t pg, const vtype &a)      \
+    {                                                      \
+        return svexp_##postfix##_z(pg, a);                 \
+    }                                                      \
+    inline vtype svexp_fast_z(svbool_t pg, const vtype &a) \
+    {                                                      \
+        return svexp_fast_##postfix##_z(pg, a);            \
     }
 
 SVEXP_IMPL(svfloat32_t, f32)
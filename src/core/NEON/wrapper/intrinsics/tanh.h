@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,18 @@ VTANH_IMPL(float32x4_t, vtanhq, f32)
 VTANH_IMPL(float16x8_t, vtanhq, f16)
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 #undef VTANH_IMPL
+
+inline float32x4_t vtanh_fast(const float32x4_t &a)
+{
+    return vtanhq_fast_f32(a);
+}
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+// The F16 rational approximation is already as cheap as the fast F32 tier
+inline float16x8_t vtanh_fast(const float16x8_t &a)
+{
+    return vtanhq_f16(a);
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 } // namespace wrapper
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_WRAPPER_TANH_H */
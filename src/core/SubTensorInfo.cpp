@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023, 2025 Arm Limited.
+ * Copyright (c) 2017-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,8 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
 
+#include "src/core/helpers/Utils.h"
+
 namespace arm_compute
 {
 namespace
@@ -175,6 +177,13 @@ bool SubTensorInfo::extend_padding(const PaddingSize &padding)
     return _parent->extend_padding(padding);
 }
 
+bool SubTensorInfo::has_padding() const
+{
+    ARM_COMPUTE_ERROR_ON(_parent == nullptr);
+    // A sub-tensor that does not span the whole extent of its parent is a strided view with gaps between rows
+    return _parent->has_padding() || has_holes(*this);
+}
+
 int32_t SubTensorInfo::offset_element_in_bytes(const Coordinates &pos) const
 {
     ARM_COMPUTE_ERROR_ON_COORDINATES_DIMENSIONS_GTE(pos, _tensor_shape.num_dimensions());
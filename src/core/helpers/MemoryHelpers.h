@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,8 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/ITensorPack.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/MemoryFootprint.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 
 #include <memory>
@@ -46,6 +48,7 @@ struct WorkspaceDataElement
     int                          slot{-1};
     experimental::MemoryLifetime lifetime{experimental::MemoryLifetime::Temporary};
     std::unique_ptr<TensorType>  tensor{nullptr};
+    std::shared_ptr<ITensor>     shared{nullptr}; /**< Shared memory imported by tensor, if any */
 };
 
 template <typename TensorType>
@@ -196,5 +199,89 @@ void release_temporaries(const experimental::MemoryRequirements &mem_reqs, Works
         }
     }
 }
+
+/** Share the tensors with Persistent lifetime of a prepared workspace with the functions holding identical ones
+ *
+ * Each persistent tensor gets its memory replaced by the copy returned by
+ * @ref IWeightsManager::share_prepared_weights, so that instances of the same model hold their prepared weights once.
+ *
+ * @note Only valid once the operator is prepared, and for operators that never write persistent tensors after that.
+ */
+template <typename TensorType>
+void share_persistent_tensors(const experimental::MemoryRequirements &mem_reqs,
+                              WorkspaceData<TensorType>              &workspace,
+                              IWeightsManager                        *weights_manager)
+{
+    if (weights_manager == nullptr)
+    {
+        return;
+    }
+
+    for (auto &ws : workspace)
+    {
+        auto tensor = ws.tensor.get();
+        if (ws.lifetime != experimental::MemoryLifetime::Persistent || ws.shared != nullptr ||
+            !tensor->allocator()->is_allocated())
+        {
+            continue;
+        }
+        for (auto &m : mem_reqs)
+        {
+            if (m.slot == ws.slot)
+            {
+                ws.shared = weights_manager->share_prepared_weights(tensor, m.alignment);
+                tensor->allocator()->free();
+                tensor->allocator()->import_memory(ws.shared->buffer());
+                break;
+            }
+        }
+    }
+}
+
+/** Memory footprint of a function built on top of an operator workspace
+ *
+ * Persistent, Temporary and Prepare requirements are accounted as prepared weights, workspace and prepare workspace
+ * respectively. The original weights are only accounted when constant and still in use, that is until the function
+ * marks them as unused after preparing its own copy.
+ *
+ * @param[in] mem_reqs Memory requirements of the operator
+ * @param[in] weights  (Optional) Original weights consumed by the function
+ *
+ * @return The memory footprint
+ */
+inline MemoryFootprint workspace_footprint(const experimental::MemoryRequirements &mem_reqs,
+                                           const ITensor                          *weights = nullptr)
+{
+    MemoryFootprint footprint{};
+    if (weights != nullptr && weights->is_used() && weights->info()->are_values_constant())
+    {
+        const ITensorInfo *info = weights->info();
+        footprint.const_weights += info->total_size();
+        footprint.padding += info->total_size() - info->tensor_shape().total_size() * info->element_size();
+        ++footprint.num_allocations;
+    }
+    for (const auto &req : mem_reqs)
+    {
+        if (req.size == 0)
+        {
+            continue;
+        }
+        switch (req.lifetime)
+        {
+            case experimental::MemoryLifetime::Persistent:
+                footprint.prepared_weights += req.size;
+                break;
+            case experimental::MemoryLifetime::Prepare:
+                footprint.prepare_workspace += req.size;
+                break;
+            case experimental::MemoryLifetime::Temporary:
+            default:
+                footprint.workspace += req.size;
+                break;
+        }
+        ++footprint.num_allocations;
+    }
+    return footprint;
+}
 } // namespace arm_compute
 #endif // ACL_SRC_CORE_HELPERS_MEMORYHELPERS_H
@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2020-2022 Arm Limited.
+* Copyright (c) 2020-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,8 @@
  */
 #include "src/core/helpers/WindowHelpers.h"
 
+#include "src/core/helpers/Utils.h"
+
 namespace arm_compute
 {
 Window
@@ -346,4 +348,30 @@ std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &sr
     return std::make_pair(win, split_dimension);
 }
 
+std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &src, const ITensorInfo *dst)
+{
+    auto win_and_split = calculate_squashed_or_max_window(src);
+
+    // An uninitialized destination will be auto-initialized as a dense tensor
+    if (win_and_split.second == Window::DimX && dst != nullptr && dst->total_size() != 0 && has_holes(*dst))
+    {
+        win_and_split = std::make_pair(calculate_max_window(src.tensor_shape()), static_cast<size_t>(Window::DimY));
+    }
+    return win_and_split;
+}
+
+std::pair<Window, size_t>
+calculate_squashed_or_max_window(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo *dst)
+{
+    auto win_and_split = calculate_squashed_or_max_window(src0, src1);
+
+    // An uninitialized destination will be auto-initialized as a dense tensor
+    if (win_and_split.second == Window::DimX && dst != nullptr && dst->total_size() != 0 && has_holes(*dst))
+    {
+        const TensorShape out_shape = TensorShape::broadcast_shape(src0.tensor_shape(), src1.tensor_shape());
+        win_and_split = std::make_pair(calculate_max_window(out_shape), static_cast<size_t>(Window::DimY));
+    }
+    return win_and_split;
+}
+
 } // namespace arm_compute
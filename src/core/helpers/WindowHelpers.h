@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2020-2022 Arm Limited.
+* Copyright (c) 2020-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -212,6 +212,32 @@ std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &sr
  */
 std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &src0, const ITensorInfo &src1);
 
+/** Calculate the squashed or maximum window for the given source and destination tensors.
+ *
+ * Same as @ref calculate_squashed_or_max_window(const ITensorInfo &) but the window is only squashed if the
+ * destination is also dense, so that strided views (e.g. sub-tensors) can be used as destination.
+ *
+ * @param[in] src Tensor info object defining the shape of the input tensor.
+ * @param[in] dst Tensor info object of the output tensor. Ignored if nullptr or not initialized yet.
+ *
+ * @return The squashed or maximum window the kernel can be executed on and the preferred split dimension.
+ */
+std::pair<Window, size_t> calculate_squashed_or_max_window(const ITensorInfo &src, const ITensorInfo *dst);
+
+/** Calculate the squashed or maximum window for the given source and destination tensors.
+ *
+ * Same as @ref calculate_squashed_or_max_window(const ITensorInfo &, const ITensorInfo &) but the window is only
+ * squashed if the destination is also dense, so that strided views (e.g. sub-tensors) can be used as destination.
+ *
+ * @param[in] src0 Tensor info object defining the shape of the first input tensor.
+ * @param[in] src1 Tensor info object defining the shape of the second input tensor.
+ * @param[in] dst  Tensor info object of the output tensor. Ignored if nullptr or not initialized yet.
+ *
+ * @return The squashed or maximum window the kernel can be executed on and the preferred split dimension.
+ */
+std::pair<Window, size_t>
+calculate_squashed_or_max_window(const ITensorInfo &src0, const ITensorInfo &src1, const ITensorInfo *dst);
+
 /** Function to compute the shape of output and window for the given inputs
  *
  * @param[in] infos Input tensor informations
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022 Arm Limited.
+ * Copyright (c) 2020, 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,9 +26,13 @@
 
 #include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/Utility.h"
 
 #include "src/common/cpuinfo/CpuIsaInfo.h"
 
+#include <algorithm>
+#include <cmath>
+
 float arm_compute::scale_utils::calculate_resize_ratio(size_t input_size, size_t output_size, bool align_corners)
 {
     const size_t offset = (align_corners && output_size > 1) ? 1 : 0;
@@ -66,3 +70,71 @@ bool arm_compute::scale_utils::is_precomputation_required(DataLayout          da
 
     return true;
 }
+
+arm_compute::scale_utils::ScaleTaps arm_compute::scale_utils::compute_scale_taps(size_t              input_size,
+                                                                               size_t              output_size,
+                                                                               InterpolationPolicy policy,
+                                                                               SamplingPolicy      sampling_policy,
+                                                                               bool                align_corners)
+{
+    ARM_COMPUTE_ERROR_ON(policy != InterpolationPolicy::BILINEAR && policy != InterpolationPolicy::AREA);
+
+    const float ratio           = calculate_resize_ratio(input_size, output_size, align_corners);
+    const float sampling_offset = (sampling_policy == SamplingPolicy::CENTER) ? 0.5f : 0.f;
+    const int   in_size         = static_cast<int>(input_size);
+
+    ScaleTaps taps;
+    taps.start.reserve(output_size + 1);
+
+    const auto add_tap = [&](int index, float weight)
+    {
+        taps.index.push_back(utility::clamp<int>(index, 0, in_size - 1));
+        taps.weight.push_back(weight);
+    };
+
+    for (size_t out = 0; out < output_size; ++out)
+    {
+        taps.start.push_back(static_cast<int32_t>(taps.index.size()));
+        if (policy == InterpolationPolicy::BILINEAR)
+        {
+            const float in_f = out * ratio + sampling_offset * (ratio - 1);
+            const int   in_i = static_cast<int>(std::floor(in_f));
+            const float frac = in_f - static_cast<float>(in_i);
+            add_tap(in_i, 1.f - frac);
+            add_tap(in_i + 1, frac);
+        }
+        else
+        {
+            // Same box as the reference area interpolation, which extends at most one element past each border
+            const int   from   = std::max(static_cast<int>(std::floor(out * ratio - 0.5f)), -1);
+            const int   to     = std::min(static_cast<int>(std::ceil((out + 1) * ratio - 0.5f)), in_size);
+            const float weight = 1.f / static_cast<float>(to - from + 1);
+            for (int i = from; i <= to; ++i)
+            {
+                add_tap(i, weight);
+            }
+        }
+    }
+    taps.start.push_back(static_cast<int32_t>(taps.index.size()));
+
+    // Quantize the weights to Q15, giving the rounding error to the largest weight so that each set adds up to one
+    taps.weight_q15.resize(taps.weight.size());
+    for (size_t out = 0; out < output_size; ++out)
+    {
+        const int32_t first   = taps.start[out];
+        const int32_t last    = taps.start[out + 1];
+        int32_t       largest = first;
+        int32_t       sum     = 0;
+        for (int32_t t = first; t < last; ++t)
+        {
+            const auto q       = static_cast<int32_t>(std::lround(taps.weight[t] * 32768.f));
+            taps.weight_q15[t] = static_cast<uint16_t>(q);
+            sum += q;
+            largest = (taps.weight[t] > taps.weight[largest]) ? t : largest;
+        }
+        taps.weight_q15[largest] = static_cast<uint16_t>(taps.weight_q15[largest] + (32768 - sum));
+        taps.max_taps            = std::max(taps.max_taps, last - first);
+    }
+
+    return taps;
+}
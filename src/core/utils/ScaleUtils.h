@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022 Arm Limited.
+ * Copyright (c) 2020, 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,10 @@
 #define UTILS_CORE_SCALEUTILS_H
 
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/math/Math.h"
+
+#include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
@@ -65,6 +69,74 @@ bool is_precomputation_required(DataLayout          data_layout,
                                 InterpolationPolicy policy,
                                 BorderMode          border_mode);
 
+/** Precomputed one-dimensional resampling taps
+ *
+ * The taps of output coordinate i are the entries [start[i], start[i + 1]) of @p index and of the weight arrays.
+ * Source coordinates are already clamped to the input, so the taps implement the replicate border mode.
+ */
+struct ScaleTaps
+{
+    std::vector<int32_t>  start{};      /**< First tap of each output coordinate, then the total number of taps */
+    std::vector<int32_t>  index{};      /**< Source coordinate of each tap */
+    std::vector<float>    weight{};     /**< Weight of each tap */
+    std::vector<uint16_t> weight_q15{}; /**< Weight of each tap in Q15, adding up to 1 << 15 for each output */
+    int32_t               max_taps{0};  /**< Largest number of taps of an output coordinate */
+};
+
+/** Computes the taps resampling one dimension for bilinear or area interpolation
+ *
+ * @param[in] input_size      The input size
+ * @param[in] output_size     The output size
+ * @param[in] policy          Interpolation policy. Supported: BILINEAR/AREA
+ * @param[in] sampling_policy Sampling policy
+ * @param[in] align_corners   True to align corners of input and output.
+ *
+ * @return The taps of every output coordinate
+ */
+ScaleTaps compute_scale_taps(size_t              input_size,
+                             size_t              output_size,
+                             InterpolationPolicy policy,
+                             SamplingPolicy      sampling_policy,
+                             bool                align_corners);
+
+/** Byte offset of the first cached row in the per-thread working space of a separable resize
+ *
+ * The working space starts with, for each slot, the source row held in it and a pointer to it.
+ *
+ * @param[in] max_taps Largest number of vertical taps of an output row
+ *
+ * @return The offset in bytes
+ */
+inline size_t separable_scratch_rows_offset(int32_t max_taps)
+{
+    return ceil_to_multiple(static_cast<size_t>(max_taps) * (sizeof(int32_t) + sizeof(void *)), size_t(64));
+}
+
+/** Byte stride between two cached rows in the per-thread working space of a separable resize
+ *
+ * @param[in] row_length   Number of elements in a horizontally resampled row
+ * @param[in] element_size Size in bytes of the intermediate elements
+ *
+ * @return The stride in bytes
+ */
+inline size_t separable_scratch_row_stride(size_t row_length, size_t element_size)
+{
+    return ceil_to_multiple(row_length * element_size, size_t(64));
+}
+
+/** Size of the per-thread working space of a separable resize
+ *
+ * @param[in] max_taps     Largest number of vertical taps of an output row
+ * @param[in] row_length   Number of elements in a horizontally resampled row
+ * @param[in] element_size Size in bytes of the intermediate elements
+ *
+ * @return The size in bytes
+ */
+inline size_t separable_scratch_size(int32_t max_taps, size_t row_length, size_t element_size)
+{
+    return separable_scratch_rows_offset(max_taps) +
+           static_cast<size_t>(max_taps) * separable_scratch_row_stride(row_length, element_size);
+}
 } // namespace scale_utils
 } // namespace arm_compute
 #endif /* UTILS_CORE_SCALEUTILS_H */
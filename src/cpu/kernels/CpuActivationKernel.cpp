@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "src/cpu/kernels/activation/heuristics/CpuActivationKernelHeuristics.h"
 #include "src/cpu/kernels/activation/list.h"
 #include "src/cpu/kernels/logistic/list.h"
+#include "src/cpu/utils/CpuCostModel.h"
 
 #include <array>
 
@@ -262,6 +263,11 @@ size_t CpuActivationKernel::get_mws(const CPUInfo &platform, size_t thread_count
     return _heuristics.mws();
 }
 
+uint64_t CpuActivationKernel::estimate_cost(const CPUInfo &platform, const Window &window) const
+{
+    return estimate_elementwise_cost(platform, window, activation_element_cost(_act_info.activation()));
+}
+
 void CpuActivationKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
 {
     // Early exit on disabled activation
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, 2024 Arm Limited.
+ * Copyright (c) 2021-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/add/list.h"
+#include "src/cpu/utils/CpuCostModel.h"
 
 #include <array>
 
@@ -183,7 +184,7 @@ void CpuAddKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1, I
 
     // Configure kernel window
     Window win;
-    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src0, *src1);
+    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src0, *src1, dst);
 
     ICpuKernel::configure(win);
 }
@@ -264,6 +265,11 @@ size_t CpuAddKernel::get_mws(const CPUInfo &platform, size_t thread_count) const
     return ICPPKernel::default_mws;
 }
 
+uint64_t CpuAddKernel::estimate_cost(const CPUInfo &platform, const Window &window) const
+{
+    return estimate_elementwise_cost(platform, window, ElementCost::LIGHT);
+}
+
 } // namespace kernels
 } // namespace cpu
 } // namespace arm_compute
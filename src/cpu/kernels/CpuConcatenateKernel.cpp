@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuConcatenateKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/NEON/NEAsymm.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, size_t axis)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(srcs.empty());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(axis > 3, "Axis not supported");
+
+    size_t offset = 0;
+    for (const ITensorInfo *src : srcs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
+        // Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src) is not needed here as this kernel doesn't use CPU FP16 instructions.
+        ARM_COMPUTE_RETURN_ERROR_ON(src->data_type() == DataType::UNKNOWN);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(axis) + offset > dst->dimension(axis));
+
+        for (size_t i = 0; i < Coordinates::num_max_dimensions; ++i)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(i != axis && src->dimension(i) != dst->dimension(i));
+        }
+        offset += src->dimension(axis);
+    }
+
+    return Status{};
+}
+
+Status validate_stack_arguments(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, size_t axis)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(srcs.empty());
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(srcs[0]);
+
+    const size_t rank = srcs[0]->num_dimensions();
+    for (const ITensorInfo *src : srcs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
+        // Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src) is not needed here as this kernel doesn't use CPU FP16 instructions.
+        ARM_COMPUTE_RETURN_ERROR_ON(src->data_type() == DataType::UNKNOWN);
+        ARM_COMPUTE_RETURN_ERROR_ON(axis > src->num_dimensions());
+        ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+        ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() != rank);
+
+        if (dst->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+                dst->tensor_shape(), misc::shape_calculator::compute_stack_shape(*src, axis, srcs.size()));
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(src, dst);
+        }
+    }
+
+    return Status{};
+}
+
+void requantize_run_qasymm8(const uint8_t                 *src_ptr,
+                            uint8_t                       *dst_ptr,
+                            size_t                         len,
+                            const UniformQuantizationInfo &src_qinfo,
+                            const UniformQuantizationInfo &dst_qinfo)
+{
+    constexpr size_t step = 16;
+
+    size_t x = 0;
+    for (; x + step <= len; x += step)
+    {
+        vst1q_u8(dst_ptr + x, vquantize(vdequantize(vld1q_u8(src_ptr + x), src_qinfo), dst_qinfo));
+    }
+
+    // Compute left-over elements
+    for (; x < len; ++x)
+    {
+        dst_ptr[x] = quantize_qasymm8(dequantize_qasymm8(src_ptr[x], src_qinfo), dst_qinfo);
+    }
+}
+
+void requantize_run_qasymm8_signed(const uint8_t                 *src_ptr,
+                                   uint8_t                       *dst_ptr,
+                                   size_t                         len,
+                                   const UniformQuantizationInfo &src_qinfo,
+                                   const UniformQuantizationInfo &dst_qinfo)
+{
+    constexpr size_t step = 16;
+
+    const auto src = reinterpret_cast<const int8_t *>(src_ptr);
+    auto       dst = reinterpret_cast<int8_t *>(dst_ptr);
+
+    size_t x = 0;
+    for (; x + step <= len; x += step)
+    {
+        vst1q_s8(dst + x, vquantize_signed(vdequantize(vld1q_s8(src + x), src_qinfo), dst_qinfo));
+    }
+
+    // Compute left-over elements
+    for (; x < len; ++x)
+    {
+        dst[x] = quantize_qasymm8_signed(dequantize_qasymm8_signed(src[x], src_qinfo), dst_qinfo);
+    }
+}
+} // namespace
+
+void CpuConcatenateKernel::configure(const std::vector<const ITensorInfo *> &srcs, ITensorInfo *dst, size_t axis)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(srcs, dst, axis));
+
+    _plans.clear();
+    _total_bytes = 0;
+    _data_type   = dst->data_type();
+    _dst_qinfo   = dst->quantization_info().uniform();
+
+    DimArray dst_dims{};
+    for (size_t i = 0; i < dst_dims.size(); ++i)
+    {
+        dst_dims[i] = i;
+    }
+
+    size_t offset = 0;
+    for (const ITensorInfo *src : srcs)
+    {
+        add_source(*src, *dst, dst_dims,
+                   dst->offset_first_element_in_bytes() + offset * dst->strides_in_bytes()[axis]);
+        offset += src->dimension(axis);
+    }
+
+    configure_window();
+}
+
+Status CpuConcatenateKernel::validate(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, size_t axis)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(srcs, dst, axis));
+    return Status{};
+}
+
+void CpuConcatenateKernel::configure_stack(const std::vector<const ITensorInfo *> &srcs, ITensorInfo *dst, size_t axis)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_stack_arguments(srcs, dst, axis));
+
+    auto_init_if_empty(*dst, srcs[0]->clone()->set_tensor_shape(
+                                 misc::shape_calculator::compute_stack_shape(*srcs[0], axis, srcs.size())));
+
+    _plans.clear();
+    _total_bytes = 0;
+    _data_type   = dst->data_type();
+    _dst_qinfo   = dst->quantization_info().uniform();
+
+    // Source dimensions from axis onwards are shifted by one in the destination
+    DimArray dst_dims{};
+    for (size_t i = 0; i < dst_dims.size(); ++i)
+    {
+        dst_dims[i] = i < axis ? i : i + 1;
+    }
+
+    for (size_t i = 0; i < srcs.size(); ++i)
+    {
+        add_source(*srcs[i], *dst, dst_dims, dst->offset_first_element_in_bytes() + i * dst->strides_in_bytes()[axis]);
+    }
+
+    configure_window();
+}
+
+Status
+CpuConcatenateKernel::validate_stack(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, size_t axis)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_stack_arguments(srcs, dst, axis));
+    return Status{};
+}
+
+void CpuConcatenateKernel::add_source(const ITensorInfo &src,
+                                      const ITensorInfo &dst,
+                                      const DimArray    &dst_dims,
+                                      size_t             dst_offset)
+{
+    const size_t   num_dims    = src.num_dimensions();
+    const Strides &src_strides = src.strides_in_bytes();
+    const Strides &dst_strides = dst.strides_in_bytes();
+    const size_t   es          = src.element_size();
+
+    SourcePlan plan{};
+    plan.bytes_begin = _total_bytes;
+    plan.src_offset  = src.offset_first_element_in_bytes();
+    plan.dst_offset  = dst_offset;
+    plan.src_qinfo   = src.quantization_info().uniform();
+    plan.requantize  = (_data_type == DataType::QASYMM8 || _data_type == DataType::QASYMM8_SIGNED) &&
+                      plan.src_qinfo != _dst_qinfo;
+
+    // Fold the innermost dimensions into a single run as long as they are dense in both tensors
+    // and are written to the same dimension of the destination
+    size_t d             = 0;
+    size_t run_bytes     = es;
+    size_t dst_run_bytes = es;
+    for (; d < num_dims; ++d)
+    {
+        if (dst_dims[d] != d || src_strides[d] != run_bytes || dst_strides[d] != dst_run_bytes)
+        {
+            break;
+        }
+        run_bytes *= src.dimension(d);
+        dst_run_bytes *= dst.dimension(d);
+        if (src.dimension(d) != dst.dimension(d))
+        {
+            // The run stops being contiguous in the destination after this dimension
+            ++d;
+            break;
+        }
+    }
+    plan.run_bytes = run_bytes;
+    plan.num_runs  = 1;
+
+    // The remaining dimensions are iterated over, one run at a time
+    for (; d < num_dims; ++d)
+    {
+        if (src.dimension(d) > 1)
+        {
+            plan.run_shape[plan.num_run_dims]   = src.dimension(d);
+            plan.src_strides[plan.num_run_dims] = src_strides[d];
+            plan.dst_strides[plan.num_run_dims] = dst_strides[dst_dims[d]];
+            plan.num_runs *= src.dimension(d);
+            ++plan.num_run_dims;
+        }
+    }
+
+    _total_bytes += plan.run_bytes * plan.num_runs;
+    _plans.push_back(plan);
+}
+
+void CpuConcatenateKernel::configure_window()
+{
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, DIV_CEIL(_total_bytes, chunk_bytes), 1));
+    ICpuKernel::configure(win);
+}
+
+void CpuConcatenateKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    auto dst = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+
+    const size_t start = window.x().start() * chunk_bytes;
+    const size_t end   = std::min(window.x().end() * chunk_bytes, _total_bytes);
+
+    // Find the source holding the first byte of this window
+    auto plan_it = std::upper_bound(_plans.begin(), _plans.end(), start,
+                                    [](size_t pos, const SourcePlan &plan) { return pos < plan.bytes_begin; });
+    --plan_it;
+
+    for (size_t pos = start; pos < end; ++plan_it)
+    {
+        const SourcePlan &plan = *plan_it;
+        const ITensor    *src  = tensors.get_const_tensor(TensorType::ACL_SRC_VEC + (plan_it - _plans.begin()));
+        ARM_COMPUTE_ERROR_ON_NULLPTR(src);
+
+        const uint8_t *src_base = src->buffer() + plan.src_offset;
+        uint8_t       *dst_base = dst->buffer() + plan.dst_offset;
+
+        const size_t local_end = std::min(end - plan.bytes_begin, plan.run_bytes * plan.num_runs);
+        size_t       local     = pos - plan.bytes_begin;
+        size_t       run       = local / plan.run_bytes;
+        size_t       run_pos   = local % plan.run_bytes;
+
+        // Coordinates and offsets of the first run
+        DimArray coords{};
+        size_t   src_off = 0;
+        size_t   dst_off = 0;
+        for (size_t d = 0; d < plan.num_run_dims; ++d)
+        {
+            coords[d] = run % plan.run_shape[d];
+            run /= plan.run_shape[d];
+            src_off += coords[d] * plan.src_strides[d];
+            dst_off += coords[d] * plan.dst_strides[d];
+        }
+
+        while (local < local_end)
+        {
+            const size_t len = std::min(plan.run_bytes - run_pos, local_end - local);
+
+            const uint8_t *src_ptr = src_base + src_off + run_pos;
+            uint8_t       *dst_ptr = dst_base + dst_off + run_pos;
+            if (!plan.requantize)
+            {
+                std::memcpy(dst_ptr, src_ptr, len);
+            }
+            else if (_data_type == DataType::QASYMM8)
+            {
+                requantize_run_qasymm8(src_ptr, dst_ptr, len, plan.src_qinfo, _dst_qinfo);
+            }
+            else
+            {
+                requantize_run_qasymm8_signed(src_ptr, dst_ptr, len, plan.src_qinfo, _dst_qinfo);
+            }
+
+            local += len;
+            run_pos = 0;
+
+            // Move to the next run
+            for (size_t d = 0; d < plan.num_run_dims; ++d)
+            {
+                src_off += plan.src_strides[d];
+                dst_off += plan.dst_strides[d];
+                if (++coords[d] < plan.run_shape[d])
+                {
+                    break;
+                }
+                src_off -= plan.run_shape[d] * plan.src_strides[d];
+                dst_off -= plan.run_shape[d] * plan.dst_strides[d];
+                coords[d] = 0;
+            }
+        }
+
+        pos = plan.bytes_begin + local;
+    }
+}
+
+const char *CpuConcatenateKernel::name() const
+{
+    return "CpuConcatenateKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUCONCATENATEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUCONCATENATEKERNEL_H
+
+#include "arm_compute/core/QuantizationInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <array>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to copy a list of source tensors into a destination tensor in a single dispatch.
+ *
+ * Used both to concatenate tensors along an existing axis and to stack them along a new one.
+ * Each source is described as a sequence of contiguous byte runs and all sources are laid out
+ * one after the other in a flat byte stream. The execution window splits this stream in
+ * equally sized chunks, so every thread copies the same amount of data regardless of how
+ * the bytes are distributed among the sources.
+ *
+ * Runs are copied with memcpy, unless the source is QASYMM8/QASYMM8_SIGNED with a quantization
+ * info that differs from the destination one, in which case the run is requantized.
+ */
+class CpuConcatenateKernel : public ICpuKernel<CpuConcatenateKernel>
+{
+public:
+    CpuConcatenateKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuConcatenateKernel);
+    /** Configure kernel to concatenate the sources along an existing axis
+     *
+     * @note All the source dimensions but @p axis must match the destination ones.
+     * @note The sources are written one after the other along @p axis, starting from offset 0.
+     *
+     * @param[in]  srcs Source tensor infos. Data types supported: All
+     * @param[out] dst  Destination tensor info. Data types supported: Same as @p srcs.
+     * @param[in]  axis Concatenation axis. Supported axis are 0, 1, 2 and 3.
+     */
+    void configure(const std::vector<const ITensorInfo *> &srcs, ITensorInfo *dst, size_t axis);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuConcatenateKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, size_t axis);
+    /** Configure kernel to stack the sources along a new axis
+     *
+     * @note All the sources must have the same shape, rank up to 4, and quantization info.
+     *
+     * @param[in]  srcs Source tensor infos. Data types supported: All
+     * @param[out] dst  Destination tensor info. Data types supported: Same as @p srcs.
+     * @param[in]  axis The dimension to stack the sources along. It must not be greater than the rank of the sources.
+     */
+    void configure_stack(const std::vector<const ITensorInfo *> &srcs, ITensorInfo *dst, size_t axis);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuConcatenateKernel::configure_stack()
+     *
+     * @return a status
+     */
+    static Status validate_stack(const std::vector<const ITensorInfo *> &srcs, const ITensorInfo *dst, size_t axis);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    /** Number of bytes of the flattened byte stream handled by each window step */
+    static constexpr size_t chunk_bytes = 8192;
+
+private:
+    using DimArray = std::array<size_t, Coordinates::num_max_dimensions>;
+
+    /** Copy plan of a single source tensor */
+    struct SourcePlan
+    {
+        size_t                  bytes_begin{0};     /**< Offset of the source in the flattened byte stream */
+        size_t                  run_bytes{0};       /**< Contiguous bytes copied per run */
+        size_t                  num_runs{0};        /**< Number of runs */
+        size_t                  src_offset{0};      /**< Offset in bytes of the first run in the source */
+        size_t                  dst_offset{0};      /**< Offset in bytes of the first run in the destination */
+        size_t                  num_run_dims{0};    /**< Number of dimensions the runs are iterated over */
+        DimArray                run_shape{};        /**< Number of runs along each run dimension */
+        DimArray                src_strides{};      /**< Source strides in bytes along each run dimension */
+        DimArray                dst_strides{};      /**< Destination strides in bytes along each run dimension */
+        bool                    requantize{false};  /**< True if the runs must be requantized to the destination */
+        UniformQuantizationInfo src_qinfo{};        /**< Source quantization info */
+    };
+
+    /** Build the copy plan of a source
+     *
+     * @param[in] src        Source tensor info.
+     * @param[in] dst        Destination tensor info.
+     * @param[in] dst_dims   Destination dimension each source dimension is written to.
+     * @param[in] dst_offset Offset in bytes of the source origin in the destination.
+     */
+    void add_source(const ITensorInfo &src, const ITensorInfo &dst, const DimArray &dst_dims, size_t dst_offset);
+    /** Compute the execution window from the configured plans */
+    void configure_window();
+
+    std::vector<SourcePlan> _plans{};
+    size_t                  _total_bytes{0};
+    DataType                _data_type{DataType::UNKNOWN};
+    UniformQuantizationInfo _dst_qinfo{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUCONCATENATEKERNEL_H
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuConv3dDepthGatherKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *src,
+                          const ITensorInfo *weights,
+                          const ITensorInfo *dst,
+                          const Conv3dInfo  &conv_info)
+{
+    //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src) is not needed here as this kernel doesn't use CPU FP16 instructions.
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->data_layout() != DataLayout::NDHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 5);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(1) != src->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(conv_info.dilation != Size3D(1U, 1U, 1U));
+
+    // Validate configured output
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(
+            dst->tensor_shape(), CpuConv3dDepthGatherKernel::compute_gathered_shape(*src, *weights, conv_info));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(src, dst);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->data_layout() != DataLayout::NHWC);
+    }
+
+    return Status{};
+}
+} // namespace
+
+TensorShape CpuConv3dDepthGatherKernel::compute_gathered_shape(const ITensorInfo &src,
+                                                               const ITensorInfo &weights,
+                                                               const Conv3dInfo  &conv_info)
+{
+    const TensorShape output_shape =
+        misc::shape_calculator::compute_conv3d_shape(src.tensor_shape(), weights.tensor_shape(), conv_info);
+
+    return TensorShape(weights.dimension(4) * src.dimension(0), src.dimension(1), src.dimension(2),
+                       output_shape[3] * output_shape[4]);
+}
+
+void CpuConv3dDepthGatherKernel::configure(const ITensorInfo *src,
+                                           const ITensorInfo *weights,
+                                           ITensorInfo       *dst,
+                                           const Conv3dInfo  &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, src->clone()
+                                 ->set_tensor_shape(compute_gathered_shape(*src, *weights, conv_info))
+                                 .set_data_layout(DataLayout::NHWC));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, weights, dst, conv_info));
+
+    _conv_info    = conv_info;
+    _kernel_depth = weights->dimension(4);
+    _output_depth =
+        misc::shape_calculator::compute_conv3d_shape(src->tensor_shape(), weights->tensor_shape(), conv_info)[3];
+
+    // Configure kernel window: every iteration copies a row of the gathered slices
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1));
+    win.set(Window::DimZ, Window::Dimension(0, dst->dimension(2)));
+    win.set(Window::DimW, Window::Dimension(0, dst->dimension(3)));
+    ICpuKernel::configure(win);
+}
+
+Status CpuConv3dDepthGatherKernel::validate(const ITensorInfo *src,
+                                            const ITensorInfo *weights,
+                                            const ITensorInfo *dst,
+                                            const Conv3dInfo  &conv_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, weights, dst, conv_info));
+    return Status{};
+}
+
+void CpuConv3dDepthGatherKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC);
+    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST);
+
+    const ITensorInfo *src_info     = src->info();
+    const ITensorInfo *dst_info     = dst->info();
+    const size_t       row_size     = src_info->dimension(0) * src_info->element_size();
+    const int          input_width  = src_info->dimension(1);
+    const int          input_depth  = src_info->dimension(3);
+    const int          output_depth = _output_depth;
+    const int          stride_d     = _conv_info.stride.depth;
+    const int          pad_front    = _conv_info.padding.front;
+
+    // Padded slices are filled with the zero point of the input, which is a single repeated byte for every data type
+    const int pad_value =
+        is_data_type_quantized_asymmetric(src_info->data_type()) ? src_info->quantization_info().uniform().offset : 0;
+
+    const Strides &src_strides = src_info->strides_in_bytes();
+    const Strides &dst_strides = dst_info->strides_in_bytes();
+
+    const uint8_t *src_ptr = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_ptr = dst->buffer() + dst_info->offset_first_element_in_bytes();
+
+    for (int slice = window[Window::DimW].start(); slice < window[Window::DimW].end(); ++slice)
+    {
+        const int batch     = slice / output_depth;
+        const int out_depth = slice % output_depth;
+
+        for (int h = window.z().start(); h < window.z().end(); ++h)
+        {
+            uint8_t *dst_row = dst_ptr + slice * dst_strides[3] + h * dst_strides.z();
+
+            for (unsigned int kd = 0; kd < _kernel_depth; ++kd)
+            {
+                const int in_depth = out_depth * stride_d - pad_front + static_cast<int>(kd);
+                uint8_t  *dst_kd   = dst_row + kd * row_size;
+
+                if (in_depth < 0 || in_depth >= input_depth)
+                {
+                    for (int w = 0; w < input_width; ++w)
+                    {
+                        std::memset(dst_kd + w * dst_strides.y(), pad_value, row_size);
+                    }
+                    continue;
+                }
+
+                const uint8_t *src_row =
+                    src_ptr + batch * src_strides[4] + in_depth * src_strides[3] + h * src_strides.z();
+                for (int w = 0; w < input_width; ++w)
+                {
+                    std::memcpy(dst_kd + w * dst_strides.y(), src_row + w * src_strides.y(), row_size);
+                }
+            }
+        }
+    }
+}
+
+const char *CpuConv3dDepthGatherKernel::name() const
+{
+    return "CpuConv3dDepthGatherKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUCONV3DDEPTHGATHERKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUCONV3DDEPTHGATHERKERNEL_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to lower the depth of a 3D convolution into the channels of a 2D convolution.
+ *
+ * For every output depth slice, the input depth slices covered by the kernel are stacked along the channels, so that
+ * the 3D convolution becomes a 2D convolution with kernel_depth * IFM channels over a batch of output_depth * N slices:
+ *
+ * [IFM, width, height, depth, N] -> [kernel_depth * IFM, width, height, output_depth * N]
+ *
+ * Slices falling into the front or back padding are filled with the zero point of the input.
+ */
+class CpuConv3dDepthGatherKernel : public ICpuKernel<CpuConv3dDepthGatherKernel>
+{
+public:
+    /** Default constructor */
+    CpuConv3dDepthGatherKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuConv3dDepthGatherKernel);
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  src       Input tensor info with NDHWC data layout. Data types supported: F16/F32/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  weights   Weights tensor info with dimensions [OFM, IFM, kernel_x, kernel_y, kernel_z].
+     * @param[out] dst       Output tensor info with NHWC data layout. Data types supported: Same as @p src
+     * @param[in]  conv_info Contains padding and stride information described in @ref Conv3dInfo.
+     */
+    void configure(const ITensorInfo *src, const ITensorInfo *weights, ITensorInfo *dst, const Conv3dInfo &conv_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuConv3dDepthGatherKernel::configure()
+     *
+     * @return a status
+     */
+    static Status
+    validate(const ITensorInfo *src, const ITensorInfo *weights, const ITensorInfo *dst, const Conv3dInfo &conv_info);
+    /** Compute the shape of the gathered tensor
+     *
+     * @param[in] src       Input tensor info with NDHWC data layout.
+     * @param[in] weights   Weights tensor info with dimensions [OFM, IFM, kernel_x, kernel_y, kernel_z].
+     * @param[in] conv_info Contains padding and stride information described in @ref Conv3dInfo.
+     *
+     * @return the shape [kernel_depth * IFM, width, height, output_depth * N]
+     */
+    static TensorShape
+    compute_gathered_shape(const ITensorInfo &src, const ITensorInfo &weights, const Conv3dInfo &conv_info);
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    Conv3dInfo   _conv_info{};
+    unsigned int _kernel_depth{0};
+    unsigned int _output_depth{0};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUCONV3DDEPTHGATHERKERNEL_H
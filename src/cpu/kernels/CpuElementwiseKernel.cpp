@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022, 2025 Arm Limited.
+ * Copyright (c) 2018-2022, 2025, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/elementwise_binary/list.h"
+#include "src/cpu/utils/CpuCostModel.h"
 
 #include <arm_neon.h>
 
@@ -262,9 +263,13 @@ void CpuArithmeticKernel::configure_common(const ITensorInfo *src0, const ITenso
         return;
     }
 
-    auto shape_and_window = compute_output_shape_and_window(src0->tensor_shape(), src1->tensor_shape());
-    auto_init_if_empty(*dst, shape_and_window.first, 1, src0->data_type());
-    ICpuKernel::configure(shape_and_window.second);
+    const TensorShape out_shape = TensorShape::broadcast_shape(src0->tensor_shape(), src1->tensor_shape());
+    auto_init_if_empty(*dst, out_shape, 1, src0->data_type());
+
+    // Same rule as the add, sub and mul kernels: only squash when the sources and the destination are all dense
+    Window win;
+    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src0, *src1, dst);
+    ICpuKernel::configure(win);
 }
 
 void CpuComparisonKernel::configure_common(const ITensorInfo *src0, const ITensorInfo *src1, ITensorInfo *dst)
@@ -285,9 +290,12 @@ void CpuComparisonKernel::configure_common(const ITensorInfo *src0, const ITenso
         return;
     }
 
-    auto shape_and_window = compute_output_shape_and_window(src0->tensor_shape(), src1->tensor_shape());
-    auto_init_if_empty(*dst, shape_and_window.first, 1, src0->data_type());
-    ICpuKernel::configure(shape_and_window.second);
+    const TensorShape out_shape = TensorShape::broadcast_shape(src0->tensor_shape(), src1->tensor_shape());
+    auto_init_if_empty(*dst, out_shape, 1, src0->data_type());
+
+    Window win;
+    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src0, *src1, dst);
+    ICpuKernel::configure(win);
 }
 
 template <class Derived>
@@ -391,6 +399,12 @@ size_t CpuArithmeticKernel::get_mws(const CPUInfo &platform, size_t thread_count
     return ICPPKernel::default_mws;
 }
 
+uint64_t CpuArithmeticKernel::estimate_cost(const CPUInfo &platform, const Window &window) const
+{
+    return estimate_elementwise_cost(platform, window,
+                                     _op == ArithmeticOperation::POWER ? ElementCost::HEAVY : ElementCost::LIGHT);
+}
+
 /** The division operator */
 
 void CpuDivisionKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1, ITensorInfo *dst)
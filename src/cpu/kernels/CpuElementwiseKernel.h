@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,6 +63,15 @@ public:
         ElementwiseKernelPtr                    ukernel;
     };
 
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension.
+     */
+    size_t get_split_dimension() const
+    {
+        return _split_dimension;
+    }
+
 protected:
     /** Validate the argument passed to the kernel
      *
@@ -75,6 +84,7 @@ protected:
 protected:
     ElementwiseKernelPtr _run_method{nullptr};
     std::string          _name{};
+    size_t               _split_dimension{Window::DimY};
 };
 
 class CpuArithmeticKernel : public CpuElementwiseKernel<CpuArithmeticKernel>
@@ -111,6 +121,15 @@ public:
      */
     size_t get_mws(const CPUInfo &platform, size_t thread_count) const override;
 
+    /** Estimate the execution time of the kernel on a single thread
+     *
+     * @param[in] platform The CPU platform used to create the context.
+     * @param[in] window   Region on which the kernel is going to be executed.
+     *
+     * @return Estimated execution time in nanoseconds
+     */
+    uint64_t estimate_cost(const CPUInfo &platform, const Window &window) const override;
+
 protected:
     /** Commmon configure function for element-wise operators with no additional options (e.g. Min, Max, SquaredDiff)
      */
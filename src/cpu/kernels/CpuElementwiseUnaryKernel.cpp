@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, 2025 Arm Limited.
+ * Copyright (c) 2018-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -182,14 +182,15 @@ static const std::vector<CpuElementwiseUnaryKernel::ElementwiseUnaryKernel> avai
 
 } // namespace
 
-void CpuElementwiseUnaryKernel::configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst)
+void CpuElementwiseUnaryKernel::configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst, bool fast_math)
 {
-    ARM_COMPUTE_ERROR_THROW_ON(validate(op, src, dst));
+    ARM_COMPUTE_ERROR_THROW_ON(validate(op, src, dst, fast_math));
     const auto uk = CpuElementwiseUnaryKernel::get_implementation(
         DataTypeISASelectorData{src.data_type(), CPUInfo::get().get_isa()});
     ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
 
     _op         = op;
+    _fast_math  = fast_math;
     _run_method = uk->ukernel;
     _name       = std::string("CpuElementwiseUnaryKernel").append("/").append(uk->name);
 
@@ -209,8 +210,10 @@ void CpuElementwiseUnaryKernel::configure(ElementWiseUnary op, const ITensorInfo
     ICpuKernel::configure(shape_and_window.second);
 }
 
-Status CpuElementwiseUnaryKernel::validate(ElementWiseUnary op, const ITensorInfo &src, const ITensorInfo &dst)
+Status
+CpuElementwiseUnaryKernel::validate(ElementWiseUnary op, const ITensorInfo &src, const ITensorInfo &dst, bool fast_math)
 {
+    ARM_COMPUTE_UNUSED(fast_math);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(&src);
 
     const auto *uk = CpuElementwiseUnaryKernel::get_implementation(
@@ -252,7 +255,7 @@ void CpuElementwiseUnaryKernel::run_op(ITensorPack &tensors, const Window &windo
     auto src = tensors.get_const_tensor(TensorType::ACL_SRC);
     auto dst = tensors.get_tensor(TensorType::ACL_DST);
 
-    _run_method(src, dst, window, _op, _lut.get());
+    _run_method(src, dst, window, _op, _lut.get(), _fast_math);
 }
 
 const char *CpuElementwiseUnaryKernel::name() const
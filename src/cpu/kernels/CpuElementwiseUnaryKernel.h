@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023 Arm Limited.
+ * Copyright (c) 2018-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,8 +43,8 @@ namespace kernels
 class CpuElementwiseUnaryKernel : public ICpuKernel<CpuElementwiseUnaryKernel>
 {
 private:
-    using ElementwiseUnaryUkernelPtr =
-        std::add_pointer<void(const ITensor *, ITensor *, const Window &, ElementWiseUnary, const uint8_t *)>::type;
+    using ElementwiseUnaryUkernelPtr = std::add_pointer<void(
+        const ITensor *, ITensor *, const Window &, ElementWiseUnary, const uint8_t *, bool)>::type;
     using ElementwiseUnaryPreparePtr = std::add_pointer<std::unique_ptr<uint8_t[]>(
         ElementWiseUnary op, const ITensorInfo *, const ITensorInfo *)>::type;
 
@@ -54,18 +54,21 @@ public:
 
     /** Function to configure the @ref CpuElementwiseUnaryKernel
      *
-     * @param[in]  op  Arithmetic operation to be executed.
-     * @param[in]  src First tensor input. Data types supported: F16/F32, F16/F32/S32 for NEG/ABS operations.
-     * @param[out] dst Output tensor. Data types supported: Same as @p src.
+     * @param[in]  op        Arithmetic operation to be executed.
+     * @param[in]  src       First tensor input. Data types supported: F16/F32, F16/F32/S32 for NEG/ABS operations.
+     * @param[out] dst       Output tensor. Data types supported: Same as @p src.
+     * @param[in]  fast_math (Optional) Allow a faster, lower accuracy approximation of @ref ElementWiseUnary::EXP
+     *                       for F16/F32. Defaults to false.
      */
-    void configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst);
+    void configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst, bool fast_math = false);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to CpuElementwiseUnaryKernel::configure()
      *
      * @return a status
      */
-    static Status validate(ElementWiseUnary op, const ITensorInfo &src, const ITensorInfo &dst);
+    static Status
+    validate(ElementWiseUnary op, const ITensorInfo &src, const ITensorInfo &dst, bool fast_math = false);
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
@@ -83,6 +86,7 @@ public:
 
 private:
     ElementWiseUnary           _op{};
+    bool                       _fast_math{false};
     ElementwiseUnaryUkernelPtr _run_method{nullptr};
     std::string                _name{};
     std::unique_ptr<uint8_t[]> _lut{};
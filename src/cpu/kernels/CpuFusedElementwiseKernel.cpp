@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuFusedElementwiseKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/Utils.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/utils/CpuCostModel.h"
+
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuFusedElementwiseKernel::FusedElementwiseKernel> available_kernels = {
+    {"neon_fp32_fused_elementwise", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::fused_elementwise_fp32_neon)},
+    {"neon_fp16_fused_elementwise",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::fused_elementwise_fp16_neon)},
+};
+
+bool is_supported_activation(const ActivationLayerInfo &act_info)
+{
+    switch (act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::ABS:
+        case ActivationLayerInfo::ActivationFunction::LINEAR:
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+        case ActivationLayerInfo::ActivationFunction::RELU:
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+        case ActivationLayerInfo::ActivationFunction::LEAKY_RELU:
+        case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
+        case ActivationLayerInfo::ActivationFunction::ELU:
+        case ActivationLayerInfo::ActivationFunction::SQUARE:
+        case ActivationLayerInfo::ActivationFunction::TANH:
+        case ActivationLayerInfo::ActivationFunction::IDENTITY:
+        case ActivationLayerInfo::ActivationFunction::HARD_SWISH:
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+Status validate_expression(const ElementwiseExpression &expr, size_t num_srcs)
+{
+    const auto &nodes = expr.nodes();
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(nodes.empty(), "The expression is empty");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(nodes.size() > fused_elementwise_max_nodes, "The expression has too many nodes");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(expr.num_inputs() != num_srcs,
+                                    "The number of inputs does not match the inputs read by the expression");
+
+    for (size_t n = 0; n < nodes.size(); ++n)
+    {
+        const ElementwiseExpressionNode &node     = nodes[n];
+        const int32_t                    num_prev = static_cast<int32_t>(n);
+        switch (node.op)
+        {
+            case ElementwiseExpressionOp::INPUT:
+                ARM_COMPUTE_RETURN_ERROR_ON(node.lhs < 0 || node.lhs >= static_cast<int32_t>(num_srcs));
+                break;
+            case ElementwiseExpressionOp::ADD:
+            case ElementwiseExpressionOp::SUB:
+            case ElementwiseExpressionOp::MUL:
+            case ElementwiseExpressionOp::DIV:
+            case ElementwiseExpressionOp::MAX:
+            case ElementwiseExpressionOp::MIN:
+            case ElementwiseExpressionOp::SQUARED_DIFF:
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.lhs < 0 || node.lhs >= num_prev || node.rhs < 0 ||
+                                                    node.rhs >= num_prev,
+                                                "Operands must refer to previous nodes");
+                break;
+            case ElementwiseExpressionOp::NEG:
+            case ElementwiseExpressionOp::ABS:
+            case ElementwiseExpressionOp::EXP:
+            case ElementwiseExpressionOp::RSQRT:
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.lhs < 0 || node.lhs >= num_prev,
+                                                "Operands must refer to previous nodes");
+                break;
+            case ElementwiseExpressionOp::ACTIVATION:
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.lhs < 0 || node.lhs >= num_prev,
+                                                "Operands must refer to previous nodes");
+                ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_supported_activation(node.act_info),
+                                                "Unsupported activation function");
+                break;
+            default:
+                ARM_COMPUTE_RETURN_ERROR_MSG("Unsupported operation");
+        }
+    }
+    return Status{};
+}
+
+TensorShape compute_output_shape(const std::vector<const ITensorInfo *> &srcs)
+{
+    TensorShape out_shape = srcs[0]->tensor_shape();
+    for (size_t i = 1; i < srcs.size(); ++i)
+    {
+        out_shape = TensorShape::broadcast_shape(out_shape, srcs[i]->tensor_shape());
+    }
+    return out_shape;
+}
+
+Status validate_arguments(const std::vector<const ITensorInfo *> &srcs,
+                          const ITensorInfo                      *dst,
+                          const ElementwiseExpression            &expr)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(srcs.empty());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(srcs.size() > fused_elementwise_max_inputs, "Too many inputs");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_expression(expr, srcs.size()));
+
+    for (const auto *src : srcs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(srcs[0], src);
+    }
+
+    const TensorShape out_shape = compute_output_shape(srcs);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(out_shape.total_size() == 0, "Inputs are not broadcast compatible");
+
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(srcs[0], dst);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(detail::have_different_dimensions(out_shape, dst->tensor_shape(), 0),
+                                        "Wrong shape for dst");
+    }
+
+    const auto *uk = CpuFusedElementwiseKernel::get_implementation(
+        DataTypeISASelectorData{srcs[0]->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuFusedElementwiseKernel::configure(const std::vector<const ITensorInfo *> &srcs,
+                                          ITensorInfo                            *dst,
+                                          const ElementwiseExpression            &expr)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(srcs, dst, expr));
+    ARM_COMPUTE_LOG_PARAMS(srcs, dst, expr);
+
+    const auto *uk = CpuFusedElementwiseKernel::get_implementation(
+        DataTypeISASelectorData{srcs[0]->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuFusedElementwiseKernel").append("/").append(uk->name);
+    _expr       = expr;
+    _num_srcs   = srcs.size();
+
+    const TensorShape out_shape = compute_output_shape(srcs);
+    auto_init_if_empty(*dst, out_shape, 1, srcs[0]->data_type());
+
+    // Without broadcasting and holes the tensors can be processed as 1D arrays
+    bool can_squash = !has_holes(*dst);
+    for (const auto *src : srcs)
+    {
+        can_squash = can_squash && !has_holes(*src) && src->tensor_shape().total_size() == out_shape.total_size();
+    }
+
+    Window win;
+    if (can_squash)
+    {
+        win.set(Window::DimX, Window::Dimension(0, out_shape.total_size(), 1));
+        _split_dimension = Window::DimX;
+    }
+    else
+    {
+        win              = calculate_max_window(out_shape);
+        _split_dimension = Window::DimY;
+    }
+    ICpuKernel::configure(win);
+}
+
+Status CpuFusedElementwiseKernel::validate(const std::vector<const ITensorInfo *> &srcs,
+                                           const ITensorInfo                      *dst,
+                                           const ElementwiseExpression            &expr)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(srcs, dst, expr));
+    return Status{};
+}
+
+void CpuFusedElementwiseKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    std::array<const ITensor *, fused_elementwise_max_inputs> srcs{};
+    for (size_t i = 0; i < _num_srcs; ++i)
+    {
+        srcs[i] = tensors.get_const_tensor(TensorType::ACL_SRC_VEC + i);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(srcs[i]);
+    }
+    auto dst = tensors.get_tensor(TensorType::ACL_DST);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+
+    _run_method(srcs.data(), dst, _expr, window);
+}
+
+uint64_t CpuFusedElementwiseKernel::estimate_cost(const CPUInfo &platform, const Window &window) const
+{
+    const uint64_t light_cost = estimate_elementwise_cost(platform, window, ElementCost::LIGHT);
+    const uint64_t heavy_cost = estimate_elementwise_cost(platform, window, ElementCost::HEAVY);
+
+    // Each operation costs as much as its standalone elementwise kernel
+    uint64_t cost = 0;
+    for (const auto &node : _expr.nodes())
+    {
+        switch (node.op)
+        {
+            case ElementwiseExpressionOp::INPUT:
+                break;
+            case ElementwiseExpressionOp::EXP:
+                cost += heavy_cost;
+                break;
+            case ElementwiseExpressionOp::ACTIVATION:
+                cost += activation_element_cost(node.act_info.activation()) == ElementCost::HEAVY ? heavy_cost
+                                                                                                  : light_cost;
+                break;
+            default:
+                cost += light_cost;
+                break;
+        }
+    }
+    return cost;
+}
+
+const char *CpuFusedElementwiseKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuFusedElementwiseKernel::FusedElementwiseKernel> &
+CpuFusedElementwiseKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUFUSEDELEMENTWISEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUFUSEDELEMENTWISEKERNEL_H
+
+#include "arm_compute/function_info/FusedElementwiseInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/fused_elementwise/list.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Arm(R) Neon(TM) kernel to evaluate an @ref ElementwiseExpression over N broadcastable inputs
+ *
+ * The whole expression is evaluated on small blocks of each destination row before moving to the next block, so the
+ * inputs are read and the destination is written once regardless of the number of operations.
+ */
+class CpuFusedElementwiseKernel : public ICpuKernel<CpuFusedElementwiseKernel>
+{
+private:
+    using FusedElementwiseKernelPtr = std::add_pointer<void(
+        const ITensor *const *, ITensor *, const ElementwiseExpression &, const Window &)>::type;
+
+public:
+    CpuFusedElementwiseKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuFusedElementwiseKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  srcs Input tensor infos, one per input of @p expr. Data types supported: F16/F32.
+     *                  The shapes must be broadcast compatible.
+     * @param[out] dst  Destination tensor info with the broadcast shape of the inputs.
+     *                  Data types supported: Same as @p srcs.
+     * @param[in]  expr Expression to evaluate. It must have at most @ref fused_elementwise_max_nodes nodes and read
+     *                  at most @ref fused_elementwise_max_inputs inputs.
+     */
+    void configure(const std::vector<const ITensorInfo *> &srcs, ITensorInfo *dst, const ElementwiseExpression &expr);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuFusedElementwiseKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &srcs,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseExpression            &expr);
+    /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
+     *
+     * @return The split dimension hint.
+     */
+    size_t get_split_dimension() const
+    {
+        return _split_dimension;
+    }
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+    uint64_t    estimate_cost(const CPUInfo &platform, const Window &window) const override;
+
+    struct FusedElementwiseKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        FusedElementwiseKernelPtr    ukernel;
+    };
+
+    static const std::vector<FusedElementwiseKernel> &get_available_kernels();
+
+private:
+    FusedElementwiseKernelPtr _run_method{nullptr};
+    ElementwiseExpression     _expr{};
+    size_t                    _num_srcs{0};
+    size_t                    _split_dimension{Window::DimY};
+    std::string               _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUFUSEDELEMENTWISEKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -113,6 +113,7 @@ struct SoftmaxKernelDataTypeISASelectorData
     bool                is_log;
     int                 axis;
     uint64_t            sme2_vector_length;
+    bool                fast_math;
 };
 
 // Selector pointer types
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/kernels/mul/generic/neon/list.h"
 #include "src/cpu/kernels/mul/generic/sme2/list.h"
+#include "src/cpu/utils/CpuCostModel.h"
 
 #include <arm_neon.h>
 
@@ -1713,7 +1714,7 @@ void CpuMulKernel::configure(ITensorInfo   *src1,
 
     // Configure kernel window
     Window win;
-    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src1, *src2);
+    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src1, *src2, dst);
 
     ICpuKernel::configure(win);
 }
@@ -1771,6 +1772,11 @@ size_t CpuMulKernel::get_mws(const CPUInfo &platform, size_t thread_count) const
     return default_mws;
 }
 
+uint64_t CpuMulKernel::estimate_cost(const CPUInfo &platform, const Window &window) const
+{
+    return estimate_elementwise_cost(platform, window, ElementCost::LIGHT);
+}
+
 Status CpuMulKernel::validate(const ITensorInfo *src1,
                               const ITensorInfo *src2,
                               const ITensorInfo *dst,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -101,6 +101,15 @@ public:
      */
     size_t get_mws(const CPUInfo &platform, size_t thread_count) const override;
 
+    /** Estimate the execution time of the kernel on a single thread
+     *
+     * @param[in] platform The CPU platform used to create the context.
+     * @param[in] window   Region on which the kernel is going to be executed.
+     *
+     * @return Estimated execution time in nanoseconds
+     */
+    uint64_t estimate_cost(const CPUInfo &platform, const Window &window) const override;
+
     /** Get the preferred dimension in which the scheduler splits the work into multiple jobs.
       *
       * @return The split dimension hint.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -144,6 +144,11 @@ void CpuPool3dKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const
     _run_method = uk->ukernel;
     _name       = std::string("CpuPool3dKernel").append("/").append(uk->name);
 
+    // Float kernels reduce the depth and height of every input column of an output row before reducing the width
+    _scratch_size = is_data_type_float(src->data_type())
+                        ? src->dimension(0) * src->dimension(idx_width) * src->element_size()
+                        : 0;
+
     // Configure kernel window
     Window win = calculate_max_window(*dst, Steps());
     ICpuKernel::configure(win);
@@ -158,17 +163,31 @@ Status CpuPool3dKernel::validate(const ITensorInfo *src, const ITensorInfo *dst,
     return Status{};
 }
 
+size_t CpuPool3dKernel::get_scratch_size_per_thread() const
+{
+    return _scratch_size;
+}
+
 void CpuPool3dKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
 
-    const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC_0);
-    ITensor       *dst = tensors.get_tensor(TensorType::ACL_DST_0);
+    const ITensor *src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    ITensor       *dst     = tensors.get_tensor(TensorType::ACL_DST_0);
+    ITensor       *scratch = tensors.get_tensor(TensorType::ACL_INT_0);
+
+    void *scratch_for_thread = nullptr;
+    if (_scratch_size != 0)
+    {
+        ARM_COMPUTE_EXIT_ON_MSG_VAR(scratch == nullptr ||
+                                        scratch->info()->total_size() < (info.thread_id + 1) * _scratch_size,
+                                    "Working space too small for thread %d of %d", info.thread_id, info.num_threads);
+        scratch_for_thread = scratch->buffer() + info.thread_id * _scratch_size;
+    }
 
-    _run_method(src, dst, _pool_info, window);
+    _run_method(src, dst, scratch_for_thread, _pool_info, window);
 }
 
 const char *CpuPool3dKernel::name() const
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,7 +41,7 @@ class CpuPool3dKernel : public ICpuKernel<CpuPool3dKernel>
 private:
     /* Template function for Pooling 3D NDHWC */
     using Pooling3dKernelPtr =
-        std::add_pointer<void(const ITensor *, ITensor *, Pooling3dLayerInfo &, const Window &)>::type;
+        std::add_pointer<void(const ITensor *, ITensor *, void *const, Pooling3dLayerInfo &, const Window &)>::type;
 
 public:
     CpuPool3dKernel() = default;
@@ -68,6 +68,13 @@ public:
      * @return a status
      */
     static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const Pooling3dLayerInfo &pool_info);
+    /** Size in bytes of the working space needed by each thread running the kernel
+     *
+     * The working space is passed as ACL_INT_0 and must hold one such region per thread.
+     *
+     * @return The size in bytes
+     */
+    size_t get_scratch_size_per_thread() const;
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
@@ -85,6 +92,7 @@ public:
 private:
     Pooling3dLayerInfo _pool_info{};
     Pooling3dKernelPtr _run_method{nullptr};
+    size_t             _scratch_size{0};
     std::string        _name{};
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024 Arm Limited.
+ * Copyright (c) 2017-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -136,7 +136,7 @@ void CpuQuantizeKernel::configure(const ITensorInfo *src, ITensorInfo *dst)
 
     // Calculate window. Squash if possible.
     Window win;
-    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src);
+    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src, dst);
 
     ICpuKernel::configure(win);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -352,6 +352,8 @@ Status validate_arguments(const ITensorInfo     *src,
                                 info.sampling_policy != SamplingPolicy::TOP_LEFT);
     ARM_COMPUTE_UNUSED(info.constant_border_value);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.use_padding, "Padding is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!info.norm_mean.empty() || !info.norm_std.empty(),
+                                    "Normalisation is only supported by CpuScaleSeparableKernel");
 
     const DataLayout data_layout   = info.data_layout == DataLayout::UNKNOWN ? src->data_layout() : info.data_layout;
     const auto       width_index   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
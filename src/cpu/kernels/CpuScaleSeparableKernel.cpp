@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuScaleSeparableKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/core/utils/InterpolationPolicyUtils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/common/Registrars.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/scale/neon/list.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuScaleSeparableKernel::ScaleSeparableKernel> available_kernels = {
+    {"neon_u8_scale_separable",
+     [](const CastDataTypeISASelectorData &data)
+     { return data.src_dt == DataType::U8 && data.dst_dt == DataType::U8; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u8_neon_scale_separable)},
+    {"neon_u8_fp32_scale_separable",
+     [](const CastDataTypeISASelectorData &data)
+     { return data.src_dt == DataType::U8 && data.dst_dt == DataType::F32; },
+     REGISTER_INTEGER_NEON(arm_compute::cpu::u8_fp32_neon_scale_separable)},
+    {"neon_u8_fp16_scale_separable",
+     [](const CastDataTypeISASelectorData &data)
+     { return data.src_dt == DataType::U8 && data.dst_dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::u8_fp16_neon_scale_separable)},
+    {"neon_fp32_scale_separable",
+     [](const CastDataTypeISASelectorData &data)
+     { return data.src_dt == DataType::F32 && data.dst_dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::fp32_neon_scale_separable)},
+    {"neon_fp16_scale_separable",
+     [](const CastDataTypeISASelectorData &data)
+     { return data.src_dt == DataType::F16 && data.dst_dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::fp16_neon_scale_separable)},
+};
+
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const ScaleKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst == src);
+
+    const auto *uk = CpuScaleSeparableKernel::get_implementation(
+        CastDataTypeISASelectorData{src->data_type(), dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(uk == nullptr || uk->ukernel == nullptr, "Unsupported data type combination");
+
+    const DataLayout data_layout = info.data_layout == DataLayout::UNKNOWN ? src->data_layout() : info.data_layout;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(data_layout != DataLayout::NHWC, "Only NHWC is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.border_mode != BorderMode::REPLICATE, "Only border mode REPLICATE is supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.use_padding, "Padding is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.sampling_policy != SamplingPolicy::CENTER &&
+                                info.sampling_policy != SamplingPolicy::TOP_LEFT);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.align_corners &&
+                                !scale_utils::is_align_corners_allowed_sampling_policy(info.sampling_policy));
+    ARM_COMPUTE_RETURN_ERROR_ON(src->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(0) != dst->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(3) != dst->dimension(3));
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) == 0 || dst->dimension(2) == 0);
+
+    if (info.interpolation_policy == InterpolationPolicy::AREA)
+    {
+        const auto wr = scale_utils::calculate_resize_ratio(src->dimension(1), dst->dimension(1), info.align_corners);
+        const auto hr = scale_utils::calculate_resize_ratio(src->dimension(2), dst->dimension(2), info.align_corners);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(wr <= 1.f && hr <= 1.f, "Area interpolation is only supported when downscaling");
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(info.interpolation_policy != InterpolationPolicy::BILINEAR);
+    }
+
+    const size_t num_channels = src->dimension(0);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.norm_mean.size() > 1 && info.norm_mean.size() != num_channels);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.norm_std.size() > 1 && info.norm_std.size() != num_channels);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(std::find(info.norm_std.begin(), info.norm_std.end(), 0.f) != info.norm_std.end(),
+                                    "Standard deviation must not be zero");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((!info.norm_mean.empty() || !info.norm_std.empty()) &&
+                                        !is_data_type_float(dst->data_type()),
+                                    "Normalisation requires a F16/F32 destination");
+
+    return Status{};
+}
+} // namespace
+
+void CpuScaleSeparableKernel::configure(const ITensorInfo *src, ITensorInfo *dst, const ScaleKernelInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, dst, info));
+
+    const auto *uk = CpuScaleSeparableKernel::get_implementation(
+        CastDataTypeISASelectorData{src->data_type(), dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuScaleSeparableKernel")
+                .append("/")
+                .append(uk->name)
+                .append("_")
+                .append(string_from_interpolation_policy(info.interpolation_policy));
+
+    const bool align_corners =
+        info.align_corners && scale_utils::is_align_corners_allowed_sampling_policy(info.sampling_policy);
+    const size_t num_channels = dst->dimension(0);
+    const size_t dst_width    = dst->dimension(1);
+
+    _taps_x = scale_utils::compute_scale_taps(src->dimension(1), dst_width, info.interpolation_policy,
+                                              info.sampling_policy, align_corners);
+    _taps_y = scale_utils::compute_scale_taps(src->dimension(2), dst->dimension(2), info.interpolation_policy,
+                                              info.sampling_policy, align_corners);
+
+    // Expand the per-channel normalisation to a whole output row, so that rows are normalised with plain vectors
+    _norm_mul.clear();
+    _norm_add.clear();
+    const bool is_conversion = src->data_type() != dst->data_type();
+    if (is_conversion || !info.norm_mean.empty() || !info.norm_std.empty())
+    {
+        _norm_mul.resize(dst_width * num_channels);
+        _norm_add.resize(dst_width * num_channels);
+        for (size_t c = 0; c < num_channels; ++c)
+        {
+            const float mean = info.norm_mean.empty() ? 0.f : info.norm_mean[info.norm_mean.size() == 1 ? 0 : c];
+            const float std  = info.norm_std.empty() ? 1.f : info.norm_std[info.norm_std.size() == 1 ? 0 : c];
+            for (size_t x = 0; x < dst_width; ++x)
+            {
+                _norm_mul[x * num_channels + c] = 1.f / std;
+                _norm_add[x * num_channels + c] = -mean / std;
+            }
+        }
+    }
+
+    // U8 rows are resampled into 16-bit fixed-point values, other types into F32
+    const size_t intermediate_size = src->data_type() == DataType::U8 ? sizeof(uint16_t) : sizeof(float);
+    _scratch_size = scale_utils::separable_scratch_size(_taps_y.max_taps, dst_width * num_channels, intermediate_size);
+
+    // Each window step along the height computes a whole output row
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuScaleSeparableKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const ScaleKernelInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, dst, info));
+    return Status{};
+}
+
+size_t CpuScaleSeparableKernel::get_scratch_size_per_thread() const
+{
+    return _scratch_size;
+}
+
+void CpuScaleSeparableKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto src     = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto       dst     = tensors.get_tensor(TensorType::ACL_DST);
+    auto       scratch = tensors.get_tensor(TensorType::ACL_INT_3);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, scratch);
+    ARM_COMPUTE_EXIT_ON_MSG_VAR(scratch->info()->total_size() < (info.thread_id + 1) * _scratch_size,
+                                "Working space too small for thread %d of %d", info.thread_id, info.num_threads);
+
+    _run_method(src, dst, _taps_x, _taps_y, _norm_mul.empty() ? nullptr : _norm_mul.data(),
+                _norm_add.empty() ? nullptr : _norm_add.data(), scratch->buffer() + info.thread_id * _scratch_size,
+                window);
+}
+
+const char *CpuScaleSeparableKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuScaleSeparableKernel::ScaleSeparableKernel> &CpuScaleSeparableKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
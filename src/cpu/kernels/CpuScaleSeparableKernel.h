@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUSCALESEPARABLEKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUSCALESEPARABLEKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/core/utils/ScaleUtils.h"
+#include "src/cpu/ICpuKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Arm(R) Neon(TM) kernel to resize a NHWC tensor in two separable passes
+ *
+ * The horizontal and vertical taps are computed once at configuration. Each output row is blended from source rows
+ * resampled along the width, which are cached so that neighbouring output rows do not resample them again.
+ * U8 sources are resampled in fixed-point arithmetic. The kernel can also convert a U8 source to F32/F16 and
+ * normalise it as (value - mean) / std per channel, writing a network input in a single pass.
+ */
+class CpuScaleSeparableKernel : public ICpuKernel<CpuScaleSeparableKernel>
+{
+private:
+    /** Separable scale function to use for the particular combination of data types */
+    using ScaleSeparableKernelPtr = std::add_pointer<void(const ITensor *,
+                                                          ITensor *,
+                                                          const scale_utils::ScaleTaps &,
+                                                          const scale_utils::ScaleTaps &,
+                                                          const float *,
+                                                          const float *,
+                                                          uint8_t *,
+                                                          const Window &)>::type;
+
+public:
+    CpuScaleSeparableKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuScaleSeparableKernel);
+    /** Initialise the kernel's inputs, output and interpolation policy
+     *
+     * Valid data type configurations:
+     * |src            |dst            |
+     * |:--------------|:--------------|
+     * |U8             |U8, F16, F32   |
+     * |F16            |F16            |
+     * |F32            |F32            |
+     *
+     * @note Only data layout NHWC and @p border_mode Replicate are supported.
+     * @note Using @p policy Area is only supported when downscaling.
+     *
+     * @param[in]  src  Source tensor info. Data types supported: U8/F16/F32.
+     * @param[out] dst  Destination tensor info. Data types supported: see the table above.
+     *                  All but the width and height dimensions must be the same size as in the input tensor.
+     * @param[in]  info @ref ScaleKernelInfo to use for configuration. Supported interpolation policies: BILINEAR/AREA
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, const ScaleKernelInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuScaleSeparableKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const ScaleKernelInfo &info);
+    /** Size in bytes of the working space needed by each thread running the kernel
+     *
+     * The working space is passed as ACL_INT_3 and must hold one such region per thread.
+     *
+     * @return The size in bytes
+     */
+    size_t get_scratch_size_per_thread() const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct ScaleSeparableKernel
+    {
+        const char                          *name;
+        const CastDataTypeISASelectorDataPtr is_selected;
+        ScaleSeparableKernelPtr              ukernel;
+    };
+
+    static const std::vector<ScaleSeparableKernel> &get_available_kernels();
+
+private:
+    ScaleSeparableKernelPtr _run_method{nullptr};
+    scale_utils::ScaleTaps  _taps_x{};
+    scale_utils::ScaleTaps  _taps_y{};
+    std::vector<float>      _norm_mul{};
+    std::vector<float>      _norm_add{};
+    size_t                  _scratch_size{0};
+    std::string             _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUSCALESEPARABLEKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "src/core/common/Registrars.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/kernels/scatter/generic/neon/impl.h"
 #include "src/cpu/kernels/scatter/list.h"
 
 #include <cstdint>
@@ -42,7 +43,7 @@ namespace cpu
 namespace kernels
 {
 
-constexpr int max_index_length = 5;
+constexpr int max_index_length = scatter_max_index_length;
 
 /* Scatter */
 static const std::vector<typename CpuScatterKernel::ScatterKernel> available_kernels = {
@@ -91,24 +92,34 @@ void CpuScatterKernel::configure(const ITensorInfo *updates,
 
     _data_block_length = is_scalar_block ? 1 : updates->dimension(0);
 
-    // The GWS will be 2D [x, y]
+    // The data window is 2D [x, y] and is walked for every update
     //  x-dimension refers to the x coordinate of the dst tensor
     //  y-dimension refers to the collapsed y-coordinate of the data part of the dst tensor
-    Window win;
+    _data_window = Window();
 
     if (!is_scalar_block)
     {
-        win = calculate_max_window(*dst, Steps(_data_block_length));
+        _data_window = calculate_max_window(*dst, Steps(_data_block_length));
 
         // Collapse the dimensions corresponding to indices in the execution window
         for (int i = 0; i < index_len; ++i)
         {
-            win.set(dst->num_dimensions() - (i + 1), Window::Dimension(0, 1, 1));
+            _data_window.set(dst->num_dimensions() - (i + 1), Window::Dimension(0, 1, 1));
         }
 
-        win = win.collapse(win, 1);
+        _data_window = _data_window.collapse(_data_window, 1);
     }
 
+    // The execution window runs over the updates, so that it can be split among threads however few
+    // destination rows there are. Without unique indices, the updates are partitioned by destination block first.
+    const int32_t num_indices = indices->tensor_shape().collapsed_from(1)[1];
+    const int32_t num_blocks  = ScatterBlockIndexer(*dst, index_len).num_blocks();
+
+    _partition_size = scatter_info.unique_indices ? 0 : num_blocks + 1 + num_indices;
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_indices, 1));
+
     ICpuKernel::configure(win);
 }
 
@@ -195,7 +206,28 @@ void CpuScatterKernel::run_op(ITensorPack &tensors, const Window &window, const
         ARM_COMPUTE_ERROR("Unsupported Configuration! Padding not supported with these shapes.");
     }
 
-    _run_method(updates, indices, dst, _scatter_func, window, _data_block_length);
+    const ITensor *partition = _partition_size != 0 ? tensors.get_const_tensor(TensorType::ACL_INT_0) : nullptr;
+    ARM_COMPUTE_ERROR_ON(_partition_size != 0 && partition == nullptr);
+
+    _run_method(updates, indices, partition, dst, _scatter_func, window, _data_window, _data_block_length);
+}
+
+size_t CpuScatterKernel::partition_size() const
+{
+    return _partition_size;
+}
+
+void CpuScatterKernel::partition_updates(ITensorPack &tensors) const
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON(_partition_size == 0);
+
+    const ITensor *indices   = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    const ITensor *dst       = tensors.get_const_tensor(TensorType::ACL_DST);
+    ITensor       *partition = tensors.get_tensor(TensorType::ACL_INT_0);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(indices, dst, partition);
+
+    scatter_partition_updates(indices, *dst->info(), partition);
 }
 
 const char *CpuScatterKernel::name() const
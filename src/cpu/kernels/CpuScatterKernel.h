@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,12 +35,23 @@ namespace cpu
 {
 namespace kernels
 {
-/** Arm(R) Neon(TM) kernel to perform the ScatterND operation */
+/** Arm(R) Neon(TM) kernel to perform the ScatterND operation
+ *
+ * The execution window runs over the updates. Unless the indices are known to be unique, the updates must
+ * first be sorted by destination block with @ref CpuScatterKernel::partition_updates, so that every destination
+ * block is owned by a single thread and duplicated indices can be reduced without synchronization.
+ */
 class CpuScatterKernel : public ICpuKernel<CpuScatterKernel>
 {
 private:
-    using ScatterKernelPtr = std::add_pointer<void(
-        const ITensor *, const ITensor *, ITensor *, const ScatterFunction &, const Window &, const int)>::type;
+    using ScatterKernelPtr = std::add_pointer<void(const ITensor *,
+                                                   const ITensor *,
+                                                   const ITensor *,
+                                                   ITensor *,
+                                                   const ScatterFunction &,
+                                                   const Window &,
+                                                   const Window &,
+                                                   const int)>::type;
 
 public:
     CpuScatterKernel() = default;
@@ -67,6 +78,19 @@ public:
                            const ITensorInfo *dst,
                            const ScatterInfo &scatter_info);
 
+    /** Number of S32 elements of the partition tensor (ACL_INT_0) the kernel needs
+     *
+     * @return the partition size, or 0 if the indices are unique and no partition is needed
+     */
+    size_t partition_size() const;
+    /** Sort the updates by destination block into the partition tensor (ACL_INT_0)
+     *
+     * Must be run, single threaded, before the kernel is scheduled when @ref partition_size is not 0.
+     *
+     * @param[in, out] tensors Tensor pack of the kernel, including the partition tensor.
+     */
+    void partition_updates(ITensorPack &tensors) const;
+
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
@@ -84,6 +108,8 @@ private:
     std::string      _name{};
     ScatterFunction  _scatter_func{};
     int              _data_block_length{};
+    Window           _data_window{};
+    size_t           _partition_size{0};
 };
 } // namespace kernels
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -64,17 +64,25 @@ static const std::vector<typename CpuSoftmaxKernel::SoftmaxKernel> available_ker
      [](const SoftmaxKernelDataTypeISASelectorData &data)
      { return (!data.is_log && data.dt == DataType::F32 && data.isa.sme2 && data.axis == 0); },
      REGISTER_FP32_SME2(sme2_fp32_softmax)},
+    {"neon_fp32_fast_softmax",
+     [](const SoftmaxKernelDataTypeISASelectorData &data)
+     { return (!data.is_log && data.dt == DataType::F32 && data.fast_math); },
+     REGISTER_FP32_NEON(neon_fp32_softmax<false, true>)},
     {"neon_fp32_softmax",
      [](const SoftmaxKernelDataTypeISASelectorData &data) { return (!data.is_log && data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(neon_fp32_softmax<false>)},
+     REGISTER_FP32_NEON(neon_fp32_softmax<false, false>)},
     {"sme2_fp16_softmax",
      [](const SoftmaxKernelDataTypeISASelectorData &data)
      { return (!data.is_log && data.dt == DataType::F16 && data.isa.sme2 && data.axis == 0); },
      REGISTER_FP16_SME2(sme2_fp16_softmax)},
+    {"neon_fp16_fast_softmax",
+     [](const SoftmaxKernelDataTypeISASelectorData &data)
+     { return (!data.is_log && data.dt == DataType::F16) && data.isa.fp16 && data.fast_math; },
+     REGISTER_FP16_NEON(neon_fp16_softmax<false, true>)},
     {"neon_fp16_softmax",
      [](const SoftmaxKernelDataTypeISASelectorData &data)
      { return (!data.is_log && data.dt == DataType::F16) && data.isa.fp16; },
-     REGISTER_FP16_NEON(neon_fp16_softmax<false>)},
+     REGISTER_FP16_NEON(neon_fp16_softmax<false, false>)},
     {"sme2_qu8_softmax_lut_512VL",
      [](const SoftmaxKernelDataTypeISASelectorData &data)
      {
@@ -96,13 +104,21 @@ static const std::vector<typename CpuSoftmaxKernel::SoftmaxKernel> available_ker
      [](const SoftmaxKernelDataTypeISASelectorData &data)
      { return (!data.is_log && data.dt == DataType::QASYMM8_SIGNED); },
      REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_softmax<false>)},
+    {"neon_fp32_fast_log_softmax",
+     [](const SoftmaxKernelDataTypeISASelectorData &data)
+     { return (data.is_log && data.dt == DataType::F32 && data.fast_math); },
+     REGISTER_FP32_NEON(neon_fp32_softmax<true, true>)},
     {"neon_fp32_log_softmax",
      [](const SoftmaxKernelDataTypeISASelectorData &data) { return (data.is_log && data.dt == DataType::F32); },
-     REGISTER_FP32_NEON(neon_fp32_softmax<true>)},
+     REGISTER_FP32_NEON(neon_fp32_softmax<true, false>)},
+    {"neon_fp16_fast_log_softmax",
+     [](const SoftmaxKernelDataTypeISASelectorData &data)
+     { return (data.is_log && data.dt == DataType::F16) && data.isa.fp16 && data.fast_math; },
+     REGISTER_FP16_NEON(neon_fp16_softmax<true, true>)},
     {"neon_fp16_log_softmax",
      [](const SoftmaxKernelDataTypeISASelectorData &data)
      { return (data.is_log && data.dt == DataType::F16) && data.isa.fp16; },
-     REGISTER_FP16_NEON(neon_fp16_softmax<true>)},
+     REGISTER_FP16_NEON(neon_fp16_softmax<true, false>)},
     {"neon_qu8_log_softmax",
      [](const SoftmaxKernelDataTypeISASelectorData &data) { return (data.is_log && data.dt == DataType::QASYMM8); },
      REGISTER_QASYMM8_NEON(arm_compute::cpu::neon_qasymm8_softmax<true>)},
@@ -112,8 +128,13 @@ static const std::vector<typename CpuSoftmaxKernel::SoftmaxKernel> available_ker
      REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::neon_qasymm8_signed_softmax<true>)},
 };
 
-Status validate_arguments_softmax(
-    const ITensorInfo &src, const ITensorInfo &dst, float beta, int axis, const ITensorInfo &tmp, bool is_log)
+Status validate_arguments_softmax(const ITensorInfo &src,
+                                  const ITensorInfo &dst,
+                                  float              beta,
+                                  int                axis,
+                                  const ITensorInfo &tmp,
+                                  bool               is_log,
+                                  bool               fast_math)
 {
     ARM_COMPUTE_UNUSED(beta);
     // Check input
@@ -149,8 +170,9 @@ Status validate_arguments_softmax(
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&src, &tmp);
     }
 
-    const auto *uk = CpuSoftmaxKernel::get_implementation(SoftmaxKernelDataTypeISASelectorData{
-        src.data_type(), CPUInfo::get().get_isa(), is_log, axis, CPUInfo::get().get_sme2_vector_length_in_bits()});
+    const auto *uk = CpuSoftmaxKernel::get_implementation(
+        SoftmaxKernelDataTypeISASelectorData{src.data_type(), CPUInfo::get().get_isa(), is_log, axis,
+                                             CPUInfo::get().get_sme2_vector_length_in_bits(), fast_math});
     ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
 
     return Status{};
@@ -163,12 +185,12 @@ const std::vector<typename CpuSoftmaxKernel::SoftmaxKernel> &CpuSoftmaxKernel::g
 }
 
 void CpuSoftmaxKernel::configure(
-    const ITensorInfo *src, ITensorInfo *dst, float beta, bool is_log, int axis, ITensorInfo *tmp)
+    const ITensorInfo *src, ITensorInfo *dst, float beta, bool is_log, int axis, ITensorInfo *tmp, bool fast_math)
 {
     _axis = axis;
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, tmp);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_softmax(*src, *dst, beta, axis, *tmp, is_log));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_softmax(*src, *dst, beta, axis, *tmp, is_log, fast_math));
 
     // Configure kernel window
     const bool is_quantized_asymmetric = is_data_type_quantized_asymmetric(src->data_type());
@@ -185,8 +207,9 @@ void CpuSoftmaxKernel::configure(
         auto_init_if_empty(*tmp, TensorInfo(*src).set_data_type(DataType::F32).reset_padding());
     }
 
-    const auto *uk = CpuSoftmaxKernel::get_implementation(SoftmaxKernelDataTypeISASelectorData{
-        src->data_type(), CPUInfo::get().get_isa(), is_log, axis, CPUInfo::get().get_sme2_vector_length_in_bits()});
+    const auto *uk = CpuSoftmaxKernel::get_implementation(
+        SoftmaxKernelDataTypeISASelectorData{src->data_type(), CPUInfo::get().get_isa(), is_log, axis,
+                                             CPUInfo::get().get_sme2_vector_length_in_bits(), fast_math});
     ARM_COMPUTE_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
 
     std::string kernel_name = is_log ? std::string("CpuLogSoftmaxKernel") : std::string("CpuSoftmaxKernel");
@@ -246,11 +269,16 @@ void CpuSoftmaxKernel::configure(
 #endif // __aarch64__
 }
 
-Status CpuSoftmaxKernel::validate(
-    const ITensorInfo *src, const ITensorInfo *dst, float beta, int axis, bool is_log, const ITensorInfo *tmp)
+Status CpuSoftmaxKernel::validate(const ITensorInfo *src,
+                                  const ITensorInfo *dst,
+                                  float              beta,
+                                  int                axis,
+                                  bool               is_log,
+                                  const ITensorInfo *tmp,
+                                  bool               fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, tmp);
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_softmax(*src, *dst, beta, axis, *tmp, is_log));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_softmax(*src, *dst, beta, axis, *tmp, is_log, fast_math));
 
     return Status{};
 }
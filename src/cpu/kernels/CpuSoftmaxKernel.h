@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,23 +47,36 @@ public:
 
     /** Set the input and output tensors.
      *
-     * @param[in]  src    Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
-     * @param[out] dst    Destination tensor info. Data types supported: same as @p input.
-     * @param[in]  beta   A scaling factor for the exponent.
-     * @param[in]  is_log True if the operation is log-softmax.
-     * @param[in]  axis   The axis along which to perform the softmax operation.
+     * @param[in]  src       Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[out] dst       Destination tensor info. Data types supported: same as @p input.
+     * @param[in]  beta      A scaling factor for the exponent.
+     * @param[in]  is_log    True if the operation is log-softmax.
+     * @param[in]  axis      The axis along which to perform the softmax operation.
      *
-     * @param      tmp    Auxiliary tensor info. Must be type F32 and same shape as the input.
+     * @param      tmp       Auxiliary tensor info. Must be type F32 and same shape as the input.
+     * @param[in]  fast_math (Optional) Allow a faster, lower accuracy approximation of the exponential for F16/F32.
+     *                       Defaults to false.
      */
-    void configure(const ITensorInfo *src, ITensorInfo *dst, float beta, bool is_log, int axis, ITensorInfo *tmp);
+    void configure(const ITensorInfo *src,
+                   ITensorInfo       *dst,
+                   float              beta,
+                   bool               is_log,
+                   int                axis,
+                   ITensorInfo       *tmp,
+                   bool               fast_math = false);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to CpuSoftmaxKernel::configure()
      *
      * @return a status
      */
-    static Status
-    validate(const ITensorInfo *src, const ITensorInfo *dst, float beta, int axis, bool is_log, const ITensorInfo *tmp);
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *dst,
+                           float              beta,
+                           int                axis,
+                           bool               is_log,
+                           const ITensorInfo *tmp,
+                           bool               fast_math = false);
 
     // Inherited methods overridden:
     void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
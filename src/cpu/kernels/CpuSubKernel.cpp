@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "src/cpu/kernels/add/generic/neon/impl.h"
 #include "src/cpu/kernels/sub/neon/impl.h"
 #include "src/cpu/kernels/sub/neon/list.h"
+#include "src/cpu/utils/CpuCostModel.h"
 
 #if defined(ENABLE_FP32_KERNELS)
 namespace
@@ -143,7 +144,7 @@ void CpuSubKernel::configure(const ITensorInfo *src0, const ITensorInfo *src1, I
 
     // CpuSubKernel doesn't need padding so update_window_and_padding() can be skipped
     Window win;
-    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src0, *src1);
+    std::tie(win, _split_dimension) = calculate_squashed_or_max_window(*src0, *src1, dst);
 
     ICpuKernel::configure(win);
 }
@@ -189,6 +190,11 @@ size_t CpuSubKernel::get_mws(const CPUInfo &platform, size_t thread_count) const
     return ICPPKernel::default_mws;
 }
 
+uint64_t CpuSubKernel::estimate_cost(const CPUInfo &platform, const Window &window) const
+{
+    return estimate_elementwise_cost(platform, window, ElementCost::LIGHT);
+}
+
 Status
 CpuSubKernel::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst, ConvertPolicy policy)
 {
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuYUVPreprocessKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/common/Registrars.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+#include "src/core/utils/ScaleUtils.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+static const std::vector<CpuYUVPreprocessKernel::YUVPreprocessKernel> available_kernels = {
+    {"neon_fp32_yuv_preprocess", [](const DataTypeISASelectorData &data) { return data.dt == DataType::F32; },
+     REGISTER_FP32_NEON(arm_compute::cpu::yuv_preprocess_fp32_neon)},
+    {"neon_fp16_yuv_preprocess",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::F16 && data.isa.fp16; },
+     REGISTER_FP16_NEON(arm_compute::cpu::yuv_preprocess_fp16_neon)},
+    {"neon_qu8_yuv_preprocess", [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8; },
+     REGISTER_QASYMM8_NEON(arm_compute::cpu::yuv_preprocess_qasymm8_neon)},
+    {"neon_qs8_yuv_preprocess",
+     [](const DataTypeISASelectorData &data) { return data.dt == DataType::QASYMM8_SIGNED; },
+     REGISTER_QASYMM8_SIGNED_NEON(arm_compute::cpu::yuv_preprocess_qasymm8_signed_neon)},
+};
+
+/** Bilinear taps of the given source coordinates, clamped to [first, last] and made relative to @p base */
+YUVPreprocessTaps compute_taps(const std::vector<float> &coords, int32_t first, int32_t last, int32_t base)
+{
+    YUVPreprocessTaps taps;
+    taps.index0.reserve(coords.size());
+    taps.index1.reserve(coords.size());
+    taps.weight.reserve(coords.size());
+    for (float coord : coords)
+    {
+        const int32_t index = static_cast<int32_t>(std::floor(coord));
+        taps.index0.push_back(utility::clamp<int32_t>(index, first, last) - base);
+        taps.index1.push_back(utility::clamp<int32_t>(index + 1, first, last) - base);
+        taps.weight.push_back(coord - static_cast<float>(index));
+    }
+    return taps;
+}
+
+/** Luma coordinates sampled by each output coordinate when resizing a crop of a frame */
+std::vector<float>
+luma_coordinates(int32_t crop_start, int32_t crop_size, size_t output_size, SamplingPolicy sampling_policy)
+{
+    const float ratio  = scale_utils::calculate_resize_ratio(crop_size, output_size, false);
+    const float offset = sampling_policy == SamplingPolicy::CENTER ? 0.5f : 0.f;
+
+    std::vector<float> coords(output_size);
+    for (size_t out = 0; out < output_size; ++out)
+    {
+        coords[out] = crop_start + (out + offset) * ratio - offset;
+    }
+    return coords;
+}
+
+/** Chroma coordinates sited at the centre of each 2x2 block of luma samples */
+std::vector<float> chroma_coordinates(std::vector<float> coords)
+{
+    for (float &coord : coords)
+    {
+        coord = (coord + 0.5f) * 0.5f - 0.5f;
+    }
+    return coords;
+}
+
+Status validate_arguments(const ITensorInfo       *luma,
+                          const ITensorInfo       *chroma0,
+                          const ITensorInfo       *chroma1,
+                          const ITensorInfo       *dst,
+                          const YUVPreprocessInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(luma, chroma0, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.format != Format::NV12 && info.format != Format::NV21 &&
+                                        info.format != Format::IYUV,
+                                    "Only NV12, NV21 and IYUV frames are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((info.format == Format::IYUV) != (chroma1 != nullptr),
+                                    "A Cr plane must be given for IYUV frames only");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(luma, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(chroma0, 1, DataType::U8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::F32, DataType::F16, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(dst, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->has_padding(), "Padding is not supported on the destination");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.sampling_policy != SamplingPolicy::CENTER &&
+                                info.sampling_policy != SamplingPolicy::TOP_LEFT);
+
+    const size_t width  = luma->dimension(0);
+    const size_t height = luma->dimension(1);
+    const size_t batch  = luma->dimension(2);
+    ARM_COMPUTE_RETURN_ERROR_ON(luma->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(width == 0 || height == 0);
+
+    // Chroma planes are subsampled by two in both directions
+    const size_t chroma_width  = (width + 1) / 2;
+    const size_t chroma_height = (height + 1) / 2;
+    const size_t uv_width      = info.format == Format::IYUV ? chroma_width : 2 * chroma_width;
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(chroma0->tensor_shape(),
+                                                       TensorShape(uv_width, chroma_height, batch));
+    if (chroma1 != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(chroma1, 1, DataType::U8);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(chroma1->tensor_shape(),
+                                                           TensorShape(chroma_width, chroma_height, batch));
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(static_cast<size_t>(info.crop.x) + info.crop.width > width ||
+                                        static_cast<size_t>(info.crop.y) + info.crop.height > height,
+                                    "Crop region out of the frame");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.crop.x >= width || info.crop.y >= height);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->dimension(0) != 3, "Destination must have three channels");
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) == 0 || dst->dimension(2) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(3) != batch);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(info.norm_mean.size() > 1 && info.norm_mean.size() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.norm_std.size() > 1 && info.norm_std.size() != 3);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(std::find(info.norm_std.begin(), info.norm_std.end(), 0.f) != info.norm_std.end(),
+                                    "Standard deviation must not be zero");
+
+    const auto *uk = CpuYUVPreprocessKernel::get_implementation(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
+
+    return Status{};
+}
+} // namespace
+
+void CpuYUVPreprocessKernel::configure(const ITensorInfo       *luma,
+                                       const ITensorInfo       *chroma0,
+                                       const ITensorInfo       *chroma1,
+                                       ITensorInfo             *dst,
+                                       const YUVPreprocessInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(luma, chroma0, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(luma, chroma0, chroma1, dst, info));
+    ARM_COMPUTE_LOG_PARAMS(luma, chroma0, chroma1, dst, info);
+
+    const auto *uk = CpuYUVPreprocessKernel::get_implementation(
+        DataTypeISASelectorData{dst->data_type(), CPUInfo::get().get_isa()});
+    ARM_COMPUTE_ERROR_ON_NULLPTR(uk);
+
+    _run_method = uk->ukernel;
+    _name       = std::string("CpuYUVPreprocessKernel").append("/").append(uk->name);
+
+    const int32_t crop_x      = info.crop.x;
+    const int32_t crop_y      = info.crop.y;
+    const int32_t crop_width  = info.crop.width == 0 ? luma->dimension(0) - crop_x : info.crop.width;
+    const int32_t crop_height = info.crop.height == 0 ? luma->dimension(1) - crop_y : info.crop.height;
+    const size_t  dst_width   = dst->dimension(1);
+    const size_t  dst_height  = dst->dimension(2);
+
+    // Chroma samples are clamped to the ones covering the crop region, so that the crop behaves as a frame of its own
+    const int32_t chroma_x_first = crop_x / 2;
+    const int32_t chroma_x_last  = (crop_x + crop_width - 1) / 2;
+    const int32_t chroma_y_first = crop_y / 2;
+    const int32_t chroma_y_last  = (crop_y + crop_height - 1) / 2;
+
+    const std::vector<float> luma_x = luma_coordinates(crop_x, crop_width, dst_width, info.sampling_policy);
+    const std::vector<float> luma_y = luma_coordinates(crop_y, crop_height, dst_height, info.sampling_policy);
+
+    _params                = YUVPreprocessParams{};
+    _params.format         = info.format;
+    _params.luma_x         = compute_taps(luma_x, crop_x, crop_x + crop_width - 1, crop_x);
+    _params.luma_y         = compute_taps(luma_y, crop_y, crop_y + crop_height - 1, 0);
+    _params.chroma_x       = compute_taps(chroma_coordinates(luma_x), chroma_x_first, chroma_x_last, chroma_x_first);
+    _params.chroma_y       = compute_taps(chroma_coordinates(luma_y), chroma_y_first, chroma_y_last, 0);
+    _params.luma_x_start   = crop_x;
+    _params.luma_x_count   = crop_width;
+    _params.chroma_x_start = chroma_x_first;
+    _params.chroma_x_count = chroma_x_last - chroma_x_first + 1;
+
+    // Colour conversion derived from the luma weights of red and blue of the standard
+    const float kr           = info.color_standard == YUVColorStandard::BT709 ? 0.2126f : 0.299f;
+    const float kb           = info.color_standard == YUVColorStandard::BT709 ? 0.0722f : 0.114f;
+    const float kg           = 1.f - kr - kb;
+    const float chroma_scale = info.full_range ? 1.f : 255.f / 224.f;
+    const float cr_to_r      = 2.f * (1.f - kr) * chroma_scale;
+    const float cb_to_g      = -2.f * kb * (1.f - kb) / kg * chroma_scale;
+    const float cr_to_g      = -2.f * kr * (1.f - kr) / kg * chroma_scale;
+    const float cb_to_b      = 2.f * (1.f - kb) * chroma_scale;
+
+    _params.luma_offset = info.full_range ? 0.f : 16.f;
+    _params.luma_scale  = info.full_range ? 1.f : 255.f / 219.f;
+    _params.cb_coeff    = info.bgr ? std::array<float, 3>{{cb_to_b, cb_to_g, 0.f}}
+                                   : std::array<float, 3>{{0.f, cb_to_g, cb_to_b}};
+    _params.cr_coeff    = info.bgr ? std::array<float, 3>{{0.f, cr_to_g, cr_to_r}}
+                                   : std::array<float, 3>{{cr_to_r, cr_to_g, 0.f}};
+
+    for (size_t c = 0; c < 3; ++c)
+    {
+        const float mean    = info.norm_mean.empty() ? 0.f : info.norm_mean[info.norm_mean.size() == 1 ? 0 : c];
+        const float stddev  = info.norm_std.empty() ? 1.f : info.norm_std[info.norm_std.size() == 1 ? 0 : c];
+        _params.norm_mul[c] = 1.f / stddev;
+        _params.norm_add[c] = -mean / stddev;
+    }
+    _params.qinfo = dst->quantization_info().uniform();
+
+    _scratch_size = yuv_preprocess_scratch_size(_params, dst_width);
+
+    // Each window step along the height computes a whole output row
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuYUVPreprocessKernel::validate(const ITensorInfo       *luma,
+                                        const ITensorInfo       *chroma0,
+                                        const ITensorInfo       *chroma1,
+                                        const ITensorInfo       *dst,
+                                        const YUVPreprocessInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(luma, chroma0, chroma1, dst, info));
+    return Status{};
+}
+
+size_t CpuYUVPreprocessKernel::get_scratch_size_per_thread() const
+{
+    return _scratch_size;
+}
+
+void CpuYUVPreprocessKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_run_method == nullptr);
+
+    const auto luma    = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto chroma0 = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    const auto chroma1 = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto       dst     = tensors.get_tensor(TensorType::ACL_DST);
+    auto       scratch = tensors.get_tensor(TensorType::ACL_INT_0);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(luma, chroma0, dst, scratch);
+    ARM_COMPUTE_ERROR_ON(scratch->info()->total_size() < (info.thread_id + 1) * _scratch_size);
+
+    _run_method(luma, chroma0, chroma1, dst, _params, scratch->buffer() + info.thread_id * _scratch_size, window);
+}
+
+const char *CpuYUVPreprocessKernel::name() const
+{
+    return _name.c_str();
+}
+
+const std::vector<CpuYUVPreprocessKernel::YUVPreprocessKernel> &CpuYUVPreprocessKernel::get_available_kernels()
+{
+    return available_kernels;
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_CPUYUVPREPROCESSKERNEL_H
+#define ACL_SRC_CPU_KERNELS_CPUYUVPREPROCESSKERNEL_H
+
+#include "arm_compute/function_info/YUVPreprocessInfo.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/yuvpreprocess/list.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Arm(R) Neon(TM) kernel to turn a YUV frame into a normalised NHWC network input
+ *
+ * The frame is cropped, resampled bilinearly, converted to RGB, normalised and quantized in a single pass over the
+ * destination rows. The sampling positions and the colour conversion are computed once at configuration.
+ */
+class CpuYUVPreprocessKernel : public ICpuKernel<CpuYUVPreprocessKernel>
+{
+private:
+    using YUVPreprocessKernelPtr = std::add_pointer<void(const ITensor *,
+                                                         const ITensor *,
+                                                         const ITensor *,
+                                                         ITensor *,
+                                                         const YUVPreprocessParams &,
+                                                         uint8_t *,
+                                                         const Window &)>::type;
+
+public:
+    CpuYUVPreprocessKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuYUVPreprocessKernel);
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  luma    Luma plane info of shape [W, H, N]. Data type supported: U8.
+     * @param[in]  chroma0 Chroma plane info. For NV12/NV21 the interleaved plane of shape [2 * ceil(W / 2), ceil(H / 2), N],
+     *                     for IYUV the Cb plane of shape [ceil(W / 2), ceil(H / 2), N]. Data type supported: U8.
+     * @param[in]  chroma1 Cr plane info of shape [ceil(W / 2), ceil(H / 2), N] for IYUV, nullptr otherwise. Data type supported: U8.
+     * @param[out] dst     Destination tensor info of shape [3, W_out, H_out, N]. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  info    Preprocessing information described in @ref YUVPreprocessInfo.
+     */
+    void configure(const ITensorInfo       *luma,
+                   const ITensorInfo       *chroma0,
+                   const ITensorInfo       *chroma1,
+                   ITensorInfo             *dst,
+                   const YUVPreprocessInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuYUVPreprocessKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo       *luma,
+                           const ITensorInfo       *chroma0,
+                           const ITensorInfo       *chroma1,
+                           const ITensorInfo       *dst,
+                           const YUVPreprocessInfo &info);
+    /** Size in bytes of the working space needed by each thread running the kernel
+     *
+     * The working space is passed as ACL_INT_0 and must hold one such region per thread.
+     *
+     * @return The size in bytes
+     */
+    size_t get_scratch_size_per_thread() const;
+
+    // Inherited methods overridden:
+    void        run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+    struct YUVPreprocessKernel
+    {
+        const char                  *name;
+        const DataTypeISASelectorPtr is_selected;
+        YUVPreprocessKernelPtr       ukernel;
+    };
+
+    static const std::vector<YUVPreprocessKernel> &get_available_kernels();
+
+private:
+    YUVPreprocessKernelPtr _run_method{nullptr};
+    YUVPreprocessParams    _params{};
+    size_t                 _scratch_size{0};
+    std::string            _name{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_CPUYUVPREPROCESSKERNEL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited.
+ * Copyright (c) 2020-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -93,6 +93,7 @@ void fp_neon_activation_impl(const ITensor             *src,
     const auto      vb                = wrapper::vdup_n(static_cast<T>(act_info.b()), ExactTagType{});
     const auto      a                 = static_cast<T>(act_info.a());
     const auto      b                 = static_cast<T>(act_info.b());
+    const bool      fast_math         = act_info.fast_math();
     execute_window_loop(
         win_collapsed,
         [&](const Coordinates &)
@@ -114,8 +115,13 @@ void fp_neon_activation_impl(const ITensor             *src,
                         tmp = wrapper::vmla(vb, va, vin);
                         break;
                     case ActivationLayerInfo::ActivationFunction::LOGISTIC:
-                        tmp = wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(vin))));
+                    {
+                        const auto vneg_in = wrapper::vneg(vin);
+                        const auto vexp_neg_in =
+                            fast_math ? wrapper::vexpq_fast(vneg_in) : wrapper::vexpq(vneg_in);
+                        tmp = wrapper::vinv(wrapper::vadd(const_1, vexp_neg_in));
                         break;
+                    }
                     case ActivationLayerInfo::ActivationFunction::RELU:
                         tmp = wrapper::vmax(const_0, vin);
                         break;
@@ -130,11 +136,14 @@ void fp_neon_activation_impl(const ITensor             *src,
                         break;
                     case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
                         tmp = wrapper::vbsl(wrapper::vcgt(vin, vsoft_relu_thresh), vin,
-                                            wrapper::vlog(wrapper::vadd(const_1, wrapper::vexpq(vin))));
+                                            wrapper::vlog(wrapper::vadd(
+                                                const_1, fast_math ? wrapper::vexpq_fast(vin) : wrapper::vexpq(vin))));
                         break;
                     case ActivationLayerInfo::ActivationFunction::ELU:
-                        tmp = wrapper::vbsl(wrapper::vcge(vin, const_0), vin,
-                                            wrapper::vmul(va, wrapper::vsub(wrapper::vexpq(vin), const_1)));
+                        tmp = wrapper::vbsl(
+                            wrapper::vcge(vin, const_0), vin,
+                            wrapper::vmul(va, fast_math ? wrapper::vexpm1q_fast(vin)
+                                                        : wrapper::vsub(wrapper::vexpq(vin), const_1)));
                         break;
                     case ActivationLayerInfo::ActivationFunction::SQRT:
 #ifdef __aarch64__
@@ -151,8 +160,11 @@ void fp_neon_activation_impl(const ITensor             *src,
                         tmp = wrapper::vmul(vin, vin);
                         break;
                     case ActivationLayerInfo::ActivationFunction::TANH:
-                        tmp = wrapper::vmul(va, wrapper::vtanh(wrapper::vmul(vb, vin)));
+                    {
+                        const auto vb_in = wrapper::vmul(vb, vin);
+                        tmp = wrapper::vmul(va, fast_math ? wrapper::vtanh_fast(vb_in) : wrapper::vtanh(vb_in));
                         break;
+                    }
                     case ActivationLayerInfo::ActivationFunction::IDENTITY:
                         tmp = vin;
                         break;
@@ -163,9 +175,13 @@ void fp_neon_activation_impl(const ITensor             *src,
                                           wrapper::vmin(const_6, wrapper::vmax(const_0, wrapper::vadd(vin, const_3)))));
                         break;
                     case ActivationLayerInfo::ActivationFunction::SWISH:
-                        tmp = wrapper::vmul(vin, wrapper::vinv(wrapper::vadd(
-                                                     const_1, wrapper::vexpq(wrapper::vneg(wrapper::vmul(va, vin))))));
+                    {
+                        const auto vneg_a_in = wrapper::vneg(wrapper::vmul(va, vin));
+                        const auto vexp_neg_a_in =
+                            fast_math ? wrapper::vexpq_fast(vneg_a_in) : wrapper::vexpq(vneg_a_in);
+                        tmp = wrapper::vmul(vin, wrapper::vinv(wrapper::vadd(const_1, vexp_neg_a_in)));
                         break;
+                    }
 #ifdef __aarch64__
                     case ActivationLayerInfo::ActivationFunction::GELU:
                         tmp = wrapper::vmul(
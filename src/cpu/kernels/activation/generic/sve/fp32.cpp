@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited.
+ * Copyright (c) 2020-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,6 +58,9 @@ void sve_fp32_activation(const ITensor *src, ITensor *dst, const ActivationLayer
 
     const auto va = svdup_n_f32(act_info.a());
     const auto vb = svdup_n_f32(act_info.b());
+
+    const bool fast_math = act_info.fast_math();
+
     execute_window_loop(
         win_collapsed,
         [&](const Coordinates &)
@@ -82,8 +85,13 @@ void sve_fp32_activation(const ITensor *src, ITensor *dst, const ActivationLayer
                         tmp = svmla_f32_z(pg, vb, va, vin);
                         break;
                     case ActivationLayerInfo::ActivationFunction::LOGISTIC:
-                        tmp = svinv_f32_z(pg, svadd_f32_z(pg, const_1, svexp_f32_z(pg, svneg_f32_z(pg, vin))));
+                    {
+                        const auto vneg_in = svneg_f32_z(pg, vin);
+                        const auto vexp_neg_in =
+                            fast_math ? svexp_fast_f32_z(pg, vneg_in) : svexp_f32_z(pg, vneg_in);
+                        tmp = svinv_f32_z(pg, svadd_f32_z(pg, const_1, vexp_neg_in));
                         break;
+                    }
                     case ActivationLayerInfo::ActivationFunction::RELU:
                         tmp = svmax_f32_z(pg, const_0, vin);
                         break;
@@ -98,12 +106,16 @@ void sve_fp32_activation(const ITensor *src, ITensor *dst, const ActivationLayer
                                           svmax_f32_z(pg, vin, const_0));
                         break;
                     case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
-                        tmp = svsel_f32(svcmpgt_f32(pg, vin, soft_relu_thresh), vin,
-                                        svlog_f32_z(pg, svadd_f32_z(pg, const_1, svexp_f32_z(pg, vin))));
+                        tmp = svsel_f32(
+                            svcmpgt_f32(pg, vin, soft_relu_thresh), vin,
+                            svlog_f32_z(pg, svadd_f32_z(pg, const_1,
+                                                        fast_math ? svexp_fast_f32_z(pg, vin) : svexp_f32_z(pg, vin))));
                         break;
                     case ActivationLayerInfo::ActivationFunction::ELU:
                         tmp = svsel_f32(svcmpgt_f32(pg, vin, const_0), vin,
-                                        svmul_f32_z(pg, va, svsub_f32_z(pg, svexp_f32_z(pg, vin), const_1)));
+                                        svmul_f32_z(pg, va,
+                                                    fast_math ? svexpm1_fast_f32_z(pg, vin)
+                                                              : svsub_f32_z(pg, svexp_f32_z(pg, vin), const_1)));
                         break;
                     case ActivationLayerInfo::ActivationFunction::SQRT:
                         tmp = svsqrt_f32_z(pg, vin);
@@ -112,8 +124,11 @@ void sve_fp32_activation(const ITensor *src, ITensor *dst, const ActivationLayer
                         tmp = svmul_f32_z(pg, vin, vin);
                         break;
                     case ActivationLayerInfo::ActivationFunction::TANH:
-                        tmp = svmul_f32_z(pg, va, svtanh_f32_z(pg, svmul_f32_z(pg, vb, vin)));
+                    {
+                        const auto vb_in = svmul_f32_z(pg, vb, vin);
+                        tmp = svmul_f32_z(pg, va, fast_math ? svtanh_fast_f32_z(pg, vb_in) : svtanh_f32_z(pg, vb_in));
                         break;
+                    }
                     case ActivationLayerInfo::ActivationFunction::IDENTITY:
                         tmp = vin;
                         break;
@@ -125,11 +140,13 @@ void sve_fp32_activation(const ITensor *src, ITensor *dst, const ActivationLayer
                                 svmin_f32_z(pg, const_6, svmax_f32_z(pg, const_0, svadd_f32_z(pg, vin, const_3)))));
                         break;
                     case ActivationLayerInfo::ActivationFunction::SWISH:
-                        tmp = svmul_f32_z(
-                            pg, vin,
-                            svinv_f32_z(pg, svadd_f32_z(pg, const_1,
-                                                        svexp_f32_z(pg, svneg_f32_z(pg, svmul_f32_z(pg, va, vin))))));
+                    {
+                        const auto vneg_a_in = svneg_f32_z(pg, svmul_f32_z(pg, va, vin));
+                        const auto vexp_neg_a_in =
+                            fast_math ? svexp_fast_f32_z(pg, vneg_a_in) : svexp_f32_z(pg, vneg_a_in);
+                        tmp = svmul_f32_z(pg, vin, svinv_f32_z(pg, svadd_f32_z(pg, const_1, vexp_neg_a_in)));
                         break;
+                    }
                     default:
                         ARM_COMPUTE_ERROR("Unsupported activation function");
                 }
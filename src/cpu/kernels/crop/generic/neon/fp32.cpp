@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,5 +41,14 @@ void fp32_in_bounds_crop_window(const ITensor *input,
     return in_bounds_crop_window<float32_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
                                             output_width_limit, input_has_single_channel, is_width_flipped);
 }
+
+void fp32_crop_resize_row(const CropResizeRow &row,
+                          float               *output_ptr,
+                          size_t               output_stride_x,
+                          InterpolationPolicy  policy,
+                          float                extrapolation_value)
+{
+    return crop_resize_row<float32_t>(row, output_ptr, output_stride_x, policy, extrapolation_value);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
 
 #include "src/core/common/Registrars.h"
 #include "src/core/NEON/wrapper/wrapper.h"
@@ -119,6 +120,177 @@ void in_bounds_crop_window(const ITensor *input,
         }
     }
 }
+
+/** Geometry of one output row of a fused crop and resize */
+struct CropResizeRow
+{
+    uint8_t *batch_ptr;    /**< Pointer to the first element of the image the box is applied to */
+    size_t   stride_x;     /**< Stride in bytes between two columns of the input image */
+    size_t   stride_y;     /**< Stride in bytes between two rows of the input image */
+    int32_t  input_width;  /**< Number of columns of the input image */
+    int32_t  input_height; /**< Number of rows of the input image */
+    int32_t  num_channels; /**< Number of channels */
+    int32_t  start_x;      /**< Input column of the first column of the box */
+    int32_t  start_y;      /**< Input row of the first row of the box */
+    int32_t  dir_x;        /**< 1, or -1 if the box is flipped horizontally */
+    int32_t  dir_y;        /**< 1, or -1 if the box is flipped vertically */
+    int32_t  crop_width;   /**< Number of columns of the box */
+    int32_t  crop_height;  /**< Number of rows of the box */
+    int32_t  output_width; /**< Number of columns of the output */
+    float    scale_x;      /**< Ratio between the width of the box and the width of the output */
+    float    src_y;        /**< Sampling row, in box coordinates */
+};
+
+/** Return the input pixel at position (cx, cy) of the box, or nullptr if it is outside of the box or the image */
+template <typename T>
+inline T *crop_resize_pixel(const CropResizeRow &row, int32_t cx, int32_t cy)
+{
+    if (cx < 0 || cx >= row.crop_width || cy < 0 || cy >= row.crop_height)
+    {
+        return nullptr;
+    }
+    const int32_t ix = row.start_x + row.dir_x * cx;
+    const int32_t iy = row.start_y + row.dir_y * cy;
+    if (ix < 0 || ix >= row.input_width || iy < 0 || iy >= row.input_height)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<T *>(row.batch_ptr + ix * row.stride_x + iy * row.stride_y);
+}
+
+/** Accumulate the vectorizable channels of one output pixel
+ *
+ * @return The first channel left for the scalar tail.
+ */
+template <typename T>
+inline int32_t crop_resize_channels(
+    T *const *taps, const float *weights, int32_t num_taps, float border, int32_t num_channels, float *out)
+{
+    constexpr int32_t window_step_x = 16 / sizeof(float);
+
+    int32_t c = 0;
+    for (; c <= num_channels - window_step_x; c += window_step_x)
+    {
+        float32x4_t acc = vdupq_n_f32(border);
+        for (int32_t t = 0; t < num_taps; ++t)
+        {
+            acc = vmlaq_n_f32(acc, load_as_f32(taps[t] + c), weights[t]);
+        }
+        vst1q_f32(out + c, acc);
+    }
+    return c;
+}
+
+/** U8 specialization: a 64-bit load for every four channels would read past the last pixel of the image,
+ * so whole 16-channel blocks are loaded at once and widened in registers.
+ */
+template <>
+inline int32_t crop_resize_channels<uint8_t>(
+    uint8_t *const *taps, const float *weights, int32_t num_taps, float border, int32_t num_channels, float *out)
+{
+    constexpr int32_t window_step_x = 16;
+
+    int32_t c = 0;
+    for (; c <= num_channels - window_step_x; c += window_step_x)
+    {
+        float32x4_t acc[4] = {vdupq_n_f32(border), vdupq_n_f32(border), vdupq_n_f32(border), vdupq_n_f32(border)};
+        for (int32_t t = 0; t < num_taps; ++t)
+        {
+            const uint8x16_t  in        = vld1q_u8(taps[t] + c);
+            const uint16x8_t  in_low    = vmovl_u8(vget_low_u8(in));
+            const uint16x8_t  in_high   = vmovl_u8(vget_high_u8(in));
+            const float32x4_t in_f32[4] = {vcvtq_f32_u32(vmovl_u16(vget_low_u16(in_low))),
+                                             vcvtq_f32_u32(vmovl_u16(vget_high_u16(in_low))),
+                                             vcvtq_f32_u32(vmovl_u16(vget_low_u16(in_high))),
+                                             vcvtq_f32_u32(vmovl_u16(vget_high_u16(in_high)))};
+            for (int32_t i = 0; i < 4; ++i)
+            {
+                acc[i] = vmlaq_n_f32(acc[i], in_f32[i], weights[t]);
+            }
+        }
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            vst1q_f32(out + c + 4 * i, acc[i]);
+        }
+    }
+    return c;
+}
+
+/** Crop and resize one output row directly from the input image
+ *
+ * Every output pixel is a weighted sum of at most four input pixels. Taps that fall outside of the box
+ * or of the image are folded into a constant term so the channel loop only streams valid pixels.
+ */
+template <typename T>
+void crop_resize_row(const CropResizeRow &row,
+                     float               *output_ptr,
+                     size_t               output_stride_x,
+                     InterpolationPolicy  policy,
+                     float                extrapolation_value)
+{
+    const int32_t num_channels = row.num_channels;
+
+    const float   floor_y = std::floor(row.src_y);
+    const int32_t cy      = static_cast<int32_t>(floor_y);
+    const float   dy      = row.src_y - floor_y;
+
+    T      *taps[4];
+    float   weights[4];
+    int32_t num_taps = 0;
+    float   border   = 0.f;
+
+    const auto add_tap = [&](int32_t tap_x, int32_t tap_y, float weight)
+    {
+        T *tap = crop_resize_pixel<T>(row, tap_x, tap_y);
+        if (tap != nullptr)
+        {
+            taps[num_taps]    = tap;
+            weights[num_taps] = weight;
+            ++num_taps;
+        }
+        else
+        {
+            border += weight * extrapolation_value;
+        }
+    };
+
+    for (int32_t ox = 0; ox < row.output_width; ++ox)
+    {
+        float *out = reinterpret_cast<float *>(reinterpret_cast<uint8_t *>(output_ptr) + ox * output_stride_x);
+
+        const float   src_x   = ox * row.scale_x;
+        const float   floor_x = std::floor(src_x);
+        const int32_t cx      = static_cast<int32_t>(floor_x);
+
+        num_taps = 0;
+        border   = 0.f;
+        if (policy == InterpolationPolicy::NEAREST_NEIGHBOR)
+        {
+            add_tap(cx, cy, 1.f);
+        }
+        else
+        {
+            const float dx   = src_x - floor_x;
+            const float dx_1 = 1.f - dx;
+            const float dy_1 = 1.f - dy;
+            add_tap(cx, cy, dx_1 * dy_1);
+            add_tap(cx + 1, cy, dx * dy_1);
+            add_tap(cx, cy + 1, dx_1 * dy);
+            add_tap(cx + 1, cy + 1, dx * dy);
+        }
+
+        int32_t c = crop_resize_channels<T>(taps, weights, num_taps, border, num_channels, out);
+        for (; c < num_channels; ++c)
+        {
+            float acc = border;
+            for (int32_t t = 0; t < num_taps; ++t)
+            {
+                acc += weights[t] * static_cast<float>(*(taps[t] + c));
+            }
+            out[c] = acc;
+        }
+    }
+}
 } // namespace cpu
 } // namespace arm_compute
 #endif //SRC_CORE_NEON_KERNELS_CROP_IMPL_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -112,5 +112,50 @@ void s32_in_bounds_crop_window(const ITensor *input,
     return in_bounds_crop_window<int32_t>(input, output, output_ptr, input_offset, window_step_x, output_width_start,
                                           output_width_limit, input_has_single_channel, is_width_flipped);
 }
+
+void u8_crop_resize_row(const CropResizeRow &row,
+                        float               *output_ptr,
+                        size_t               output_stride_x,
+                        InterpolationPolicy  policy,
+                        float                extrapolation_value)
+{
+    return crop_resize_row<uint8_t>(row, output_ptr, output_stride_x, policy, extrapolation_value);
+}
+
+void u16_crop_resize_row(const CropResizeRow &row,
+                         float               *output_ptr,
+                         size_t               output_stride_x,
+                         InterpolationPolicy  policy,
+                         float                extrapolation_value)
+{
+    return crop_resize_row<uint16_t>(row, output_ptr, output_stride_x, policy, extrapolation_value);
+}
+
+void u32_crop_resize_row(const CropResizeRow &row,
+                         float               *output_ptr,
+                         size_t               output_stride_x,
+                         InterpolationPolicy  policy,
+                         float                extrapolation_value)
+{
+    return crop_resize_row<uint32_t>(row, output_ptr, output_stride_x, policy, extrapolation_value);
+}
+
+void s16_crop_resize_row(const CropResizeRow &row,
+                         float               *output_ptr,
+                         size_t               output_stride_x,
+                         InterpolationPolicy  policy,
+                         float                extrapolation_value)
+{
+    return crop_resize_row<int16_t>(row, output_ptr, output_stride_x, policy, extrapolation_value);
+}
+
+void s32_crop_resize_row(const CropResizeRow &row,
+                         float               *output_ptr,
+                         size_t               output_stride_x,
+                         InterpolationPolicy  policy,
+                         float                extrapolation_value)
+{
+    return crop_resize_row<int32_t>(row, output_ptr, output_stride_x, policy, extrapolation_value);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,10 +31,10 @@ namespace arm_compute
 namespace cpu
 {
 void neon_fp16_elementwise_unary(
-    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut)
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut, bool fast_math)
 {
     ARM_COMPUTE_UNUSED(lut);
-    return elementwise_op<__fp16>(in, out, window, op);
+    return elementwise_op<__fp16>(in, out, window, op, fast_math);
 }
 } // namespace cpu
 } // namespace arm_compute
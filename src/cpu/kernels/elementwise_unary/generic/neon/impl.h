@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023 Arm Limited.
+ * Copyright (c) 2018-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,14 +59,14 @@ inline ScalarType elementwise_op_scalar_imp(ElementWiseUnary op, const ScalarTyp
 }
 
 template <typename ScalarType, typename VectorType>
-inline VectorType elementwise_op_imp(ElementWiseUnary op, const VectorType &a)
+inline VectorType elementwise_op_imp(ElementWiseUnary op, const VectorType &a, bool fast_math)
 {
     switch (op)
     {
         case ElementWiseUnary::RSQRT:
             return wrapper::vinvsqrt(a);
         case ElementWiseUnary::EXP:
-            return wrapper::vexpq(a);
+            return fast_math ? wrapper::vexpq_fast(a) : wrapper::vexpq(a);
         case ElementWiseUnary::NEG:
             return wrapper::vneg(a);
         case ElementWiseUnary::LOG:
@@ -83,7 +83,7 @@ inline VectorType elementwise_op_imp(ElementWiseUnary op, const VectorType &a)
 }
 
 template <typename ScalarType>
-inline void elementwise_op(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op)
+inline void elementwise_op(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, bool fast_math)
 {
     const int  window_step_x  = 16 / sizeof(ScalarType);
     const auto window_start_x = static_cast<int>(window.x().start());
@@ -105,7 +105,8 @@ inline void elementwise_op(const ITensor *in, ITensor *out, const Window &window
             int x = window_start_x;
             for (; x <= window_end_x - window_step_x; x += window_step_x)
             {
-                wrapper::vstore(output_ptr + x, elementwise_op_imp<ScalarType>(op, wrapper::vloadq(input_ptr + x)));
+                wrapper::vstore(output_ptr + x,
+                                elementwise_op_imp<ScalarType>(op, wrapper::vloadq(input_ptr + x), fast_math));
             }
             for (; x < window_end_x; ++x)
             {
@@ -116,7 +117,8 @@ inline void elementwise_op(const ITensor *in, ITensor *out, const Window &window
 }
 
 template <>
-inline void elementwise_op<int8_t>(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op)
+inline void elementwise_op<int8_t>(
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, bool fast_math)
 {
     const int                     window_step_x     = 16;
     const auto                    window_start_x    = static_cast<int>(window.x().start());
@@ -151,10 +153,10 @@ inline void elementwise_op<int8_t>(const ITensor *in, ITensor *out, const Window
 
                 // Perform activation
                 float32x4x4_t vtmp_deq = {{
-                    elementwise_op_imp<float>(op, vin_deq.val[0]),
-                    elementwise_op_imp<float>(op, vin_deq.val[1]),
-                    elementwise_op_imp<float>(op, vin_deq.val[2]),
-                    elementwise_op_imp<float>(op, vin_deq.val[3]),
+                    elementwise_op_imp<float>(op, vin_deq.val[0], fast_math),
+                    elementwise_op_imp<float>(op, vin_deq.val[1], fast_math),
+                    elementwise_op_imp<float>(op, vin_deq.val[2], fast_math),
+                    elementwise_op_imp<float>(op, vin_deq.val[3], fast_math),
                 }};
 
                 if ((op == ElementWiseUnary::LOG) || (op == ElementWiseUnary::RSQRT))
@@ -208,7 +210,8 @@ inline void elementwise_op<int8_t>(const ITensor *in, ITensor *out, const Window
         input, output);
 }
 template <>
-inline void elementwise_op<uint8_t>(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op)
+inline void elementwise_op<uint8_t>(
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, bool fast_math)
 {
     const int                     window_step_x     = 16;
     const auto                    window_start_x    = static_cast<int>(window.x().start());
@@ -242,10 +245,10 @@ inline void elementwise_op<uint8_t>(const ITensor *in, ITensor *out, const Windo
 
                 // Perform activation
                 float32x4x4_t vtmp_deq = {{
-                    elementwise_op_imp<float>(op, vin_deq.val[0]),
-                    elementwise_op_imp<float>(op, vin_deq.val[1]),
-                    elementwise_op_imp<float>(op, vin_deq.val[2]),
-                    elementwise_op_imp<float>(op, vin_deq.val[3]),
+                    elementwise_op_imp<float>(op, vin_deq.val[0], fast_math),
+                    elementwise_op_imp<float>(op, vin_deq.val[1], fast_math),
+                    elementwise_op_imp<float>(op, vin_deq.val[2], fast_math),
+                    elementwise_op_imp<float>(op, vin_deq.val[3], fast_math),
                 }};
                 if ((op == ElementWiseUnary::LOG) || (op == ElementWiseUnary::RSQRT))
                 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,10 +30,10 @@ namespace arm_compute
 namespace cpu
 {
 void neon_s32_elementwise_unary(
-    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut)
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut, bool fast_math)
 {
     ARM_COMPUTE_UNUSED(lut);
-    return elementwise_op<int32_t>(in, out, window, op);
+    return elementwise_op<int32_t>(in, out, window, op, fast_math);
 }
 } // namespace cpu
 } // namespace arm_compute
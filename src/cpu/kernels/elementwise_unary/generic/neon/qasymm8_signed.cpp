@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,10 +33,10 @@ namespace cpu
 #ifndef __aarch64__
 // Fallback function to be used for armv7a, for aarch64 LUT is used
 void neon_qasymm8_signed_elementwise_unary(
-    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut)
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut, bool fast_math)
 {
     ARM_COMPUTE_UNUSED(lut);
-    return elementwise_op<int8_t>(in, out, window, op);
+    return elementwise_op<int8_t>(in, out, window, op, fast_math);
 }
 #endif // #ifndef __aarch64__
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, 2024 Arm Limited.
+ * Copyright (c) 2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,14 +33,14 @@ namespace cpu
 {
 template <typename ScalarType, typename VectorType>
 inline typename std::enable_if<utils::traits::is_floating_point<ScalarType>::value, VectorType>::type
-elementwise_op_sve_imp(svbool_t pg, ElementWiseUnary op, const VectorType &a)
+elementwise_op_sve_imp(svbool_t pg, ElementWiseUnary op, const VectorType &a, bool fast_math)
 {
     switch (op)
     {
         case ElementWiseUnary::RSQRT:
             return svinvsqrt(pg, a);
         case ElementWiseUnary::EXP:
-            return wrapper::svexp_z(pg, a);
+            return fast_math ? wrapper::svexp_fast_z(pg, a) : wrapper::svexp_z(pg, a);
         case ElementWiseUnary::NEG:
             return svneg_z(pg, a);
         case ElementWiseUnary::LOG:
@@ -58,8 +58,9 @@ elementwise_op_sve_imp(svbool_t pg, ElementWiseUnary op, const VectorType &a)
 
 template <typename ScalarType, typename VectorType>
 inline typename std::enable_if<std::is_integral<ScalarType>::value, VectorType>::type
-elementwise_op_sve_imp(svbool_t pg, ElementWiseUnary op, const VectorType &a)
+elementwise_op_sve_imp(svbool_t pg, ElementWiseUnary op, const VectorType &a, bool fast_math)
 {
+    ARM_COMPUTE_UNUSED(fast_math);
     switch (op)
     {
         case ElementWiseUnary::NEG:
@@ -72,7 +73,7 @@ elementwise_op_sve_imp(svbool_t pg, ElementWiseUnary op, const VectorType &a)
 }
 
 template <typename ScalarType>
-void elementwise_sve_op(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op)
+void elementwise_sve_op(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, bool fast_math)
 {
     const auto all_true_pg    = wrapper::svptrue<ScalarType>();
     const auto window_start_x = static_cast<int>(window.x().start());
@@ -102,6 +103,7 @@ void elementwise_sve_op(const ITensor *in, ITensor *out, const Window &window, E
                 // and put the inside of this function here.
                 // More info: https://github.com/google/highway/issues/2356
 
+                ARM_COMPUTE_UNUSED(fast_math);
                 auto vout = vin;
                 switch (op)
                 {
@@ -116,7 +118,7 @@ void elementwise_sve_op(const ITensor *in, ITensor *out, const Window &window, E
                 }
                 svst1(pg, output_ptr + x, vout);
 #else  // defined(__llvm__) && defined(__APPLE__) && defined(__clang__)
-                svst1(pg, output_ptr + x, elementwise_op_sve_imp<ScalarType, decltype(vin)>(pg, op, vin));
+                svst1(pg, output_ptr + x, elementwise_op_sve_imp<ScalarType, decltype(vin)>(pg, op, vin, fast_math));
 #endif // defined(__llvm__) && defined(__APPLE__) && defined(__clang__)
                 x += wrapper::svcnt<ScalarType>();
                 pg = wrapper::svwhilelt<ScalarType>(x, window_end_x);
@@ -125,9 +127,12 @@ void elementwise_sve_op(const ITensor *in, ITensor *out, const Window &window, E
         input, output);
 }
 
-template void elementwise_sve_op<float16_t>(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op);
-template void elementwise_sve_op<float32_t>(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op);
-template void elementwise_sve_op<int32_t>(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op);
+template void elementwise_sve_op<float16_t>(
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, bool fast_math);
+template void elementwise_sve_op<float32_t>(
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, bool fast_math);
+template void elementwise_sve_op<int32_t>(
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, bool fast_math);
 
 } // namespace cpu
 } // namespace arm_compute
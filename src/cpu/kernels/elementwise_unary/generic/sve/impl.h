@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,7 @@ namespace arm_compute
 namespace cpu
 {
 template <typename ScalarType>
-void elementwise_sve_op(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op);
+void elementwise_sve_op(const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, bool fast_math);
 } // namespace cpu
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,9 +31,9 @@ namespace arm_compute
 namespace cpu
 {
 void sve2_q8_elementwise_unary(
-    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut)
+    const ITensor *in, ITensor *out, const Window &window, ElementWiseUnary op, const uint8_t *lut, bool fast_math)
 {
-    ARM_COMPUTE_UNUSED(op);
+    ARM_COMPUTE_UNUSED(op, fast_math);
 
     auto       win          = window;
     const auto window_end_x = window.x().end();
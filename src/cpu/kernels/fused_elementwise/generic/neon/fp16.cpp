@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,18 +21,21 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#ifndef SRC_CORE_NEON_KERNELS_INSTANCENORM_LIST_H
-#define SRC_CORE_NEON_KERNELS_INSTANCENORM_LIST_H
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/fused_elementwise/generic/neon/impl.h"
+
 namespace arm_compute
 {
 namespace cpu
 {
-#define DECLARE_INSTANCENORM_KERNEL(func_name)                                                                        \
-    void func_name(ITensor *input, ITensor *output, float gamma, float beta, float epsilon, bool use_mixed_precision, \
-                   const Window &window)
-DECLARE_INSTANCENORM_KERNEL(neon_fp32_instancenorm);
-DECLARE_INSTANCENORM_KERNEL(neon_fp16_instancenorm);
-#undef DECLARE_INSTANCENORM_KERNEL
+void fused_elementwise_fp16_neon(const ITensor *const        *srcs,
+                                 ITensor                     *dst,
+                                 const ElementwiseExpression &expr,
+                                 const Window                &window)
+{
+    fused_elementwise_impl<float16_t>(srcs, dst, expr, window);
+}
 } // namespace cpu
 } // namespace arm_compute
-#endif //SRC_CORE_NEON_KERNELS_INSTANCENORM_LIST_H
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
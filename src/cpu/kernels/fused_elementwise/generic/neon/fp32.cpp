@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,21 +21,18 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "src/cpu/kernels/instancenorm/generic/neon/impl.h"
+#include "src/cpu/kernels/fused_elementwise/generic/neon/impl.h"
+
 namespace arm_compute
 {
 namespace cpu
 {
-void neon_fp32_instancenorm(ITensor      *input,
-                            ITensor      *output,
-                            float         gamma,
-                            float         beta,
-                            float         epsilon,
-                            bool          use_mixed_precision,
-                            const Window &window)
+void fused_elementwise_fp32_neon(const ITensor *const        *srcs,
+                                 ITensor                     *dst,
+                                 const ElementwiseExpression &expr,
+                                 const Window                &window)
 {
-    ARM_COMPUTE_UNUSED(use_mixed_precision);
-    return instance_normalization_nchw<float>(input, output, gamma, beta, epsilon, window);
+    fused_elementwise_impl<float>(srcs, dst, expr, window);
 }
 } // namespace cpu
 } // namespace arm_compute
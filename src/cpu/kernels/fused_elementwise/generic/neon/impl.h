@@ -0,0 +1,456 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/FusedElementwiseInfo.h"
+
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/cpu/kernels/fused_elementwise/list.h"
+
+#include <algorithm>
+#include <array>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Number of vectors processed by each node of the expression before moving to the next node */
+constexpr int fused_elementwise_tile_vectors = 4;
+
+/** Block of consecutive elements held as vectors while the expression is evaluated */
+template <typename T>
+struct FusedElementwiseTile
+{
+    wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128> v[fused_elementwise_tile_vectors];
+};
+
+/** Binary operation of a fused elementwise expression, specialised at compile time */
+template <ElementwiseExpressionOp op>
+struct FusedElementwiseBinary;
+
+template <>
+struct FusedElementwiseBinary<ElementwiseExpressionOp::ADD>
+{
+    template <typename V>
+    static V apply(const V &a, const V &b)
+    {
+        return wrapper::vadd(a, b);
+    }
+};
+
+template <>
+struct FusedElementwiseBinary<ElementwiseExpressionOp::SUB>
+{
+    template <typename V>
+    static V apply(const V &a, const V &b)
+    {
+        return wrapper::vsub(a, b);
+    }
+};
+
+template <>
+struct FusedElementwiseBinary<ElementwiseExpressionOp::MUL>
+{
+    template <typename V>
+    static V apply(const V &a, const V &b)
+    {
+        return wrapper::vmul(a, b);
+    }
+};
+
+template <>
+struct FusedElementwiseBinary<ElementwiseExpressionOp::DIV>
+{
+    template <typename V>
+    static V apply(const V &a, const V &b)
+    {
+        return wrapper::vdiv(a, b);
+    }
+};
+
+template <>
+struct FusedElementwiseBinary<ElementwiseExpressionOp::MAX>
+{
+    template <typename V>
+    static V apply(const V &a, const V &b)
+    {
+        return wrapper::vmax(a, b);
+    }
+};
+
+template <>
+struct FusedElementwiseBinary<ElementwiseExpressionOp::MIN>
+{
+    template <typename V>
+    static V apply(const V &a, const V &b)
+    {
+        return wrapper::vmin(a, b);
+    }
+};
+
+template <>
+struct FusedElementwiseBinary<ElementwiseExpressionOp::SQUARED_DIFF>
+{
+    template <typename V>
+    static V apply(const V &a, const V &b)
+    {
+        const V diff = wrapper::vsub(a, b);
+        return wrapper::vmul(diff, diff);
+    }
+};
+
+/** Unary operation of a fused elementwise expression, specialised at compile time */
+template <ElementwiseExpressionOp op>
+struct FusedElementwiseUnary;
+
+template <>
+struct FusedElementwiseUnary<ElementwiseExpressionOp::NEG>
+{
+    template <typename V>
+    static V apply(const V &a)
+    {
+        return wrapper::vneg(a);
+    }
+};
+
+template <>
+struct FusedElementwiseUnary<ElementwiseExpressionOp::ABS>
+{
+    template <typename V>
+    static V apply(const V &a)
+    {
+        return wrapper::vabs(a);
+    }
+};
+
+template <>
+struct FusedElementwiseUnary<ElementwiseExpressionOp::EXP>
+{
+    template <typename V>
+    static V apply(const V &a)
+    {
+        return wrapper::vexpq(a);
+    }
+};
+
+template <>
+struct FusedElementwiseUnary<ElementwiseExpressionOp::RSQRT>
+{
+    template <typename V>
+    static V apply(const V &a)
+    {
+        return wrapper::vinvsqrt(a);
+    }
+};
+
+template <ElementwiseExpressionOp op, typename T>
+inline void fused_elementwise_binary_tile(const FusedElementwiseTile<T> &a,
+                                          const FusedElementwiseTile<T> &b,
+                                          FusedElementwiseTile<T>       &dst)
+{
+    for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+    {
+        dst.v[i] = FusedElementwiseBinary<op>::apply(a.v[i], b.v[i]);
+    }
+}
+
+template <ElementwiseExpressionOp op, typename T>
+inline void fused_elementwise_unary_tile(const FusedElementwiseTile<T> &a, FusedElementwiseTile<T> &dst)
+{
+    for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+    {
+        dst.v[i] = FusedElementwiseUnary<op>::apply(a.v[i]);
+    }
+}
+
+template <typename T>
+inline void fused_elementwise_activation_tile(const FusedElementwiseTile<T> &a,
+                                              FusedElementwiseTile<T>       &dst,
+                                              const ActivationLayerInfo     &act_info)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    const auto const_0   = wrapper::vdup_n(static_cast<T>(0.f), ExactTagType{});
+    const auto const_1   = wrapper::vdup_n(static_cast<T>(1.f), ExactTagType{});
+    const auto const_3   = wrapper::vdup_n(static_cast<T>(3.f), ExactTagType{});
+    const auto const_6   = wrapper::vdup_n(static_cast<T>(6.f), ExactTagType{});
+    const auto inv_6     = wrapper::vdup_n(static_cast<T>(0.166666667f), ExactTagType{});
+    const auto soft_relu = wrapper::vdup_n(static_cast<T>(12.f), ExactTagType{});
+    const auto va        = wrapper::vdup_n(static_cast<T>(act_info.a()), ExactTagType{});
+    const auto vb        = wrapper::vdup_n(static_cast<T>(act_info.b()), ExactTagType{});
+
+    switch (act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::ABS:
+            fused_elementwise_unary_tile<ElementwiseExpressionOp::ABS>(a, dst);
+            break;
+        case ActivationLayerInfo::ActivationFunction::LINEAR:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vmla(vb, va, a.v[i]);
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vinv(wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(a.v[i]))));
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vmax(const_0, a.v[i]);
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vmin(va, wrapper::vmax(const_0, a.v[i]));
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vmin(va, wrapper::vmax(vb, a.v[i]));
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::LEAKY_RELU:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vbsl(wrapper::vcgt(a.v[i], const_0), a.v[i], wrapper::vmul(va, a.v[i]));
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vbsl(wrapper::vcgt(a.v[i], soft_relu), a.v[i],
+                                         wrapper::vlog(wrapper::vadd(const_1, wrapper::vexpq(a.v[i]))));
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::ELU:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vbsl(wrapper::vcge(a.v[i], const_0), a.v[i],
+                                         wrapper::vmul(va, wrapper::vsub(wrapper::vexpq(a.v[i]), const_1)));
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::SQUARE:
+            fused_elementwise_binary_tile<ElementwiseExpressionOp::MUL>(a, a, dst);
+            break;
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                dst.v[i] = wrapper::vmul(va, wrapper::vtanh(wrapper::vmul(vb, a.v[i])));
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::IDENTITY:
+            dst = a;
+            break;
+        case ActivationLayerInfo::ActivationFunction::HARD_SWISH:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                const auto gate = wrapper::vmin(const_6, wrapper::vmax(const_0, wrapper::vadd(a.v[i], const_3)));
+                dst.v[i]        = wrapper::vmul(a.v[i], wrapper::vmul(inv_6, gate));
+            }
+            break;
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+            for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+            {
+                const auto gate = wrapper::vadd(const_1, wrapper::vexpq(wrapper::vneg(wrapper::vmul(va, a.v[i]))));
+                dst.v[i]        = wrapper::vmul(a.v[i], wrapper::vinv(gate));
+            }
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+/** Evaluate an elementwise expression in a single pass over the destination
+ *
+ * Each row of the destination is processed in tiles of @ref fused_elementwise_tile_vectors vectors. All the nodes of
+ * the expression are evaluated on a tile before moving to the next one, so intermediate values never leave the
+ * stack. Inputs of size 1 in a dimension are broadcast along it.
+ */
+template <typename T>
+void fused_elementwise_impl(const ITensor *const        *srcs,
+                            ITensor                     *dst,
+                            const ElementwiseExpression &expr,
+                            const Window                &window)
+{
+    using ExactTagType = typename wrapper::traits::neon_bitvector_tag_t<T, wrapper::traits::BitWidth::W128>;
+
+    constexpr int vector_size = static_cast<int>(16 / sizeof(T));
+    constexpr int tile_size   = fused_elementwise_tile_vectors * vector_size;
+
+    const auto    &nodes          = expr.nodes();
+    const int      num_nodes      = static_cast<int>(nodes.size());
+    const uint32_t num_inputs     = expr.num_inputs();
+    const int      window_start_x = static_cast<int>(window.x().start());
+    const int      window_end_x   = static_cast<int>(window.x().end());
+
+    // Broadcasting along X reads the first element of each row
+    std::array<bool, fused_elementwise_max_inputs> broadcast_x{};
+    for (uint32_t i = 0; i < num_inputs; ++i)
+    {
+        broadcast_x[i] = srcs[i]->info()->dimension(0) == 1 && dst->info()->dimension(0) > 1;
+    }
+
+    Window win = window;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator dst_it(dst, win);
+
+    std::array<const T *, fused_elementwise_max_inputs>              rows{};
+    std::array<FusedElementwiseTile<T>, fused_elementwise_max_nodes> values;
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            for (uint32_t i = 0; i < num_inputs; ++i)
+            {
+                const ITensorInfo *info   = srcs[i]->info();
+                size_t             offset = info->offset_first_element_in_bytes();
+                for (size_t d = 1; d < info->num_dimensions(); ++d)
+                {
+                    offset += (info->dimension(d) > 1) ? id[d] * info->strides_in_bytes()[d] : 0;
+                }
+                rows[i] = reinterpret_cast<const T *>(srcs[i]->buffer() + offset);
+            }
+            auto *out = reinterpret_cast<T *>(dst_it.ptr());
+
+            for (int x = window_start_x; x < window_end_x; x += tile_size)
+            {
+                const int len = std::min(tile_size, window_end_x - x);
+
+                for (int n = 0; n < num_nodes; ++n)
+                {
+                    const ElementwiseExpressionNode &node = nodes[n];
+                    FusedElementwiseTile<T>         &res  = values[n];
+                    switch (node.op)
+                    {
+                        case ElementwiseExpressionOp::INPUT:
+                        {
+                            const T *row = rows[node.lhs];
+                            if (broadcast_x[node.lhs])
+                            {
+                                const auto v = wrapper::vdup_n(*row, ExactTagType{});
+                                for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+                                {
+                                    res.v[i] = v;
+                                }
+                            }
+                            else if (len == tile_size)
+                            {
+                                for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+                                {
+                                    res.v[i] = wrapper::vloadq(row + x + i * vector_size);
+                                }
+                            }
+                            else
+                            {
+                                T tail[tile_size] = {};
+                                std::copy_n(row + x, len, tail);
+                                for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+                                {
+                                    res.v[i] = wrapper::vloadq(tail + i * vector_size);
+                                }
+                            }
+                            break;
+                        }
+                        case ElementwiseExpressionOp::ADD:
+                            fused_elementwise_binary_tile<ElementwiseExpressionOp::ADD>(values[node.lhs],
+                                                                                        values[node.rhs], res);
+                            break;
+                        case ElementwiseExpressionOp::SUB:
+                            fused_elementwise_binary_tile<ElementwiseExpressionOp::SUB>(values[node.lhs],
+                                                                                        values[node.rhs], res);
+                            break;
+                        case ElementwiseExpressionOp::MUL:
+                            fused_elementwise_binary_tile<ElementwiseExpressionOp::MUL>(values[node.lhs],
+                                                                                        values[node.rhs], res);
+                            break;
+                        case ElementwiseExpressionOp::DIV:
+                            fused_elementwise_binary_tile<ElementwiseExpressionOp::DIV>(values[node.lhs],
+                                                                                        values[node.rhs], res);
+                            break;
+                        case ElementwiseExpressionOp::MAX:
+                            fused_elementwise_binary_tile<ElementwiseExpressionOp::MAX>(values[node.lhs],
+                                                                                        values[node.rhs], res);
+                            break;
+                        case ElementwiseExpressionOp::MIN:
+                            fused_elementwise_binary_tile<ElementwiseExpressionOp::MIN>(values[node.lhs],
+                                                                                        values[node.rhs], res);
+                            break;
+                        case ElementwiseExpressionOp::SQUARED_DIFF:
+                            fused_elementwise_binary_tile<ElementwiseExpressionOp::SQUARED_DIFF>(
+                                values[node.lhs], values[node.rhs], res);
+                            break;
+                        case ElementwiseExpressionOp::NEG:
+                            fused_elementwise_unary_tile<ElementwiseExpressionOp::NEG>(values[node.lhs], res);
+                            break;
+                        case ElementwiseExpressionOp::ABS:
+                            fused_elementwise_unary_tile<ElementwiseExpressionOp::ABS>(values[node.lhs], res);
+                            break;
+                        case ElementwiseExpressionOp::EXP:
+                            fused_elementwise_unary_tile<ElementwiseExpressionOp::EXP>(values[node.lhs], res);
+                            break;
+                        case ElementwiseExpressionOp::RSQRT:
+                            fused_elementwise_unary_tile<ElementwiseExpressionOp::RSQRT>(values[node.lhs], res);
+                            break;
+                        case ElementwiseExpressionOp::ACTIVATION:
+                            fused_elementwise_activation_tile(values[node.lhs], res, node.act_info);
+                            break;
+                        default:
+                            ARM_COMPUTE_ERROR("Unsupported operation");
+                    }
+                }
+
+                const FusedElementwiseTile<T> &result = values[num_nodes - 1];
+                if (len == tile_size)
+                {
+                    for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+                    {
+                        wrapper::vstore(out + x + i * vector_size, result.v[i]);
+                    }
+                }
+                else
+                {
+                    T tail[tile_size];
+                    for (int i = 0; i < fused_elementwise_tile_vectors; ++i)
+                    {
+                        wrapper::vstore(tail + i * vector_size, result.v[i]);
+                    }
+                    std::copy_n(tail, len, out + x);
+                }
+            }
+        },
+        dst_it);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_FUSED_ELEMENTWISE_GENERIC_NEON_IMPL_H
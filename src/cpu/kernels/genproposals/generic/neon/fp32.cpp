@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,5 +33,17 @@ void neon_fp32_computeallanchors(const ITensor     *anchors,
 {
     return compute_all_anchors<float>(anchors, all_anchors, anchors_info, window);
 }
+
+void neon_fp32_decodeproposals(const ITensor                  *scores,
+                               const ITensor                  *deltas,
+                               const ITensor                  *anchors,
+                               ITensor                        *proposals,
+                               ITensor                        *scores_out,
+                               const ComputeAnchorsInfo       &anchors_info,
+                               const BoundingBoxTransformInfo &bbox_info,
+                               const Window                   &window)
+{
+    return decode_proposals_fp32(scores, deltas, anchors, proposals, scores_out, anchors_info, bbox_info, window);
+}
 } // namespace cpu
 } // namespace arm_compute
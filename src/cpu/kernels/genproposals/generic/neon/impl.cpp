@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,14 @@
  * SOFTWARE.
  */
 #include "src/cpu/kernels/genproposals/generic/neon/impl.h"
+
+#include "src/core/NEON/NEMath.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -67,5 +75,226 @@ void compute_all_anchors_qasymm16(const ITensor     *anchors,
         },
         all_anchors_it);
 }
+
+namespace
+{
+/** Parameters of the box decoding shared by the vector and scalar paths */
+struct DecodeParams
+{
+    float inv_weights[4]; /**< Reciprocal of the weights applied to the deltas */
+    float clip;           /**< Upper bound of the width and height deltas in log-space */
+    float offset;         /**< Offset subtracted from the bottom right corner */
+    float max_x;          /**< Largest valid x coordinate */
+    float max_y;          /**< Largest valid y coordinate */
+};
+
+/** Apply the deltas to 4 anchors
+ *
+ * @param[in] anchor Anchor coordinates (x1, y1, x2, y2) of 4 boxes.
+ * @param[in] delta  Deltas (dx, dy, dw, dh) of 4 boxes.
+ * @param[in] params Decoding parameters.
+ *
+ * @return The coordinates (x1, y1, x2, y2) of the 4 decoded boxes, clipped to the image
+ */
+inline float32x4x4_t decode_boxes(const float32x4x4_t &anchor, const float32x4x4_t &delta, const DecodeParams &params)
+{
+    const float32x4_t one    = vdupq_n_f32(1.f);
+    const float32x4_t half   = vdupq_n_f32(0.5f);
+    const float32x4_t zero   = vdupq_n_f32(0.f);
+    const float32x4_t clip   = vdupq_n_f32(params.clip);
+    const float32x4_t offset = vdupq_n_f32(params.offset);
+    const float32x4_t max_x  = vdupq_n_f32(params.max_x);
+    const float32x4_t max_y  = vdupq_n_f32(params.max_y);
+
+    const float32x4_t width  = vaddq_f32(vsubq_f32(anchor.val[2], anchor.val[0]), one);
+    const float32x4_t height = vaddq_f32(vsubq_f32(anchor.val[3], anchor.val[1]), one);
+    const float32x4_t ctr_x  = vmlaq_f32(anchor.val[0], half, width);
+    const float32x4_t ctr_y  = vmlaq_f32(anchor.val[1], half, height);
+
+    const float32x4_t dx = vmulq_n_f32(delta.val[0], params.inv_weights[0]);
+    const float32x4_t dy = vmulq_n_f32(delta.val[1], params.inv_weights[1]);
+    const float32x4_t dw = vminq_f32(vmulq_n_f32(delta.val[2], params.inv_weights[2]), clip);
+    const float32x4_t dh = vminq_f32(vmulq_n_f32(delta.val[3], params.inv_weights[3]), clip);
+
+    const float32x4_t pred_ctr_x  = vmlaq_f32(ctr_x, dx, width);
+    const float32x4_t pred_ctr_y  = vmlaq_f32(ctr_y, dy, height);
+    const float32x4_t pred_half_w = vmulq_f32(half, vmulq_f32(vexpq_f32(dw), width));
+    const float32x4_t pred_half_h = vmulq_f32(half, vmulq_f32(vexpq_f32(dh), height));
+
+    float32x4x4_t box;
+    box.val[0] = vminq_f32(vmaxq_f32(vsubq_f32(pred_ctr_x, pred_half_w), zero), max_x);
+    box.val[1] = vminq_f32(vmaxq_f32(vsubq_f32(pred_ctr_y, pred_half_h), zero), max_y);
+    box.val[2] = vminq_f32(vmaxq_f32(vsubq_f32(vaddq_f32(pred_ctr_x, pred_half_w), offset), zero), max_x);
+    box.val[3] = vminq_f32(vmaxq_f32(vsubq_f32(vaddq_f32(pred_ctr_y, pred_half_h), offset), zero), max_y);
+    return box;
+}
+
+/** Scalar version of @ref decode_boxes for a single box */
+inline void decode_box(const float *anchor, const float *delta, const DecodeParams &params, float *box)
+{
+    const float width  = anchor[2] - anchor[0] + 1.f;
+    const float height = anchor[3] - anchor[1] + 1.f;
+    const float ctr_x  = anchor[0] + 0.5f * width;
+    const float ctr_y  = anchor[1] + 0.5f * height;
+
+    const float dx = delta[0] * params.inv_weights[0];
+    const float dy = delta[1] * params.inv_weights[1];
+    const float dw = std::min(delta[2] * params.inv_weights[2], params.clip);
+    const float dh = std::min(delta[3] * params.inv_weights[3], params.clip);
+
+    const float pred_ctr_x  = dx * width + ctr_x;
+    const float pred_ctr_y  = dy * height + ctr_y;
+    const float pred_half_w = 0.5f * std::exp(dw) * width;
+    const float pred_half_h = 0.5f * std::exp(dh) * height;
+
+    box[0] = utility::clamp<float>(pred_ctr_x - pred_half_w, 0.f, params.max_x);
+    box[1] = utility::clamp<float>(pred_ctr_y - pred_half_h, 0.f, params.max_y);
+    box[2] = utility::clamp<float>(pred_ctr_x + pred_half_w - params.offset, 0.f, params.max_x);
+    box[3] = utility::clamp<float>(pred_ctr_y + pred_half_h - params.offset, 0.f, params.max_y);
+}
+} // namespace
+
+void decode_proposals_fp32(const ITensor                  *scores,
+                           const ITensor                  *deltas,
+                           const ITensor                  *anchors,
+                           ITensor                        *proposals,
+                           ITensor                        *scores_out,
+                           const ComputeAnchorsInfo       &anchors_info,
+                           const BoundingBoxTransformInfo &bbox_info,
+                           const Window                   &window)
+{
+    constexpr size_t window_step = 4;
+
+    const bool   is_nhwc     = scores->info()->data_layout() == DataLayout::NHWC;
+    const size_t num_anchors = anchors->info()->dimension(1);
+    const size_t feat_width  = anchors_info.feat_width();
+    const float  stride      = 1.f / anchors_info.spatial_scale();
+
+    DecodeParams params{};
+    for (int i = 0; i < 4; ++i)
+    {
+        params.inv_weights[i] = 1.f / bbox_info.weights()[i];
+    }
+    params.clip   = bbox_info.bbox_xform_clip();
+    params.offset = bbox_info.correct_transform_coords() ? 1.f : 0.f;
+    params.max_x  = std::floor(bbox_info.img_width() / bbox_info.scale() + 0.5f) - 1.f;
+    params.max_y  = std::floor(bbox_info.img_height() / bbox_info.scale() + 0.5f) - 1.f;
+
+    // Gather the base anchors, so that the anchors of consecutive boxes can be loaded and deinterleaved at once
+    std::vector<float> base_anchors(4 * num_anchors);
+    for (size_t a = 0; a < num_anchors; ++a)
+    {
+        std::copy_n(reinterpret_cast<const float *>(anchors->ptr_to_element(Coordinates(0, a))), 4,
+                    base_anchors.data() + 4 * a);
+    }
+
+    const float       lane_id_values[] = {0.f, 1.f, 2.f, 3.f};
+    const float32x4_t lane_ids         = vld1q_f32(lane_id_values);
+
+    auto *proposals_ptr =
+        reinterpret_cast<float *>(proposals->buffer() + proposals->info()->offset_first_element_in_bytes());
+    auto *scores_out_ptr =
+        reinterpret_cast<float *>(scores_out->buffer() + scores_out->info()->offset_first_element_in_bytes());
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const int   y       = id.y();
+            const float shift_y = y * stride;
+
+            if (is_nhwc)
+            {
+                // Deltas and scores of the anchors of a location are contiguous: vectorize across the anchors
+                for (size_t x = 0; x < feat_width; ++x)
+                {
+                    const float  shift_x    = x * stride;
+                    const size_t out_offset = (y * feat_width + x) * num_anchors;
+                    const auto *delta_ptr =
+                        reinterpret_cast<const float *>(deltas->ptr_to_element(Coordinates(0, x, y)));
+                    const auto *score_ptr =
+                        reinterpret_cast<const float *>(scores->ptr_to_element(Coordinates(0, x, y)));
+
+                    size_t a = 0;
+                    for (; a + window_step <= num_anchors; a += window_step)
+                    {
+                        float32x4x4_t anchor = vld4q_f32(base_anchors.data() + 4 * a);
+                        anchor.val[0]        = vaddq_f32(anchor.val[0], vdupq_n_f32(shift_x));
+                        anchor.val[1]        = vaddq_f32(anchor.val[1], vdupq_n_f32(shift_y));
+                        anchor.val[2]        = vaddq_f32(anchor.val[2], vdupq_n_f32(shift_x));
+                        anchor.val[3]        = vaddq_f32(anchor.val[3], vdupq_n_f32(shift_y));
+
+                        vst4q_f32(proposals_ptr + 4 * (out_offset + a),
+                                  decode_boxes(anchor, vld4q_f32(delta_ptr + 4 * a), params));
+                        vst1q_f32(scores_out_ptr + out_offset + a, vld1q_f32(score_ptr + a));
+                    }
+                    for (; a < num_anchors; ++a)
+                    {
+                        const float *base = base_anchors.data() + 4 * a;
+                        const float  anchor[4]{base[0] + shift_x, base[1] + shift_y, base[2] + shift_x,
+                                              base[3] + shift_y};
+                        decode_box(anchor, delta_ptr + 4 * a, params, proposals_ptr + 4 * (out_offset + a));
+                        scores_out_ptr[out_offset + a] = score_ptr[a];
+                    }
+                }
+            }
+            else
+            {
+                // Deltas and scores of consecutive locations are contiguous: vectorize across the feature map width
+                for (size_t a = 0; a < num_anchors; ++a)
+                {
+                    const float *base = base_anchors.data() + 4 * a;
+                    const float *delta_ptr[4];
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        delta_ptr[k] =
+                            reinterpret_cast<const float *>(deltas->ptr_to_element(Coordinates(0, y, 4 * a + k)));
+                    }
+                    const auto *score_ptr =
+                        reinterpret_cast<const float *>(scores->ptr_to_element(Coordinates(0, y, a)));
+
+                    size_t x = 0;
+                    for (; x + window_step <= feat_width; x += window_step)
+                    {
+                        const float32x4_t shift_x =
+                            vmulq_n_f32(vaddq_f32(vdupq_n_f32(static_cast<float>(x)), lane_ids), stride);
+
+                        float32x4x4_t anchor;
+                        anchor.val[0] = vaddq_f32(vdupq_n_f32(base[0]), shift_x);
+                        anchor.val[1] = vdupq_n_f32(base[1] + shift_y);
+                        anchor.val[2] = vaddq_f32(vdupq_n_f32(base[2]), shift_x);
+                        anchor.val[3] = vdupq_n_f32(base[3] + shift_y);
+
+                        float32x4x4_t delta;
+                        for (size_t k = 0; k < 4; ++k)
+                        {
+                            delta.val[k] = vld1q_f32(delta_ptr[k] + x);
+                        }
+
+                        // Interleave the coordinates of the 4 boxes, which are num_anchors boxes apart in the output
+                        float boxes[16];
+                        vst4q_f32(boxes, decode_boxes(anchor, delta, params));
+                        const float *scores_x = score_ptr + x;
+                        for (size_t l = 0; l < window_step; ++l)
+                        {
+                            const size_t out_idx = (y * feat_width + x + l) * num_anchors + a;
+                            vst1q_f32(proposals_ptr + 4 * out_idx, vld1q_f32(boxes + 4 * l));
+                            scores_out_ptr[out_idx] = scores_x[l];
+                        }
+                    }
+                    for (; x < feat_width; ++x)
+                    {
+                        const float  shift_x = x * stride;
+                        const float  anchor[4]{base[0] + shift_x, base[1] + shift_y, base[2] + shift_x,
+                                              base[3] + shift_y};
+                        const float  delta[4]{delta_ptr[0][x], delta_ptr[1][x], delta_ptr[2][x], delta_ptr[3][x]};
+                        const size_t out_idx = (y * feat_width + x) * num_anchors + a;
+                        decode_box(anchor, delta, params, proposals_ptr + 4 * out_idx);
+                        scores_out_ptr[out_idx] = score_ptr[x];
+                    }
+                }
+            }
+        });
+}
 } // namespace cpu
 } // namespace arm_compute
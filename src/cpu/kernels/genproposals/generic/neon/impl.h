@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -70,6 +70,15 @@ void compute_all_anchors_qasymm16(const ITensor     *anchors,
                                   ITensor           *all_anchors,
                                   ComputeAnchorsInfo anchors_info,
                                   const Window      &window);
+
+void decode_proposals_fp32(const ITensor                  *scores,
+                           const ITensor                  *deltas,
+                           const ITensor                  *anchors,
+                           ITensor                        *proposals,
+                           ITensor                        *scores_out,
+                           const ComputeAnchorsInfo       &anchors_info,
+                           const BoundingBoxTransformInfo &bbox_info,
+                           const Window                   &window);
 } // namespace cpu
 } // namespace arm_compute
 #endif //define SRC_CORE_SVE_KERNELS_NEGENERATEPROPOSALSLAYERKERNEL_IMPL_H
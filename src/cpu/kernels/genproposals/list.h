@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,7 +27,7 @@ namespace arm_compute
 {
 namespace cpu
 {
-#define DECLARE_NEGENERATEPROPOSALSLAYERKERNEL_KERNEL(func_name) \
+#define DECLARE_NEGENERATEPROPOSALSLAYERKERNEL_KERNEL(func_name)                                                      \
     void func_name(const ITensor *anchors, ITensor *all_anchors, ComputeAnchorsInfo anchors_info, const Window &window)
 
 DECLARE_NEGENERATEPROPOSALSLAYERKERNEL_KERNEL(neon_qu16_computeallanchors);
@@ -35,6 +35,15 @@ DECLARE_NEGENERATEPROPOSALSLAYERKERNEL_KERNEL(neon_fp16_computeallanchors);
 DECLARE_NEGENERATEPROPOSALSLAYERKERNEL_KERNEL(neon_fp32_computeallanchors);
 
 #undef DECLARE_NEGENERATEPROPOSALSLAYERKERNEL_KERNEL
+
+#define DECLARE_DECODEPROPOSALS_KERNEL(func_name)                                                                     \
+    void func_name(const ITensor *scores, const ITensor *deltas, const ITensor *anchors, ITensor *proposals,          \
+                   ITensor *scores_out, const ComputeAnchorsInfo &anchors_info,                                       \
+                   const BoundingBoxTransformInfo &bbox_info, const Window &window)
+
+DECLARE_DECODEPROPOSALS_KERNEL(neon_fp32_decodeproposals);
+
+#undef DECLARE_DECODEPROPOSALS_KERNEL
 } // namespace cpu
 } // namespace arm_compute
 #endif /* SRC_CORE_NEON_KERNELS_NEGENERATEPROPOSALSLAYERKERNEL_LIST_H */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/groupnorm/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void neon_fp32_groupnorm_statistics(const ITensor *input,
+                                    ITensor       *stats,
+                                    float         *scratch,
+                                    unsigned int   num_groups,
+                                    unsigned int   num_splits,
+                                    const Window  &window)
+{
+    return group_normalization_statistics<float>(input, stats, scratch, num_groups, num_splits, window);
+}
+
+void neon_fp32_groupnorm(const ITensor                           *input,
+                         ITensor                                 *output,
+                         const ITensor                           *stats,
+                         const ITensor                           *gamma,
+                         const ITensor                           *beta,
+                         float                                   *scratch,
+                         const GroupNormalizationLayerKernelInfo &info,
+                         const Window                            &window)
+{
+    return group_normalization<float>(input, output, stats, gamma, beta, scratch, info, window);
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,434 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GROUPNORM_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_GROUPNORM_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Conversions between the data type of the tensors and the float accumulators, 8 elements at a time */
+template <typename T>
+struct GroupNormVector;
+
+template <>
+struct GroupNormVector<float>
+{
+    static float32x4x2_t load(const float *ptr)
+    {
+        return {{vld1q_f32(ptr), vld1q_f32(ptr + 4)}};
+    }
+    static void store(float *ptr, const float32x4x2_t &v)
+    {
+        vst1q_f32(ptr, v.val[0]);
+        vst1q_f32(ptr + 4, v.val[1]);
+    }
+};
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+struct GroupNormVector<float16_t>
+{
+    static float32x4x2_t load(const float16_t *ptr)
+    {
+        const float16x8_t v = vld1q_f16(ptr);
+        return {{vcvt_f32_f16(vget_low_f16(v)), vcvt_f32_f16(vget_high_f16(v))}};
+    }
+    static void store(float16_t *ptr, const float32x4x2_t &v)
+    {
+        vst1q_f16(ptr, vcombine_f16(vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1])));
+    }
+};
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Bounds of the @p split -th of @p num_splits balanced chunks of @p total units */
+inline std::pair<size_t, size_t> group_norm_split_range(size_t total, size_t num_splits, size_t split)
+{
+    return std::make_pair(total * split / num_splits, total * (split + 1) / num_splits);
+}
+
+/** Units a group is split along and number of elements of the group in each unit
+ *
+ * A unit is a row of a channel plane in NCHW and a spatial position in NHWC.
+ *
+ * @return The number of units of a group and the number of elements of the group per unit
+ */
+inline std::pair<size_t, size_t> group_norm_units(const ITensorInfo &info, unsigned int num_groups)
+{
+    const TensorShape &shape = info.tensor_shape();
+    if (info.data_layout() == DataLayout::NCHW)
+    {
+        return std::make_pair(shape[1] * (shape[2] / num_groups), shape[0]);
+    }
+    return std::make_pair(shape[1] * shape[2], shape[0] / num_groups);
+}
+
+/** Pointer to the mean and sum of squared deviations of a split of a group */
+inline float *group_norm_stats_ptr(const ITensor *stats, size_t split, size_t group, size_t batch)
+{
+    return reinterpret_cast<float *>(stats->ptr_to_element(Coordinates(0, split, group, batch)));
+}
+
+inline float group_norm_horizontal_add(float32x4_t v)
+{
+    const float32x2_t tmp = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(tmp, tmp), 0);
+}
+
+/** Merge the statistics of the splits of a group with Chan's parallel update
+ *
+ * @return The mean and the variance of the group
+ */
+inline std::pair<float, float>
+group_norm_merge_statistics(const ITensor *stats, size_t group, size_t batch, size_t num_units, size_t unit_size)
+{
+    const size_t num_splits = stats->info()->dimension(1);
+
+    float mean  = 0.f;
+    float m2    = 0.f;
+    float count = 0.f;
+    for (size_t split = 0; split < num_splits; ++split)
+    {
+        const auto  range       = group_norm_split_range(num_units, num_splits, split);
+        const float split_count = static_cast<float>((range.second - range.first) * unit_size);
+        if (split_count == 0.f)
+        {
+            continue;
+        }
+        const float *src   = group_norm_stats_ptr(stats, split, group, batch);
+        const float  total = count + split_count;
+        const float  delta = src[0] - mean;
+        mean += delta * split_count / total;
+        m2 += src[1] + delta * delta * count * split_count / total;
+        count = total;
+    }
+    return std::make_pair(mean, m2 / count);
+}
+
+/** Mean and sum of squared deviations of a chunk of the rows of a group in NCHW
+ *
+ * Values are accumulated relative to the first value of the chunk, which keeps the single pass
+ * sum of squares accurate when the mean is large compared to the standard deviation.
+ */
+template <typename T>
+void group_normalization_statistics_nchw(
+    const ITensor *input, ITensor *stats, unsigned int num_groups, unsigned int num_splits, const Window &window)
+{
+    const ITensorInfo &info               = *input->info();
+    const Strides     &strides            = info.strides_in_bytes();
+    const size_t       width              = info.dimension(0);
+    const size_t       height             = info.dimension(1);
+    const size_t       channels_per_group = info.dimension(2) / num_groups;
+    const size_t       num_rows           = height * channels_per_group;
+    const uint8_t     *src                = input->buffer() + info.offset_first_element_in_bytes();
+
+    for (int item = window.x().start(); item < window.x().end(); ++item)
+    {
+        const size_t split = item % num_splits;
+        const size_t group = (item / num_splits) % num_groups;
+        const size_t batch = item / (num_splits * num_groups);
+        const auto   range = group_norm_split_range(num_rows, num_splits, split);
+        float       *dst   = group_norm_stats_ptr(stats, split, group, batch);
+        if (range.first == range.second)
+        {
+            dst[0] = 0.f;
+            dst[1] = 0.f;
+            continue;
+        }
+
+        const uint8_t *group_src = src + batch * strides[3] + group * channels_per_group * strides[2];
+        const auto     row_ptr   = [&](size_t row)
+        { return reinterpret_cast<const T *>(group_src + (row / height) * strides[2] + (row % height) * strides[1]); };
+
+        const float       shift   = static_cast<float>(*row_ptr(range.first));
+        const float32x4_t vshift  = vdupq_n_f32(shift);
+        float32x4_t       vsum    = vdupq_n_f32(0.f);
+        float32x4_t       vsum_sq = vdupq_n_f32(0.f);
+        float             sum     = 0.f;
+        float             sum_sq  = 0.f;
+        for (size_t row = range.first; row < range.second; ++row)
+        {
+            const T *in = row_ptr(row);
+            size_t   x  = 0;
+            for (; x + 8 <= width; x += 8)
+            {
+                const float32x4x2_t v  = GroupNormVector<T>::load(in + x);
+                const float32x4_t   d0 = vsubq_f32(v.val[0], vshift);
+                const float32x4_t   d1 = vsubq_f32(v.val[1], vshift);
+                vsum                   = vaddq_f32(vsum, vaddq_f32(d0, d1));
+                vsum_sq                = vmlaq_f32(vmlaq_f32(vsum_sq, d0, d0), d1, d1);
+            }
+            for (; x < width; ++x)
+            {
+                const float d = static_cast<float>(in[x]) - shift;
+                sum += d;
+                sum_sq += d * d;
+            }
+        }
+        sum += group_norm_horizontal_add(vsum);
+        sum_sq += group_norm_horizontal_add(vsum_sq);
+
+        const float count = static_cast<float>((range.second - range.first) * width);
+        dst[0]            = shift + sum / count;
+        dst[1]            = std::max(0.f, sum_sq - sum * sum / count);
+    }
+}
+
+/** Mean and sum of squared deviations of every group over a chunk of the spatial positions in NHWC
+ *
+ * Channels are accumulated side by side across the positions of the chunk, each relative to its value
+ * at the first position, then folded into their group. @p scratch holds 3 floats per channel.
+ */
+template <typename T>
+void group_normalization_statistics_nhwc(const ITensor *input,
+                                         ITensor       *stats,
+                                         float         *scratch,
+                                         unsigned int   num_groups,
+                                         unsigned int   num_splits,
+                                         const Window  &window)
+{
+    const ITensorInfo &info               = *input->info();
+    const Strides     &strides            = info.strides_in_bytes();
+    const size_t       channels           = info.dimension(0);
+    const size_t       width              = info.dimension(1);
+    const size_t       num_positions      = width * info.dimension(2);
+    const size_t       channels_per_group = channels / num_groups;
+    const uint8_t     *src                = input->buffer() + info.offset_first_element_in_bytes();
+
+    float *const shift  = scratch;
+    float *const sum    = scratch + channels;
+    float *const sum_sq = scratch + 2 * channels;
+
+    for (int item = window.x().start(); item < window.x().end(); ++item)
+    {
+        const size_t split = item % num_splits;
+        const size_t batch = item / num_splits;
+        const auto   range = group_norm_split_range(num_positions, num_splits, split);
+        if (range.first == range.second)
+        {
+            for (size_t group = 0; group < num_groups; ++group)
+            {
+                float *dst = group_norm_stats_ptr(stats, split, group, batch);
+                dst[0]     = 0.f;
+                dst[1]     = 0.f;
+            }
+            continue;
+        }
+
+        const uint8_t *batch_src    = src + batch * strides[3];
+        const auto     position_ptr = [&](size_t position)
+        {
+            return reinterpret_cast<const T *>(batch_src + (position / width) * strides[2] +
+                                               (position % width) * strides[1]);
+        };
+
+        const T *first = position_ptr(range.first);
+        for (size_t c = 0; c < channels; ++c)
+        {
+            shift[c] = static_cast<float>(first[c]);
+        }
+        std::fill(sum, sum + channels, 0.f);
+        std::fill(sum_sq, sum_sq + channels, 0.f);
+
+        for (size_t position = range.first; position < range.second; ++position)
+        {
+            const T *in = position_ptr(position);
+            size_t   c  = 0;
+            for (; c + 8 <= channels; c += 8)
+            {
+                const float32x4x2_t v  = GroupNormVector<T>::load(in + c);
+                const float32x4_t   d0 = vsubq_f32(v.val[0], vld1q_f32(shift + c));
+                const float32x4_t   d1 = vsubq_f32(v.val[1], vld1q_f32(shift + c + 4));
+                vst1q_f32(sum + c, vaddq_f32(vld1q_f32(sum + c), d0));
+                vst1q_f32(sum + c + 4, vaddq_f32(vld1q_f32(sum + c + 4), d1));
+                vst1q_f32(sum_sq + c, vmlaq_f32(vld1q_f32(sum_sq + c), d0, d0));
+                vst1q_f32(sum_sq + c + 4, vmlaq_f32(vld1q_f32(sum_sq + c + 4), d1, d1));
+            }
+            for (; c < channels; ++c)
+            {
+                const float d = static_cast<float>(in[c]) - shift[c];
+                sum[c] += d;
+                sum_sq[c] += d * d;
+            }
+        }
+
+        // Channels of a group hold the same number of elements, so their moments fold with equal weights
+        const float count = static_cast<float>(range.second - range.first);
+        for (size_t group = 0; group < num_groups; ++group)
+        {
+            const size_t first_channel = group * channels_per_group;
+            const size_t last_channel  = first_channel + channels_per_group;
+
+            float mean = 0.f;
+            for (size_t c = first_channel; c < last_channel; ++c)
+            {
+                sum_sq[c] = std::max(0.f, sum_sq[c] - sum[c] * sum[c] / count);
+                sum[c]    = shift[c] + sum[c] / count;
+                mean += sum[c];
+            }
+            mean /= static_cast<float>(channels_per_group);
+
+            float m2 = 0.f;
+            for (size_t c = first_channel; c < last_channel; ++c)
+            {
+                const float delta = sum[c] - mean;
+                m2 += sum_sq[c] + count * delta * delta;
+            }
+
+            float *dst = group_norm_stats_ptr(stats, split, group, batch);
+            dst[0]     = mean;
+            dst[1]     = m2;
+        }
+    }
+}
+
+template <typename T>
+void group_normalization_statistics(const ITensor *input,
+                                    ITensor       *stats,
+                                    float         *scratch,
+                                    unsigned int   num_groups,
+                                    unsigned int   num_splits,
+                                    const Window  &window)
+{
+    if (input->info()->data_layout() == DataLayout::NCHW)
+    {
+        group_normalization_statistics_nchw<T>(input, stats, num_groups, num_splits, window);
+    }
+    else
+    {
+        group_normalization_statistics_nhwc<T>(input, stats, scratch, num_groups, num_splits, window);
+    }
+}
+
+template <typename T>
+void group_normalization(const ITensor                           *input,
+                         ITensor                                 *output,
+                         const ITensor                           *stats,
+                         const ITensor                           *gamma,
+                         const ITensor                           *beta,
+                         float                                   *scratch,
+                         const GroupNormalizationLayerKernelInfo &info,
+                         const Window                            &window)
+{
+    const ITensorInfo &src_info           = *input->info();
+    const bool         is_nchw            = src_info.data_layout() == DataLayout::NCHW;
+    const size_t       row_size           = src_info.dimension(0);
+    const size_t       channels           = src_info.dimension(is_nchw ? 2 : 0);
+    const size_t       channels_per_group = channels / info.num_groups;
+    const auto         units              = group_norm_units(src_info, info.num_groups);
+
+    // Statistics and affine parameters folded into a per-channel scale and offset, refreshed for each batch
+    float *const scale         = scratch;
+    float *const offset        = scratch + channels;
+    size_t       current_batch = std::numeric_limits<size_t>::max();
+
+    const auto param_value = [](const ITensor *param, size_t c, float default_value)
+    {
+        if (param == nullptr)
+        {
+            return default_value;
+        }
+        return static_cast<float>(*reinterpret_cast<const T *>(param->ptr_to_element(Coordinates(c))));
+    };
+    const auto update_batch = [&](size_t batch)
+    {
+        for (size_t group = 0; group < info.num_groups; ++group)
+        {
+            const auto  stat        = group_norm_merge_statistics(stats, group, batch, units.first, units.second);
+            const float inv_std_dev = 1.f / std::sqrt(stat.second + info.epsilon);
+            for (size_t c = group * channels_per_group; c < (group + 1) * channels_per_group; ++c)
+            {
+                scale[c]  = param_value(gamma, c, info.gamma) * inv_std_dev;
+                offset[c] = param_value(beta, c, info.beta) - stat.first * scale[c];
+            }
+        }
+        current_batch = batch;
+    };
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input_it(input, win);
+    Iterator output_it(output, win);
+
+    execute_window_loop(
+        win,
+        [&](const Coordinates &id)
+        {
+            if (static_cast<size_t>(id[3]) != current_batch)
+            {
+                update_batch(id[3]);
+            }
+
+            const auto in  = reinterpret_cast<const T *>(input_it.ptr());
+            const auto out = reinterpret_cast<T *>(output_it.ptr());
+            size_t     x   = 0;
+            if (is_nchw)
+            {
+                const float       row_scale  = scale[id.z()];
+                const float       row_offset = offset[id.z()];
+                const float32x4_t vscale     = vdupq_n_f32(row_scale);
+                const float32x4_t voffset    = vdupq_n_f32(row_offset);
+                for (; x + 8 <= row_size; x += 8)
+                {
+                    const float32x4x2_t v = GroupNormVector<T>::load(in + x);
+                    GroupNormVector<T>::store(
+                        out + x, {{vmlaq_f32(voffset, v.val[0], vscale), vmlaq_f32(voffset, v.val[1], vscale)}});
+                }
+                for (; x < row_size; ++x)
+                {
+                    out[x] = static_cast<T>(static_cast<float>(in[x]) * row_scale + row_offset);
+                }
+            }
+            else
+            {
+                for (; x + 8 <= row_size; x += 8)
+                {
+                    const float32x4x2_t v  = GroupNormVector<T>::load(in + x);
+                    const float32x4_t   r0 = vmlaq_f32(vld1q_f32(offset + x), v.val[0], vld1q_f32(scale + x));
+                    const float32x4_t   r1 = vmlaq_f32(vld1q_f32(offset + x + 4), v.val[1], vld1q_f32(scale + x + 4));
+                    GroupNormVector<T>::store(out + x, {{r0, r1}});
+                }
+                for (; x < row_size; ++x)
+                {
+                    out[x] = static_cast<T>(static_cast<float>(in[x]) * scale[x] + offset[x]);
+                }
+            }
+        },
+        input_it, output_it);
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GROUPNORM_GENERIC_NEON_IMPL_H
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_GROUPNORM_LIST_H
+#define ACL_SRC_CPU_KERNELS_GROUPNORM_LIST_H
+
+namespace arm_compute
+{
+namespace cpu
+{
+#define DECLARE_GROUPNORM_STATISTICS_KERNEL(func_name)                                            \
+    void func_name(const ITensor *input, ITensor *stats, float *scratch, unsigned int num_groups, \
+                   unsigned int num_splits, const Window &window)
+DECLARE_GROUPNORM_STATISTICS_KERNEL(neon_fp32_groupnorm_statistics);
+DECLARE_GROUPNORM_STATISTICS_KERNEL(neon_fp16_groupnorm_statistics);
+#undef DECLARE_GROUPNORM_STATISTICS_KERNEL
+
+#define DECLARE_GROUPNORM_KERNEL(func_name)                                                            \
+    void func_name(const ITensor *input, ITensor *output, const ITensor *stats, const ITensor *gamma,  \
+                   const ITensor *beta, float *scratch, const GroupNormalizationLayerKernelInfo &info, \
+                   const Window &window)
+DECLARE_GROUPNORM_KERNEL(neon_fp32_groupnorm);
+DECLARE_GROUPNORM_KERNEL(neon_fp16_groupnorm);
+#undef DECLARE_GROUPNORM_KERNEL
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_GROUPNORM_LIST_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -85,6 +85,7 @@ void create_arm_dwc(const ITensorInfo                                      *src,
     arm_conv::depthwise::DepthwiseArgs args(&cpu_info, kernel_rows, kernel_cols, stride_rows, stride_cols,
                                             dilation_rows, dilation_cols, n_batches, src_rows, src_cols, n_channels,
                                             dst_rows, dst_cols, info.depth_multiplier, padding, activation, nullptr);
+    args.fast_mode = info.enable_fast_math;
 
     // Configure assembly pooling kernel
     auto dwc_kernel_asm = arm_conv::depthwise::depthwise<TSrc, TWeights, TDst>(args);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,10 +47,12 @@ using namespace arm_compute::misc::shape_calculator;
 void CpuPool2dAssemblyWrapperKernel::configure(const ITensorInfo      *src,
                                                ITensorInfo            *dst,
                                                const PoolingLayerInfo &info,
-                                               const CPUInfo          &cpu_info)
+                                               const CPUInfo          &cpu_info,
+                                               unsigned int            num_workloads)
 {
     ARM_COMPUTE_UNUSED(cpu_info);
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_ON(num_workloads == 0);
 
     // dst initialization if not yet initialized
     auto_init_if_empty(*dst, src->clone()->set_tensor_shape(compute_pool_shape(*src, info)));
@@ -93,7 +95,10 @@ void CpuPool2dAssemblyWrapperKernel::configure(const ITensorInfo      *src,
     }
 #endif // defined(__aarch64__)
 
-    Window win = calculate_max_window(*dst, Steps());
+    // The assembly kernels split the work by workload index rather than by window
+    _num_workloads = num_workloads;
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, static_cast<int>(_num_workloads), 1));
     INEKernel::configure(win);
 }
 
@@ -163,7 +168,6 @@ void CpuPool2dAssemblyWrapperKernel::run_op(ITensorPack &tensors, const Window &
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(_kernel_asm.get());
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
-    ARM_COMPUTE_UNUSED(window);
     ARM_COMPUTE_UNUSED(info);
 
     ARM_COMPUTE_ERROR_ON(tensors.empty());
@@ -189,8 +193,18 @@ void CpuPool2dAssemblyWrapperKernel::run_op(ITensorPack &tensors, const Window &
     const size_t ld_dst_row   = ld_dst_col * (dst_shape[1] + dst_padding.top + dst_padding.bottom);
     const size_t ld_dst_batch = ld_dst_row * dst_shape[2];
 
-    _kernel_asm->execute(in_ptr, ld_src_col, ld_src_row, ld_src_batch, out_ptr, ld_dst_col, ld_dst_row, ld_dst_batch,
-                         working_space, info.thread_id, info.num_threads);
+    // Each part of the window is one workload, indexed independently of the thread running it
+    for (int workload = window.x().start(); workload < window.x().end(); ++workload)
+    {
+        _kernel_asm->execute(in_ptr, ld_src_col, ld_src_row, ld_src_batch, out_ptr, ld_dst_col, ld_dst_row,
+                             ld_dst_batch, working_space, static_cast<unsigned int>(workload), _num_workloads);
+    }
+}
+
+void CpuPool2dAssemblyWrapperKernel::prepare_run()
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(_kernel_asm.get());
+    _kernel_asm->prepare_execution();
 }
 
 size_t CpuPool2dAssemblyWrapperKernel::get_working_size(unsigned int num_threads) const
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -62,12 +62,21 @@ public:
 
     /** Initialise the kernel's src and dst.
      *
-     * @param[in]  src      Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
-     * @param[out] dst      Destination tensor info to store the result of pooling. Data types supported: same as @p src.
-     * @param[in]  info     Pooling meta-data.
-     * @param[in]  cpu_info CPU information needed to select the most appropriate kernel.
+     * The execution is split in @p num_workloads parts which make up the kernel's window along the X dimension, so
+     * that every part runs exactly once whatever the number of threads the scheduler uses.
+     *
+     * @param[in]  src           Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[out] dst           Destination tensor info to store the result of pooling. Data types supported: same as @p src.
+     * @param[in]  info          Pooling meta-data.
+     * @param[in]  cpu_info      CPU information needed to select the most appropriate kernel.
+     * @param[in]  num_workloads (Optional) Number of parts the execution is split in. The workspace must be sized for
+     *                           as many threads, see @ref get_working_size. Defaults to 1.
      */
-    void configure(const ITensorInfo *src, ITensorInfo *dst, const PoolingLayerInfo &info, const CPUInfo &cpu_info);
+    void configure(const ITensorInfo      *src,
+                   ITensorInfo            *dst,
+                   const PoolingLayerInfo &info,
+                   const CPUInfo          &cpu_info,
+                   unsigned int            num_workloads = 1);
 
     /** Static function to check if given info will lead to a valid configuration
      *
@@ -88,6 +97,12 @@ public:
      */
     size_t get_working_size(unsigned int num_threads) const;
 
+    /** Reset the state shared by the workloads of an execution.
+     *
+     * Must be called once before scheduling each execution of the kernel.
+     */
+    void prepare_run();
+
     /** Was the asm kernel successfully configured?
      *
      * @return True if the asm kernel is configured and ready to run
@@ -118,6 +133,7 @@ private:
                                     const CPUInfo          &cpu_info);
 
     std::unique_ptr<arm_conv::pooling::IPoolingCommon> _kernel_asm{nullptr};
+    unsigned int                                       _num_workloads{1};
 
     /** Return minimum workload size of the relevant kernel
      *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,7 +29,7 @@ namespace arm_compute
 namespace cpu
 {
 #define DECLARE_POOLING_KERNEL(func_name) \
-    void func_name(const ITensor *src0, ITensor *dst0, Pooling3dLayerInfo &, const Window &window)
+    void func_name(const ITensor *src0, ITensor *dst0, void *const scratch, Pooling3dLayerInfo &, const Window &window)
 
 DECLARE_POOLING_KERNEL(neon_q8_pool3d);
 DECLARE_POOLING_KERNEL(neon_q8_signed_pool3d);
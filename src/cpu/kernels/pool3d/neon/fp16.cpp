@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2022-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,9 +29,10 @@ namespace arm_compute
 {
 namespace cpu
 {
-void neon_fp16_pool3d(const ITensor *src, ITensor *dst0, Pooling3dLayerInfo &pool_info, const Window &window)
+void neon_fp16_pool3d(
+    const ITensor *src, ITensor *dst0, void *const scratch, Pooling3dLayerInfo &pool_info, const Window &window)
 {
-    return poolingMxNxD_fp_neon_ndhwc<float16_t>(src, dst0, pool_info, window);
+    return poolingMxNxD_fp_neon_ndhwc<float16_t>(src, dst0, scratch, pool_info, window);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023 Arm Limited.
+ * Copyright (c) 2019-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,115 +26,182 @@
 #include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/core/Helpers.h"
 
+#include <arm_neon.h>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
 class Window;
 namespace cpu
 {
-/** Average pooling over an aligned window */
-template <typename input_data_type>
-inline input_data_type roi_align_1x1(const ITensor *input,
-                                     unsigned int   roi_batch,
-                                     float          region_start_x,
-                                     float          bin_size_x,
-                                     int            grid_size_x,
-                                     float          region_end_x,
-                                     float          region_start_y,
-                                     float          bin_size_y,
-                                     int            grid_size_y,
-                                     float          region_end_y,
-                                     int            pz)
+/** Bilinear sample of the input: offsets in bytes of the 4 neighbours and their interpolation weights */
+struct ROIAlignSample
+{
+    size_t offset[4];
+    float  weight[4];
+};
+
+/** Samples of an output bin of the pooled region */
+struct ROIAlignBin
+{
+    size_t first_sample; /**< Index of the first sample of the bin in the sample plan */
+    size_t num_samples;  /**< Number of samples of the bin, 0 if the bin is empty */
+    float  inv_count;    /**< Reciprocal of the number of samples */
+};
+
+/** Conversions between the data type of the tensors and the float accumulators, 8 channels at a time */
+template <typename T>
+struct ROIAlignVector;
+
+template <>
+struct ROIAlignVector<float>
 {
-    if ((region_end_x <= region_start_x) || (region_end_y <= region_start_y))
+    static float32x4x2_t load(const float *ptr)
     {
-        return input_data_type(0);
+        return {{vld1q_f32(ptr), vld1q_f32(ptr + 4)}};
     }
-    else
+    static void store(float *ptr, const float32x4x2_t &v, const UniformQuantizationInfo &)
     {
-        const DataLayout data_layout = input->info()->data_layout();
-        float            avg         = 0;
-        // Iterate through the aligned pooling region
-        for (int iy = 0; iy < grid_size_y; ++iy)
-        {
-            for (int ix = 0; ix < grid_size_x; ++ix)
-            {
-                // Align the window in the middle of every bin
-                float y = region_start_y + (iy + 0.5) * bin_size_y / float(grid_size_y);
-                float x = region_start_x + (ix + 0.5) * bin_size_x / float(grid_size_x);
-
-                // Interpolation in the [0,0] [0,1] [1,0] [1,1] square
-                const int y_low  = y;
-                const int x_low  = x;
-                const int y_high = y_low + 1;
-                const int x_high = x_low + 1;
+        vst1q_f32(ptr, v.val[0]);
+        vst1q_f32(ptr + 4, v.val[1]);
+    }
+};
 
-                const float ly = y - y_low;
-                const float lx = x - x_low;
-                const float hy = 1. - ly;
-                const float hx = 1. - lx;
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template <>
+struct ROIAlignVector<float16_t>
+{
+    static float32x4x2_t load(const float16_t *ptr)
+    {
+        const float16x8_t v = vld1q_f16(ptr);
+        return {{vcvt_f32_f16(vget_low_f16(v)), vcvt_f32_f16(vget_high_f16(v))}};
+    }
+    static void store(float16_t *ptr, const float32x4x2_t &v, const UniformQuantizationInfo &)
+    {
+        vst1q_f16(ptr, vcombine_f16(vcvt_f16_f32(v.val[0]), vcvt_f16_f32(v.val[1])));
+    }
+};
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
 
-                const float w1 = hy * hx;
-                const float w2 = hy * lx;
-                const float w3 = ly * hx;
-                const float w4 = ly * lx;
-                if (data_layout == DataLayout::NCHW)
-                {
-                    const auto data1 = *reinterpret_cast<const input_data_type *>(
-                        input->ptr_to_element(Coordinates(x_low, y_low, pz, roi_batch)));
-                    const auto data2 = *reinterpret_cast<const input_data_type *>(
-                        input->ptr_to_element(Coordinates(x_high, y_low, pz, roi_batch)));
-                    const auto data3 = *reinterpret_cast<const input_data_type *>(
-                        input->ptr_to_element(Coordinates(x_low, y_high, pz, roi_batch)));
-                    const auto data4 = *reinterpret_cast<const input_data_type *>(
-                        input->ptr_to_element(Coordinates(x_high, y_high, pz, roi_batch)));
-                    avg += w1 * data1 + w2 * data2 + w3 * data3 + w4 * data4;
-                }
-                else
-                {
-                    const auto data1 = *reinterpret_cast<const input_data_type *>(
-                        input->ptr_to_element(Coordinates(pz, x_low, y_low, roi_batch)));
-                    const auto data2 = *reinterpret_cast<const input_data_type *>(
-                        input->ptr_to_element(Coordinates(pz, x_high, y_low, roi_batch)));
-                    const auto data3 = *reinterpret_cast<const input_data_type *>(
-                        input->ptr_to_element(Coordinates(pz, x_low, y_high, roi_batch)));
-                    const auto data4 = *reinterpret_cast<const input_data_type *>(
-                        input->ptr_to_element(Coordinates(pz, x_high, y_high, roi_batch)));
-                    avg += w1 * data1 + w2 * data2 + w3 * data3 + w4 * data4;
-                }
-            }
+template <>
+struct ROIAlignVector<uint8_t>
+{
+    static float32x4x2_t load(const uint8_t *ptr)
+    {
+        const uint16x8_t v = vmovl_u8(vld1_u8(ptr));
+        return {{vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), vcvtq_f32_u32(vmovl_u16(vget_high_u16(v)))}};
+    }
+    static void store(uint8_t *ptr, const float32x4x2_t &v, const UniformQuantizationInfo &qinfo)
+    {
+        float values[8];
+        vst1q_f32(values, v.val[0]);
+        vst1q_f32(values + 4, v.val[1]);
+        for (int i = 0; i < 8; ++i)
+        {
+            ptr[i] = quantize_qasymm8(values[i], qinfo);
         }
+    }
+};
 
-        avg /= grid_size_x * grid_size_y;
-        return input_data_type(avg);
+template <>
+struct ROIAlignVector<int8_t>
+{
+    static float32x4x2_t load(const int8_t *ptr)
+    {
+        const int16x8_t v = vmovl_s8(vld1_s8(ptr));
+        return {{vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(v)))}};
     }
-}
+    static void store(int8_t *ptr, const float32x4x2_t &v, const UniformQuantizationInfo &qinfo)
+    {
+        float values[8];
+        vst1q_f32(values, v.val[0]);
+        vst1q_f32(values + 4, v.val[1]);
+        for (int i = 0; i < 8; ++i)
+        {
+            ptr[i] = quantize_qasymm8_signed(values[i], qinfo);
+        }
+    }
+};
 
-/** Average pooling over an aligned window */
-template <typename input_data_type>
-inline input_data_type roi_align_1x1_qasymm8(const ITensor          *input,
-                                             unsigned int            roi_batch,
-                                             float                   region_start_x,
-                                             float                   bin_size_x,
-                                             int                     grid_size_x,
-                                             float                   region_end_x,
-                                             float                   region_start_y,
-                                             float                   bin_size_y,
-                                             int                     grid_size_y,
-                                             float                   region_end_y,
-                                             int                     pz,
-                                             const QuantizationInfo &out_qinfo)
+/** Store a single value, quantizing it if needed */
+template <typename T>
+inline void roi_align_store(T *ptr, float value, const UniformQuantizationInfo &qinfo)
 {
-    if ((region_end_x <= region_start_x) || (region_end_y <= region_start_y))
+    if (std::is_same<T, uint8_t>::value)
+    {
+        *ptr = quantize_qasymm8(value, qinfo);
+    }
+    else if (std::is_same<T, int8_t>::value)
     {
-        return input_data_type(out_qinfo.uniform().offset);
+        *ptr = quantize_qasymm8_signed(value, qinfo);
     }
     else
     {
-        float                         avg         = 0;
-        const UniformQuantizationInfo input_qinfo = input->info()->quantization_info().uniform();
-        const bool       is_qasymm_signed = is_data_type_quantized_asymmetric_signed(input->info()->data_type());
-        const DataLayout data_layout      = input->info()->data_layout();
+        *ptr = static_cast<T>(value);
+    }
+}
+
+inline float compute_region_coordinate(int p, float bin_size, float roi_anchor, float max_value)
+{
+    const float region_start = p * bin_size + roi_anchor;
+    return utility::clamp(region_start, 0.0f, max_value);
+}
+
+/** Build the bilinear samples of all the bins of an output row
+ *
+ * The coordinates and the weights only depend on the ROI and on the output bin, so they are computed once and shared by
+ * all the channels.
+ *
+ * @param[out] bins         Bins of the row.
+ * @param[out] samples      Samples of all the bins of the row.
+ * @param[in]  py           Index of the output row.
+ * @param[in]  roi_anchor_x Left coordinate of the ROI on the input.
+ * @param[in]  roi_anchor_y Top coordinate of the ROI on the input.
+ * @param[in]  bin_size_x   Width of a bin on the input.
+ * @param[in]  bin_size_y   Height of a bin on the input.
+ * @param[in]  input_width  Width of the input.
+ * @param[in]  input_height Height of the input.
+ * @param[in]  stride_x     Stride in bytes between two consecutive columns of the input.
+ * @param[in]  stride_y     Stride in bytes between two consecutive rows of the input.
+ * @param[in]  pool_info    ROI pooling information.
+ */
+inline void build_roi_align_row_plan(std::vector<ROIAlignBin>     &bins,
+                                     std::vector<ROIAlignSample>  &samples,
+                                     int                           py,
+                                     float                         roi_anchor_x,
+                                     float                         roi_anchor_y,
+                                     float                         bin_size_x,
+                                     float                         bin_size_y,
+                                     int                           input_width,
+                                     int                           input_height,
+                                     size_t                        stride_x,
+                                     size_t                        stride_y,
+                                     const ROIPoolingLayerInfo    &pool_info)
+{
+    const int   pooled_w       = pool_info.pooled_width();
+    const float region_start_y = compute_region_coordinate(py, bin_size_y, roi_anchor_y, input_height);
+    const float region_end_y   = compute_region_coordinate(py + 1, bin_size_y, roi_anchor_y, input_height);
+    const int   grid_size_x    = (pool_info.sampling_ratio() > 0) ? pool_info.sampling_ratio() : int(ceil(bin_size_x));
+    const int   grid_size_y    = (pool_info.sampling_ratio() > 0) ? pool_info.sampling_ratio() : int(ceil(bin_size_y));
+
+    bins.resize(pooled_w);
+    samples.clear();
+    for (int px = 0; px < pooled_w; ++px)
+    {
+        const float region_start_x = compute_region_coordinate(px, bin_size_x, roi_anchor_x, input_width);
+        const float region_end_x   = compute_region_coordinate(px + 1, bin_size_x, roi_anchor_x, input_width);
+
+        bins[px].first_sample = samples.size();
+        bins[px].num_samples  = 0;
+        bins[px].inv_count    = 1.f / (grid_size_x * grid_size_y);
+        if ((region_end_x <= region_start_x) || (region_end_y <= region_start_y))
+        {
+            continue;
+        }
 
         // Iterate through the aligned pooling region
         for (int iy = 0; iy < grid_size_y; ++iy)
@@ -142,133 +209,36 @@ inline input_data_type roi_align_1x1_qasymm8(const ITensor          *input,
             for (int ix = 0; ix < grid_size_x; ++ix)
             {
                 // Align the window in the middle of every bin
-                float y = region_start_y + (iy + 0.5) * bin_size_y / float(grid_size_y);
-                float x = region_start_x + (ix + 0.5) * bin_size_x / float(grid_size_x);
+                const float y = region_start_y + (iy + 0.5) * bin_size_y / float(grid_size_y);
+                const float x = region_start_x + (ix + 0.5) * bin_size_x / float(grid_size_x);
 
-                // Interpolation in the [0,0] [0,1] [1,0] [1,1] square
-                const int y_low  = y;
-                const int x_low  = x;
-                const int y_high = y_low + 1;
-                const int x_high = x_low + 1;
+                // Interpolation in the [0,0] [0,1] [1,0] [1,1] square. Samples in the last row or column
+                // reuse the edge instead of reading past it, so the input does not need any padding.
+                const int y_low  = std::min(static_cast<int>(y), input_height - 1);
+                const int x_low  = std::min(static_cast<int>(x), input_width - 1);
+                const int y_high = std::min(y_low + 1, input_height - 1);
+                const int x_high = std::min(x_low + 1, input_width - 1);
 
                 const float ly = y - y_low;
                 const float lx = x - x_low;
                 const float hy = 1. - ly;
                 const float hx = 1. - lx;
 
-                const float w1 = hy * hx;
-                const float w2 = hy * lx;
-                const float w3 = ly * hx;
-                const float w4 = ly * lx;
-
-                if (data_layout == DataLayout::NCHW)
-                {
-                    if (is_qasymm_signed)
-                    {
-                        float data1 =
-                            dequantize_qasymm8_signed(*reinterpret_cast<const input_data_type *>(input->ptr_to_element(
-                                                          Coordinates(x_low, y_low, pz, roi_batch))),
-                                                      input_qinfo);
-                        float data2 =
-                            dequantize_qasymm8_signed(*reinterpret_cast<const input_data_type *>(input->ptr_to_element(
-                                                          Coordinates(x_high, y_low, pz, roi_batch))),
-                                                      input_qinfo);
-                        float data3 =
-                            dequantize_qasymm8_signed(*reinterpret_cast<const input_data_type *>(input->ptr_to_element(
-                                                          Coordinates(x_low, y_high, pz, roi_batch))),
-                                                      input_qinfo);
-                        float data4 =
-                            dequantize_qasymm8_signed(*reinterpret_cast<const input_data_type *>(input->ptr_to_element(
-                                                          Coordinates(x_high, y_high, pz, roi_batch))),
-                                                      input_qinfo);
-                        avg += w1 * data1 + w2 * data2 + w3 * data3 + w4 * data4;
-                    }
-                    else
-                    {
-                        float data1 =
-                            dequantize_qasymm8(*reinterpret_cast<const input_data_type *>(
-                                                   input->ptr_to_element(Coordinates(x_low, y_low, pz, roi_batch))),
-                                               input_qinfo);
-                        float data2 =
-                            dequantize_qasymm8(*reinterpret_cast<const input_data_type *>(
-                                                   input->ptr_to_element(Coordinates(x_high, y_low, pz, roi_batch))),
-                                               input_qinfo);
-                        float data3 =
-                            dequantize_qasymm8(*reinterpret_cast<const input_data_type *>(
-                                                   input->ptr_to_element(Coordinates(x_low, y_high, pz, roi_batch))),
-                                               input_qinfo);
-                        float data4 =
-                            dequantize_qasymm8(*reinterpret_cast<const input_data_type *>(
-                                                   input->ptr_to_element(Coordinates(x_high, y_high, pz, roi_batch))),
-                                               input_qinfo);
-                        avg += w1 * data1 + w2 * data2 + w3 * data3 + w4 * data4;
-                    }
-                }
-                else
-                {
-                    if (is_qasymm_signed)
-                    {
-                        const auto data1 =
-                            dequantize_qasymm8_signed(*reinterpret_cast<const input_data_type *>(input->ptr_to_element(
-                                                          Coordinates(pz, x_low, y_low, roi_batch))),
-                                                      input_qinfo);
-                        const auto data2 =
-                            dequantize_qasymm8_signed(*reinterpret_cast<const input_data_type *>(input->ptr_to_element(
-                                                          Coordinates(pz, x_high, y_low, roi_batch))),
-                                                      input_qinfo);
-                        const auto data3 =
-                            dequantize_qasymm8_signed(*reinterpret_cast<const input_data_type *>(input->ptr_to_element(
-                                                          Coordinates(pz, x_low, y_high, roi_batch))),
-                                                      input_qinfo);
-                        const auto data4 =
-                            dequantize_qasymm8_signed(*reinterpret_cast<const input_data_type *>(input->ptr_to_element(
-                                                          Coordinates(pz, x_high, y_high, roi_batch))),
-                                                      input_qinfo);
-                        avg += w1 * data1 + w2 * data2 + w3 * data3 + w4 * data4;
-                    }
-                    else
-                    {
-                        const auto data1 =
-                            dequantize_qasymm8(*reinterpret_cast<const input_data_type *>(
-                                                   input->ptr_to_element(Coordinates(pz, x_low, y_low, roi_batch))),
-                                               input_qinfo);
-                        const auto data2 =
-                            dequantize_qasymm8(*reinterpret_cast<const input_data_type *>(
-                                                   input->ptr_to_element(Coordinates(pz, x_high, y_low, roi_batch))),
-                                               input_qinfo);
-                        const auto data3 =
-                            dequantize_qasymm8(*reinterpret_cast<const input_data_type *>(
-                                                   input->ptr_to_element(Coordinates(pz, x_low, y_high, roi_batch))),
-                                               input_qinfo);
-                        const auto data4 =
-                            dequantize_qasymm8(*reinterpret_cast<const input_data_type *>(
-                                                   input->ptr_to_element(Coordinates(pz, x_high, y_high, roi_batch))),
-                                               input_qinfo);
-                        avg += w1 * data1 + w2 * data2 + w3 * data3 + w4 * data4;
-                    }
-                }
+                ROIAlignSample sample;
+                sample.offset[0] = x_low * stride_x + y_low * stride_y;
+                sample.offset[1] = x_high * stride_x + y_low * stride_y;
+                sample.offset[2] = x_low * stride_x + y_high * stride_y;
+                sample.offset[3] = x_high * stride_x + y_high * stride_y;
+                sample.weight[0] = hy * hx;
+                sample.weight[1] = hy * lx;
+                sample.weight[2] = ly * hx;
+                sample.weight[3] = ly * lx;
+                samples.push_back(sample);
             }
         }
-
-        avg /= grid_size_x * grid_size_y;
-
-        input_data_type res = 0;
-        if (is_qasymm_signed)
-        {
-            res = quantize_qasymm8_signed(avg, out_qinfo);
-        }
-        else
-        {
-            res = quantize_qasymm8(avg, out_qinfo);
-        }
-        return res;
+        bins[px].num_samples = samples.size() - bins[px].first_sample;
     }
 }
-inline float compute_region_coordinate(int p, float bin_size, float roi_anchor, float max_value)
-{
-    const float region_start = p * bin_size + roi_anchor;
-    return utility::clamp(region_start, 0.0f, max_value);
-}
 
 template <typename input_data_type, typename roi_data_type>
 void roi_align(const ITensor      *input,
@@ -280,29 +250,50 @@ void roi_align(const ITensor      *input,
 {
     ARM_COMPUTE_UNUSED(info);
 
+    constexpr int window_step_x = 8;
+
     const DataLayout data_layout    = input->info()->data_layout();
+    const bool       is_nhwc        = data_layout == DataLayout::NHWC;
     const size_t     values_per_roi = rois->info()->dimension(0);
 
-    const int roi_list_start = window.x().start();
-    const int roi_list_end   = window.x().end();
-
     const unsigned int idx_width  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const unsigned int idx_height = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
     const unsigned int idx_depth  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
 
-    const int input_width   = input->info()->dimension(idx_width);
-    const int input_height  = input->info()->dimension(idx_height);
-    const int input_chanels = input->info()->dimension(idx_depth);
-    const int pooled_w      = pool_info.pooled_width();
-    const int pooled_h      = pool_info.pooled_height();
+    const int    input_width    = input->info()->dimension(idx_width);
+    const int    input_height   = input->info()->dimension(idx_height);
+    const int    input_channels = input->info()->dimension(idx_depth);
+    const size_t stride_x       = input->info()->strides_in_bytes()[idx_width];
+    const size_t stride_y       = input->info()->strides_in_bytes()[idx_height];
+    const size_t stride_z       = input->info()->strides_in_bytes()[idx_depth];
+    const size_t stride_batch   = input->info()->strides_in_bytes()[3];
+    const int    pooled_w       = pool_info.pooled_width();
+    const int    pooled_h       = pool_info.pooled_height();
 
     const DataType data_type = input->info()->data_type();
     const bool     is_qasymm = is_data_type_quantized_asymmetric(data_type);
 
+    // Accumulate in the input quantized domain: the weights of a bin sum to one, so only the final value is dequantized
+    const UniformQuantizationInfo input_qinfo  = input->info()->quantization_info().uniform();
+    const UniformQuantizationInfo output_qinfo = output->info()->quantization_info().uniform();
+    const float                   in_scale     = is_qasymm ? input_qinfo.scale : 1.f;
+    const float                   in_offset    = is_qasymm ? input_qinfo.offset : 0.f;
+    const float                   empty_value  = is_qasymm ? output_qinfo.offset : 0.f;
+
+    const uint8_t *input_ptr = input->buffer() + input->info()->offset_first_element_in_bytes();
+
     const auto             *rois_ptr   = reinterpret_cast<const roi_data_type *>(rois->buffer());
     const QuantizationInfo &rois_qinfo = rois->info()->quantization_info();
-    for (int roi_indx = roi_list_start; roi_indx < roi_list_end; ++roi_indx)
+
+    std::vector<ROIAlignBin>    bins;
+    std::vector<ROIAlignSample> samples;
+
+    // Each window iteration computes a row of the output of a ROI
+    for (int row = window.y().start(); row < window.y().end(); ++row)
     {
+        const int roi_indx = row / pooled_h;
+        const int py       = row % pooled_h;
+
         const unsigned int roi_batch = rois_ptr[values_per_roi * roi_indx];
 
         roi_data_type qx1 = rois_ptr[values_per_roi * roi_indx + 1];
@@ -324,52 +315,103 @@ void roi_align(const ITensor      *input,
         const float roi_anchor_y = y1 * pool_info.spatial_scale();
         const float roi_dims_x   = std::max((x2 - x1) * pool_info.spatial_scale(), 1.0f);
         const float roi_dims_y   = std::max((y2 - y1) * pool_info.spatial_scale(), 1.0f);
-        float       bin_size_x   = roi_dims_x / pool_info.pooled_width();
-        float       bin_size_y   = roi_dims_y / pool_info.pooled_height();
+        const float bin_size_x   = roi_dims_x / pool_info.pooled_width();
+        const float bin_size_y   = roi_dims_y / pool_info.pooled_height();
+
+        build_roi_align_row_plan(bins, samples, py, roi_anchor_x, roi_anchor_y, bin_size_x, bin_size_y, input_width,
+                                 input_height, stride_x, stride_y, pool_info);
 
-        // Iterate through all feature maps
-        for (int ch = 0; ch < input_chanels; ++ch)
+        const uint8_t *batch_ptr = input_ptr + roi_batch * stride_batch;
+
+        if (is_nhwc)
         {
-            // Iterate through all output pixels
-            for (int py = 0; py < pooled_h; ++py)
+            // The channels of a sample are contiguous: the weights are broadcast and the channels streamed
+            for (int px = 0; px < pooled_w; ++px)
             {
-                for (int px = 0; px < pooled_w; ++px)
+                auto *out_ptr =
+                    reinterpret_cast<input_data_type *>(output->ptr_to_element(Coordinates(0, px, py, roi_indx)));
+                const ROIAlignBin    &bin        = bins[px];
+                const ROIAlignSample *bin_sample = samples.data() + bin.first_sample;
+
+                if (bin.num_samples == 0)
                 {
-                    const float region_start_x = compute_region_coordinate(px, bin_size_x, roi_anchor_x, input_width);
-                    const float region_start_y = compute_region_coordinate(py, bin_size_y, roi_anchor_y, input_height);
-                    const float region_end_x = compute_region_coordinate(px + 1, bin_size_x, roi_anchor_x, input_width);
-                    const float region_end_y =
-                        compute_region_coordinate(py + 1, bin_size_y, roi_anchor_y, input_height);
-                    const int roi_bin_grid_x =
-                        (pool_info.sampling_ratio() > 0) ? pool_info.sampling_ratio() : int(ceil(bin_size_x));
-                    const int roi_bin_grid_y =
-                        (pool_info.sampling_ratio() > 0) ? pool_info.sampling_ratio() : int(ceil(bin_size_y));
-                    input_data_type out_val(0);
-                    if (is_qasymm)
+                    for (int ch = 0; ch < input_channels; ++ch)
                     {
-                        out_val = roi_align_1x1_qasymm8<input_data_type>(
-                            input, roi_batch, region_start_x, bin_size_x, roi_bin_grid_x, region_end_x, region_start_y,
-                            bin_size_y, roi_bin_grid_y, region_end_y, ch, output->info()->quantization_info());
+                        out_ptr[ch] = static_cast<input_data_type>(empty_value);
                     }
-                    else
+                    continue;
+                }
+
+                int ch = 0;
+                for (; ch <= (input_channels - window_step_x); ch += window_step_x)
+                {
+                    float32x4_t acc0 = vdupq_n_f32(0.f);
+                    float32x4_t acc1 = vdupq_n_f32(0.f);
+                    for (size_t s = 0; s < bin.num_samples; ++s)
                     {
-                        out_val = roi_align_1x1<input_data_type>(input, roi_batch, region_start_x, bin_size_x,
-                                                                 roi_bin_grid_x, region_end_x, region_start_y,
-                                                                 bin_size_y, roi_bin_grid_y, region_end_y, ch);
+                        const ROIAlignSample &sample = bin_sample[s];
+                        for (int k = 0; k < 4; ++k)
+                        {
+                            const auto *ptr =
+                                reinterpret_cast<const input_data_type *>(batch_ptr + sample.offset[k]) + ch;
+                            const float32x4x2_t data = ROIAlignVector<input_data_type>::load(ptr);
+                            acc0 = vmlaq_n_f32(acc0, data.val[0], sample.weight[k]);
+                            acc1 = vmlaq_n_f32(acc1, data.val[1], sample.weight[k]);
+                        }
                     }
 
-                    if (data_layout == DataLayout::NCHW)
+                    // Average and dequantize
+                    const float32x4_t scale  = vdupq_n_f32(bin.inv_count * in_scale);
+                    const float32x4_t offset = vdupq_n_f32(in_offset * in_scale);
+                    const float32x4x2_t res  = {{vsubq_f32(vmulq_f32(acc0, scale), offset),
+                                                 vsubq_f32(vmulq_f32(acc1, scale), offset)}};
+                    ROIAlignVector<input_data_type>::store(out_ptr + ch, res, output_qinfo);
+                }
+                for (; ch < input_channels; ++ch)
+                {
+                    float acc = 0.f;
+                    for (size_t s = 0; s < bin.num_samples; ++s)
+                    {
+                        const ROIAlignSample &sample = bin_sample[s];
+                        for (int k = 0; k < 4; ++k)
+                        {
+                            acc += sample.weight[k] *
+                                   static_cast<float>(
+                                       reinterpret_cast<const input_data_type *>(batch_ptr + sample.offset[k])[ch]);
+                        }
+                    }
+                    roi_align_store(out_ptr + ch, (acc * bin.inv_count - in_offset) * in_scale, output_qinfo);
+                }
+            }
+        }
+        else
+        {
+            // The samples are shared by all the channel planes
+            for (int ch = 0; ch < input_channels; ++ch)
+            {
+                const uint8_t *plane_ptr = batch_ptr + ch * stride_z;
+                auto *out_ptr =
+                    reinterpret_cast<input_data_type *>(output->ptr_to_element(Coordinates(0, py, ch, roi_indx)));
+                for (int px = 0; px < pooled_w; ++px)
+                {
+                    const ROIAlignBin &bin = bins[px];
+                    if (bin.num_samples == 0)
                     {
-                        auto out_ptr = reinterpret_cast<input_data_type *>(
-                            output->ptr_to_element(Coordinates(px, py, ch, roi_indx)));
-                        *out_ptr = out_val;
+                        out_ptr[px] = static_cast<input_data_type>(empty_value);
+                        continue;
                     }
-                    else
+
+                    float acc = 0.f;
+                    for (size_t s = bin.first_sample; s < bin.first_sample + bin.num_samples; ++s)
                     {
-                        auto out_ptr = reinterpret_cast<input_data_type *>(
-                            output->ptr_to_element(Coordinates(ch, px, py, roi_indx)));
-                        *out_ptr = out_val;
+                        const ROIAlignSample &sample = samples[s];
+                        for (int k = 0; k < 4; ++k)
+                        {
+                            const auto *ptr = reinterpret_cast<const input_data_type *>(plane_ptr + sample.offset[k]);
+                            acc += sample.weight[k] * static_cast<float>(*ptr);
+                        }
                     }
+                    roi_align_store(out_ptr + px, (acc * bin.inv_count - in_offset) * in_scale, output_qinfo);
                 }
             }
         }
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/utils/ScaleUtils.h"
+#include "src/cpu/kernels/scale/neon/list.h"
+#include "src/cpu/kernels/scale/neon/separable.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+namespace cpu
+{
+void fp32_neon_scale_separable(const ITensor                *src,
+                               ITensor                      *dst,
+                               const scale_utils::ScaleTaps &taps_x,
+                               const scale_utils::ScaleTaps &taps_y,
+                               const float                  *norm_mul,
+                               const float                  *norm_add,
+                               uint8_t                      *scratch,
+                               const Window                 &window)
+{
+    const size_t num_channels = dst->info()->dimension(0);
+    const size_t dst_width    = dst->info()->dimension(1);
+
+    scale_separable_nhwc<float>(
+        src, dst, taps_y, scratch, window,
+        [&](const uint8_t *src_row, size_t src_stride_x, float *row)
+        { separable_horizontal_fp<float>(src_row, src_stride_x, num_channels, taps_x, dst_width, row); },
+        [&](const float *const *rows, int32_t first_tap, int32_t num_taps, size_t offset, size_t length,
+            uint8_t *dst_ptr)
+        {
+            separable_vertical_fp(rows, taps_y.weight.data() + first_tap, num_taps, offset, length, norm_mul,
+                                  norm_add, reinterpret_cast<float *>(dst_ptr));
+        });
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,8 @@
 #include "src/core/helpers/ScaleHelpers.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/core/utils/ScaleUtils.h"
+#include "src/cpu/kernels/scale/neon/list.h"
+#include "src/cpu/kernels/scale/neon/separable.h"
 #include "support/Rounding.h"
 
 #include <arm_neon.h>
@@ -779,5 +781,52 @@ void s16_neon_scale(const ITensor      *src,
         s16_neon_scale_nearest(src, dst, offsets, sampling_offset, align_corners, window);
     }
 }
+
+void u8_neon_scale_separable(const ITensor                *src,
+                             ITensor                      *dst,
+                             const scale_utils::ScaleTaps &taps_x,
+                             const scale_utils::ScaleTaps &taps_y,
+                             const float                  *norm_mul,
+                             const float                  *norm_add,
+                             uint8_t                      *scratch,
+                             const Window                 &window)
+{
+    ARM_COMPUTE_UNUSED(norm_mul, norm_add);
+    const size_t num_channels = dst->info()->dimension(0);
+    const size_t dst_width    = dst->info()->dimension(1);
+
+    scale_separable_nhwc<uint16_t>(
+        src, dst, taps_y, scratch, window,
+        [&](const uint8_t *src_row, size_t src_stride_x, uint16_t *row)
+        { separable_horizontal_u8(src_row, src_stride_x, num_channels, taps_x, dst_width, row); },
+        [&](const uint16_t *const *rows, int32_t first_tap, int32_t num_taps, size_t offset, size_t length,
+            uint8_t *dst_ptr)
+        { separable_vertical_u8(rows, taps_y.weight_q15.data() + first_tap, num_taps, offset, length, dst_ptr); });
+}
+
+void u8_fp32_neon_scale_separable(const ITensor                *src,
+                                  ITensor                      *dst,
+                                  const scale_utils::ScaleTaps &taps_x,
+                                  const scale_utils::ScaleTaps &taps_y,
+                                  const float                  *norm_mul,
+                                  const float                  *norm_add,
+                                  uint8_t                      *scratch,
+                                  const Window                 &window)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(norm_mul, norm_add);
+    const size_t num_channels = dst->info()->dimension(0);
+    const size_t dst_width    = dst->info()->dimension(1);
+
+    scale_separable_nhwc<uint16_t>(
+        src, dst, taps_y, scratch, window,
+        [&](const uint8_t *src_row, size_t src_stride_x, uint16_t *row)
+        { separable_horizontal_u8(src_row, src_stride_x, num_channels, taps_x, dst_width, row); },
+        [&](const uint16_t *const *rows, int32_t first_tap, int32_t num_taps, size_t offset, size_t length,
+            uint8_t *dst_ptr)
+        {
+            separable_vertical_u8_normalize(rows, taps_y.weight_q15.data() + first_tap, num_taps, offset, length,
+                                            norm_mul, norm_add, reinterpret_cast<float *>(dst_ptr));
+        });
+}
 } // namespace cpu
 } // namespace arm_compute
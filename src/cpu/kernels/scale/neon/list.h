@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,19 @@ DECLARE_SCALE_KERNEL(fp16_nearest_neon_scale_nchw);
 
 #undef DECLARE_SCALE_KERNEL
 
+#define DECLARE_SCALE_SEPARABLE_KERNEL(func_name)                                                             \
+    void func_name(const ITensor *src, ITensor *dst, const scale_utils::ScaleTaps &taps_x,                    \
+                   const scale_utils::ScaleTaps &taps_y, const float *norm_mul, const float *norm_add,        \
+                   uint8_t *scratch, const Window &window)
+
+DECLARE_SCALE_SEPARABLE_KERNEL(u8_neon_scale_separable);
+DECLARE_SCALE_SEPARABLE_KERNEL(u8_fp32_neon_scale_separable);
+DECLARE_SCALE_SEPARABLE_KERNEL(u8_fp16_neon_scale_separable);
+DECLARE_SCALE_SEPARABLE_KERNEL(fp32_neon_scale_separable);
+DECLARE_SCALE_SEPARABLE_KERNEL(fp16_neon_scale_separable);
+
+#undef DECLARE_SCALE_SEPARABLE_KERNEL
+
 #ifdef ENABLE_NCHW_KERNELS
 template <typename T>
 void scale_nearest_nchw(const ITensor *src,
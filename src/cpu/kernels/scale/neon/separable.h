@@ -0,0 +1,433 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_SCALE_NEON_SEPARABLE_H
+#define ACL_SRC_CPU_KERNELS_SCALE_NEON_SEPARABLE_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/core/utils/ScaleUtils.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+inline float32x4_t separable_load_f32(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void separable_store_f32(float *ptr, float32x4_t value)
+{
+    vst1q_f32(ptr, value);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+inline float32x4_t separable_load_f32(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void separable_store_f32(float16_t *ptr, float32x4_t value)
+{
+    vst1_f16(ptr, vcvt_f16_f32(value));
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
+
+/** Resamples a U8 NHWC row along the width, producing Q7 fixed-point values
+ *
+ * @param[in]  src_row      Pointer to the first element of the source row
+ * @param[in]  src_stride_x Stride in bytes between two source pixels
+ * @param[in]  num_channels Number of channels
+ * @param[in]  taps         Horizontal taps
+ * @param[in]  dst_width    Destination width
+ * @param[out] dst          Resampled row, @p dst_width * @p num_channels values
+ */
+inline void separable_horizontal_u8(const uint8_t                *src_row,
+                                    size_t                        src_stride_x,
+                                    size_t                        num_channels,
+                                    const scale_utils::ScaleTaps &taps,
+                                    size_t                        dst_width,
+                                    uint16_t                     *dst)
+{
+    const int32_t  *index  = taps.index.data();
+    const uint16_t *weight = taps.weight_q15.data();
+
+    for (size_t xo = 0; xo < dst_width; ++xo, dst += num_channels)
+    {
+        const int32_t first = taps.start[xo];
+        const int32_t last  = taps.start[xo + 1];
+
+        size_t c = 0;
+        for (; c + 16 <= num_channels; c += 16)
+        {
+            uint32x4_t acc0 = vdupq_n_u32(0);
+            uint32x4_t acc1 = vdupq_n_u32(0);
+            uint32x4_t acc2 = vdupq_n_u32(0);
+            uint32x4_t acc3 = vdupq_n_u32(0);
+            for (int32_t t = first; t < last; ++t)
+            {
+                const uint8x16_t in = vld1q_u8(src_row + index[t] * src_stride_x + c);
+                const uint16x8_t lo = vmovl_u8(vget_low_u8(in));
+                const uint16x8_t hi = vmovl_u8(vget_high_u8(in));
+                acc0                = vmlal_n_u16(acc0, vget_low_u16(lo), weight[t]);
+                acc1                = vmlal_n_u16(acc1, vget_high_u16(lo), weight[t]);
+                acc2                = vmlal_n_u16(acc2, vget_low_u16(hi), weight[t]);
+                acc3                = vmlal_n_u16(acc3, vget_high_u16(hi), weight[t]);
+            }
+            vst1q_u16(dst + c, vcombine_u16(vrshrn_n_u32(acc0, 8), vrshrn_n_u32(acc1, 8)));
+            vst1q_u16(dst + c + 8, vcombine_u16(vrshrn_n_u32(acc2, 8), vrshrn_n_u32(acc3, 8)));
+        }
+        for (; c + 8 <= num_channels; c += 8)
+        {
+            uint32x4_t acc0 = vdupq_n_u32(0);
+            uint32x4_t acc1 = vdupq_n_u32(0);
+            for (int32_t t = first; t < last; ++t)
+            {
+                const uint16x8_t in = vmovl_u8(vld1_u8(src_row + index[t] * src_stride_x + c));
+                acc0                = vmlal_n_u16(acc0, vget_low_u16(in), weight[t]);
+                acc1                = vmlal_n_u16(acc1, vget_high_u16(in), weight[t]);
+            }
+            vst1q_u16(dst + c, vcombine_u16(vrshrn_n_u32(acc0, 8), vrshrn_n_u32(acc1, 8)));
+        }
+        for (; c < num_channels; ++c)
+        {
+            uint32_t acc = 0;
+            for (int32_t t = first; t < last; ++t)
+            {
+                acc += static_cast<uint32_t>(src_row[index[t] * src_stride_x + c]) * weight[t];
+            }
+            dst[c] = static_cast<uint16_t>((acc + 128) >> 8);
+        }
+    }
+}
+
+/** Resamples a F32/F16 NHWC row along the width, producing F32 values
+ *
+ * @param[in]  src_row      Pointer to the first element of the source row
+ * @param[in]  src_stride_x Stride in bytes between two source pixels
+ * @param[in]  num_channels Number of channels
+ * @param[in]  taps         Horizontal taps
+ * @param[in]  dst_width    Destination width
+ * @param[out] dst          Resampled row, @p dst_width * @p num_channels values
+ */
+template <typename T>
+void separable_horizontal_fp(const uint8_t                *src_row,
+                             size_t                        src_stride_x,
+                             size_t                        num_channels,
+                             const scale_utils::ScaleTaps &taps,
+                             size_t                        dst_width,
+                             float                        *dst)
+{
+    const int32_t *index  = taps.index.data();
+    const float   *weight = taps.weight.data();
+
+    for (size_t xo = 0; xo < dst_width; ++xo, dst += num_channels)
+    {
+        const int32_t first = taps.start[xo];
+        const int32_t last  = taps.start[xo + 1];
+
+        size_t c = 0;
+        for (; c + 8 <= num_channels; c += 8)
+        {
+            float32x4_t acc0 = vdupq_n_f32(0.f);
+            float32x4_t acc1 = vdupq_n_f32(0.f);
+            for (int32_t t = first; t < last; ++t)
+            {
+                const T *in = reinterpret_cast<const T *>(src_row + index[t] * src_stride_x) + c;
+                acc0        = vmlaq_n_f32(acc0, separable_load_f32(in), weight[t]);
+                acc1        = vmlaq_n_f32(acc1, separable_load_f32(in + 4), weight[t]);
+            }
+            vst1q_f32(dst + c, acc0);
+            vst1q_f32(dst + c + 4, acc1);
+        }
+        for (; c + 4 <= num_channels; c += 4)
+        {
+            float32x4_t acc = vdupq_n_f32(0.f);
+            for (int32_t t = first; t < last; ++t)
+            {
+                const T *in = reinterpret_cast<const T *>(src_row + index[t] * src_stride_x) + c;
+                acc         = vmlaq_n_f32(acc, separable_load_f32(in), weight[t]);
+            }
+            vst1q_f32(dst + c, acc);
+        }
+        for (; c < num_channels; ++c)
+        {
+            float acc = 0.f;
+            for (int32_t t = first; t < last; ++t)
+            {
+                acc += static_cast<float>(reinterpret_cast<const T *>(src_row + index[t] * src_stride_x)[c]) *
+                       weight[t];
+            }
+            dst[c] = acc;
+        }
+    }
+}
+
+/** Blends Q7 rows into a U8 output, rounding to nearest
+ *
+ * @param[in]  rows     Horizontally resampled rows, one per vertical tap
+ * @param[in]  weight   Q15 weights of the vertical taps
+ * @param[in]  num_taps Number of vertical taps
+ * @param[in]  offset   Offset of the first element to blend in the rows
+ * @param[in]  length   Number of elements to blend
+ * @param[out] dst      Destination
+ */
+inline void separable_vertical_u8(const uint16_t *const *rows,
+                                  const uint16_t        *weight,
+                                  int32_t                num_taps,
+                                  size_t                 offset,
+                                  size_t                 length,
+                                  uint8_t               *dst)
+{
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        uint32x4_t acc0 = vdupq_n_u32(0);
+        uint32x4_t acc1 = vdupq_n_u32(0);
+        uint32x4_t acc2 = vdupq_n_u32(0);
+        uint32x4_t acc3 = vdupq_n_u32(0);
+        for (int32_t k = 0; k < num_taps; ++k)
+        {
+            const uint16x8_t lo = vld1q_u16(rows[k] + offset + i);
+            const uint16x8_t hi = vld1q_u16(rows[k] + offset + i + 8);
+            acc0                = vmlal_n_u16(acc0, vget_low_u16(lo), weight[k]);
+            acc1                = vmlal_n_u16(acc1, vget_high_u16(lo), weight[k]);
+            acc2                = vmlal_n_u16(acc2, vget_low_u16(hi), weight[k]);
+            acc3                = vmlal_n_u16(acc3, vget_high_u16(hi), weight[k]);
+        }
+        // Q7 * Q15 leaves 22 fractional bits
+        const uint16x8_t lo = vcombine_u16(vmovn_u32(vrshrq_n_u32(acc0, 22)), vmovn_u32(vrshrq_n_u32(acc1, 22)));
+        const uint16x8_t hi = vcombine_u16(vmovn_u32(vrshrq_n_u32(acc2, 22)), vmovn_u32(vrshrq_n_u32(acc3, 22)));
+        vst1q_u8(dst + i, vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)));
+    }
+    for (; i < length; ++i)
+    {
+        uint32_t acc = 0;
+        for (int32_t k = 0; k < num_taps; ++k)
+        {
+            acc += static_cast<uint32_t>(rows[k][offset + i]) * weight[k];
+        }
+        dst[i] = static_cast<uint8_t>(std::min<uint32_t>((acc + (1u << 21)) >> 22, 255u));
+    }
+}
+
+/** Blends Q7 rows into a F32/F16 output, applying per-element scale and offset
+ *
+ * @param[in]  rows     Horizontally resampled rows, one per vertical tap
+ * @param[in]  weight   Q15 weights of the vertical taps
+ * @param[in]  num_taps Number of vertical taps
+ * @param[in]  offset   Offset of the first element to blend in the rows and in @p mul and @p add
+ * @param[in]  length   Number of elements to blend
+ * @param[in]  mul      Multipliers applied to the blended values
+ * @param[in]  add      Offsets added to the scaled values
+ * @param[out] dst      Destination
+ */
+template <typename T>
+void separable_vertical_u8_normalize(const uint16_t *const *rows,
+                                     const uint16_t        *weight,
+                                     int32_t                num_taps,
+                                     size_t                 offset,
+                                     size_t                 length,
+                                     const float           *mul,
+                                     const float           *add,
+                                     T                     *dst)
+{
+    mul += offset;
+    add += offset;
+
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8)
+    {
+        uint32x4_t acc0 = vdupq_n_u32(0);
+        uint32x4_t acc1 = vdupq_n_u32(0);
+        for (int32_t k = 0; k < num_taps; ++k)
+        {
+            const uint16x8_t in = vld1q_u16(rows[k] + offset + i);
+            acc0                = vmlal_n_u16(acc0, vget_low_u16(in), weight[k]);
+            acc1                = vmlal_n_u16(acc1, vget_high_u16(in), weight[k]);
+        }
+        const float32x4_t v0 = vcvtq_n_f32_u32(acc0, 22);
+        const float32x4_t v1 = vcvtq_n_f32_u32(acc1, 22);
+        separable_store_f32(dst + i, vmlaq_f32(vld1q_f32(add + i), v0, vld1q_f32(mul + i)));
+        separable_store_f32(dst + i + 4, vmlaq_f32(vld1q_f32(add + i + 4), v1, vld1q_f32(mul + i + 4)));
+    }
+    for (; i < length; ++i)
+    {
+        uint32_t acc = 0;
+        for (int32_t k = 0; k < num_taps; ++k)
+        {
+            acc += static_cast<uint32_t>(rows[k][offset + i]) * weight[k];
+        }
+        dst[i] = static_cast<T>(static_cast<float>(acc) * (1.f / (1 << 22)) * mul[i] + add[i]);
+    }
+}
+
+/** Blends F32 rows into a F32/F16 output
+ *
+ * @param[in]  rows     Horizontally resampled rows, one per vertical tap
+ * @param[in]  weight   Weights of the vertical taps
+ * @param[in]  num_taps Number of vertical taps
+ * @param[in]  offset   Offset of the first element to blend in the rows and in @p mul and @p add
+ * @param[in]  length   Number of elements to blend
+ * @param[in]  mul      (Optional) Multipliers applied to the blended values
+ * @param[in]  add      (Optional) Offsets added to the scaled values. Must be given with @p mul
+ * @param[out] dst      Destination
+ */
+template <typename T>
+void separable_vertical_fp(const float *const *rows,
+                           const float        *weight,
+                           int32_t             num_taps,
+                           size_t              offset,
+                           size_t              length,
+                           const float        *mul,
+                           const float        *add,
+                           T                  *dst)
+{
+    const bool normalize = mul != nullptr;
+
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8)
+    {
+        float32x4_t acc0 = vmulq_n_f32(vld1q_f32(rows[0] + offset + i), weight[0]);
+        float32x4_t acc1 = vmulq_n_f32(vld1q_f32(rows[0] + offset + i + 4), weight[0]);
+        for (int32_t k = 1; k < num_taps; ++k)
+        {
+            acc0 = vmlaq_n_f32(acc0, vld1q_f32(rows[k] + offset + i), weight[k]);
+            acc1 = vmlaq_n_f32(acc1, vld1q_f32(rows[k] + offset + i + 4), weight[k]);
+        }
+        if (normalize)
+        {
+            acc0 = vmlaq_f32(vld1q_f32(add + offset + i), acc0, vld1q_f32(mul + offset + i));
+            acc1 = vmlaq_f32(vld1q_f32(add + offset + i + 4), acc1, vld1q_f32(mul + offset + i + 4));
+        }
+        separable_store_f32(dst + i, acc0);
+        separable_store_f32(dst + i + 4, acc1);
+    }
+    for (; i < length; ++i)
+    {
+        float acc = 0.f;
+        for (int32_t k = 0; k < num_taps; ++k)
+        {
+            acc += rows[k][offset + i] * weight[k];
+        }
+        dst[i] = static_cast<T>(normalize ? acc * mul[offset + i] + add[offset + i] : acc);
+    }
+}
+
+/** Resizes a NHWC tensor one output row at a time: the source rows needed by each output row are resampled
+ * horizontally, then blended vertically. Resampled rows are cached in @p scratch, so that output rows sharing a
+ * source row only resample it once.
+ *
+ * @param[in]  src             Source tensor
+ * @param[out] dst             Destination tensor
+ * @param[in]  taps_y          Vertical taps
+ * @param[in]  scratch         Working space of the calling thread, see @ref scale_utils::separable_scratch_size
+ * @param[in]  window          Region on which to execute the kernel, split along the height
+ * @param[in]  horizontal_pass Function resampling a source row, called as (src_row, src_stride_x, row)
+ * @param[in]  vertical_pass   Function blending resampled rows, called as (rows, first_tap, num_taps, offset, length, dst)
+ */
+template <typename TI, typename HorizontalPass, typename VerticalPass>
+void scale_separable_nhwc(const ITensor                *src,
+                          ITensor                      *dst,
+                          const scale_utils::ScaleTaps &taps_y,
+                          uint8_t                      *scratch,
+                          const Window                 &window,
+                          const HorizontalPass         &horizontal_pass,
+                          const VerticalPass           &vertical_pass)
+{
+    const ITensorInfo *src_info = src->info();
+    const ITensorInfo *dst_info = dst->info();
+
+    const size_t num_channels = dst_info->dimension(0);
+    const size_t dst_width    = dst_info->dimension(1);
+    const size_t row_length   = num_channels * dst_width;
+    const size_t src_stride_x = src_info->strides_in_bytes()[1];
+    const size_t src_stride_y = src_info->strides_in_bytes()[2];
+    const size_t src_stride_b = src_info->strides_in_bytes()[3];
+    const size_t dst_stride_x = dst_info->strides_in_bytes()[1];
+    const size_t dst_stride_y = dst_info->strides_in_bytes()[2];
+    const size_t dst_stride_b = dst_info->strides_in_bytes()[3];
+
+    // Blend whole output rows at once unless the destination is padded between pixels
+    const bool is_dst_dense = dst_stride_x == num_channels * dst_info->element_size();
+
+    const int32_t max_taps     = taps_y.max_taps;
+    const size_t  cache_stride = scale_utils::separable_scratch_row_stride(row_length, sizeof(TI));
+    auto          rows         = reinterpret_cast<const TI **>(scratch);
+    auto          slot_row     = reinterpret_cast<int32_t *>(scratch + max_taps * sizeof(void *));
+    uint8_t      *cache        = scratch + scale_utils::separable_scratch_rows_offset(max_taps);
+
+    const uint8_t *src_base = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_base = dst->buffer() + dst_info->offset_first_element_in_bytes();
+
+    for (int b = window[3].start(); b < window[3].end(); b += window[3].step())
+    {
+        const uint8_t *src_batch = src_base + b * src_stride_b;
+        uint8_t       *dst_batch = dst_base + b * dst_stride_b;
+
+        std::fill_n(slot_row, max_taps, -1);
+
+        for (int yo = window.z().start(); yo < window.z().end(); yo += window.z().step())
+        {
+            const int32_t first_tap = taps_y.start[yo];
+            const int32_t num_taps  = taps_y.start[yo + 1] - first_tap;
+            for (int32_t t = 0; t < num_taps; ++t)
+            {
+                // The source rows of an output row are consecutive, hence never share a slot
+                const int32_t sy   = taps_y.index[first_tap + t];
+                const int32_t slot = sy % max_taps;
+                auto          row  = reinterpret_cast<TI *>(cache + slot * cache_stride);
+                if (slot_row[slot] != sy)
+                {
+                    horizontal_pass(src_batch + sy * src_stride_y, src_stride_x, row);
+                    slot_row[slot] = sy;
+                }
+                rows[t] = row;
+            }
+
+            uint8_t *dst_row = dst_batch + yo * dst_stride_y;
+            if (is_dst_dense)
+            {
+                vertical_pass(rows, first_tap, num_taps, 0, row_length, dst_row);
+            }
+            else
+            {
+                for (size_t xo = 0; xo < dst_width; ++xo)
+                {
+                    vertical_pass(rows, first_tap, num_taps, xo * num_channels, num_channels,
+                                  dst_row + xo * dst_stride_x);
+                }
+            }
+        }
+    }
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_SCALE_NEON_SEPARABLE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,27 +33,34 @@ namespace cpu
 {
 void scatter_fp16_neon(const ITensor         *src,
                        const ITensor         *indices,
+                       const ITensor         *partition,
                        ITensor               *dst,
                        const ScatterFunction &scatter_func,
                        const Window          &window,
+                       const Window          &data_window,
                        const int              data_block_length)
 {
     switch (scatter_func)
     {
         case ScatterFunction::Update:
-            scatter_neon<ScatterFunction::Update, float16_t>(src, indices, dst, window, data_block_length);
+            scatter_neon<ScatterFunction::Update, float16_t>(src, indices, partition, dst, window, data_window,
+                                                             data_block_length);
             break;
         case ScatterFunction::Add:
-            scatter_neon<ScatterFunction::Add, float16_t>(src, indices, dst, window, data_block_length);
+            scatter_neon<ScatterFunction::Add, float16_t>(src, indices, partition, dst, window, data_window,
+                                                          data_block_length);
             break;
         case ScatterFunction::Sub:
-            scatter_neon<ScatterFunction::Sub, float16_t>(src, indices, dst, window, data_block_length);
+            scatter_neon<ScatterFunction::Sub, float16_t>(src, indices, partition, dst, window, data_window,
+                                                          data_block_length);
             break;
         case ScatterFunction::Max:
-            scatter_neon<ScatterFunction::Max, float16_t>(src, indices, dst, window, data_block_length);
+            scatter_neon<ScatterFunction::Max, float16_t>(src, indices, partition, dst, window, data_window,
+                                                          data_block_length);
             break;
         case ScatterFunction::Min:
-            scatter_neon<ScatterFunction::Min, float16_t>(src, indices, dst, window, data_block_length);
+            scatter_neon<ScatterFunction::Min, float16_t>(src, indices, partition, dst, window, data_window,
+                                                          data_block_length);
             break;
         default:
             ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,15 +33,207 @@
 #include "src/core/NEON/wrapper/wrapper.h"
 #include "src/cpu/CpuTypes.h"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace arm_compute
 {
 namespace cpu
 {
+constexpr int scatter_max_index_length = 5;
+
+/** Maps the index tuples of a scatter operation to the destination blocks they address
+ *
+ * Blocks are numbered in row-major order of the index dimensions of the destination, which are its outermost ones.
+ */
+class ScatterBlockIndexer
+{
+public:
+    /** Constructor
+     *
+     * @param[in] dst_info  Destination tensor info.
+     * @param[in] index_len Number of coordinates of each index tuple.
+     */
+    ScatterBlockIndexer(const ITensorInfo &dst_info, int index_len) : _index_len(index_len)
+    {
+        const int dst_dims = dst_info.num_dimensions();
+        for (int i = 1; i <= scatter_max_index_length; ++i)
+        {
+            _shape[i - 1] = dst_info.tensor_shape()[std::max(dst_dims - i, 0)];
+        }
+        for (int i = 0; i < _index_len; ++i)
+        {
+            _num_blocks *= _shape[i];
+        }
+    }
+    /** Number of destination blocks that can be addressed */
+    int32_t num_blocks() const
+    {
+        return _num_blocks;
+    }
+    /** Flatten an index tuple
+     *
+     * @param[in] idx Index tuple, outermost coordinate first.
+     *
+     * @return the destination block, or -1 if the tuple is out of bounds
+     */
+    int32_t operator()(const int32_t *idx) const
+    {
+        int32_t block = 0;
+        for (int i = 0; i < _index_len; ++i)
+        {
+            if (idx[i] >= _shape[i] || idx[i] < 0)
+            {
+                return -1;
+            }
+            block = block * _shape[i] + idx[i];
+        }
+        return block;
+    }
+
+private:
+    int32_t _shape[scatter_max_index_length]{};
+    int     _index_len{0};
+    int32_t _num_blocks{1};
+};
+
+/** Sort the updates of a scatter operation by destination block
+ *
+ * The partition tensor is filled with the offsets of the updates of each block (num_blocks + 1 values)
+ * followed by the update ids sorted by block. The sort is stable, so the updates of a block keep the order
+ * they have in @p indices. Out of bounds updates are discarded.
+ *
+ * @param[in]  indices   Indices tensor.
+ * @param[in]  dst_info  Destination tensor info.
+ * @param[out] partition Partition tensor. Data type supported: S32.
+ */
+inline void scatter_partition_updates(const ITensor *indices, const ITensorInfo &dst_info, ITensor *partition)
+{
+    const ITensorInfo        *idx_info          = indices->info();
+    const auto                indices_strides_y = idx_info->strides_in_bytes()[1];
+    const size_t              num_indices       = idx_info->tensor_shape().collapsed_from(1)[1];
+    const ScatterBlockIndexer indexer(dst_info, idx_info->dimension(0));
+    const int32_t             num_blocks = indexer.num_blocks();
+
+    const uint8_t *idx_ptr_raw_base = indices->ptr_to_element(Coordinates(0));
+    int32_t       *block_offsets    = reinterpret_cast<int32_t *>(partition->ptr_to_element(Coordinates(0)));
+    int32_t       *block_updates    = block_offsets + num_blocks + 1;
+
+    const auto block_of = [&](size_t update)
+    { return indexer(reinterpret_cast<const int32_t *>(idx_ptr_raw_base + update * indices_strides_y)); };
+
+    // Count the updates of each block
+    std::fill_n(block_offsets, num_blocks + 1, 0);
+    for (size_t update = 0; update < num_indices; ++update)
+    {
+        const int32_t block = block_of(update);
+        if (block >= 0)
+        {
+            ++block_offsets[block + 1];
+        }
+    }
+    for (int32_t block = 0; block < num_blocks; ++block)
+    {
+        block_offsets[block + 1] += block_offsets[block];
+    }
+
+    // Place the updates, which leaves every offset pointing to the end of its block
+    for (size_t update = 0; update < num_indices; ++update)
+    {
+        const int32_t block = block_of(update);
+        if (block >= 0)
+        {
+            block_updates[block_offsets[block]++] = static_cast<int32_t>(update);
+        }
+    }
+    for (int32_t block = num_blocks; block > 0; --block)
+    {
+        block_offsets[block] = block_offsets[block - 1];
+    }
+    block_offsets[0] = 0;
+}
+
 template <arm_compute::ScatterFunction sf, typename ScalarType>
-void scatter_neon(
-    const ITensor *updates, const ITensor *indices, ITensor *dst, const Window &window, const int data_block_length)
+inline void scatter_block(const uint8_t *upt_ptr, uint8_t *dst_ptr, const int data_block_length)
+{
+    constexpr int vec_size = 16 / sizeof(ScalarType);
+
+    const auto upt = reinterpret_cast<const ScalarType *>(upt_ptr);
+    auto       out = reinterpret_cast<ScalarType *>(dst_ptr);
+
+    int x = 0;
+    for (; x <= (data_block_length - vec_size); x += vec_size)
+    {
+        const auto update_val_vec = wrapper::vloadq(upt + x);
+        const auto dst_val_vec    = wrapper::vloadq(out + x);
+
+        switch (sf)
+        {
+            case ScatterFunction::Update:
+                wrapper::vstore(out + x, update_val_vec);
+                break;
+            case ScatterFunction::Add:
+                wrapper::vstore(out + x, wrapper::vadd(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Sub:
+                wrapper::vstore(out + x, wrapper::vsub(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Max:
+                wrapper::vstore(out + x, wrapper::vmax(dst_val_vec, update_val_vec));
+                break;
+            case ScatterFunction::Min:
+                wrapper::vstore(out + x, wrapper::vmin(dst_val_vec, update_val_vec));
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+        }
+    }
+
+    for (; x < data_block_length; ++x)
+    {
+        const ScalarType update_val = upt[x];
+        const ScalarType dst_val    = out[x];
+        ScalarType       output_val;
+        switch (sf)
+        {
+            case ScatterFunction::Update:
+                output_val = update_val;
+                break;
+            case ScatterFunction::Add:
+                output_val = dst_val + update_val;
+                break;
+            case ScatterFunction::Sub:
+                output_val = dst_val - update_val;
+                break;
+            case ScatterFunction::Max:
+                output_val = std::max(dst_val, update_val);
+                break;
+            case ScatterFunction::Min:
+                output_val = std::min(dst_val, update_val);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+        }
+        out[x] = output_val;
+    }
+}
+
+/** Apply the updates in the range of @p window
+ *
+ * The window runs over the updates. When @p partition is nullptr the indices are unique and each update
+ * in the range is applied directly. Otherwise the updates are taken in the order given by
+ * @ref scatter_partition_updates, and the window only selects the destination blocks to process: the ones
+ * whose first sorted update falls in the range. Each block is therefore written by a single thread,
+ * which applies all its updates in their original order.
+ */
+template <arm_compute::ScatterFunction sf, typename ScalarType>
+void scatter_neon(const ITensor *updates,
+                  const ITensor *indices,
+                  const ITensor *partition,
+                  ITensor       *dst,
+                  const Window  &window,
+                  const Window  &data_window,
+                  const int      data_block_length)
 {
     const auto updates_info = updates->info();
     const auto idx_info     = indices->info();
@@ -49,14 +241,6 @@ void scatter_neon(
 
     const auto indices_strides_y = idx_info->strides_in_bytes()[1];
 
-    const int     dst_dims         = dst_info->num_dimensions();
-    constexpr int max_index_length = 5;
-    int32_t       dst_shape[max_index_length];
-    for (int i = 1; i <= max_index_length; ++i)
-    {
-        dst_shape[i - 1] = dst_info->tensor_shape()[std::max(dst_dims - i, 0)];
-    }
-
     const int  index_len = idx_info->dimension(0);
     const auto num_dims  = dst_info->num_dimensions();
     const int  ind_dims  = idx_info->num_dimensions();
@@ -65,110 +249,56 @@ void scatter_neon(
 
     const int out_block_stride = dst_info->strides_in_bytes()[num_dims - index_len];
 
-    TensorShape  ind_collapsed = idx_info->tensor_shape().collapsed_from(1);
-    const size_t num_indices   = ind_collapsed[1];
+    const ScatterBlockIndexer indexer(*dst_info, index_len);
+    const int32_t             num_blocks = indexer.num_blocks();
+
+    const int32_t start = window.x().start();
+    const int32_t end   = window.x().end();
+
+    const uint8_t *idx_ptr_raw_base = indices->ptr_to_element(arm_compute::Coordinates(0));
 
-    Iterator updates_it(updates, window);
-    Iterator dst_it(dst, window);
+    const int32_t *block_offsets = nullptr;
+    const int32_t *block_updates = nullptr;
+    int32_t        first_block   = 0;
+    if (partition != nullptr)
+    {
+        block_offsets = reinterpret_cast<const int32_t *>(partition->ptr_to_element(arm_compute::Coordinates(0)));
+        block_updates = block_offsets + num_blocks + 1;
+        first_block   = std::lower_bound(block_offsets, block_offsets + num_blocks, start) - block_offsets;
+    }
 
-    constexpr int vec_size         = 16 / sizeof(ScalarType);
-    uint8_t      *idx_ptr_raw_base = indices->ptr_to_element(arm_compute::Coordinates(0));
+    Iterator updates_it(updates, data_window);
+    Iterator dst_it(dst, data_window);
 
     execute_window_loop(
-        window,
+        data_window,
         [&](const Coordinates &)
         {
-            uint8_t *idx_ptr_raw = idx_ptr_raw_base;
-            for (size_t index_element = 0; index_element < num_indices; ++index_element)
+            if (partition == nullptr)
             {
-                int32_t *idx_ptr = reinterpret_cast<int32_t *>(idx_ptr_raw);
-
-                // Out of bounds check
-                bool out_of_bounds = false;
-                for (int i = 0; i < index_len; ++i)
+                for (int32_t update = start; update < end; ++update)
                 {
-                    if (idx_ptr[i] >= dst_shape[i] || idx_ptr[i] < 0)
+                    const int32_t block =
+                        indexer(reinterpret_cast<const int32_t *>(idx_ptr_raw_base + update * indices_strides_y));
+                    if (block >= 0)
                     {
-                        out_of_bounds = true;
+                        scatter_block<sf, ScalarType>(updates_it.ptr() + static_cast<size_t>(update) * upt_block_stride,
+                                                      dst_it.ptr() + static_cast<size_t>(block) * out_block_stride,
+                                                      data_block_length);
                     }
                 }
-
-                idx_ptr_raw += indices_strides_y;
-
-                if (out_of_bounds)
-                {
-                    continue;
-                }
-
-                int32_t index = 0;
-                for (int i = 0; i < index_len; ++i)
-                {
-                    index = index * dst_shape[i] + idx_ptr[i];
-                }
-
-                const uint8_t *upt_from_index_ptr = updates_it.ptr() + index_element * upt_block_stride;
-
-                uint8_t *dst_from_index_ptr = dst_it.ptr() + index * out_block_stride;
-
-                int x = 0;
-                for (; x <= (data_block_length - vec_size); x += vec_size)
-                {
-                    const auto update_val_vec =
-                        wrapper::vloadq(reinterpret_cast<const ScalarType *>(upt_from_index_ptr) + x);
-                    const auto dst_val_vec = wrapper::vloadq(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x);
-
-                    switch (sf)
-                    {
-                        case ScatterFunction::Update:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x, update_val_vec);
-                            break;
-                        case ScatterFunction::Add:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vadd(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Sub:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vsub(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Max:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vmax(dst_val_vec, update_val_vec));
-                            break;
-                        case ScatterFunction::Min:
-                            wrapper::vstore(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x,
-                                            wrapper::vmin(dst_val_vec, update_val_vec));
-                            break;
-                        default:
-                            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
-                    }
-                }
-
-                for (; x < data_block_length; ++x)
+            }
+            else
+            {
+                for (int32_t block = first_block; block < num_blocks && block_offsets[block] < end; ++block)
                 {
-                    const ScalarType update_val = *(reinterpret_cast<const ScalarType *>(upt_from_index_ptr) + x);
-                    const ScalarType dst_val    = *(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x);
-                    ScalarType       output_val;
-                    switch (sf)
+                    uint8_t *dst_from_index_ptr = dst_it.ptr() + static_cast<size_t>(block) * out_block_stride;
+                    for (int32_t i = block_offsets[block]; i < block_offsets[block + 1]; ++i)
                     {
-                        case ScatterFunction::Update:
-                            output_val = update_val;
-                            break;
-                        case ScatterFunction::Add:
-                            output_val = dst_val + update_val;
-                            break;
-                        case ScatterFunction::Sub:
-                            output_val = dst_val - update_val;
-                            break;
-                        case ScatterFunction::Max:
-                            output_val = std::max(dst_val, update_val);
-                            break;
-                        case ScatterFunction::Min:
-                            output_val = std::min(dst_val, update_val);
-                            break;
-                        default:
-                            ARM_COMPUTE_ERROR("Invalid reduction function for scatter.");
+                        const size_t update = block_updates[i];
+                        scatter_block<sf, ScalarType>(updates_it.ptr() + update * upt_block_stride, dst_from_index_ptr,
+                                                      data_block_length);
                     }
-                    *(reinterpret_cast<ScalarType *>(dst_from_index_ptr) + x) = output_val;
                 }
             }
         },
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,9 +28,10 @@ namespace arm_compute
 {
 namespace cpu
 {
-#define DECLARE_SCATTER_KERNEL(func_name)                                                                         \
-    void func_name(const ITensor *src, const ITensor *indices, ITensor *dst, const ScatterFunction &scatter_func, \
-                   const Window &window, const int data_block_length)
+#define DECLARE_SCATTER_KERNEL(func_name)                                                                  \
+    void func_name(const ITensor *src, const ITensor *indices, const ITensor *partition, ITensor *dst,     \
+                   const ScatterFunction &scatter_func, const Window &window, const Window &data_window, \
+                   const int data_block_length)
 
 DECLARE_SCATTER_KERNEL(scatter_fp32_neon);
 DECLARE_SCATTER_KERNEL(scatter_fp16_neon);
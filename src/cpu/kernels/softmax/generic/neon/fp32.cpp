@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,7 +30,7 @@ namespace arm_compute
 namespace cpu
 {
 
-template <bool IS_LOG>
+template <bool IS_LOG, bool FAST_MATH>
 void neon_fp32_softmax(const ITensor *in,
                        void *const    tmp,
                        ITensor       *out,
@@ -42,28 +42,42 @@ void neon_fp32_softmax(const ITensor *in,
     ARM_COMPUTE_UNUSED(lut_ptr);
     if (axis == 0)
     {
-        return neon_softmax_x_float<float, IS_LOG>(in, tmp, out, beta, axis, window);
+        return neon_softmax_x_float<float, IS_LOG, FAST_MATH>(in, tmp, out, beta, axis, window);
     }
     else
     {
-        return neon_softmax_non_x_float<float, IS_LOG>(in, tmp, out, beta, axis, window);
+        return neon_softmax_non_x_float<float, IS_LOG, FAST_MATH>(in, tmp, out, beta, axis, window);
     }
 }
 
-template void neon_fp32_softmax<true>(const ITensor *in,
-                                      void *const    tmp,
-                                      ITensor       *out,
-                                      const float    beta,
-                                      int            axis,
-                                      const Window  &window,
-                                      const void    *lut_ptr);
-template void neon_fp32_softmax<false>(const ITensor *in,
-                                       void *const    tmp,
-                                       ITensor       *out,
-                                       const float    beta,
-                                       int            axis,
-                                       const Window  &window,
-                                       const void    *lut_ptr);
+template void neon_fp32_softmax<true, false>(const ITensor *in,
+                                             void *const    tmp,
+                                             ITensor       *out,
+                                             const float    beta,
+                                             int            axis,
+                                             const Window  &window,
+                                             const void    *lut_ptr);
+template void neon_fp32_softmax<false, false>(const ITensor *in,
+                                              void *const    tmp,
+                                              ITensor       *out,
+                                              const float    beta,
+                                              int            axis,
+                                              const Window  &window,
+                                              const void    *lut_ptr);
+template void neon_fp32_softmax<true, true>(const ITensor *in,
+                                            void *const    tmp,
+                                            ITensor       *out,
+                                            const float    beta,
+                                            int            axis,
+                                            const Window  &window,
+                                            const void    *lut_ptr);
+template void neon_fp32_softmax<false, true>(const ITensor *in,
+                                             void *const    tmp,
+                                             ITensor       *out,
+                                             const float    beta,
+                                             int            axis,
+                                             const Window  &window,
+                                             const void    *lut_ptr);
 
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -59,9 +59,16 @@ inline float wrapper_vaddv(const float32x4_t &a, int sum_stages)
 } // namespace
 #endif // __aarch64__
 
+/** Exponential of the float softmax kernels, using the fast math tier if @p FAST_MATH is true */
+template <bool FAST_MATH, typename V>
+inline V softmax_vexpq(const V &a)
+{
+    return FAST_MATH ? wrapper::vexpq_fast(a) : wrapper::vexpq(a);
+}
+
 // The template implementation for float data types is stored in the header file because
 // we need all fp16 instantiated code to live in fp16.cpp files.
-template <typename T, bool IS_LOG>
+template <typename T, bool IS_LOG, bool FAST_MATH>
 void neon_softmax_x_float(const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window)
 {
     ARM_COMPUTE_UNUSED(axis);
@@ -142,11 +149,11 @@ void neon_softmax_x_float(const ITensor *in, void *const tmp, ITensor *out, floa
                     if (IS_LOG)
                     {
                         vec_elements = wrapper::vmul(vec_elements, beta_vec);
-                        vec_sum      = wrapper::vadd(vec_sum, wrapper::vexpq(vec_elements));
+                        vec_sum      = wrapper::vadd(vec_sum, softmax_vexpq<FAST_MATH>(vec_elements));
                     }
                     else
                     {
-                        vec_elements = wrapper::vexpq(wrapper::vmul(vec_elements, beta_vec));
+                        vec_elements = softmax_vexpq<FAST_MATH>(wrapper::vmul(vec_elements, beta_vec));
                         vec_sum      = wrapper::vadd(vec_sum, vec_elements);
                     }
                     wrapper::vstore(out_ptr + x, vec_elements);
@@ -229,7 +236,7 @@ void neon_softmax_x_float(const ITensor *in, void *const tmp, ITensor *out, floa
         },
         in_it, out_it);
 }
-template <typename T, bool IS_LOG>
+template <typename T, bool IS_LOG, bool FAST_MATH>
 void neon_softmax_non_x_float(
     const ITensor *in, void *const tmp, ITensor *out, float beta, int axis, const Window &window)
 {
@@ -311,11 +318,11 @@ void neon_softmax_non_x_float(
                         if (IS_LOG)
                         {
                             vec_elements = wrapper::vmul(vec_elements, beta_vec);
-                            vec_sum      = wrapper::vadd(vec_sum, wrapper::vexpq(vec_elements));
+                            vec_sum      = wrapper::vadd(vec_sum, softmax_vexpq<FAST_MATH>(vec_elements));
                         }
                         else
                         {
-                            vec_elements = wrapper::vexpq(wrapper::vmul(vec_elements, beta_vec));
+                            vec_elements = softmax_vexpq<FAST_MATH>(wrapper::vmul(vec_elements, beta_vec));
                             vec_sum      = wrapper::vadd(vec_sum, vec_elements);
                         }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,8 +33,13 @@ namespace cpu
     void func_name(const ITensor *in, void *const tmp, ITensor *out, const float beta, int axis, const Window &window, \
                    const void *lut_ptr)
 
-DECLARE_SOFTMAX_KERNEL(neon_fp32_softmax);
-DECLARE_SOFTMAX_KERNEL(neon_fp16_softmax);
+#define DECLARE_FP_SOFTMAX_KERNEL(func_name)                                                                           \
+    template <bool IS_LOG, bool FAST_MATH>                                                                             \
+    void func_name(const ITensor *in, void *const tmp, ITensor *out, const float beta, int axis, const Window &window, \
+                   const void *lut_ptr)
+
+DECLARE_FP_SOFTMAX_KERNEL(neon_fp32_softmax);
+DECLARE_FP_SOFTMAX_KERNEL(neon_fp16_softmax);
 DECLARE_SOFTMAX_KERNEL(neon_qasymm8_softmax);
 DECLARE_SOFTMAX_KERNEL(neon_qasymm8_signed_softmax);
 
@@ -87,6 +92,7 @@ void sve_softmax_bf16(const ITensor *in,
 #endif // ARM_COMPUTE_ENABLE_BF16
 
 #undef DECLARE_SOFTMAX_KERNEL
+#undef DECLARE_FP_SOFTMAX_KERNEL
 } // namespace cpu
 } // namespace arm_compute
 
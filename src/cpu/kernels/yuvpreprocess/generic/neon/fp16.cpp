@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
+#include "src/cpu/kernels/yuvpreprocess/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void yuv_preprocess_fp16_neon(const ITensor             *luma,
+                              const ITensor             *chroma0,
+                              const ITensor             *chroma1,
+                              ITensor                   *dst,
+                              const YUVPreprocessParams &params,
+                              uint8_t                   *scratch,
+                              const Window              &window)
+{
+    yuv_preprocess_nhwc<float16_t>(
+        luma, chroma0, chroma1, dst, params, scratch, window,
+        [](const float32x4x2_t &c0, const float32x4x2_t &c1, const float32x4x2_t &c2, float16_t *out)
+        {
+            vst3q_f16(out, float16x8x3_t{{vcombine_f16(vcvt_f16_f32(c0.val[0]), vcvt_f16_f32(c0.val[1])),
+                                          vcombine_f16(vcvt_f16_f32(c1.val[0]), vcvt_f16_f32(c1.val[1])),
+                                          vcombine_f16(vcvt_f16_f32(c2.val[0]), vcvt_f16_f32(c2.val[1]))}});
+        },
+        [](float c0, float c1, float c2, float16_t *out)
+        {
+            out[0] = static_cast<float16_t>(c0);
+            out[1] = static_cast<float16_t>(c1);
+            out[2] = static_cast<float16_t>(c2);
+        });
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
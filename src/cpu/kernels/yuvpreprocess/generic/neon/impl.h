@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_YUVPREPROCESS_GENERIC_NEON_IMPL_H
+#define ACL_SRC_CPU_KERNELS_YUVPREPROCESS_GENERIC_NEON_IMPL_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/core/Window.h"
+
+#include "src/cpu/kernels/yuvpreprocess/list.h"
+
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Widen eight samples to floats */
+inline float32x4x2_t yuv_widen(const uint8x8_t &v)
+{
+    const uint16x8_t v16 = vmovl_u8(v);
+    return {{vcvtq_f32_u32(vmovl_u16(vget_low_u16(v16))), vcvtq_f32_u32(vmovl_u16(vget_high_u16(v16)))}};
+}
+
+/** Blend eight samples of two rows and store them as floats */
+inline void yuv_blend_store(const uint8x8_t &a, const uint8x8_t &b, const float32x4_t &weight, float *out)
+{
+    const float32x4x2_t fa = yuv_widen(a);
+    const float32x4x2_t fb = yuv_widen(b);
+    vst1q_f32(out, vmlaq_f32(fa.val[0], vsubq_f32(fb.val[0], fa.val[0]), weight));
+    vst1q_f32(out + 4, vmlaq_f32(fa.val[1], vsubq_f32(fb.val[1], fa.val[1]), weight));
+}
+
+/** Blend two rows of samples vertically into a row of floats */
+inline void yuv_blend_rows(const uint8_t *row0, const uint8_t *row1, float weight, int32_t length, float *out)
+{
+    const float32x4_t vweight = vdupq_n_f32(weight);
+
+    int32_t x = 0;
+    for (; x <= length - 8; x += 8)
+    {
+        yuv_blend_store(vld1_u8(row0 + x), vld1_u8(row1 + x), vweight, out + x);
+    }
+    for (; x < length; ++x)
+    {
+        out[x] = row0[x] + weight * (row1[x] - row0[x]);
+    }
+}
+
+/** Blend two rows of interleaved chroma samples vertically into a row of floats per plane */
+inline void yuv_blend_interleaved_rows(
+    const uint8_t *row0, const uint8_t *row1, float weight, int32_t length, float *out0, float *out1)
+{
+    const float32x4_t vweight = vdupq_n_f32(weight);
+
+    int32_t x = 0;
+    for (; x <= length - 8; x += 8)
+    {
+        const uint8x8x2_t a = vld2_u8(row0 + 2 * x);
+        const uint8x8x2_t b = vld2_u8(row1 + 2 * x);
+        yuv_blend_store(a.val[0], b.val[0], vweight, out0 + x);
+        yuv_blend_store(a.val[1], b.val[1], vweight, out1 + x);
+    }
+    for (; x < length; ++x)
+    {
+        out0[x] = row0[2 * x] + weight * (row1[2 * x] - row0[2 * x]);
+        out1[x] = row0[2 * x + 1] + weight * (row1[2 * x + 1] - row0[2 * x + 1]);
+    }
+}
+
+/** Resample a row of floats horizontally to the destination width */
+inline void yuv_resample_row(const float *row, const YUVPreprocessTaps &taps, size_t length, float *out)
+{
+    const int32_t *index0 = taps.index0.data();
+    const int32_t *index1 = taps.index1.data();
+    const float   *weight = taps.weight.data();
+    for (size_t x = 0; x < length; ++x)
+    {
+        const float a = row[index0[x]];
+        out[x]        = a + weight[x] * (row[index1[x]] - a);
+    }
+}
+
+/** Convert a NV12/NV21/IYUV frame to a normalised NHWC RGB tensor
+ *
+ * Each window step computes one output row. The two luma rows and the two chroma rows it samples are blended
+ * vertically into the working space, resampled to the destination width, then converted to RGB, normalised and
+ * written eight pixels at a time.
+ *
+ * @param[in]  luma         Luma plane
+ * @param[in]  chroma0      Interleaved chroma plane for NV12/NV21, Cb plane for IYUV
+ * @param[in]  chroma1      Cr plane for IYUV, unused otherwise
+ * @param[out] dst          Destination tensor
+ * @param[in]  params       Parameters computed at configuration
+ * @param[in]  scratch      Working space of the calling thread
+ * @param[in]  window       Window to execute
+ * @param[in]  store        Writes eight pixels, given the three normalised channels
+ * @param[in]  store_scalar Writes one pixel, given the three normalised channels
+ */
+template <typename T, typename StoreFn, typename StoreScalarFn>
+void yuv_preprocess_nhwc(const ITensor             *luma,
+                         const ITensor             *chroma0,
+                         const ITensor             *chroma1,
+                         ITensor                   *dst,
+                         const YUVPreprocessParams &params,
+                         uint8_t                   *scratch,
+                         const Window              &window,
+                         StoreFn                  &&store,
+                         StoreScalarFn            &&store_scalar)
+{
+    const size_t   dst_width   = dst->info()->dimension(1);
+    const Strides &dst_strides = dst->info()->strides_in_bytes();
+    const Strides &y_strides   = luma->info()->strides_in_bytes();
+    const Strides &c_strides   = chroma0->info()->strides_in_bytes();
+    uint8_t       *dst_base    = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+    const uint8_t *y_base = luma->buffer() + luma->info()->offset_first_element_in_bytes() + params.luma_x_start;
+
+    const bool     is_planar    = params.format == Format::IYUV;
+    const size_t   chroma_x_off = is_planar ? params.chroma_x_start : 2 * params.chroma_x_start;
+    const uint8_t *c0_base = chroma0->buffer() + chroma0->info()->offset_first_element_in_bytes() + chroma_x_off;
+    const uint8_t *c1_base =
+        is_planar ? chroma1->buffer() + chroma1->info()->offset_first_element_in_bytes() + chroma_x_off : nullptr;
+
+    float *y_row  = reinterpret_cast<float *>(scratch);
+    float *cb_row = y_row + yuv_preprocess_scratch_row_stride(params.luma_x_count);
+    float *cr_row = cb_row + yuv_preprocess_scratch_row_stride(params.chroma_x_count);
+    float *y_res  = cr_row + yuv_preprocess_scratch_row_stride(params.chroma_x_count);
+    float *cb_res = y_res + yuv_preprocess_scratch_row_stride(dst_width);
+    float *cr_res = cb_res + yuv_preprocess_scratch_row_stride(dst_width);
+
+    const float32x4_t vluma_offset = vdupq_n_f32(params.luma_offset);
+    const float32x4_t vluma_scale  = vdupq_n_f32(params.luma_scale);
+    const float32x4_t vhalf        = vdupq_n_f32(128.f);
+    const float32x4_t vzero        = vdupq_n_f32(0.f);
+    const float32x4_t vmax         = vdupq_n_f32(255.f);
+
+    // Convert four pixels to one normalised output channel
+    const auto convert = [&](const float32x4_t &y, const float32x4_t &cb, const float32x4_t &cr, int c)
+    {
+        float32x4_t v = vmlaq_n_f32(vmlaq_n_f32(y, cb, params.cb_coeff[c]), cr, params.cr_coeff[c]);
+        v             = vminq_f32(vmaxq_f32(v, vzero), vmax);
+        return vmlaq_n_f32(vdupq_n_f32(params.norm_add[c]), v, params.norm_mul[c]);
+    };
+    const auto convert_scalar = [&](float y, float cb, float cr, int c)
+    {
+        const float v = utility::clamp<float>(y + params.cb_coeff[c] * cb + params.cr_coeff[c] * cr, 0.f, 255.f);
+        return v * params.norm_mul[c] + params.norm_add[c];
+    };
+
+    execute_window_loop(
+        window,
+        [&](const Coordinates &id)
+        {
+            const int out_y = id[2];
+            const int batch = id[3];
+
+            // Blend the sampled rows vertically
+            const uint8_t *y_plane = y_base + batch * y_strides[2];
+            yuv_blend_rows(y_plane + params.luma_y.index0[out_y] * y_strides[1],
+                           y_plane + params.luma_y.index1[out_y] * y_strides[1], params.luma_y.weight[out_y],
+                           params.luma_x_count, y_row);
+
+            const size_t   c_row0   = params.chroma_y.index0[out_y] * c_strides[1];
+            const size_t   c_row1   = params.chroma_y.index1[out_y] * c_strides[1];
+            const float    c_weight = params.chroma_y.weight[out_y];
+            const uint8_t *c0_plane = c0_base + batch * c_strides[2];
+            if (is_planar)
+            {
+                const uint8_t *c1_plane = c1_base + batch * chroma1->info()->strides_in_bytes()[2];
+                const size_t   c1_row0  = params.chroma_y.index0[out_y] * chroma1->info()->strides_in_bytes()[1];
+                const size_t   c1_row1  = params.chroma_y.index1[out_y] * chroma1->info()->strides_in_bytes()[1];
+                yuv_blend_rows(c0_plane + c_row0, c0_plane + c_row1, c_weight, params.chroma_x_count, cb_row);
+                yuv_blend_rows(c1_plane + c1_row0, c1_plane + c1_row1, c_weight, params.chroma_x_count, cr_row);
+            }
+            else
+            {
+                const bool is_nv21 = params.format == Format::NV21;
+                yuv_blend_interleaved_rows(c0_plane + c_row0, c0_plane + c_row1, c_weight, params.chroma_x_count,
+                                           is_nv21 ? cr_row : cb_row, is_nv21 ? cb_row : cr_row);
+            }
+
+            // Resample the rows to the destination width
+            yuv_resample_row(y_row, params.luma_x, dst_width, y_res);
+            yuv_resample_row(cb_row, params.chroma_x, dst_width, cb_res);
+            yuv_resample_row(cr_row, params.chroma_x, dst_width, cr_res);
+
+            // Convert to RGB and normalise
+            T     *out = reinterpret_cast<T *>(dst_base + out_y * dst_strides[2] + batch * dst_strides[3]);
+            size_t x   = 0;
+            for (; x + 8 <= dst_width; x += 8)
+            {
+                float32x4x2_t c[3];
+                for (int i = 0; i < 2; ++i)
+                {
+                    const float32x4_t y =
+                        vmulq_f32(vsubq_f32(vld1q_f32(y_res + x + 4 * i), vluma_offset), vluma_scale);
+                    const float32x4_t cb = vsubq_f32(vld1q_f32(cb_res + x + 4 * i), vhalf);
+                    const float32x4_t cr = vsubq_f32(vld1q_f32(cr_res + x + 4 * i), vhalf);
+                    for (int ch = 0; ch < 3; ++ch)
+                    {
+                        c[ch].val[i] = convert(y, cb, cr, ch);
+                    }
+                }
+                store(c[0], c[1], c[2], out + 3 * x);
+            }
+            for (; x < dst_width; ++x)
+            {
+                const float y  = (y_res[x] - params.luma_offset) * params.luma_scale;
+                const float cb = cb_res[x] - 128.f;
+                const float cr = cr_res[x] - 128.f;
+                store_scalar(convert_scalar(y, cb, cr, 0), convert_scalar(y, cb, cr, 1), convert_scalar(y, cb, cr, 2),
+                             out + 3 * x);
+            }
+        });
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_YUVPREPROCESS_GENERIC_NEON_IMPL_H
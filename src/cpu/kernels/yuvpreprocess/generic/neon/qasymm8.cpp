@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/QuantizationInfo.h"
+
+#include "src/core/NEON/NEAsymm.h"
+#include "src/cpu/kernels/yuvpreprocess/generic/neon/impl.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void yuv_preprocess_qasymm8_neon(const ITensor             *luma,
+                                 const ITensor             *chroma0,
+                                 const ITensor             *chroma1,
+                                 ITensor                   *dst,
+                                 const YUVPreprocessParams &params,
+                                 uint8_t                   *scratch,
+                                 const Window              &window)
+{
+    const UniformQuantizationInfo qinfo = params.qinfo;
+    yuv_preprocess_nhwc<uint8_t>(
+        luma, chroma0, chroma1, dst, params, scratch, window,
+        [&](const float32x4x2_t &c0, const float32x4x2_t &c1, const float32x4x2_t &c2, uint8_t *out)
+        { vst3_u8(out, uint8x8x3_t{{vquantize(c0, qinfo), vquantize(c1, qinfo), vquantize(c2, qinfo)}}); },
+        [&](float c0, float c1, float c2, uint8_t *out)
+        {
+            out[0] = quantize_qasymm8(c0, qinfo, RoundingPolicy::TO_NEAREST_EVEN);
+            out[1] = quantize_qasymm8(c1, qinfo, RoundingPolicy::TO_NEAREST_EVEN);
+            out[2] = quantize_qasymm8(c2, qinfo, RoundingPolicy::TO_NEAREST_EVEN);
+        });
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_KERNELS_YUVPREPROCESS_LIST_H
+#define ACL_SRC_CPU_KERNELS_YUVPREPROCESS_LIST_H
+
+#include "arm_compute/core/CoreTypes.h"
+#include "arm_compute/core/QuantizationInfo.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+class Window;
+
+namespace cpu
+{
+/** Bilinear taps of one dimension, one entry per output coordinate */
+struct YUVPreprocessTaps
+{
+    std::vector<int32_t> index0{}; /**< First source coordinate */
+    std::vector<int32_t> index1{}; /**< Second source coordinate */
+    std::vector<float>   weight{}; /**< Weight of the second source coordinate */
+};
+
+/** Parameters of a fused YUV preprocessing computed at configuration */
+struct YUVPreprocessParams
+{
+    Format                  format{Format::NV12};      /**< Format of the frame */
+    YUVPreprocessTaps       luma_x{};                  /**< Luma columns, relative to @ref luma_x_start */
+    YUVPreprocessTaps       luma_y{};                  /**< Luma rows */
+    YUVPreprocessTaps       chroma_x{};                /**< Chroma columns, relative to @ref chroma_x_start */
+    YUVPreprocessTaps       chroma_y{};                /**< Chroma rows */
+    int32_t                 luma_x_start{0};           /**< First luma column read */
+    int32_t                 luma_x_count{0};           /**< Number of luma columns read */
+    int32_t                 chroma_x_start{0};         /**< First chroma column read */
+    int32_t                 chroma_x_count{0};         /**< Number of chroma columns read */
+    float                   luma_offset{0.f};          /**< Black level of the luma samples */
+    float                   luma_scale{1.f};           /**< Scale of the luma samples after removing the black level */
+    std::array<float, 3>    cb_coeff{};                /**< Contribution of Cb to each output channel */
+    std::array<float, 3>    cr_coeff{};                /**< Contribution of Cr to each output channel */
+    std::array<float, 3>    norm_mul{{1.f, 1.f, 1.f}}; /**< Per output channel normalisation scale */
+    std::array<float, 3>    norm_add{{0.f, 0.f, 0.f}}; /**< Per output channel normalisation offset */
+    UniformQuantizationInfo qinfo{};                   /**< Quantization of quantized destinations */
+};
+
+/** Number of floats reserved for a row of the per-thread working space of a fused YUV preprocessing
+ *
+ * @param[in] length Number of elements in the row
+ *
+ * @return The number of floats, rounded up to a cache line
+ */
+inline size_t yuv_preprocess_scratch_row_stride(size_t length)
+{
+    return ((length + 15) / 16) * 16;
+}
+
+/** Size in bytes of the per-thread working space of a fused YUV preprocessing
+ *
+ * The working space holds the luma and chroma rows blended vertically, then the three channels resampled to the
+ * destination width.
+ *
+ * @param[in] params    Parameters of the preprocessing
+ * @param[in] dst_width Width of the destination
+ *
+ * @return The size in bytes
+ */
+inline size_t yuv_preprocess_scratch_size(const YUVPreprocessParams &params, size_t dst_width)
+{
+    return sizeof(float) * (yuv_preprocess_scratch_row_stride(params.luma_x_count) +
+                            2 * yuv_preprocess_scratch_row_stride(params.chroma_x_count) +
+                            3 * yuv_preprocess_scratch_row_stride(dst_width));
+}
+
+#define DECLARE_YUV_PREPROCESS_KERNEL(func_name)                                                      \
+    void func_name(const ITensor *luma, const ITensor *chroma0, const ITensor *chroma1, ITensor *dst, \
+                   const YUVPreprocessParams &params, uint8_t *scratch, const Window &window)
+
+DECLARE_YUV_PREPROCESS_KERNEL(yuv_preprocess_fp32_neon);
+DECLARE_YUV_PREPROCESS_KERNEL(yuv_preprocess_fp16_neon);
+DECLARE_YUV_PREPROCESS_KERNEL(yuv_preprocess_qasymm8_neon);
+DECLARE_YUV_PREPROCESS_KERNEL(yuv_preprocess_qasymm8_signed_neon);
+
+#undef DECLARE_YUV_PREPROCESS_KERNEL
+
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_KERNELS_YUVPREPROCESS_LIST_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,10 +33,6 @@
 
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
-#include "src/cpu/kernels/CpuConcatenateBatchKernel.h"
-#include "src/cpu/kernels/CpuConcatenateDepthKernel.h"
-#include "src/cpu/kernels/CpuConcatenateHeightKernel.h"
-#include "src/cpu/kernels/CpuConcatenateWidthKernel.h"
 
 namespace arm_compute
 {
@@ -47,8 +43,9 @@ void CpuConcatenate::configure(const std::vector<const ITensorInfo *> &srcs_vect
     ARM_COMPUTE_ERROR_ON(dst == nullptr);
     ARM_COMPUTE_LOG_PARAMS(srcs_vector, dst, axis);
 
-    _axis     = axis;
-    _num_srcs = srcs_vector.size();
+    _num_srcs    = srcs_vector.size();
+    _axis        = axis;
+    _is_prepared = false;
 
     TensorShape dst_shape = arm_compute::misc::shape_calculator::calculate_concatenate_shape(srcs_vector, axis);
 
@@ -56,45 +53,8 @@ void CpuConcatenate::configure(const std::vector<const ITensorInfo *> &srcs_vect
     auto_init_if_empty(*dst, dst_shape, 1, srcs_vector[0]->data_type());
     ARM_COMPUTE_ERROR_THROW_ON(CpuConcatenate::validate(srcs_vector, dst, axis));
 
-    unsigned int offset = 0;
-
-    for (unsigned int i = 0; i < _num_srcs; ++i)
-    {
-        switch (axis)
-        {
-            case Window::DimX:
-            {
-                auto kernel = std::make_unique<kernels::CpuConcatenateWidthKernel>();
-                kernel->configure(srcs_vector.at(i), offset, dst);
-                _concat_kernels.emplace_back(std::move(kernel));
-                break;
-            }
-            case Window::DimY:
-            {
-                auto kernel = std::make_unique<kernels::CpuConcatenateHeightKernel>();
-                kernel->configure(srcs_vector.at(i), offset, dst);
-                _concat_kernels.emplace_back(std::move(kernel));
-                break;
-            }
-            case Window::DimZ:
-            {
-                auto kernel = std::make_unique<kernels::CpuConcatenateDepthKernel>();
-                kernel->configure(srcs_vector.at(i), offset, dst);
-                _concat_kernels.emplace_back(std::move(kernel));
-                break;
-            }
-            case 3:
-            {
-                auto kernel = std::make_unique<kernels::CpuConcatenateBatchKernel>();
-                kernel->configure(srcs_vector.at(i), offset, dst);
-                _concat_kernels.emplace_back(std::move(kernel));
-                break;
-            }
-            default:
-                ARM_COMPUTE_ERROR("Axis not supported");
-        }
-        offset += srcs_vector.at(i)->dimension(axis);
-    }
+    _concat_kernel = std::make_unique<kernels::CpuConcatenateKernel>();
+    _concat_kernel->configure(srcs_vector, dst, axis);
 }
 
 Status
@@ -103,37 +63,7 @@ CpuConcatenate::validate(const std::vector<const ITensorInfo *> &srcs_vector, co
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(dst);
     ARM_COMPUTE_RETURN_ERROR_ON(srcs_vector.size() < 2);
 
-    unsigned int offset = 0;
-    for (const auto &src : srcs_vector)
-    {
-        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src);
-        switch (axis)
-        {
-            case Window::DimX:
-            {
-                ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuConcatenateWidthKernel::validate(src, offset, dst));
-                break;
-            }
-            case Window::DimY:
-            {
-                ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuConcatenateHeightKernel::validate(src, offset, dst));
-                break;
-            }
-            case Window::DimZ:
-            {
-                ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuConcatenateDepthKernel::validate(src, offset, dst));
-                break;
-            }
-            case 3:
-            {
-                ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuConcatenateBatchKernel::validate(src, offset, dst));
-                break;
-            }
-            default:
-                ARM_COMPUTE_ERROR("Axis not supported");
-        }
-        offset += src->dimension(axis);
-    }
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuConcatenateKernel::validate(srcs_vector, dst, axis));
 
     if (dst->total_size() != 0)
     {
@@ -156,15 +86,24 @@ void CpuConcatenate::run(ITensorPack &tensors)
         ARM_COMPUTE_ERROR("Configured with different number of inputs");
     }
 
-    int i = 0;
-    for (auto &k : _concat_kernels)
+    if (!_is_prepared)
     {
-        ITensorPack pack;
-        pack.add_tensor(TensorType::ACL_SRC, tensors.get_const_tensor(ACL_SRC_VEC + i));
-        pack.add_tensor(TensorType::ACL_DST, tensors.get_tensor(ACL_DST));
-        NEScheduler::get().schedule_op(k.get(), Window::DimY, k->window(), pack);
-        ++i;
+        // Plan the copy at runtime, in case there is padding being added after configure()
+        std::vector<const ITensorInfo *> srcs_info(_num_srcs);
+        for (unsigned int i = 0; i < _num_srcs; ++i)
+        {
+            const ITensor *src = tensors.get_const_tensor(TensorType::ACL_SRC_VEC + i);
+            ARM_COMPUTE_ERROR_ON_NULLPTR(src);
+            srcs_info[i] = src->info();
+        }
+        ITensor *dst = tensors.get_tensor(TensorType::ACL_DST);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(dst);
+        _concat_kernel->configure(srcs_info, dst->info(), _axis);
+        _is_prepared = true;
     }
+
+    // All the sources are copied by a single dispatch over the flattened destination bytes
+    NEScheduler::get().schedule_op(_concat_kernel.get(), Window::DimX, _concat_kernel->window(), tensors);
 }
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,21 +24,19 @@
 #ifndef ARM_COMPUTE_CPU_CONCATENATE_H
 #define ARM_COMPUTE_CPU_CONCATENATE_H
 
-#include "src/cpu/ICpuKernel.h"
 #include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuConcatenateKernel.h"
 
+#include <memory>
 #include <vector>
 
 namespace arm_compute
 {
 namespace cpu
 {
-/** Basic function to execute concatenate tensors along a given axis. This function calls the following kernels:
+/** Basic function to execute concatenate tensors along a given axis. This function calls the following kernel:
  *
- * -# @ref kernels::CpuConcatenateWidthKernel (if underlying concatenation axis is 0).
- * -# @ref kernels::CpuConcatenateHeightKernel (if underlying concatenation axis is 1).
- * -# @ref kernels::CpuConcatenateDepthKernel (if underlying concatenation axis is 2).
- * -# @ref kernels::CpuConcatenateBatchKernel (if underlying concatenation axis is 3).
+ * -# @ref kernels::CpuConcatenateKernel, which copies all the sources in a single dispatch.
  */
 class CpuConcatenate : public ICpuOperator
 {
@@ -46,9 +44,8 @@ public:
     CpuConcatenate() = default;
     /** Configure operator for a given list of arguments
      *
-     * @note Input and output tensor dimensions preconditions defer depending on the concatenation axis.
-     * @note Preconditions can be found respectively at @ref kernels::CpuConcatenateWidthKernel, @ref kernels::CpuConcatenateHeightKernel,
-     *       @ref kernels::CpuConcatenateDepthKernel and @ref kernels::CpuConcatenateBatchKernel.
+     * @note All the source dimensions but @p axis must match the destination ones.
+     * @note Preconditions can be found at @ref kernels::CpuConcatenateKernel.
      *
      * @param[in,out] srcs_vector The vectors containing all the tensors to concatenate. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
      * @param[out]    dst         Output tensor. Data types supported: Same as @p srcs_vector.
@@ -67,9 +64,10 @@ public:
     void run(ITensorPack &tensors) override;
 
 private:
-    std::vector<std::unique_ptr<ICPPKernel>> _concat_kernels{};
-    unsigned int                             _num_srcs{0};
-    unsigned int                             _axis{0};
+    std::unique_ptr<kernels::CpuConcatenateKernel> _concat_kernel{nullptr};
+    unsigned int                                   _num_srcs{0};
+    size_t                                         _axis{0};
+    bool                                           _is_prepared{false};
 };
 } // namespace cpu
 } // namespace arm_compute
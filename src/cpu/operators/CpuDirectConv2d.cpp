@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,7 +23,6 @@
  */
 #include "src/cpu/operators/CpuDirectConv2d.h"
 
-#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/Validate.h"
@@ -43,12 +42,10 @@ CpuDirectConv2d::CpuDirectConv2d(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)),
       _output_stage_kernel(),
       _conv_kernel(),
-      _input_border_handler(),
       _activationlayer_function(),
       _accumulator(),
       _has_bias(false),
-      _is_activationlayer_enabled(false),
-      _is_padding_required()
+      _is_activationlayer_enabled(false)
 {
 }
 
@@ -62,12 +59,10 @@ void CpuDirectConv2d::configure(ITensorInfo               *src,
     ARM_COMPUTE_ERROR_ON(src->data_layout() != DataLayout::NCHW && src->data_layout() != DataLayout::NHWC);
     ARM_COMPUTE_LOG_PARAMS(src, weights, bias, dst, conv_info, act_info);
 
-    _output_stage_kernel  = std::make_unique<kernels::CpuDirectConv2dOutputStageKernel>();
-    _conv_kernel          = std::make_unique<kernels::CpuDirectConv2dKernel>();
-    _input_border_handler = std::make_unique<NEFillBorderKernel>();
-    _is_nchw              = src->data_layout() == DataLayout::NCHW;
-    _has_bias             = bias != nullptr;
-    _is_padding_required  = !_conv_kernel->border_size().empty();
+    _output_stage_kernel = std::make_unique<kernels::CpuDirectConv2dOutputStageKernel>();
+    _conv_kernel         = std::make_unique<kernels::CpuDirectConv2dKernel>();
+    _is_nchw             = src->data_layout() == DataLayout::NCHW;
+    _has_bias            = bias != nullptr;
 
     // Free accumulator
     if (_accumulator.buffer() != nullptr)
@@ -103,15 +98,9 @@ void CpuDirectConv2d::configure(ITensorInfo               *src,
         output_to_use = &_dst_perm_info;
     }
 
+    // The kernel skips the out-of-bounds taps, so the input can stay unpadded
     _conv_kernel->configure(input_to_use, weights_to_use, output_to_use, conv_info);
 
-    if (_is_padding_required)
-    {
-        // Add zero padding XY
-        _input_border_handler->configure(input_to_use, _conv_kernel->border_size(), BorderMode::CONSTANT,
-                                         PixelValue(static_cast<float>(0.f)));
-    }
-
     if (_is_nchw)
     {
         _permute_output = std::make_unique<cpu::CpuPermute>();
@@ -247,13 +236,6 @@ void CpuDirectConv2d::run(ITensorPack &tensors)
         pack_perm_weights.add_tensor(TensorType::ACL_DST, weights_perm);
         _permute_weights->run(pack_perm_weights);
 
-        if (_is_padding_required)
-        {
-            ITensorPack pack;
-            pack.add_tensor(TensorType::ACL_SRC_DST, src_perm);
-            NEScheduler::get().schedule_op(_input_border_handler.get(), Window::DimZ, _input_border_handler->window(),
-                                           pack);
-        }
         ITensorPack pack_dconv;
         pack_dconv.add_const_tensor(TensorType::ACL_SRC_0, src_perm);
         pack_dconv.add_const_tensor(TensorType::ACL_SRC_1, weights_perm);
@@ -267,13 +249,6 @@ void CpuDirectConv2d::run(ITensorPack &tensors)
     }
     else
     {
-        if (_is_padding_required)
-        {
-            ITensorPack pack;
-            pack.add_tensor(TensorType::ACL_SRC_DST, src);
-            NEScheduler::get().schedule_op(_input_border_handler.get(), Window::DimZ, _input_border_handler->window(),
-                                           pack);
-        }
         NEScheduler::get().schedule_op(_conv_kernel.get(), Window::DimY, _conv_kernel->window(), tensors);
     }
 
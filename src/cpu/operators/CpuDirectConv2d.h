@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,7 +32,6 @@
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
-#include "src/core/NEON/kernels/NEFillBorderKernel.h"
 #include "src/cpu/ICpuKernel.h"
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/kernels/CpuDirectConv2dKernel.h"
@@ -50,9 +49,10 @@ namespace cpu
  *
  *  This function calls the following kernels:
  *
- * -# @ref NEFillBorderKernel for the input
- * -# @ref kernels::CpuDirectConv2dOutputStageKernel
  * -# @ref kernels::CpuDirectConv2dKernel
+ * -# @ref kernels::CpuDirectConv2dOutputStageKernel
+ *
+ * @note The convolution kernel handles the image borders itself, so the input does not need any padding.
  */
 class CpuDirectConv2d : public ICpuOperator
 {
@@ -112,7 +112,6 @@ private:
     MemoryGroup                                                _memory_group;
     std::unique_ptr<kernels::CpuDirectConv2dOutputStageKernel> _output_stage_kernel;
     std::unique_ptr<kernels::CpuDirectConv2dKernel>            _conv_kernel;
-    std::unique_ptr<NEFillBorderKernel>                        _input_border_handler;
     std::unique_ptr<CpuActivation>                             _activationlayer_function;
     Tensor                                                     _accumulator;
     std::unique_ptr<CpuPermute>                                _permute_input{nullptr};
@@ -121,7 +120,6 @@ private:
     bool                                                       _is_nchw{true};
     bool                                                       _has_bias{false};
     bool                                                       _is_activationlayer_enabled{false};
-    bool                                                       _is_padding_required{false};
     experimental::MemoryRequirements                           _aux_mem{Count};
     TensorInfo                                                 _src_perm_info{};
     TensorInfo                                                 _wei_perm_info{};
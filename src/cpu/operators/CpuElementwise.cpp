@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,8 @@
  */
 #include "src/cpu/operators/CpuElementwise.h"
 
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/WindowHelpers.h"
 #include "src/cpu/kernels/CpuElementwiseKernel.h"
@@ -36,7 +38,7 @@ void CpuElementwiseBase::run(ITensorPack &tensors)
     // If the kernel has been configured, use the window from the kernel.
     if (_kernel->is_window_configured())
     {
-        ICpuOperator::run(tensors);
+        NEScheduler::get().schedule_op(_kernel.get(), _split_dimension, _kernel->window(), tensors);
         return;
     }
 
@@ -52,7 +54,8 @@ void CpuElementwiseArithmetic<op>::configure(const ITensorInfo *src0, const ITen
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuArithmeticKernel>();
     k->configure(op, src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension();
+    _kernel          = std::move(k);
 }
 
 template <ArithmeticOperation op>
@@ -71,7 +74,8 @@ void CpuElementwiseDivision::configure(const ITensorInfo *src0, const ITensorInf
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuDivisionKernel>();
     k->configure(src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension();
+    _kernel          = std::move(k);
 }
 
 Status CpuElementwiseDivision::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst)
@@ -84,7 +88,8 @@ void CpuElementwisePower::configure(const ITensorInfo *src0, const ITensorInfo *
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuPowerKernel>();
     k->configure(src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension();
+    _kernel          = std::move(k);
 }
 
 Status CpuElementwisePower::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *dst)
@@ -98,7 +103,8 @@ void CpuElementwiseComparisonStatic<COP>::configure(const ITensorInfo *src0, con
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuComparisonKernel>();
     k->configure(COP, src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension();
+    _kernel          = std::move(k);
 }
 
 template <ComparisonOperation COP>
@@ -116,7 +122,8 @@ void CpuElementwiseComparison::configure(const ITensorInfo  *src0,
     ARM_COMPUTE_LOG_PARAMS(src0, src1, dst);
     auto k = std::make_unique<kernels::CpuComparisonKernel>();
     k->configure(op, src0, src1, dst);
-    _kernel = std::move(k);
+    _split_dimension = k->get_split_dimension();
+    _kernel          = std::move(k);
 }
 
 Status CpuElementwiseComparison::validate(const ITensorInfo  *src0,
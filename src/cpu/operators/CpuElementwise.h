@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,8 @@
 #ifndef ARM_COMPUTE_CPU_ELEMENTWISE_H
 #define ARM_COMPUTE_CPU_ELEMENTWISE_H
 
+#include "arm_compute/core/Window.h"
+
 #include "src/cpu/ICpuOperator.h"
 
 namespace arm_compute
@@ -35,6 +37,9 @@ class CpuElementwiseBase : public ICpuOperator
 public:
     // Inherited methods overridden:
     void run(ITensorPack &tensors) override;
+
+protected:
+    size_t _split_dimension{Window::DimY};
 };
 /** Class to run @ref cpu::kernels::CpuArithmeticKernel except for division and power
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025 Arm Limited.
+ * Copyright (c) 2021, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,17 +33,18 @@ namespace cpu
 {
 using KernelType = kernels::CpuElementwiseUnaryKernel;
 
-void CpuElementwiseUnary::configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst)
+void CpuElementwiseUnary::configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst, bool fast_math)
 {
-    ARM_COMPUTE_LOG_PARAMS(op, src, dst);
+    ARM_COMPUTE_LOG_PARAMS(op, src, dst, fast_math);
     auto k = std::make_unique<KernelType>();
-    k->configure(op, src, dst);
+    k->configure(op, src, dst, fast_math);
     _kernel = std::move(k);
 }
 
-Status CpuElementwiseUnary::validate(ElementWiseUnary op, const ITensorInfo &src, const ITensorInfo &dst)
+Status
+CpuElementwiseUnary::validate(ElementWiseUnary op, const ITensorInfo &src, const ITensorInfo &dst, bool fast_math)
 {
-    return KernelType::validate(op, src, dst);
+    return KernelType::validate(op, src, dst, fast_math);
 }
 
 void CpuElementwiseUnary::run(ITensorPack &tensors)
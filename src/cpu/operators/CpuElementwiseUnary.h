@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,18 +37,22 @@ class CpuElementwiseUnary : public ICpuOperator
 public:
     /** Initialize the function
      *
-     * @param[in]  op  Unary operation to execute
-     * @param[in]  src Input tensor information. Data types supported: F16/F32, F16/F32/S32 for NEG/ABS operations.
-     * @param[out] dst Output tensor information. Data types supported: Same as @p src.
+     * @param[in]  op        Unary operation to execute
+     * @param[in]  src       Input tensor information.
+     *                       Data types supported: F16/F32, F16/F32/S32 for NEG/ABS operations.
+     * @param[out] dst       Output tensor information. Data types supported: Same as @p src.
+     * @param[in]  fast_math (Optional) Allow a faster, lower accuracy approximation of @ref ElementWiseUnary::EXP
+     *                       for F16/F32. Defaults to false.
      */
-    void configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst);
+    void configure(ElementWiseUnary op, const ITensorInfo &src, ITensorInfo &dst, bool fast_math = false);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuElementwiseUnary::configure()
      *
      * @return a status
      */
-    static Status validate(ElementWiseUnary op, const ITensorInfo &src, const ITensorInfo &dst);
+    static Status
+    validate(ElementWiseUnary op, const ITensorInfo &src, const ITensorInfo &dst, bool fast_math = false);
 
     // Inherited methods overridden:
     void run(ITensorPack &tensors) override;
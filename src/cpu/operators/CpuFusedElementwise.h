@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUFUSEDELEMENTWISE_H
+#define ACL_SRC_CPU_OPERATORS_CPUFUSEDELEMENTWISE_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/function_info/FusedElementwiseInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to evaluate a fused elementwise expression in Neon ™
+ *
+ * This function calls the following kernels:
+ *
+ * -# @ref kernels::CpuFusedElementwiseKernel
+ */
+class CpuFusedElementwise : public ICpuOperator
+{
+public:
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  srcs Input tensor infos, one per input of @p expr. Data types supported: F16/F32.
+     *                  The shapes must be broadcast compatible.
+     * @param[out] dst  Destination tensor info with the broadcast shape of the inputs.
+     *                  Data types supported: Same as @p srcs.
+     * @param[in]  expr Expression to evaluate.
+     */
+    void configure(const std::vector<const ITensorInfo *> &srcs, ITensorInfo *dst, const ElementwiseExpression &expr);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuFusedElementwise::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const std::vector<const ITensorInfo *> &srcs,
+                           const ITensorInfo                      *dst,
+                           const ElementwiseExpression            &expr);
+
+    // Inherited methods overridden:
+    void run(ITensorPack &tensors) override;
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUFUSEDELEMENTWISE_H
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuGemmConv3d.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuConv3dDepthGatherKernel.h"
+#include "src/cpu/operators/CpuGemmDirectConv2d.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+using namespace arm_compute::experimental;
+
+namespace
+{
+/** Upper bound in bytes of the gathered input, which holds kernel_z copies of every input element */
+constexpr size_t max_gathered_src_size = 64 * 1024 * 1024;
+
+Conv2dInfo init_conv2d_info(const Conv3dInfo &conv_info)
+{
+    const PadStrideInfo pad_stride_info(conv_info.stride.width, conv_info.stride.height, conv_info.padding.left,
+                                        conv_info.padding.right, conv_info.padding.top, conv_info.padding.bottom,
+                                        conv_info.round_type);
+    return Conv2dInfo(pad_stride_info, Size2D(1U, 1U), conv_info.act_info, conv_info.enable_fast_math, 1);
+}
+
+/** Weights [OFM, IFM, kernel_x, kernel_y, kernel_z] as NHWC 2D weights [kernel_z * IFM, kernel_x, kernel_y, OFM] */
+TensorShape compute_reshaped_weights_shape(const ITensorInfo &weights)
+{
+    return TensorShape(weights.dimension(4) * weights.dimension(1), weights.dimension(2), weights.dimension(3),
+                       weights.dimension(0));
+}
+
+/** Output [OFM, width, height, depth, N] seen as a batch of NHWC 2D outputs [OFM, width, height, depth * N] */
+TensorShape compute_dst_2d_shape(const TensorShape &dst_shape)
+{
+    return TensorShape(dst_shape[0], dst_shape[1], dst_shape[2], dst_shape[3] * dst_shape[4]);
+}
+
+void reshape_weights(const ITensor *src, ITensor *dst)
+{
+    const ITensorInfo *src_info     = src->info();
+    const ITensorInfo *dst_info     = dst->info();
+    const size_t       element_size = src_info->element_size();
+    const size_t       num_ofm      = src_info->dimension(0);
+    const size_t       num_ifm      = src_info->dimension(1);
+
+    const Strides &src_strides = src_info->strides_in_bytes();
+    const Strides &dst_strides = dst_info->strides_in_bytes();
+
+    const uint8_t *src_ptr = src->buffer() + src_info->offset_first_element_in_bytes();
+    uint8_t       *dst_ptr = dst->buffer() + dst_info->offset_first_element_in_bytes();
+
+    for (size_t kd = 0; kd < src_info->dimension(4); ++kd)
+    {
+        for (size_t kh = 0; kh < src_info->dimension(3); ++kh)
+        {
+            for (size_t kw = 0; kw < src_info->dimension(2); ++kw)
+            {
+                for (size_t ifm = 0; ifm < num_ifm; ++ifm)
+                {
+                    const uint8_t *src_row = src_ptr + kd * src_strides[4] + kh * src_strides[3] +
+                                             kw * src_strides[2] + ifm * src_strides[1];
+                    uint8_t *dst_col = dst_ptr + kh * dst_strides[2] + kw * dst_strides[1] +
+                                       (kd * num_ifm + ifm) * dst_strides[0];
+                    for (size_t ofm = 0; ofm < num_ofm; ++ofm)
+                    {
+                        std::memcpy(dst_col + ofm * dst_strides[3], src_row + ofm * src_strides[0], element_size);
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace
+
+CpuGemmConv3d::CpuGemmConv3d()
+    : _gather_kernel(std::make_unique<kernels::CpuConv3dDepthGatherKernel>()),
+      _gemm_conv(std::make_unique<CpuGemmDirectConv2d>()),
+      _gathered_src(),
+      _reshaped_weights(),
+      _dst_2d(),
+      _aux_mem(),
+      _is_prepared(false)
+{
+}
+
+CpuGemmConv3d::~CpuGemmConv3d() = default;
+
+void CpuGemmConv3d::configure(const ITensorInfo *src0,
+                              const ITensorInfo *src1,
+                              const ITensorInfo *src2,
+                              ITensorInfo       *dst,
+                              const Conv3dInfo  &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src0, src1, dst);
+    ARM_COMPUTE_LOG_PARAMS(src0, src1, src2, dst, conv_info);
+
+    // Output auto initialization if not yet initialized
+    const TensorShape output_shape =
+        misc::shape_calculator::compute_conv3d_shape(src0->tensor_shape(), src1->tensor_shape(), conv_info);
+    auto_init_if_empty(*dst, output_shape, 1, src0->data_type(), src0->quantization_info());
+
+    ARM_COMPUTE_ERROR_THROW_ON(CpuGemmConv3d::validate(src0, src1, src2, dst, conv_info));
+
+    _is_prepared = false;
+
+    _gather_kernel->configure(src0, src1, &_gathered_src, conv_info);
+
+    _reshaped_weights = src1->clone()
+                            ->set_tensor_shape(compute_reshaped_weights_shape(*src1))
+                            .set_data_layout(DataLayout::NHWC)
+                            .set_is_resizable(true);
+    _dst_2d =
+        dst->clone()->set_tensor_shape(compute_dst_2d_shape(dst->tensor_shape())).set_data_layout(DataLayout::NHWC);
+
+    _gemm_conv->configure(&_gathered_src, &_reshaped_weights, src2, &_dst_2d, init_conv2d_info(conv_info));
+
+    // The assembly dispatch keeps its own pretransposed copy of the weights, so the reshaped ones are only needed in
+    // prepare
+    _aux_mem = _gemm_conv->workspace();
+    _aux_mem.resize(Count);
+    _aux_mem[GatheredSrc] =
+        MemoryInfo(offset_int_vec(GatheredSrc), MemoryLifetime::Temporary, _gathered_src.total_size());
+    _aux_mem[ReshapedWeights] =
+        MemoryInfo(offset_int_vec(ReshapedWeights), MemoryLifetime::Prepare, _reshaped_weights.total_size());
+}
+
+Status CpuGemmConv3d::validate(const ITensorInfo *src0,
+                               const ITensorInfo *src1,
+                               const ITensorInfo *src2,
+                               const ITensorInfo *dst,
+                               const Conv3dInfo  &conv_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src0, src1, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(src0->data_layout() != DataLayout::NDHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src0, 1, DataType::F16, DataType::F32, DataType::QASYMM8,
+                                                         DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, src1);
+    ARM_COMPUTE_RETURN_ERROR_ON(src1->num_dimensions() > 5);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!src1->are_values_constant(), "Weights are reshaped once and must be constant");
+    ARM_COMPUTE_RETURN_ERROR_ON(conv_info.dilation != Size3D(1U, 1U, 1U));
+
+    const TensorShape output_shape =
+        misc::shape_calculator::compute_conv3d_shape(src0->tensor_shape(), src1->tensor_shape(), conv_info);
+
+    TensorInfo dst_2d;
+    if (dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, dst);
+        // The batch of 2D outputs aliases the memory of the destination
+        ARM_COMPUTE_RETURN_ERROR_ON(!dst->padding().empty());
+        dst_2d = dst->clone()->set_tensor_shape(compute_dst_2d_shape(output_shape)).set_data_layout(DataLayout::NHWC);
+    }
+    else
+    {
+        dst_2d = TensorInfo(compute_dst_2d_shape(output_shape), 1, src0->data_type(), src0->quantization_info());
+        dst_2d.set_data_layout(DataLayout::NHWC);
+    }
+
+    TensorInfo gathered_src;
+    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuConv3dDepthGatherKernel::validate(src0, src1, &gathered_src, conv_info));
+    gathered_src = src0->clone()
+                       ->set_tensor_shape(
+                           kernels::CpuConv3dDepthGatherKernel::compute_gathered_shape(*src0, *src1, conv_info))
+                       .set_data_layout(DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(gathered_src.total_size() > max_gathered_src_size,
+                                    "Gathered input exceeds the workspace limit of the indirect GEMM path");
+
+    const TensorInfo reshaped_weights =
+        src1->clone()->set_tensor_shape(compute_reshaped_weights_shape(*src1)).set_data_layout(DataLayout::NHWC);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        CpuGemmDirectConv2d::validate(&gathered_src, &reshaped_weights, src2, &dst_2d, init_conv2d_info(conv_info)));
+
+    return Status{};
+}
+
+void CpuGemmConv3d::prepare(ITensorPack &tensors)
+{
+    if (!_is_prepared)
+    {
+        const ITensor *weights = tensors.get_const_tensor(ACL_SRC_1);
+        ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+
+        CpuAuxTensorHandler reshaped_weights(offset_int_vec(ReshapedWeights), _reshaped_weights, tensors);
+        reshape_weights(weights, reshaped_weights.get());
+
+        ITensorPack gemm_pack = tensors;
+        gemm_pack.add_const_tensor(ACL_SRC_1, reshaped_weights.get());
+        _gemm_conv->prepare(gemm_pack);
+
+        _is_prepared = true;
+    }
+}
+
+void CpuGemmConv3d::run(ITensorPack &tensors)
+{
+    prepare(tensors);
+
+    const ITensor *src = tensors.get_const_tensor(ACL_SRC_0);
+    ITensor       *dst = tensors.get_tensor(ACL_DST);
+
+    CpuAuxTensorHandler gathered_src(offset_int_vec(GatheredSrc), _gathered_src, tensors);
+    CpuAuxTensorHandler dst_2d(_dst_2d, *dst);
+
+    // Split the gathering across the output depth slices, or across the rows when there are only a few slices
+    ITensorPack   gather_pack{{ACL_SRC, src}, {ACL_DST, gathered_src.get()}};
+    const Window &win = _gather_kernel->window();
+    const auto    split_dimension =
+        win.num_iterations(Window::DimW) >= NEScheduler::get().num_threads() ? Window::DimW : Window::DimZ;
+    NEScheduler::get().schedule_op(_gather_kernel.get(), split_dimension, win, gather_pack);
+
+    ITensorPack gemm_pack = tensors;
+    gemm_pack.add_const_tensor(ACL_SRC_0, gathered_src.get());
+    gemm_pack.add_tensor(ACL_DST, dst_2d.get());
+    _gemm_conv->run(gemm_pack);
+}
+
+experimental::MemoryRequirements CpuGemmConv3d::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUGEMMCONV3D_H
+#define ACL_SRC_CPU_OPERATORS_CPUGEMMCONV3D_H
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuOperator.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace cpu
+{
+class CpuGemmDirectConv2d;
+namespace kernels
+{
+class CpuConv3dDepthGatherKernel;
+} // namespace kernels
+
+/** Function to run a 3D convolution as an indirect GEMM.
+ *
+ * The input depth slices covered by the kernel are gathered along the channels, which lowers the 3D convolution to a
+ * 2D convolution over a batch of output depth slices. The latter runs through the assembly indirect GEMM, with the
+ * weights reshaped once in prepare.
+ *
+ * The gathered input holds kernel_z copies of the input, so validation fails when it would exceed 64MB and callers are
+ * expected to fall back to @ref CpuDirectConv3d.
+ *
+ *  This function calls the following kernels/functions:
+ *
+ * -# @ref kernels::CpuConv3dDepthGatherKernel
+ * -# @ref CpuGemmDirectConv2d
+ */
+class CpuGemmConv3d : public ICpuOperator
+{
+public:
+    CpuGemmConv3d();
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmConv3d);
+    ~CpuGemmConv3d();
+    /** Set the input, weights, biases and output tensor info.
+     *
+     * Valid data layouts:
+     * - NDHWC
+     *
+     * Valid data type configurations:
+     * |src0           |src1               |src2   |dst            |
+     * |:--------------|:------------------|:------|:--------------|
+     * |F16            |F16                |F16    |F16            |
+     * |F32            |F32                |F32    |F32            |
+     * |QASYMM8        |QASYMM8            |S32    |QASYMM8        |
+     * |QASYMM8_SIGNED |QASYMM8_SIGNED     |S32    |QASYMM8_SIGNED |
+     *
+     * @param[in]  src0      Input tensor info.
+     * @param[in]  src1      Set of kernels to convolve the input volume. Weights are 5D with dimensions
+     *                       [OFM, IFM, kernel_x, kernel_y, kernel_z] and must be constant.
+     * @param[in]  src2      Set of biases. Can be nullptr.
+     * @param[out] dst       Output tensor info.
+     * @param[in]  conv_info Contains padding, stride, activation information. Dilation is not supported.
+     */
+    void configure(const ITensorInfo *src0,
+                   const ITensorInfo *src1,
+                   const ITensorInfo *src2,
+                   ITensorInfo       *dst,
+                   const Conv3dInfo  &conv_info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmConv3d::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src0,
+                           const ITensorInfo *src1,
+                           const ITensorInfo *src2,
+                           const ITensorInfo *dst,
+                           const Conv3dInfo  &conv_info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        /* Slots 0-3 are reserved for CpuGemmDirectConv2d */
+        GatheredSrc = 4,
+        ReshapedWeights,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuConv3dDepthGatherKernel> _gather_kernel;
+    std::unique_ptr<CpuGemmDirectConv2d>                 _gemm_conv;
+    TensorInfo                                           _gathered_src{};
+    TensorInfo                                           _reshaped_weights{};
+    TensorInfo                                           _dst_2d{};
+    experimental::MemoryRequirements                     _aux_mem{};
+    bool                                                 _is_prepared{false};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUGEMMCONV3D_H
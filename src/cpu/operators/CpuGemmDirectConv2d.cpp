@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -240,6 +240,12 @@ void CpuGemmDirectConv2d::prepare(ITensorPack &tensors)
         // Call prepare of assembly dispatch
         _gemm_asm_func->prepare(tensors);
 
+        // Once pretransposed by the assembly dispatch, the original weights are not read anymore
+        if (_aux_mem[Pretranspose].size > 0)
+        {
+            weights->mark_as_unused();
+        }
+
         _is_prepared = true;
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,7 +74,7 @@ void CpuPool2d::configure(ITensorInfo *src, ITensorInfo *dst, const PoolingLayer
 
         auto pooling_wrapper = std::make_unique<kernels::CpuPool2dAssemblyWrapperKernel>();
         ARM_COMPUTE_ERROR_ON(pooling_wrapper == nullptr);
-        pooling_wrapper->configure(src, dst, pool_info, ci);
+        pooling_wrapper->configure(src, dst, pool_info, ci, num_threads);
 
         // Get kernel's memory requirements
         constexpr size_t alignment      = 4096;
@@ -114,8 +114,8 @@ void CpuPool2d::run(ITensorPack &tensors)
 
     if (_asm_glue)
     {
-        const auto hints = (_is_global_pooling_layer) ? Window::DimX : Window::DimY;
-        NEScheduler::get().schedule_op(_asm_glue.get(), hints, _asm_glue->window(), tensors);
+        _asm_glue->prepare_run();
+        NEScheduler::get().schedule_op(_asm_glue.get(), Window::DimX, _asm_glue->window(), tensors);
     }
     else
     {
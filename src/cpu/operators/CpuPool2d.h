@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,9 +38,13 @@ struct PoolingLayerInfo;
 
 namespace cpu
 {
+namespace kernels
+{
+class CpuPool2dAssemblyWrapperKernel;
+} // namespace kernels
+
 /** Basic function to simulate a pooling layer with the specified pooling operation. This function calls the following kernels:
  *
- * -# @ref NEFillBorderKernel (executed if padding size is different from zero)
  * -# @ref kernels::CpuPool2dKernel
  * -# @ref kernels::CpuPool2dAssemblyWrapperKernel
  */
@@ -77,8 +81,8 @@ public:
     experimental::MemoryRequirements workspace() const override;
 
 private:
-    std::unique_ptr<INEKernel> _pooling_layer_kernel;
-    std::unique_ptr<INEKernel> _asm_glue;
+    std::unique_ptr<INEKernel>                               _pooling_layer_kernel;
+    std::unique_ptr<kernels::CpuPool2dAssemblyWrapperKernel> _asm_glue;
 
     bool                             _is_global_pooling_layer;
     bool                             _use_kernel_indices;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,7 +28,9 @@
 #include "arm_compute/runtime/Scheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/kernels/CpuPool3dKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 using namespace arm_compute::experimental;
 
@@ -36,7 +38,7 @@ namespace arm_compute
 {
 namespace cpu
 {
-CpuPool3d::CpuPool3d() : _aux_mem(1)
+CpuPool3d::CpuPool3d() : _aux_mem(AuxTensorIdx::Count)
 {
 }
 
@@ -49,6 +51,13 @@ void CpuPool3d::configure(const ITensorInfo *src, ITensorInfo *dst, const Poolin
     // Configure pooling kernel
     auto k = std::make_unique<kernels::CpuPool3dKernel>();
     k->configure(src, dst, pool_info);
+
+    // Every thread keeps its own partially reduced row
+    _scratch_per_thread = k->get_scratch_size_per_thread();
+    _aux_mem[AuxTensorIdx::Scratch] =
+        MemoryInfo(offset_int_vec(AuxTensorIdx::Scratch), MemoryLifetime::Temporary,
+                   _scratch_per_thread * Scheduler::get().num_threads());
+
     _kernel = std::move(k);
 }
 
@@ -61,7 +70,18 @@ void CpuPool3d::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No tensors provided");
 
-    Scheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+    // A workspace smaller than what the current number of threads needs is replaced by a temporary one
+    TensorInfo scratch_info(TensorShape(_scratch_per_thread * Scheduler::get().num_threads()), 1, DataType::U8);
+    CpuAuxTensorHandler scratch(offset_int_vec(AuxTensorIdx::Scratch), scratch_info, tensors, true);
+
+    ITensorPack run_pack = tensors;
+    run_pack.add_tensor(TensorType::ACL_INT_0, scratch.get());
+
+    // Split across the output height or depth, so that the rows of the output are computed by a single thread
+    const Window &win = _kernel->window();
+    const auto    split_dimension =
+        win.num_iterations(Window::DimW) > win.num_iterations(Window::DimZ) ? Window::DimW : Window::DimZ;
+    Scheduler::get().schedule_op(_kernel.get(), split_dimension, win, run_pack);
 }
 
 experimental::MemoryRequirements CpuPool3d::workspace() const
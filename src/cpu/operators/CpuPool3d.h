@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #define ARM_COMPUTE_CPU_POOL3D_H
 
 #include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/TensorInfo.h"
 
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuOperator.h"
@@ -66,6 +67,13 @@ public:
     experimental::MemoryRequirements workspace() const override;
 
 private:
+    enum AuxTensorIdx
+    {
+        Scratch = 0,
+        Count
+    };
+
+    size_t                           _scratch_per_thread{0};
     experimental::MemoryRequirements _aux_mem{};
 };
 } // namespace cpu
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,8 +28,11 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/ScaleUtils.h"
 #include "src/cpu/kernels/CpuScaleKernel.h"
+#include "src/cpu/kernels/CpuScaleSeparableKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
 #include "support/Rounding.h"
 
 namespace arm_compute
@@ -100,8 +103,31 @@ void CpuScale::configure(ITensorInfo *src, ITensorInfo *dst, const ScaleKernelIn
     ARM_COMPUTE_ERROR_THROW_ON(CpuScale::validate(src, dst, info));
     ARM_COMPUTE_LOG_PARAMS(src, dst, info);
 
-    _scale_info  = info;
-    _is_prepared = false;
+    _scale_info    = info;
+    _is_prepared   = false;
+    _use_separable = false;
+    _aux_mem.clear();
+
+    // Resizes that can be computed in two separable passes do not need the per-element offsets and weights
+    if (bool(kernels::CpuScaleSeparableKernel::validate(src, dst, info)))
+    {
+        auto k = std::make_unique<kernels::CpuScaleSeparableKernel>();
+        k->configure(src, dst, info);
+
+        // Every thread caches its own resampled rows. The workspace is sized for the current number of threads
+        // and grown at run time if the scheduler has been given more threads since
+        _separable_scratch_per_thread = k->get_scratch_size_per_thread();
+        _separable_scratch =
+            TensorInfo(TensorShape(_separable_scratch_per_thread * NEScheduler::get().num_threads()), 1, DataType::U8);
+        _aux_mem.resize(AuxTensorIdx::Count);
+        _aux_mem[AuxTensorIdx::SeparableScratch] =
+            experimental::MemoryInfo(offset_int_vec(AuxTensorIdx::SeparableScratch),
+                                     experimental::MemoryLifetime::Temporary, _separable_scratch.total_size());
+
+        _use_separable = true;
+        _kernel        = std::move(k);
+        return;
+    }
 
     // Get data layout and width/height indices
     _data_layout        = _scale_info.data_layout == DataLayout::UNKNOWN ? src->data_layout() : _scale_info.data_layout;
@@ -163,6 +189,13 @@ Status CpuScale::validate(const ITensorInfo *src, const ITensorInfo *dst, const
     ARM_COMPUTE_RETURN_ERROR_ON(info.sampling_policy != SamplingPolicy::CENTER &&
                                 info.sampling_policy != SamplingPolicy::TOP_LEFT);
 
+    // Data type conversion and normalisation are only implemented by the separable kernel
+    const Status separable_status = kernels::CpuScaleSeparableKernel::validate(src, dst, info);
+    if (bool(separable_status) || src->data_type() != dst->data_type())
+    {
+        return separable_status;
+    }
+
     ITensorInfo *offsets = nullptr;
     ITensorInfo *dx      = nullptr;
     ITensorInfo *dy      = nullptr;
@@ -214,7 +247,13 @@ void CpuScale::prepare(ITensorPack &tensors)
 {
     if (!_is_prepared)
     {
-        _is_prepared       = true;
+        _is_prepared = true;
+        if (_use_separable)
+        {
+            // The separable kernel computes its taps at configuration
+            return;
+        }
+
         const auto src     = tensors.get_const_tensor(TensorType::ACL_SRC);
         auto       dst     = tensors.get_tensor(TensorType::ACL_DST);
         auto       dx      = tensors.get_tensor(TensorType::ACL_INT_0);
@@ -283,7 +322,26 @@ void CpuScale::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
     prepare(tensors);
+
+    if (_use_separable)
+    {
+        // A workspace smaller than what the current number of threads needs is replaced by a temporary one
+        TensorInfo scratch_info(
+            TensorShape(_separable_scratch_per_thread * NEScheduler::get().num_threads()), 1, DataType::U8);
+        CpuAuxTensorHandler scratch(offset_int_vec(AuxTensorIdx::SeparableScratch), scratch_info, tensors, true);
+
+        ITensorPack separable_pack = tensors;
+        separable_pack.add_tensor(TensorType::ACL_INT_3, scratch.get());
+        NEScheduler::get().schedule_op(_kernel.get(), Window::DimZ, _kernel->window(), separable_pack);
+        return;
+    }
+
     NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
 }
+
+experimental::MemoryRequirements CpuScale::workspace() const
+{
+    return _aux_mem;
+}
 } // namespace cpu
 } // namespace arm_compute
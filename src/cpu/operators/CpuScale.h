@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/ITensorInfo.h"
 #include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorInfo.h"
 
 #include "src/cpu/ICpuKernel.h"
 #include "src/cpu/ICpuOperator.h"
@@ -44,10 +45,11 @@ public:
     /** Initialize the function's source, destination, interpolation type and border_mode.
      *
      * @param[in, out] src  Source tensor info. Data type supported: QASYMM8/QASYMM8_SIGNED/U8/S16/F16/F32. (Written to only for @p border_mode != UNDEFINED)
-     * @param[out]     dst  Destination tensor info. Data type supported: Same as @p src. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
+     * @param[out]     dst  Destination tensor info. Data type supported: Same as @p src, or F16/F32 if @p src is U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in]      info @ref ScaleKernelInfo to be used for configuration
      *
      * @note Using S8 data type only supports NHWC, @p border_mode Replicate, and @p policy Bilinear
+     * @note NHWC resizes supported by @ref kernels::CpuScaleSeparableKernel are dispatched to it
      */
     void configure(ITensorInfo *src, ITensorInfo *dst, const ScaleKernelInfo &info);
     /** Static function to check if given info will lead to a valid configuration
@@ -61,8 +63,20 @@ public:
     // Inherited methods overridden:
     void prepare(ITensorPack &tensors) override;
     void run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
 
 private:
+    enum AuxTensorIdx
+    {
+        /* Slots 0 - 2 reserved for dx, dy and offsets */
+        SeparableScratch = 3,
+        Count
+    };
+
+    TensorInfo                       _separable_scratch{};
+    size_t                           _separable_scratch_per_thread{0};
+    experimental::MemoryRequirements _aux_mem{};
+    bool                             _use_separable{false};
     ScaleKernelInfo _scale_info{InterpolationPolicy::NEAREST_NEIGHBOR, BorderMode::UNDEFINED};
     DataLayout      _data_layout{DataLayout::UNKNOWN};
     bool            _is_prepared{false};
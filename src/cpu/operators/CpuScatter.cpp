@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,7 +28,9 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/kernels/CpuScatterKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 namespace arm_compute
 {
@@ -58,11 +60,18 @@ void CpuScatter::configure(const ITensorInfo *src,
         _copy_operator = std::move(j);
         _run_copy      = true;
     }
-    auto k = std::make_unique<kernels::CpuScatterKernel>();
+    _scatter_kernel = std::make_unique<kernels::CpuScatterKernel>();
+    _scatter_kernel->configure(updates, indices, dst, scatter_info);
 
-    k->configure(updates, indices, dst, scatter_info);
+    const size_t partition_size = _scatter_kernel->partition_size();
+    if (partition_size != 0)
+    {
+        _partition_info = TensorInfo(TensorShape(partition_size), 1, DataType::S32);
 
-    _kernel = std::move(k);
+        _aux_mem[AuxTensorIdx::Partition] = experimental::MemoryInfo(offset_int_vec(AuxTensorIdx::Partition),
+                                                                     experimental::MemoryLifetime::Temporary,
+                                                                     _partition_info.total_size());
+    }
 }
 
 Status CpuScatter::validate(const ITensorInfo *src,
@@ -101,7 +110,20 @@ void CpuScatter::run(ITensorPack &tensors)
         ITensorPack copy_pack{{ACL_SRC, src}, {ACL_DST, dst}};
         _copy_operator->run(copy_pack);
     }
-    NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+
+    CpuAuxTensorHandler partition(offset_int_vec(AuxTensorIdx::Partition), _partition_info, tensors, true);
+    if (_scatter_kernel->partition_size() != 0)
+    {
+        // Sort the updates by destination block, so that each block is owned by a single thread
+        _scatter_kernel->partition_updates(tensors);
+    }
+
+    NEScheduler::get().schedule_op(_scatter_kernel.get(), Window::DimX, _scatter_kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuScatter::workspace() const
+{
+    return _aux_mem;
 }
 } // namespace cpu
 } // namespace arm_compute
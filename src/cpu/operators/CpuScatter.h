@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Arm Limited.
+ * Copyright (c) 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,11 +24,13 @@
 #ifndef ACL_SRC_CPU_OPERATORS_CPUSCATTER_H
 #define ACL_SRC_CPU_OPERATORS_CPUSCATTER_H
 
+#include "arm_compute/core/experimental/Types.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/function_info/ScatterInfo.h"
 
-#include "src/cpu/ICpuKernel.h"
 #include "src/cpu/ICpuOperator.h"
+#include "src/cpu/kernels/CpuScatterKernel.h"
 #include "src/cpu/operators/CpuCopy.h"
 #include "src/cpu/operators/CpuFill.h"
 
@@ -36,7 +38,11 @@ namespace arm_compute
 {
 namespace cpu
 {
-/** Basic function to execute Scatter in Neon ™ */
+/** Basic function to execute Scatter in Neon ™
+ *
+ * Unless the indices are known to be unique, the updates are first sorted by destination block into
+ * an auxiliary tensor, then @ref kernels::CpuScatterKernel is split among threads by destination block.
+ */
 class CpuScatter : public ICpuOperator
 {
 public:
@@ -72,14 +78,23 @@ public:
                            const ScatterInfo &scatter_info);
 
     // Inherited methods overridden:
-    void run(ITensorPack &tensors) override;
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
 
 private:
-    std::unique_ptr<ICPPKernel>   _scatter_kernel{nullptr};
-    std::unique_ptr<cpu::CpuCopy> _copy_operator{nullptr};
-    std::unique_ptr<cpu::CpuFill> _fill_operator{nullptr};
-    bool                          _fill_zero{false};
-    bool                          _run_copy{false};
+    enum AuxTensorIdx
+    {
+        Partition = 0,
+        Count
+    };
+
+    std::unique_ptr<kernels::CpuScatterKernel> _scatter_kernel{nullptr};
+    std::unique_ptr<cpu::CpuCopy>              _copy_operator{nullptr};
+    std::unique_ptr<cpu::CpuFill>              _fill_operator{nullptr};
+    bool                                       _fill_zero{false};
+    bool                                       _run_copy{false};
+    TensorInfo                                 _partition_info{};
+    experimental::MemoryRequirements           _aux_mem{Count};
 };
 } // namespace cpu
 } // namespace arm_compute
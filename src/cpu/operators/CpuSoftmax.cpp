@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,12 +45,13 @@ CpuSoftmaxGeneric::CpuSoftmaxGeneric() : _softmax_kernel(), _tmp(), _aux_mem(Int
 {
 }
 
-void CpuSoftmaxGeneric::configure(const ITensorInfo *src, ITensorInfo *dst, float beta, int32_t axis, bool is_log)
+void CpuSoftmaxGeneric::configure(
+    const ITensorInfo *src, ITensorInfo *dst, float beta, int32_t axis, bool is_log, bool fast_math)
 {
     // Perform validation step
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
-    ARM_COMPUTE_ERROR_THROW_ON(CpuSoftmaxGeneric::validate(src, dst, beta, axis, is_log));
-    ARM_COMPUTE_LOG_PARAMS(src, dst, beta, axis);
+    ARM_COMPUTE_ERROR_THROW_ON(CpuSoftmaxGeneric::validate(src, dst, beta, axis, is_log, fast_math));
+    ARM_COMPUTE_LOG_PARAMS(src, dst, beta, axis, fast_math);
 
     const unsigned int actual_axis =
         static_cast<unsigned int>(wrap_around(axis, static_cast<int32_t>(src->num_dimensions())));
@@ -74,7 +75,7 @@ void CpuSoftmaxGeneric::configure(const ITensorInfo *src, ITensorInfo *dst, floa
     auto sm = std::make_unique<kernels::CpuSoftmaxKernel>();
 
     // Softmax 2D case
-    sm->configure(tmp_input, dst, beta, is_log, actual_axis, &_tmp);
+    sm->configure(tmp_input, dst, beta, is_log, actual_axis, &_tmp, fast_math);
 
     _softmax_kernel = std::move(sm);
 
@@ -85,8 +86,8 @@ void CpuSoftmaxGeneric::configure(const ITensorInfo *src, ITensorInfo *dst, floa
     }
 }
 
-Status
-CpuSoftmaxGeneric::validate(const ITensorInfo *src, const ITensorInfo *dst, float beta, int32_t axis, bool is_log)
+Status CpuSoftmaxGeneric::validate(
+    const ITensorInfo *src, const ITensorInfo *dst, float beta, int32_t axis, bool is_log, bool fast_math)
 {
     // Perform validation step
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
@@ -106,7 +107,7 @@ CpuSoftmaxGeneric::validate(const ITensorInfo *src, const ITensorInfo *dst, floa
         static_cast<unsigned int>(wrap_around(axis, static_cast<int32_t>(src->num_dimensions())));
 
     ARM_COMPUTE_RETURN_ON_ERROR(
-        kernels::CpuSoftmaxKernel::validate(src, dst, beta, actual_axis, is_log, &tensor_info_tmp));
+        kernels::CpuSoftmaxKernel::validate(src, dst, beta, actual_axis, is_log, &tensor_info_tmp, fast_math));
 
     return Status{};
 }
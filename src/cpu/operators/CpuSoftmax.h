@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -58,23 +58,34 @@ public:
     CpuSoftmaxGeneric();
     /** Set the input and output tensors.
      *
-     * @param[in,out] src    Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
-     *                       last value of each row to the nearest multiple.
-     * @param[out]    dst    Destination tensor ifo. Data types supported: same as @p input.
-     * @param[in]     beta   (Optional) A scaling factor for the exponent.
-     * @param[in]     axis   (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6 and
-     *                       axis=1, softmax will be applied to 4x6=24 vectors of size 5. Defaults to 0
-     * @param[in]     is_log True if the operation is log-softmax
+     * @param[in,out] src       Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     *                          last value of each row to the nearest multiple.
+     * @param[out]    dst       Destination tensor ifo. Data types supported: same as @p input.
+     * @param[in]     beta      (Optional) A scaling factor for the exponent.
+     * @param[in]     axis      (Optional) The dimension in which to apply the function. E.g. for input of shape 4x5x6
+     *                          and axis=1, softmax will be applied to 4x6=24 vectors of size 5. Defaults to 0
+     * @param[in]     is_log    True if the operation is log-softmax
+     * @param[in]     fast_math (Optional) Allow a faster, lower accuracy approximation of the exponential for F16/F32.
+     *                          Defaults to false.
      */
-    void configure(const ITensorInfo *src, ITensorInfo *dst, float beta = 1.0f, int32_t axis = 0, bool is_log = false);
+    void configure(const ITensorInfo *src,
+                   ITensorInfo       *dst,
+                   float              beta      = 1.0f,
+                   int32_t            axis      = 0,
+                   bool               is_log    = false,
+                   bool               fast_math = false);
     /** Static function to check if given info will lead to a valid configuration
      *
      * Similar to @ref CpuSoftmaxGeneric::configure()
      *
      * @return a status
      */
-    static Status
-    validate(const ITensorInfo *src, const ITensorInfo *dst, float beta = 1.0f, int32_t axis = 0, bool is_log = false);
+    static Status validate(const ITensorInfo *src,
+                           const ITensorInfo *dst,
+                           float              beta      = 1.0f,
+                           int32_t            axis      = 0,
+                           bool               is_log    = false,
+                           bool               fast_math = false);
 
     // Inherited methods overridden:
     void                             run(ITensorPack &tensors) override;
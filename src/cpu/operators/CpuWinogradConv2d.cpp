@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Arm Limited.
+ * Copyright (c) 2021-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -463,6 +463,9 @@ void CpuWinogradConv2d::prepare(ITensorPack &tensors)
             *_conv_args, permuted_weights_ptr, permuted_weight_row_stride, permuted_weight_col_stride,
             permuted_weight_channel_stride, win_wght_transf_ptr, _winograd_impl.winograd_spec, 0, 1 // Thread 1 of 1
         );
+        // The original weights are not read after the transform
+        weights->mark_as_unused();
+
         ITensorPack gemm_pack = tensors;
         gemm_pack.add_const_tensor(ACL_SRC_1, winograd_transformed_weights.get());
         _gemm_function->prepare(gemm_pack);
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/operators/CpuYUVPreprocess.h"
+
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuYUVPreprocessKernel.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+void CpuYUVPreprocess::configure(const ITensorInfo       *luma,
+                                 const ITensorInfo       *chroma0,
+                                 const ITensorInfo       *chroma1,
+                                 ITensorInfo             *dst,
+                                 const YUVPreprocessInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(luma, chroma0, dst);
+    ARM_COMPUTE_LOG_PARAMS(luma, chroma0, chroma1, dst, info);
+
+    auto k = std::make_unique<kernels::CpuYUVPreprocessKernel>();
+    k->configure(luma, chroma0, chroma1, dst, info);
+
+    // Every thread blends and resamples its rows in its own region of the working space
+    _scratch = TensorInfo(TensorShape(k->get_scratch_size_per_thread() * NEScheduler::get().num_threads()), 1,
+                          DataType::U8);
+    _aux_mem.resize(AuxTensorIdx::Count);
+    _aux_mem[AuxTensorIdx::Scratch] = experimental::MemoryInfo(
+        offset_int_vec(AuxTensorIdx::Scratch), experimental::MemoryLifetime::Temporary, _scratch.total_size());
+
+    _kernel = std::move(k);
+}
+
+Status CpuYUVPreprocess::validate(const ITensorInfo       *luma,
+                                  const ITensorInfo       *chroma0,
+                                  const ITensorInfo       *chroma1,
+                                  const ITensorInfo       *dst,
+                                  const YUVPreprocessInfo &info)
+{
+    return kernels::CpuYUVPreprocessKernel::validate(luma, chroma0, chroma1, dst, info);
+}
+
+void CpuYUVPreprocess::run(ITensorPack &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No inputs provided");
+
+    // Injects the working space in the pack as ACL_INT_0
+    CpuAuxTensorHandler scratch(offset_int_vec(AuxTensorIdx::Scratch), _scratch, tensors, true);
+
+    NEScheduler::get().schedule_op(_kernel.get(), Window::DimZ, _kernel->window(), tensors);
+}
+
+experimental::MemoryRequirements CpuYUVPreprocess::workspace() const
+{
+    return _aux_mem;
+}
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_OPERATORS_CPUYUVPREPROCESS_H
+#define ACL_SRC_CPU_OPERATORS_CPUYUVPREPROCESS_H
+
+#include "arm_compute/core/experimental/Types.h"
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/function_info/YUVPreprocessInfo.h"
+
+#include "src/cpu/ICpuOperator.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Basic function to turn a YUV frame into a normalised network input in Neon ™
+ *
+ * This function calls the following kernels:
+ *
+ * -# @ref kernels::CpuYUVPreprocessKernel
+ */
+class CpuYUVPreprocess : public ICpuOperator
+{
+public:
+    /** Initialise the kernel's inputs and output
+     *
+     * @param[in]  luma    Luma plane info of shape [W, H, N]. Data type supported: U8.
+     * @param[in]  chroma0 Chroma plane info. For NV12/NV21 the interleaved plane of shape [2 * ceil(W / 2), ceil(H / 2), N],
+     *                     for IYUV the Cb plane of shape [ceil(W / 2), ceil(H / 2), N]. Data type supported: U8.
+     * @param[in]  chroma1 Cr plane info of shape [ceil(W / 2), ceil(H / 2), N] for IYUV, nullptr otherwise. Data type supported: U8.
+     * @param[out] dst     Destination tensor info of shape [3, W_out, H_out, N]. Data types supported: F32/F16/QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  info    Preprocessing information described in @ref YUVPreprocessInfo.
+     */
+    void configure(const ITensorInfo       *luma,
+                   const ITensorInfo       *chroma0,
+                   const ITensorInfo       *chroma1,
+                   ITensorInfo             *dst,
+                   const YUVPreprocessInfo &info);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to @ref CpuYUVPreprocess::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo       *luma,
+                           const ITensorInfo       *chroma0,
+                           const ITensorInfo       *chroma1,
+                           const ITensorInfo       *dst,
+                           const YUVPreprocessInfo &info);
+
+    // Inherited methods overridden:
+    void                             run(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
+
+private:
+    enum AuxTensorIdx
+    {
+        Scratch = 0,
+        Count
+    };
+
+    TensorInfo                       _scratch{};
+    experimental::MemoryRequirements _aux_mem{};
+};
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_OPERATORS_CPUYUVPREPROCESS_H
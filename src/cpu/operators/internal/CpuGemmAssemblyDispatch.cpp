@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2025 Arm Limited.
+ * Copyright (c) 2018-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -723,6 +723,16 @@ void Fallback<TypeInput, TypeWeight, TypeOutput, OutputStage>::run(ITensorPack &
             }
         }
     }
+    else if (b_to_use && _B_pretranspose_required)
+    {
+        // The memory of the pretransposed B can be replaced after prepare(), e.g. by a copy shared between several
+        // instances of the same model, so bind it again from the tensor pack
+        const ITensor *pretranspose = tensors.get_const_tensor(offset_int_vec(Pretranspose));
+        if (pretranspose != nullptr && pretranspose->buffer() != nullptr)
+        {
+            _gemm_kernel_asm->set_pretransposed_B_data(pretranspose->buffer());
+        }
+    }
 
     // The scheduling_hint needs to be compatible with the window exposed by arm_gemm
     // The default case is when we split among the X dimension
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_SRC_CPU_UTILS_CPUCOSTMODEL_H
+#define ACL_SRC_CPU_UTILS_CPUCOSTMODEL_H
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/function_info/ActivationLayerInfo.h"
+
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace cpu
+{
+/** Amount of work done per element by a kernel */
+enum class ElementCost
+{
+    LIGHT, /**< A few arithmetic instructions per element, e.g. addition or ReLU */
+    HEAVY  /**< Transcendental functions per element, e.g. exponential or hyperbolic tangent */
+};
+
+/** Amount of work done per element by an activation function
+ *
+ * @param[in] act Activation function.
+ *
+ * @return The per-element cost class of @p act
+ */
+inline ElementCost activation_element_cost(ActivationLayerInfo::ActivationFunction act)
+{
+    switch (act)
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+        case ActivationLayerInfo::ActivationFunction::ELU:
+        case ActivationLayerInfo::ActivationFunction::GELU:
+        case ActivationLayerInfo::ActivationFunction::SOFT_RELU:
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            return ElementCost::HEAVY;
+        default:
+            return ElementCost::LIGHT;
+    }
+}
+
+/** Estimate the single-threaded execution time of a kernel visiting each element of a window once
+ *
+ * The per-element costs are derived from the thread count heuristics measured for the activation kernel on
+ * Neoverse V1, and scaled by an estimated factor on in-order cores.
+ *
+ * @param[in] platform The CPU platform used to create the context.
+ * @param[in] window   Region on which the kernel is going to be executed.
+ * @param[in] cost     Amount of work done per element.
+ *
+ * @return Estimated execution time in nanoseconds
+ */
+inline uint64_t estimate_elementwise_cost(const CPUInfo &platform, const Window &window, ElementCost cost)
+{
+    // Picoseconds per element on out-of-order cores
+    constexpr uint64_t light_cost_ps = 500;
+    constexpr uint64_t heavy_cost_ps = 5000;
+    // Slowdown of in-order cores
+    constexpr uint64_t in_order_factor = 3;
+
+    uint64_t num_elements = 1;
+    for (size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        num_elements *= static_cast<uint64_t>(window[d].end() - window[d].start());
+    }
+
+    uint64_t cost_ps = num_elements * (cost == ElementCost::HEAVY ? heavy_cost_ps : light_cost_ps);
+    switch (platform.get_cpu_model())
+    {
+        case CPUModel::A35:
+        case CPUModel::A53:
+        case CPUModel::A55r0:
+        case CPUModel::A55r1:
+        case CPUModel::A510:
+            cost_ps *= in_order_factor;
+            break;
+        default:
+            break;
+    }
+
+    return cost_ps / 1000;
+}
+} // namespace cpu
+} // namespace arm_compute
+#endif // ACL_SRC_CPU_UTILS_CPUCOSTMODEL_H
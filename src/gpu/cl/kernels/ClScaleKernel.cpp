@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,6 +77,8 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *dst, const
         !arm_compute::scale_utils::is_align_corners_allowed_sampling_policy(info.sampling_policy));
     ARM_COMPUTE_RETURN_ERROR_ON(is_data_type_quantized(src->data_type()) &&
                                 !is_data_type_quantized_asymmetric(src->data_type()));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!info.norm_mean.empty() || !info.norm_std.empty(),
+                                    "Normalisation is not supported");
 
     float            scale_x     = 0.f;
     float            scale_y     = 0.f;
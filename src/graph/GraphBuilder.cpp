@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -377,7 +377,8 @@ NodeID GraphBuilder::add_depthwise_convolution_node(Graph                     &g
                                                     ITensorAccessorUPtr        weights_accessor,
                                                     ITensorAccessorUPtr        bias_accessor,
                                                     const QuantizationInfo    &quant_info,
-                                                    const QuantizationInfo    &out_quant_info)
+                                                    const QuantizationInfo    &out_quant_info,
+                                                    FastMathHint               fast_math_hint)
 {
     check_nodeidx_pair(input, g);
     ARM_COMPUTE_ERROR_ON((kernel_spatial_extend.width == 0) || (kernel_spatial_extend.height == 0));
@@ -418,7 +419,8 @@ NodeID GraphBuilder::add_depthwise_convolution_node(Graph                     &g
     }
 
     // Create convolution node and connect
-    NodeID conv_nid = g.add_node<DepthwiseConvolutionLayerNode>(conv_info, depth_multiplier, method, out_quant_info);
+    NodeID conv_nid = g.add_node<DepthwiseConvolutionLayerNode>(conv_info, depth_multiplier, method, out_quant_info,
+                                                                fast_math_hint);
     g.add_connection(input.node_id, input.index, conv_nid, 0);
     g.add_connection(w_nid, 0, conv_nid, 1);
     if (has_bias)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -98,6 +98,15 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
     return _weights_managers;
 }
 
+void GraphContext::share_weights_managers(const GraphContext &ctx)
+{
+    for (const auto &wm_ctx : ctx._weights_managers)
+    {
+        WeightsManagerContext shared_ctx = wm_ctx.second;
+        insert_weights_management_ctx(std::move(shared_ctx));
+    }
+}
+
 void GraphContext::finalize()
 {
     const size_t num_pools = 1;
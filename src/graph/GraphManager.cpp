@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -155,5 +155,13 @@ void GraphManager::invalidate_graph(Graph &graph)
 
     _workloads.erase(it);
 }
+
+MemoryFootprint GraphManager::memory_footprint(Graph &graph)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    return detail::memory_footprint(it->second);
+}
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -92,6 +92,9 @@ Status CLNodeValidator::validate(INode *node)
         case NodeType::DetectionPostProcessLayer:
             return detail::validate_detection_post_process_layer<CPPDetectionPostProcessLayer>(
                 *polymorphic_downcast<DetectionPostProcessLayerNode *>(node));
+        case NodeType::FusedElementwiseLayer:
+            return ARM_COMPUTE_CREATE_ERROR(arm_compute::ErrorCode::RUNTIME_ERROR,
+                                            "Unsupported operation : FusedElementwiseLayer");
         case NodeType::GenerateProposalsLayer:
             return detail::validate_generate_proposals_layer<CLGenerateProposalsLayer>(
                 *polymorphic_downcast<GenerateProposalsLayerNode *>(node));
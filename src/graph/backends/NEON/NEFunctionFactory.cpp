@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021,2023 Arm Limited.
+ * Copyright (c) 2018-2021,2023,2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -113,6 +113,53 @@ std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETa
 
     return func;
 }
+
+template <>
+std::unique_ptr<IFunction>
+create_depthwise_convolution_layer<NEDepthwiseConvolutionLayer, NETargetInfo>(DepthwiseConvolutionLayerNode &node)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+
+    const bool is_quantized = is_data_type_quantized_asymmetric(input->info()->data_type());
+
+    if (is_quantized)
+    {
+        biases->info()->set_data_type(DataType::S32);
+    }
+
+    const PadStrideInfo       conv_info        = node.convolution_info();
+    const unsigned int        depth_multiplier = node.depth_multiplier();
+    const ActivationLayerInfo fused_act        = node.fused_activation();
+    const bool                fast_math        = node.fast_math_hint() == FastMathHint::Enabled;
+
+    // Create and configure function
+    auto func = std::make_unique<NEDepthwiseConvolutionLayer>();
+    func->configure(input, weights, biases, output, conv_info, depth_multiplier, fused_act, Size2D(1U, 1U), fast_math);
+
+    // Log info
+    std::ostringstream qss;
+    if (is_quantized)
+    {
+        qss << " Input QuantInfo: " << input->info()->quantization_info()
+            << " Weights QuantInfo: " << weights->info()->quantization_info()
+            << " Output QuantInfo: " << output->info()->quantization_info();
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name() << " Type: " << node.type() << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type() << " Input shape: "
+                               << input->info()->tensor_shape() << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Depth multiplier: " << depth_multiplier << qss.str()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
+                               << (fast_math ? " Fast math enabled" : "") << std::endl);
+    return func;
+}
 } // namespace detail
 
 std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &ctx)
@@ -180,6 +227,9 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes,
                                                                                         NETargetInfo>(
                 *polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedElementwiseLayer:
+            return detail::create_fused_elementwise_layer<NEFusedElementwise, NETargetInfo>(
+                *polymorphic_downcast<FusedElementwiseLayerNode *>(node));
         case NodeType::L2NormalizeLayer:
             return detail::create_l2_normalize_layer<NEL2NormalizeLayer, NETargetInfo>(
                 *polymorphic_downcast<L2NormalizeLayerNode *>(node), ctx);
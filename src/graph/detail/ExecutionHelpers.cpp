@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,11 +24,18 @@
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
 
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/Edge.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/ILifetimeManager.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/IPoolManager.h"
+
+#include <map>
+#include <set>
 
 namespace arm_compute
 {
@@ -36,6 +43,31 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+size_t padding_bytes(const ITensorInfo &info)
+{
+    return info.total_size() - info.tensor_shape().total_size() * info.element_size();
+}
+
+/** Consumers of a constant tensor left to prepare */
+struct ConstTensorUses
+{
+    size_t pending{0};        /**< Number of consumers not prepared yet */
+    bool   consumed{true};    /**< Whether all the prepared consumers hold their own copy of the tensor */
+    bool   is_managed{false}; /**< Whether the tensor is managed by a weights manager */
+};
+
+size_t pool_bytes(const std::shared_ptr<IMemoryManager> &mm)
+{
+    if (mm == nullptr || mm->lifetime_manager() == nullptr || mm->pool_manager() == nullptr)
+    {
+        return 0;
+    }
+    return mm->lifetime_manager()->pool_size() * mm->pool_manager()->num_pools();
+}
+} // namespace
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -222,10 +254,82 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload)
 void prepare_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+    Graph &g = *workload.graph;
+
+    std::set<const INode *> task_nodes;
+    for (auto &task : workload.tasks)
+    {
+        task_nodes.insert(task.node);
+    }
+
+    // Constant tensors are released once all their consumers hold a transformed copy of them. The consumers that
+    // prepare first would otherwise free them while the others still need them. Weights managed by a weights manager
+    // are left to its reference counting.
+    std::map<Tensor *, ConstTensorUses> const_uses;
+    for (auto &node : g.nodes())
+    {
+        if (node == nullptr || node->type() != NodeType::Const || node->num_outputs() == 0)
+        {
+            continue;
+        }
+        Tensor *tensor = node->output(0);
+        if (tensor == nullptr || tensor->handle() == nullptr || tensor->bound_edges().empty())
+        {
+            continue;
+        }
+
+        ConstTensorUses         uses{};
+        std::set<const INode *> consumers;
+        for (auto &eid : tensor->bound_edges())
+        {
+            const Edge *e = g.edge(eid);
+            if (e != nullptr && e->consumer() != nullptr)
+            {
+                consumers.insert(e->consumer());
+                uses.consumed = uses.consumed && task_nodes.count(e->consumer()) != 0;
+            }
+        }
+        uses.pending = consumers.size();
+
+        const WeightsManagerContext *wm_ctx = workload.ctx->weights_management_ctx(tensor->desc().target);
+        uses.is_managed =
+            wm_ctx != nullptr && wm_ctx->wm != nullptr && wm_ctx->wm->are_weights_managed(&tensor->handle()->tensor());
+
+        const_uses.emplace(tensor, uses);
+    }
+
     for (auto &task : workload.tasks)
     {
         task.prepare();
-        release_unused_tensors(*workload.graph);
+
+        std::set<Tensor *> inputs;
+        for (unsigned int i = 0; task.node != nullptr && i < task.node->num_inputs(); ++i)
+        {
+            inputs.insert(task.node->input(i));
+        }
+        for (auto *input : inputs)
+        {
+            auto it = const_uses.find(input);
+            if (it == const_uses.end() || it->second.is_managed)
+            {
+                continue;
+            }
+
+            ConstTensorUses &uses   = it->second;
+            const ITensor   &tensor = input->handle()->tensor();
+            uses.consumed           = uses.consumed && !tensor.is_used();
+            if (--uses.pending == 0 && uses.consumed)
+            {
+                tensor.mark_as_unused();
+            }
+            else
+            {
+                tensor.mark_as_used();
+            }
+        }
+
+        release_unused_tensors(g);
     }
 }
 
@@ -272,6 +376,104 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload)
 
     return is_valid;
 }
+
+MemoryFootprint memory_footprint(ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+
+    MemoryFootprint footprint{};
+
+    // Prepared weights and workspaces of the functions, the constant inputs they report are graph tensors
+    MemoryFootprint functions{};
+    for (auto &task : workload.tasks)
+    {
+        if (task.task)
+        {
+            const MemoryFootprint task_footprint = task.task->memory_footprint();
+            functions.prepared_weights += task_footprint.prepared_weights;
+            functions.workspace += task_footprint.workspace;
+            functions.prepare_workspace += task_footprint.prepare_workspace;
+            functions.num_allocations += task_footprint.num_allocations - (task_footprint.const_weights != 0 ? 1 : 0);
+        }
+    }
+    footprint += functions;
+
+    // Memory managed by the context pools replaces the per-function and per-tensor sizes
+    size_t intra_pools      = 0;
+    size_t cross_pools      = 0;
+    size_t num_pools_allocs = 0;
+    for (auto &mm_ctx : workload.ctx->memory_managers())
+    {
+        const size_t intra = pool_bytes(mm_ctx.second.intra_mm);
+        const size_t cross = pool_bytes(mm_ctx.second.cross_mm);
+        intra_pools += intra;
+        cross_pools += cross;
+        num_pools_allocs += (intra != 0 ? mm_ctx.second.intra_mm->pool_manager()->num_pools() : 0) +
+                            (cross != 0 ? mm_ctx.second.cross_mm->pool_manager()->num_pools() : 0);
+    }
+    if (intra_pools != 0)
+    {
+        footprint.workspace = intra_pools;
+    }
+    footprint.transition += cross_pools;
+    footprint.num_allocations += num_pools_allocs;
+
+    // Graph tensors: constants, plus the transition buffers not served by the transition pool
+    std::set<TensorID> const_tensors;
+    std::set<TensorID> io_tensors;
+    for (auto &node : workload.graph->nodes())
+    {
+        if (node == nullptr)
+        {
+            continue;
+        }
+        for (unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            if (node->type() == NodeType::Const)
+            {
+                const_tensors.insert(node->output_id(i));
+            }
+            else if (node->type() == NodeType::Input)
+            {
+                io_tensors.insert(node->output_id(i));
+            }
+        }
+        for (unsigned int i = 0; node->type() == NodeType::Output && i < node->num_inputs(); ++i)
+        {
+            io_tensors.insert(node->input_id(i));
+        }
+    }
+
+    for (auto &tensor : workload.graph->tensors())
+    {
+        if (tensor == nullptr || tensor->handle() == nullptr || tensor->handle()->is_subtensor() ||
+            tensor->bound_edges().empty() || !tensor->handle()->tensor().is_used())
+        {
+            continue;
+        }
+
+        const ITensorInfo &info     = *tensor->handle()->tensor().info();
+        const bool         is_const = const_tensors.count(tensor->id()) != 0;
+        if (!is_const && cross_pools != 0 && io_tensors.count(tensor->id()) == 0)
+        {
+            continue;
+        }
+
+        if (is_const)
+        {
+            footprint.const_weights += info.total_size();
+        }
+        else
+        {
+            footprint.transition += info.total_size();
+        }
+        footprint.padding += padding_bytes(info);
+        ++footprint.num_allocations;
+    }
+
+    return footprint;
+}
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,11 +43,23 @@ void Stream::finalize(Target target, const GraphConfig &config)
     _manager.finalize_graph(_g, _ctx, pm, target);
 }
 
+void Stream::finalize(Target target, const GraphConfig &config, const Stream &model)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!config.use_function_weights_manager, "Replicas share weights through weights managers");
+    _ctx.share_weights_managers(model._ctx);
+    finalize(target, config);
+}
+
 void Stream::run()
 {
     _manager.execute_graph(_g);
 }
 
+MemoryFootprint Stream::memory_footprint()
+{
+    return _manager.memory_footprint(_g);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -69,8 +69,12 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
 
             // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2)
             auto *concat_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
-            if (output_tensor == nullptr ||
-                get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis()) < 2)
+            if (output_tensor == nullptr)
+            {
+                continue;
+            }
+            const size_t axis_idx = get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis());
+            if (axis_idx < 2)
             {
                 continue;
             }
@@ -91,19 +95,22 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
                 ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : "
                                               << node->id() << " and name : " << node->name() << std::endl);
                 // Create sub-tensor handles
-                unsigned depth = 0;
+                unsigned offset = 0;
                 for (unsigned int i = 0; i < node->input_edges().size(); ++i)
                 {
                     auto       input_tensor = node->input(i);
                     const auto input_shape  = input_tensor->desc().shape;
 
+                    Coordinates coords;
+                    coords.set(axis_idx, offset);
+
                     backends::IDeviceBackend &backend =
                         backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
                     std::unique_ptr<ITensorHandle> handle =
-                        backend.create_subtensor(output_tensor->handle(), input_shape, Coordinates(0, 0, depth), false);
+                        backend.create_subtensor(output_tensor->handle(), input_shape, coords, false);
                     input_tensor->set_handle(std::move(handle));
 
-                    depth += input_shape.z();
+                    offset += input_shape[axis_idx];
                 }
 
                 auto *dc_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
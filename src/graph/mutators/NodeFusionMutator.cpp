@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
 
 #include "arm_compute/core/utils/DataTypeUtils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/GraphBuilder.h"
 #include "arm_compute/graph/Logger.h"
@@ -34,6 +35,7 @@
 #include "src/graph/mutators/MutatorUtils.h"
 #include "support/Cast.h"
 
+#include <algorithm>
 #include <list>
 #include <set>
 
@@ -364,6 +366,230 @@ void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse
         }
     }
 }
+
+/** Chain of element-wise nodes and the expression evaluating it */
+struct ElementwiseChain
+{
+    ElementwiseExpression    expression{};  /**< Expression evaluating the chain */
+    std::vector<NodeIdxPair> inputs{};      /**< Outputs of the nodes outside the chain read by the expression */
+    std::vector<int32_t>     input_nodes{}; /**< Expression node reading each input */
+    std::vector<INode *>     nodes{};       /**< Nodes of the chain */
+    int32_t                  result{-1};    /**< Expression node holding the output of the last node of the chain */
+};
+
+bool is_fusable_elementwise_node(const INode                &node,
+                                 DataType                    data_type,
+                                 const std::set<Activation> &supported_activations)
+{
+    if (node.assigned_target() != Target::NEON || node.num_outputs() != 1 || node.output(0) == nullptr ||
+        node.output(0)->desc().data_type != data_type)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        if (node.input(i) == nullptr || node.input(i)->desc().data_type != data_type)
+        {
+            return false;
+        }
+    }
+
+    auto is_supported_activation = [&](const ActivationLayerInfo &act_info)
+    { return !act_info.enabled() || supported_activations.count(act_info.activation()) != 0; };
+
+    switch (node.type())
+    {
+        case NodeType::EltwiseLayer:
+            return is_supported_activation(
+                arm_compute::utils::cast::polymorphic_downcast<const EltwiseLayerNode *>(&node)->fused_activation());
+        case NodeType::UnaryEltwiseLayer:
+        {
+            const auto descriptor =
+                arm_compute::utils::cast::polymorphic_downcast<const UnaryEltwiseLayerNode *>(&node)
+                    ->eltwise_descriptor();
+            return descriptor.op == UnaryEltwiseOperation::Exp && is_supported_activation(descriptor.fused_activation);
+        }
+        case NodeType::ActivationLayer:
+            return is_supported_activation(
+                arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node)->activation_info());
+        default:
+            return false;
+    }
+}
+
+ElementwiseExpressionOp to_expression_op(EltwiseOperation op)
+{
+    switch (op)
+    {
+        case EltwiseOperation::Add:
+            return ElementwiseExpressionOp::ADD;
+        case EltwiseOperation::Sub:
+            return ElementwiseExpressionOp::SUB;
+        case EltwiseOperation::Mul:
+            return ElementwiseExpressionOp::MUL;
+        case EltwiseOperation::Max:
+            return ElementwiseExpressionOp::MAX;
+        case EltwiseOperation::Div:
+            return ElementwiseExpressionOp::DIV;
+        case EltwiseOperation::Min:
+            return ElementwiseExpressionOp::MIN;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported element-wise operation");
+    }
+}
+
+/** Appends a node to a chain
+ *
+ * Inputs produced by the previous node of the chain are read from the expression, the others become inputs of
+ * the expression. The same tensor read several times is only an input once.
+ *
+ * @return False if the resulting expression is too large for the fused elementwise operator
+ */
+bool append_to_elementwise_chain(ElementwiseChain &chain, INode &node)
+{
+    ElementwiseChain     new_chain = chain;
+    std::vector<int32_t> operands;
+    for (size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        ARM_COMPUTE_ERROR_ON(edge == nullptr);
+        if (!new_chain.nodes.empty() && edge->producer_id() == new_chain.nodes.back()->id())
+        {
+            operands.push_back(new_chain.result);
+            continue;
+        }
+
+        const auto it =
+            std::find_if(new_chain.inputs.begin(), new_chain.inputs.end(), [&](const NodeIdxPair &input)
+                         { return input.node_id == edge->producer_id() && input.index == edge->producer_idx(); });
+        if (it == new_chain.inputs.end())
+        {
+            new_chain.input_nodes.push_back(
+                new_chain.expression.input(static_cast<uint32_t>(new_chain.inputs.size())));
+            new_chain.inputs.push_back(NodeIdxPair{edge->producer_id(), edge->producer_idx()});
+            operands.push_back(new_chain.input_nodes.back());
+        }
+        else
+        {
+            operands.push_back(new_chain.input_nodes[std::distance(new_chain.inputs.begin(), it)]);
+        }
+    }
+
+    ElementwiseExpression &expr = new_chain.expression;
+    ActivationLayerInfo    fused_activation{};
+    switch (node.type())
+    {
+        case NodeType::EltwiseLayer:
+        {
+            const auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(&node);
+            new_chain.result =
+                expr.binary(to_expression_op(eltwise_node->eltwise_operation()), operands[0], operands[1]);
+            fused_activation = eltwise_node->fused_activation();
+            break;
+        }
+        case NodeType::UnaryEltwiseLayer:
+        {
+            const auto *unary_node = arm_compute::utils::cast::polymorphic_downcast<UnaryEltwiseLayerNode *>(&node);
+            new_chain.result       = expr.unary(ElementwiseExpressionOp::EXP, operands[0]);
+            fused_activation       = unary_node->eltwise_descriptor().fused_activation;
+            break;
+        }
+        case NodeType::ActivationLayer:
+            fused_activation =
+                arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(&node)->activation_info();
+            new_chain.result = operands[0];
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported node type");
+    }
+    if (fused_activation.enabled())
+    {
+        new_chain.result = expr.activation(new_chain.result, fused_activation);
+    }
+    new_chain.nodes.push_back(&node);
+
+    if (expr.nodes().size() > elementwise_expression_max_nodes ||
+        new_chain.inputs.size() > elementwise_expression_max_inputs)
+    {
+        return false;
+    }
+    chain = std::move(new_chain);
+    return true;
+}
+
+void fuse_elementwise_chains(Graph &g, const std::set<Activation> &supported_activations)
+{
+    // Visiting the nodes in topological order makes every chain start from its first node
+    for (const NodeID id : dfs(g))
+    {
+        INode *head = g.node(id);
+        if (head == nullptr || head->num_outputs() != 1 || head->output(0) == nullptr)
+        {
+            continue;
+        }
+        const DataType data_type = head->output(0)->desc().data_type;
+        if ((data_type != DataType::F32 && data_type != DataType::F16) ||
+            !is_fusable_elementwise_node(*head, data_type, supported_activations))
+        {
+            continue;
+        }
+
+        // Grow the chain while the output of its last node is only read by another fusable node
+        ElementwiseChain chain;
+        INode           *node = head;
+        while (append_to_elementwise_chain(chain, *node))
+        {
+            if (node->output_edges().size() != 1 || node->output(0)->accessor() != nullptr)
+            {
+                break;
+            }
+            INode *next = g.edge(*node->output_edges().begin())->consumer();
+            if (next == nullptr || !is_fusable_elementwise_node(*next, data_type, supported_activations))
+            {
+                break;
+            }
+            node = next;
+        }
+
+        INode *tail = chain.nodes.empty() ? nullptr : chain.nodes.back();
+        if (chain.nodes.size() < 2 || tail->output_edges().empty())
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing " << chain.nodes.size() << " element-wise nodes starting with ID : "
+                                                << head->id() << " into a single node" << std::endl);
+
+        const Target assigned_target = head->assigned_target();
+        std::string  fused_name;
+        for (const INode *n : chain.nodes)
+        {
+            if (!n->name().empty())
+            {
+                fused_name += (fused_name.empty() ? "" : "+") + n->name();
+            }
+        }
+
+        // Create the fused node and connect it to the inputs of the chain
+        const NodeID fused_id = g.add_node<FusedElementwiseLayerNode>(chain.expression);
+        for (size_t i = 0; i < chain.inputs.size(); ++i)
+        {
+            g.add_connection(chain.inputs[i].node_id, chain.inputs[i].index, fused_id, i);
+        }
+
+        auto fused_node = g.node(fused_id);
+        transfer_driving_nodes_and_remove_old_node(g, fused_node, tail, true);
+
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{fused_name, assigned_target});
+
+        // Remove the remaining nodes of the chain
+        for (size_t i = 0; i < chain.nodes.size() - 1; ++i)
+        {
+            g.remove_node(chain.nodes[i]->id());
+        }
+    }
+}
 } // namespace detail
 
 const char *NodeFusionMutator::name()
@@ -386,6 +612,14 @@ void NodeFusionMutator::mutate(Graph &g)
         Activation::RELU,       Activation::SOFT_RELU,    Activation::SQRT,
         Activation::SQUARE,     Activation::TANH};
 
+    // Supported activations when fusing chains of element-wise nodes
+    const std::set<Activation> supported_fused_elementwise_activations = {
+        Activation::ABS,        Activation::BOUNDED_RELU, Activation::ELU,
+        Activation::HARD_SWISH, Activation::IDENTITY,     Activation::LEAKY_RELU,
+        Activation::LINEAR,     Activation::LOGISTIC,     Activation::LU_BOUNDED_RELU,
+        Activation::RELU,       Activation::SOFT_RELU,    Activation::SQUARE,
+        Activation::SWISH,      Activation::TANH};
+
     // Preconditions
     auto empty_prec     = [](INode &) { return true; };
     auto cl_target_prec = [](INode &n) { return n.assigned_target() == Target::CL; };
@@ -423,6 +657,8 @@ void NodeFusionMutator::mutate(Graph &g)
         g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(
         g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    // Remaining chains of element-wise and activation nodes on Neon are evaluated by a single fused node
+    detail::fuse_elementwise_chains(g, supported_fused_elementwise_activations);
 }
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019, 2021 Arm Limited.
+ * Copyright (c) 2018-2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,11 +35,13 @@ namespace graph
 DepthwiseConvolutionLayerNode::DepthwiseConvolutionLayerNode(PadStrideInfo              info,
                                                              int                        depth_multiplier,
                                                              DepthwiseConvolutionMethod method,
-                                                             QuantizationInfo           out_quant_info)
+                                                             QuantizationInfo           out_quant_info,
+                                                             FastMathHint               fast_math_hint)
     : _info(std::move(info)),
       _depth_multiplier(depth_multiplier),
       _method(method),
       _out_quant_info(std::move(out_quant_info)),
+      _fast_math_hint(fast_math_hint),
       _fused_activation()
 {
     _input_edges.resize(3, EmptyEdgeID);
@@ -61,6 +63,16 @@ DepthwiseConvolutionMethod DepthwiseConvolutionLayerNode::depthwise_convolution_
     return _method;
 }
 
+void DepthwiseConvolutionLayerNode::set_fast_math_hint(FastMathHint hint)
+{
+    _fast_math_hint = hint;
+}
+
+FastMathHint DepthwiseConvolutionLayerNode::fast_math_hint() const
+{
+    return _fast_math_hint;
+}
+
 PadStrideInfo DepthwiseConvolutionLayerNode::convolution_info() const
 {
     return _info;
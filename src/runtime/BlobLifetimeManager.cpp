@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include <cmath>
 #include <iterator>
 #include <map>
+#include <numeric>
 
 namespace arm_compute
 {
@@ -55,6 +56,12 @@ MappingType BlobLifetimeManager::mapping_type() const
     return MappingType::BLOBS;
 }
 
+size_t BlobLifetimeManager::pool_size() const
+{
+    return std::accumulate(std::begin(_blobs), std::end(_blobs), size_t(0),
+                           [](size_t total, const BlobInfo &b) { return total + b.size; });
+}
+
 void BlobLifetimeManager::update_blobs_and_mappings()
 {
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CommandList.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/ITensorPack.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/MemoryFootprint.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Tensor aliasing the buffer and metadata another tensor had at record time */
+class FrozenTensor final : public ITensor
+{
+public:
+    explicit FrozenTensor(const ITensor &tensor) : _info(tensor.info()->clone()), _buffer(tensor.buffer())
+    {
+    }
+    ITensorInfo *info() const override
+    {
+        return _info.get();
+    }
+    ITensorInfo *info() override
+    {
+        return _info.get();
+    }
+    uint8_t *buffer() const override
+    {
+        return _buffer;
+    }
+
+private:
+    std::unique_ptr<ITensorInfo> _info;
+    uint8_t                     *_buffer;
+};
+
+/** Recorded kernel dispatch */
+class Command
+{
+public:
+    Command(ICPPKernel *kernel, const ITensorPack &tensors) : _kernel(kernel)
+    {
+        for (const auto &element : tensors)
+        {
+            const ITensor *src = element.second.tensor != nullptr ? element.second.tensor : element.second.ctensor;
+            if (src == nullptr)
+            {
+                continue;
+            }
+            _frozen.emplace_back(std::make_unique<FrozenTensor>(*src));
+            if (element.second.tensor != nullptr)
+            {
+                _tensors.add_tensor(element.first, _frozen.back().get());
+            }
+            else
+            {
+                _tensors.add_const_tensor(element.first, _frozen.back().get());
+            }
+        }
+    }
+
+    /** Add a sub-window to execute
+     *
+     * @param[in] window Sub-window.
+     */
+    void add_window(const Window &window)
+    {
+        window.validate();
+        _windows.push_back(window);
+    }
+
+    /** Add a sub-window to execute when the kernel is split along all dimensions
+     *
+     * @param[in] window         Sub-window.
+     * @param[in] thread_locator Position of the sub-window in the split.
+     */
+    void add_window(const Window &window, const Window &thread_locator)
+    {
+        add_window(window);
+        thread_locator.validate();
+        _thread_locators.push_back(thread_locator);
+    }
+
+    /** Create the workloads running the sub-windows
+     *
+     * @note Must be called once all the sub-windows have been added and the command is at its final address.
+     */
+    void finalize()
+    {
+        if (_windows.size() > 1)
+        {
+            _workloads.reserve(_windows.size());
+            for (unsigned int t = 0; t < _windows.size(); ++t)
+            {
+                _workloads.emplace_back([this, t](const ThreadInfo &info) { run(t, info); });
+            }
+        }
+    }
+
+    void execute(IScheduler &scheduler)
+    {
+        if (_workloads.empty())
+        {
+            ThreadInfo info;
+            info.cpu_info = &scheduler.cpu_info();
+            run(0, info);
+        }
+        else
+        {
+            scheduler.run_tagged_workloads(_workloads, _kernel->name());
+        }
+    }
+
+private:
+    void run(unsigned int t, const ThreadInfo &info)
+    {
+        if (!_tensors.empty())
+        {
+            _kernel->run_op(_tensors, _windows[t], info);
+        }
+        else if (!_thread_locators.empty())
+        {
+            _kernel->run_nd(_windows[t], info, _thread_locators[t]);
+        }
+        else
+        {
+            _kernel->run(_windows[t], info);
+        }
+    }
+
+    ICPPKernel                                *_kernel;
+    ITensorPack                                _tensors{};
+    std::vector<std::unique_ptr<FrozenTensor>> _frozen{};
+    std::vector<Window>                        _windows{};
+    std::vector<Window>                        _thread_locators{};
+    std::vector<IScheduler::Workload>          _workloads{};
+};
+
+/** Number of host buffers freed since the start of the process */
+size_t num_freed_buffers()
+{
+    const AllocationCounters counters = allocation_counters();
+    return counters.total_allocations - counters.live_allocations;
+}
+
+/** Kernel dispatches recorded by a command list */
+struct CommandStore
+{
+    std::vector<std::unique_ptr<Command>> commands{};
+    bool                                  replayable{true};
+};
+
+/** Scheduler recording the kernels dispatched through it into a command list
+ *
+ * Each dispatch is split with the generic scheduler logic, recorded and then executed by the wrapped scheduler.
+ */
+class RecordingScheduler final : public IScheduler
+{
+public:
+    RecordingScheduler(IScheduler &scheduler, CommandStore &list) : _scheduler(scheduler), _list(&list)
+    {
+    }
+    void detach()
+    {
+        _list = nullptr;
+    }
+    void set_num_threads(unsigned int num_threads) override
+    {
+        _scheduler.set_num_threads(num_threads);
+    }
+    unsigned int num_threads() const override
+    {
+        return _scheduler.num_threads();
+    }
+    void schedule(ICPPKernel *kernel, const Hints &hints) override
+    {
+        ITensorPack tensors;
+        schedule_op(kernel, hints, kernel->window(), tensors);
+    }
+    void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override
+    {
+        ARM_COMPUTE_ERROR_ON(kernel == nullptr);
+        if (_list == nullptr)
+        {
+            _scheduler.schedule_op(kernel, hints, window, tensors);
+            return;
+        }
+
+        auto command = std::make_unique<Command>(kernel, tensors);
+        if (hints.split_dimension() == IScheduler::split_dimensions_all)
+        {
+            unsigned int m_threads, n_threads;
+            std::tie(m_threads, n_threads) = num_windows_2d(window);
+            for (unsigned int ni = 0; ni != n_threads; ++ni)
+            {
+                for (unsigned int mi = 0; mi != m_threads; ++mi)
+                {
+                    Window thread_locator;
+                    thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
+                    thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
+                    command->add_window(window.split_window(Window::DimX, mi, m_threads)
+                                            .split_window(Window::DimY, ni, n_threads),
+                                        thread_locator);
+                }
+            }
+        }
+        else
+        {
+            const unsigned int num_windows = num_windows_1d(*kernel, hints, window);
+            if (num_windows == 0)
+            {
+                return;
+            }
+            for (unsigned int t = 0; t < num_windows; ++t)
+            {
+                command->add_window(num_windows == 1 ? window
+                                                     : window.split_window(hints.split_dimension(), t, num_windows));
+            }
+        }
+        command->finalize();
+        command->execute(_scheduler);
+        _list->commands.emplace_back(std::move(command));
+    }
+    void run_tagged_workloads(std::vector<Workload> &workloads, const char *tag) override
+    {
+        if (_list != nullptr)
+        {
+            _list->replayable = false;
+        }
+        _scheduler.run_tagged_workloads(workloads, tag);
+    }
+
+protected:
+    void run_workloads(std::vector<Workload> &workloads) override
+    {
+        run_tagged_workloads(workloads, nullptr);
+    }
+
+private:
+    IScheduler   &_scheduler;
+    CommandStore *_list;
+};
+
+/** Install a recording scheduler for the lifetime of the object and restore the previous one afterwards */
+class RecordingScope
+{
+public:
+    explicit RecordingScope(CommandStore &list) : _type(Scheduler::get_type())
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(_type == Scheduler::Type::CUSTOM,
+                                 "Recording with a custom scheduler is not supported");
+        _recorder = std::make_shared<RecordingScheduler>(Scheduler::get(), list);
+        Scheduler::set(_recorder);
+    }
+    ~RecordingScope()
+    {
+        _recorder->detach();
+        Scheduler::set(_type);
+    }
+
+private:
+    Scheduler::Type                     _type;
+    std::shared_ptr<RecordingScheduler> _recorder{};
+};
+} // namespace
+
+struct CommandList::Impl
+{
+    std::function<void()> func{};
+    CommandStore          store{};
+};
+
+CommandList::CommandList() : _impl(std::make_unique<Impl>())
+{
+}
+CommandList::CommandList(CommandList &&)            = default;
+CommandList &CommandList::operator=(CommandList &&) = default;
+CommandList::~CommandList()                         = default;
+
+void CommandList::record(std::function<void()> func)
+{
+    ARM_COMPUTE_ERROR_ON(!func);
+
+    _impl->store.commands.clear();
+    _impl->store.replayable = true;
+    _impl->func             = std::move(func);
+
+    const size_t num_freed = num_freed_buffers();
+    {
+        RecordingScope scope(_impl->store);
+        _impl->func();
+    }
+
+    // The recorded commands keep the buffers of their tensors: a buffer freed while recording, such as a temporary
+    // workspace allocated by an operator, would be used after being freed by a replay
+    if (num_freed_buffers() != num_freed)
+    {
+        _impl->store.replayable = false;
+    }
+}
+
+void CommandList::replay()
+{
+    if (!_impl->store.replayable)
+    {
+        _impl->func();
+        return;
+    }
+
+    IScheduler &scheduler = Scheduler::get();
+    for (auto &command : _impl->store.commands)
+    {
+        command->execute(scheduler);
+    }
+}
+
+bool CommandList::is_replayable() const
+{
+    return _impl->store.replayable;
+}
+
+size_t CommandList::size() const
+{
+    return _impl->store.commands.size();
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2025 Arm Limited.
+ * Copyright (c) 2016-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,63 @@
 
 namespace arm_compute
 {
+#ifndef BARE_METAL
+namespace
+{
+/** State shared by the workloads of a single kernel dispatch
+ *
+ * Workloads only capture their own indices and a reference to this structure so that they fit in the small buffer
+ * of std::function and do not need a heap allocation each.
+ */
+struct DispatchContext
+{
+    ICPPKernel   *kernel;
+    const Window *window;
+    ITensorPack  *tensors;
+    unsigned int  split_dimension;
+    unsigned int  num_windows_x;
+    unsigned int  num_windows_y;
+};
+
+void run_1d(const DispatchContext &ctx, unsigned int t, const ThreadInfo &info)
+{
+    Window win = ctx.window->split_window(ctx.split_dimension, t, ctx.num_windows_x);
+    win.validate();
+
+    if (ctx.tensors->empty())
+    {
+        ctx.kernel->run(win, info);
+    }
+    else
+    {
+        ctx.kernel->run_op(*ctx.tensors, win, info);
+    }
+}
+
+void run_2d(const DispatchContext &ctx, unsigned int mi, unsigned int ni, const ThreadInfo &info)
+{
+    //narrow the window to our mi-ni workload
+    Window win = ctx.window->split_window(Window::DimX, mi, ctx.num_windows_x)
+                     .split_window(Window::DimY, ni, ctx.num_windows_y);
+    win.validate();
+
+    Window thread_locator;
+    thread_locator.set(Window::DimX, Window::Dimension(mi, ctx.num_windows_x));
+    thread_locator.set(Window::DimY, Window::Dimension(ni, ctx.num_windows_y));
+    thread_locator.validate();
+
+    if (ctx.tensors->empty())
+    {
+        ctx.kernel->run_nd(win, info, thread_locator);
+    }
+    else
+    {
+        ctx.kernel->run_op(*ctx.tensors, win, info);
+    }
+}
+} // namespace
+#endif /* !BARE_METAL */
+
 IScheduler::IScheduler()
 {
     // Work out the best possible number of execution threads
@@ -59,127 +116,59 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 #ifndef BARE_METAL
-    const Window &max_window = window;
     if (hints.split_dimension() == IScheduler::split_dimensions_all)
     {
         /*
          * if the split dim is size_t max then this signals we should parallelise over
          * all dimensions
          */
-        const std::size_t m = max_window.num_iterations(Window::DimX);
-        const std::size_t n = max_window.num_iterations(Window::DimY);
-
-        const unsigned int num_iterations = m * n;
-        const unsigned int num_threads    = std::min(num_iterations, this->num_threads());
-
-        //in c++17 this can be swapped for   auto [ m_threads, n_threads ] = split_2d(...
+        //in c++17 this can be swapped for   auto [ m_threads, n_threads ] = num_windows_2d(...
         unsigned m_threads, n_threads;
-        std::tie(m_threads, n_threads) = scheduler_utils::split_2d(num_threads, m, n);
+        std::tie(m_threads, n_threads) = num_windows_2d(window);
 
-        // Clamp m_threads and n_threads if not all threads have work to do
-        unsigned int max_parallelism = std::min<unsigned int>(m, m_threads) * std::min<unsigned int>(n, n_threads);
-        if (max_parallelism < num_threads)
-        {
-            m_threads = std::min<unsigned int>(m, m_threads);
-            n_threads = std::min<unsigned int>(n, n_threads);
-        }
+        const DispatchContext ctx{kernel, &window, &tensors, hints.split_dimension(), m_threads, n_threads};
 
         std::vector<IScheduler::Workload> workloads;
+        workloads.reserve(m_threads * n_threads);
         for (unsigned int ni = 0; ni != n_threads; ++ni)
         {
             for (unsigned int mi = 0; mi != m_threads; ++mi)
             {
-                workloads.push_back(
-                    [ni, mi, m_threads, n_threads, &max_window, &kernel, &tensors](const ThreadInfo &info)
-                    {
-                        //narrow the window to our mi-ni workload
-                        Window win = max_window.split_window(Window::DimX, mi, m_threads)
-                                         .split_window(Window::DimY, ni, n_threads);
-
-                        win.validate();
-
-                        Window thread_locator;
-                        thread_locator.set(Window::DimX, Window::Dimension(mi, m_threads));
-                        thread_locator.set(Window::DimY, Window::Dimension(ni, n_threads));
-
-                        thread_locator.validate();
-
-                        if (tensors.empty())
-                        {
-                            kernel->run_nd(win, info, thread_locator);
-                        }
-                        else
-                        {
-                            kernel->run_op(tensors, win, info);
-                        }
-                    });
+                workloads.emplace_back([mi, ni, &ctx](const ThreadInfo &info) { run_2d(ctx, mi, ni, info); });
             }
         }
         run_workloads(workloads);
     }
     else
     {
-        const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
-        const unsigned int num_threads    = std::min(num_iterations, this->num_threads());
+        const unsigned int num_windows = num_windows_1d(*kernel, hints, window);
 
-        if (num_iterations == 0)
+        if (num_windows == 0)
         {
             return;
         }
 
-        if (!kernel->is_parallelisable() || num_threads == 1)
+        if (num_windows == 1)
         {
             ThreadInfo info;
             info.cpu_info = &cpu_info();
             if (tensors.empty())
             {
-                kernel->run(max_window, info);
+                kernel->run(window, info);
             }
             else
             {
-                kernel->run_op(tensors, max_window, info);
+                kernel->run_op(tensors, window, info);
             }
         }
         else
         {
-            unsigned int num_windows = 0;
-            switch (hints.strategy())
-            {
-                case StrategyHint::STATIC:
-                    num_windows = num_threads;
-                    break;
-                case StrategyHint::DYNAMIC:
-                {
-                    const unsigned int granule_threshold =
-                        (hints.threshold() <= 0) ? num_threads : static_cast<unsigned int>(hints.threshold());
-                    // Make sure we don't use some windows which are too small as this might create some contention on the ThreadFeeder
-                    num_windows = num_iterations > granule_threshold ? granule_threshold : num_iterations;
-                    break;
-                }
-                default:
-                    ARM_COMPUTE_ERROR("Unknown strategy");
-            }
-            // Make sure the smallest window is larger than minimum workload size
-            num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
+            const DispatchContext ctx{kernel, &window, &tensors, hints.split_dimension(), num_windows, 1};
 
             std::vector<IScheduler::Workload> workloads(num_windows);
             for (unsigned int t = 0; t < num_windows; ++t)
             {
-                //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo &info)
-                {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
-                    win.validate();
-
-                    if (tensors.empty())
-                    {
-                        kernel->run(win, info);
-                    }
-                    else
-                    {
-                        kernel->run_op(tensors, win, info);
-                    }
-                };
+                workloads[t] = [t, &ctx](const ThreadInfo &info) { run_1d(ctx, t, info); };
             }
             run_workloads(workloads);
         }
@@ -189,6 +178,73 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
 #endif /* !BARE_METAL */
 }
 
+unsigned int IScheduler::num_windows_1d(const ICPPKernel &kernel, const Hints &hints, const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON(hints.split_dimension() == IScheduler::split_dimensions_all);
+
+    const unsigned int num_iterations = window.num_iterations(hints.split_dimension());
+    const unsigned int num_threads    = std::min(num_iterations, this->num_threads());
+
+    if (num_iterations == 0)
+    {
+        return 0;
+    }
+
+    if (!kernel.is_parallelisable() || num_threads == 1)
+    {
+        return 1;
+    }
+
+    unsigned int num_windows = 0;
+    switch (hints.strategy())
+    {
+        case StrategyHint::STATIC:
+            num_windows = num_threads;
+            break;
+        case StrategyHint::DYNAMIC:
+        {
+            const unsigned int granule_threshold =
+                (hints.threshold() <= 0) ? num_threads : static_cast<unsigned int>(hints.threshold());
+            // Make sure we don't use some windows which are too small as this might create some contention on the ThreadFeeder
+            num_windows = num_iterations > granule_threshold ? granule_threshold : num_iterations;
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unknown strategy");
+    }
+    // Make sure the smallest window is larger than minimum workload size
+    num_windows = adjust_num_of_windows(window, hints.split_dimension(), num_windows, kernel, cpu_info());
+
+    return adjust_num_of_windows_by_cost(kernel, window, num_windows);
+}
+
+std::pair<unsigned int, unsigned int> IScheduler::num_windows_2d(const Window &window)
+{
+#ifndef BARE_METAL
+    const std::size_t m = window.num_iterations(Window::DimX);
+    const std::size_t n = window.num_iterations(Window::DimY);
+
+    const unsigned int num_iterations = m * n;
+    const unsigned int num_threads    = std::min(num_iterations, this->num_threads());
+
+    unsigned m_threads, n_threads;
+    std::tie(m_threads, n_threads) = scheduler_utils::split_2d(num_threads, m, n);
+
+    // Clamp m_threads and n_threads if not all threads have work to do
+    unsigned int max_parallelism = std::min<unsigned int>(m, m_threads) * std::min<unsigned int>(n, n_threads);
+    if (max_parallelism < num_threads)
+    {
+        m_threads = std::min<unsigned int>(m, m_threads);
+        n_threads = std::min<unsigned int>(n, n_threads);
+    }
+
+    return std::make_pair(m_threads, n_threads);
+#else  /* !BARE_METAL */
+    ARM_COMPUTE_UNUSED(window);
+    return std::make_pair(1U, 1U);
+#endif /* !BARE_METAL */
+}
+
 void IScheduler::run_tagged_workloads(std::vector<Workload> &workloads, const char *tag)
 {
     ARM_COMPUTE_UNUSED(tag);
@@ -235,4 +291,18 @@ std::size_t IScheduler::adjust_num_of_windows(const Window     &window,
     return 1; //  If the workload is so small that it can't be split, we should run a single thread
 }
 
+unsigned int
+IScheduler::adjust_num_of_windows_by_cost(const ICPPKernel &kernel, const Window &window, unsigned int num_windows)
+{
+    const uint64_t cost = kernel.estimate_cost(cpu_info(), window);
+    if (cost != 0)
+    {
+        const unsigned int previous_num_windows = _previous_num_windows.load(std::memory_order_relaxed);
+        num_windows = scheduler_utils::num_threads_from_cost(cost, num_windows, previous_num_windows);
+    }
+    _previous_num_windows.store(num_windows, std::memory_order_relaxed);
+
+    return num_windows;
+}
+
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,15 +23,83 @@
  */
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstring>
+
 namespace arm_compute
 {
-IWeightsManager::IWeightsManager() : _managed_weights(), _managed_counter(), _managed_weights_parents()
+namespace
+{
+/** FNV-1a hash of the data type, shape, quantization and values of a tensor
+ *
+ * It identifies identical weights held by different tensors, e.g. by several instances of the same model.
+ */
+uint64_t hash_weights_content(const ITensor &weights)
 {
+    constexpr uint64_t fnv_prime = 0x100000001b3ULL;
+    uint64_t           hash      = 0xcbf29ce484222325ULL;
+    const auto         combine   = [&hash](uint64_t value)
+    {
+        hash ^= value;
+        hash *= fnv_prime;
+    };
+
+    const ITensorInfo &info = *weights.info();
+    combine(static_cast<uint64_t>(info.data_type()));
+    for (size_t d = 0; d < info.num_dimensions(); ++d)
+    {
+        combine(info.dimension(d));
+    }
+    const QuantizationInfo qinfo = info.quantization_info();
+    for (float scale : qinfo.scale())
+    {
+        uint32_t bits{0};
+        std::memcpy(&bits, &scale, sizeof(bits));
+        combine(bits);
+    }
+    for (int32_t offset : qinfo.offset())
+    {
+        combine(static_cast<uint32_t>(offset));
+    }
+
+    const uint8_t *data = weights.buffer();
+    const size_t   size = info.total_size();
+    size_t         i    = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t word{0};
+        std::memcpy(&word, data + i, sizeof(word));
+        combine(word);
+    }
+    for (; i < size; ++i)
+    {
+        combine(data[i]);
+    }
+    return hash;
 }
+} // namespace
+
+IWeightsManager::IWeightsManager()
+    : _managed_weights(),
+      _managed_counter(),
+      _managed_weights_parents(),
+      _prepared_weights(),
+      _mtx()
+{
+}
+
+IWeightsManager::~IWeightsManager() = default;
 
 void IWeightsManager::manage(const ITensor *weights, ITransformWeights *parent)
 {
-    if (!are_weights_managed(weights))
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    manage_unlocked(weights, parent);
+}
+
+void IWeightsManager::manage_unlocked(const ITensor *weights, ITransformWeights *parent)
+{
+    if (!are_weights_managed_unlocked(weights))
     {
         _managed_weights[weights];
         _managed_counter[weights];
@@ -54,7 +122,8 @@ void IWeightsManager::manage(const ITensor *weights, ITransformWeights *parent)
 
 ITensor *IWeightsManager::run(const ITensor *weights, ITransformWeights *weights_transform)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(!are_weights_managed(weights), "Cannot run function. Weights are not managed");
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(!are_weights_managed_unlocked(weights), "Cannot run function. Weights are not managed");
 
     // Find if I have the same weights with weights transform. If I do, don't run the reshape
     auto     item = _managed_weights.find(weights);
@@ -93,7 +162,6 @@ ITensor *IWeightsManager::run(const ITensor *weights, ITransformWeights *weights
     // mark the weights as unused
     if (_managed_weights_parents.find(weights) == _managed_weights_parents.end())
     {
-        auto item           = _managed_weights.find(weights);
         bool mark_as_unused = true;
         for (auto it : item->second)
         {
@@ -114,13 +182,20 @@ ITensor *IWeightsManager::run(const ITensor *weights, ITransformWeights *weights
 }
 
 bool IWeightsManager::are_weights_managed(const ITensor *weights)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    return are_weights_managed_unlocked(weights);
+}
+
+bool IWeightsManager::are_weights_managed_unlocked(const ITensor *weights) const
 {
     return (_managed_weights.find(weights) != _managed_weights.end());
 }
 
 ITensor *IWeightsManager::acquire(const ITensor *weights, ITransformWeights *weights_transform)
 {
-    ARM_COMPUTE_ERROR_ON_MSG(!are_weights_managed(weights), "Cannot acquire weights. Weights are not managed");
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(!are_weights_managed_unlocked(weights), "Cannot acquire weights. Weights are not managed");
 
     ITensor *transformed_weights{nullptr};
     auto     item = _managed_weights.find(weights);
@@ -146,14 +221,15 @@ ITensor *IWeightsManager::acquire(const ITensor *weights, ITransformWeights *wei
     }
 
     // Manage the weights and store link to the parent node
-    manage(transformed_weights, weights_transform);
+    manage_unlocked(transformed_weights, weights_transform);
 
     return transformed_weights;
 }
 
 void IWeightsManager::release(const ITensor *weights)
 {
-    if (weights == nullptr || !are_weights_managed(weights))
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    if (weights == nullptr || !are_weights_managed_unlocked(weights))
     {
         return;
     }
@@ -167,11 +243,57 @@ void IWeightsManager::release(const ITensor *weights)
 
 void IWeightsManager::pre_mark_as_unused(const ITensor *weights)
 {
-    if (weights == nullptr || !are_weights_managed(weights))
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    if (weights == nullptr || !are_weights_managed_unlocked(weights))
     {
         return;
     }
 
     _managed_counter[weights].is_unused = true;
 }
+
+std::shared_ptr<ITensor> IWeightsManager::share_prepared_weights(const ITensor *weights, size_t alignment)
+{
+    ARM_COMPUTE_ERROR_ON(weights == nullptr || weights->buffer() == nullptr);
+
+    // Hash outside of the lock: prepared weights can be large
+    const uint64_t hash = hash_weights_content(*weights);
+    const size_t   size = weights->info()->total_size();
+
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    auto                                        range = _prepared_weights.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        std::shared_ptr<ITensor> shared = it->second.lock();
+        if (shared == nullptr)
+        {
+            it = _prepared_weights.erase(it);
+            continue;
+        }
+        // Guard against hash collisions
+        if (shared->info()->total_size() == size && std::memcmp(shared->buffer(), weights->buffer(), size) == 0)
+        {
+            return shared;
+        }
+        ++it;
+    }
+
+    auto shared = std::make_shared<Tensor>();
+    shared->allocator()->init(TensorInfo(TensorShape(size), 1, DataType::U8), alignment);
+    shared->allocator()->allocate();
+    std::memcpy(shared->buffer(), weights->buffer(), size);
+    _prepared_weights.emplace(hash, shared);
+    return shared;
+}
+
+size_t IWeightsManager::num_shared_prepared_weights() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    size_t                                      num_shared = 0;
+    for (const auto &prepared : _prepared_weights)
+    {
+        num_shared += prepared.second.expired() ? 0 : 1;
+    }
+    return num_shared;
+}
 } // namespace arm_compute
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryFootprint.h"
+
+#include <atomic>
+
+namespace arm_compute
+{
+namespace
+{
+std::atomic<size_t> live_bytes{0};
+std::atomic<size_t> live_allocations{0};
+std::atomic<size_t> peak_bytes{0};
+std::atomic<size_t> total_allocations{0};
+} // namespace
+
+AllocationCounters allocation_counters()
+{
+    AllocationCounters counters{};
+    counters.live_bytes        = live_bytes.load(std::memory_order_relaxed);
+    counters.live_allocations  = live_allocations.load(std::memory_order_relaxed);
+    counters.peak_bytes        = peak_bytes.load(std::memory_order_relaxed);
+    counters.total_allocations = total_allocations.load(std::memory_order_relaxed);
+    return counters;
+}
+
+void reset_allocation_peak()
+{
+    peak_bytes.store(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+namespace detail
+{
+void on_allocate(size_t size)
+{
+    const size_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    live_allocations.fetch_add(1, std::memory_order_relaxed);
+    total_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    size_t peak = peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+    {
+    }
+}
+
+void on_free(size_t size)
+{
+    live_bytes.fetch_sub(size, std::memory_order_relaxed);
+    live_allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+} // namespace detail
+} // namespace arm_compute
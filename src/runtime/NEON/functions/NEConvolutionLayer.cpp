@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,7 @@ struct NEConvolutionLayer::Impl
 {
     MemoryGroup                        memory_group{};
     std::shared_ptr<IMemoryManager>    memory_manager{};
+    IWeightsManager                   *weights_manager{nullptr};
     std::unique_ptr<cpu::ICpuOperator> op{nullptr};
     ITensorPack                        run_pack{};
     ITensorPack                        prep_pack{};
@@ -54,9 +55,11 @@ struct NEConvolutionLayer::Impl
     bool                               is_prepared{false};
 };
 
-NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) : _impl(std::make_unique<Impl>())
+NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
+    : _impl(std::make_unique<Impl>())
 {
-    _impl->memory_manager = std::move(memory_manager);
+    _impl->memory_manager  = std::move(memory_manager);
+    _impl->weights_manager = weights_manager;
 }
 
 NEConvolutionLayer::~NEConvolutionLayer() = default;
@@ -209,9 +212,24 @@ void NEConvolutionLayer::prepare()
 
             // Release temporary tensors that are only used in prepare stage
             release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+
+            const ITensor *biases = _impl->prep_pack.get_const_tensor(TensorType::ACL_SRC_2);
+            if (biases == nullptr || biases->info()->are_values_constant())
+            {
+                share_persistent_tensors(_impl->aux_mem_req, _impl->workspace, _impl->weights_manager);
+            }
         }
 
         _impl->is_prepared = true;
     }
 }
+
+MemoryFootprint NEConvolutionLayer::memory_footprint() const
+{
+    if (_impl->func)
+    {
+        return _impl->func->memory_footprint();
+    }
+    return workspace_footprint(_impl->aux_mem_req, _impl->run_pack.get_const_tensor(ACL_SRC_1));
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,9 @@
 
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/NEON/kernels/NEDeconvolutionPhaseInterleaveKernel.h"
+
+#include <cstring>
 
 using namespace arm_compute::misc::shape_calculator;
 
@@ -65,6 +68,194 @@ PadStrideInfo compute_upsample_info(const PadStrideInfo &info, uint32_t deconv_p
     return PadStrideInfo(stride_x, stride_y, deconv_pad_left, deconv_pad_right, deconv_pad_top, deconv_pad_bottom,
                          DimensionRoundingType::FLOOR);
 }
+
+/** Sub-pixel decomposition of a strided deconvolution along one spatial axis
+ *
+ * Output element o only receives contributions from the kernel taps k = r, r + s, r + 2s, ... where
+ * r = (o + pad_before) % s, so the deconvolution is equivalent to s stride-1 convolutions of the original
+ * input with ceil(K / s) taps each.
+ */
+struct PhaseAxisInfo
+{
+    unsigned int taps;       /**< Number of taps of each phase sub-kernel */
+    unsigned int pad_before; /**< Padding before the input of the phase convolution */
+    unsigned int pad_after;  /**< Padding after the input of the phase convolution */
+    unsigned int offset;     /**< Phase of the first output element */
+};
+
+PhaseAxisInfo
+compute_phase_axis_info(unsigned int kernel_size, unsigned int stride, unsigned int pad_before, unsigned int pad_after)
+{
+    PhaseAxisInfo axis{};
+    axis.taps       = (kernel_size + stride - 1) / stride;
+    axis.pad_before = axis.taps - 1 - pad_before / stride;
+    axis.pad_after  = (kernel_size - 1 - pad_after) / stride;
+    axis.offset     = pad_before % stride;
+    return axis;
+}
+
+bool use_phase_decomposition(const ITensorInfo &weights, const PadStrideInfo &info)
+{
+    const DataLayout   data_layout = weights.data_layout();
+    const unsigned int kernel_w =
+        weights.dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH));
+    const unsigned int kernel_h =
+        weights.dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT));
+
+    // Unit strides do not insert any zero so the plain convolution is already optimal
+    const bool is_strided = info.stride().first > 1 || info.stride().second > 1;
+
+    // Padding larger than the kernel crops whole phases which the decomposition cannot express
+    const bool is_padding_supported = info.pad_left() < kernel_w && info.pad_right() < kernel_w &&
+                                      info.pad_top() < kernel_h && info.pad_bottom() < kernel_h;
+
+    return is_strided && is_padding_supported;
+}
+
+/** Compute the info of the tensors used by the sub-pixel decomposition
+ *
+ * @param[in]  input         Input tensor info.
+ * @param[in]  weights       Weights tensor info.
+ * @param[in]  bias          (Optional) Bias tensor info.
+ * @param[in]  output        Output tensor info.
+ * @param[in]  info          Deconvolution padding and strides.
+ * @param[out] phase_weights Stacked phase sub-kernels with dimensions [taps_x, taps_y, IFM, stride_x * stride_y * OFM].
+ * @param[out] phase_bias    Bias replicated for every phase. Left untouched if @p bias is nullptr.
+ * @param[out] phase_output  Output of the phase convolution.
+ *
+ * @return The padding and strides of the phase convolution
+ */
+PadStrideInfo compute_phase_tensor_infos(const ITensorInfo   &input,
+                                         const ITensorInfo   &weights,
+                                         const ITensorInfo   *bias,
+                                         const ITensorInfo   &output,
+                                         const PadStrideInfo &info,
+                                         TensorInfo          &phase_weights,
+                                         TensorInfo          &phase_bias,
+                                         TensorInfo          &phase_output)
+{
+    const DataLayout   data_layout = input.data_layout();
+    const unsigned int idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const unsigned int idx_n       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
+    const unsigned int stride_x    = info.stride().first;
+    const unsigned int stride_y    = info.stride().second;
+    const unsigned int num_phases  = stride_x * stride_y;
+    const unsigned int num_ofm     = weights.dimension(idx_n);
+
+    const PhaseAxisInfo axis_x =
+        compute_phase_axis_info(weights.dimension(idx_w), stride_x, info.pad_left(), info.pad_right());
+    const PhaseAxisInfo axis_y =
+        compute_phase_axis_info(weights.dimension(idx_h), stride_y, info.pad_top(), info.pad_bottom());
+
+    TensorShape phase_weights_shape = weights.tensor_shape();
+    phase_weights_shape.set(idx_w, axis_x.taps);
+    phase_weights_shape.set(idx_h, axis_y.taps);
+    phase_weights_shape.set(idx_n, num_phases * num_ofm);
+
+    // Per-channel quantized weights need their scales replicated for every phase
+    QuantizationInfo weights_qinfo = weights.quantization_info();
+    if (is_data_type_quantized_per_channel(weights.data_type()))
+    {
+        std::vector<float> scales;
+        scales.reserve(num_phases * weights_qinfo.scale().size());
+        for (unsigned int p = 0; p < num_phases; ++p)
+        {
+            scales.insert(scales.end(), weights_qinfo.scale().begin(), weights_qinfo.scale().end());
+        }
+        weights_qinfo = QuantizationInfo(scales);
+    }
+    phase_weights = TensorInfo(phase_weights_shape, 1, weights.data_type(), weights_qinfo);
+    phase_weights.set_data_layout(data_layout);
+
+    if (bias != nullptr)
+    {
+        phase_bias = TensorInfo(TensorShape(num_phases * num_ofm), 1, bias->data_type(), bias->quantization_info());
+    }
+
+    TensorShape phase_output_shape = input.tensor_shape();
+    phase_output_shape.set(idx_w, input.dimension(idx_w) + axis_x.pad_before + axis_x.pad_after - axis_x.taps + 1);
+    phase_output_shape.set(idx_h, input.dimension(idx_h) + axis_y.pad_before + axis_y.pad_after - axis_y.taps + 1);
+    phase_output_shape.set(idx_c, num_phases * num_ofm);
+    phase_output = TensorInfo(phase_output_shape, 1, output.data_type(), output.quantization_info());
+    phase_output.set_data_layout(data_layout);
+
+    return PadStrideInfo(1, 1, axis_x.pad_before, axis_x.pad_after, axis_y.pad_before, axis_y.pad_after,
+                         DimensionRoundingType::FLOOR);
+}
+
+/** Scatter the deconvolution weights into the stacked phase sub-kernels
+ *
+ * Phase (rx, ry) is stored in the output feature maps [(ry * stride_x + rx) * OFM, (ry * stride_x + rx + 1) * OFM).
+ * Its tap (tx, ty) holds the weight (rx + (taps_x - 1 - tx) * stride_x, ry + (taps_y - 1 - ty) * stride_y) of the
+ * original kernel, or zero when that position falls outside of the kernel.
+ */
+void fill_phase_weights(const ITensor &weights,
+                        const ITensor &phase_weights,
+                        unsigned int   stride_x,
+                        unsigned int   stride_y)
+{
+    const ITensorInfo &info         = *weights.info();
+    const DataLayout   data_layout  = info.data_layout();
+    const unsigned int idx_w        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_h        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int idx_c        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const unsigned int idx_n        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
+    const unsigned int kernel_w     = info.dimension(idx_w);
+    const unsigned int kernel_h     = info.dimension(idx_h);
+    const unsigned int num_ifm      = info.dimension(idx_c);
+    const unsigned int num_ofm      = info.dimension(idx_n);
+    const unsigned int taps_x       = phase_weights.info()->dimension(idx_w);
+    const unsigned int taps_y       = phase_weights.info()->dimension(idx_h);
+    const size_t       element_size = info.element_size();
+
+    // Taps outside of the original kernel must not contribute, which for asymmetric weights means the zero point
+    const int zero_value =
+        is_data_type_quantized_asymmetric(info.data_type()) ? info.quantization_info().uniform().offset : 0;
+
+    Coordinates src_id;
+    Coordinates dst_id;
+    for (unsigned int ry = 0; ry < stride_y; ++ry)
+    {
+        for (unsigned int rx = 0; rx < stride_x; ++rx)
+        {
+            const unsigned int phase = ry * stride_x + rx;
+            for (unsigned int ofm = 0; ofm < num_ofm; ++ofm)
+            {
+                for (unsigned int ty = 0; ty < taps_y; ++ty)
+                {
+                    const unsigned int ky = ry + (taps_y - 1 - ty) * stride_y;
+                    for (unsigned int tx = 0; tx < taps_x; ++tx)
+                    {
+                        const unsigned int kx = rx + (taps_x - 1 - tx) * stride_x;
+                        for (unsigned int ifm = 0; ifm < num_ifm; ++ifm)
+                        {
+                            dst_id.set(idx_w, tx);
+                            dst_id.set(idx_h, ty);
+                            dst_id.set(idx_c, ifm);
+                            dst_id.set(idx_n, phase * num_ofm + ofm);
+                            uint8_t *dst_ptr = phase_weights.ptr_to_element(dst_id);
+
+                            if (kx < kernel_w && ky < kernel_h)
+                            {
+                                src_id.set(idx_w, kx);
+                                src_id.set(idx_h, ky);
+                                src_id.set(idx_c, ifm);
+                                src_id.set(idx_n, ofm);
+                                std::memcpy(dst_ptr, weights.ptr_to_element(src_id), element_size);
+                            }
+                            else
+                            {
+                                std::memset(dst_ptr, zero_value, element_size);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
 } // namespace
 
 NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
@@ -72,17 +263,25 @@ NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memor
       _conv_f(memory_manager),
       _upsample_f(),
       _flip_weights(),
+      _interleave_kernel(),
       _scaled_output(),
       _weights_flipped(),
       _flip_axis(),
+      _phase_weights(),
+      _phase_bias(),
+      _phase_output(),
       _original_weights(nullptr),
+      _original_bias(nullptr),
       _input(nullptr),
       _info(),
       _is_prepared(false),
-      _do_upsampling(true)
+      _do_upsampling(true),
+      _use_phase_decomposition(false)
 {
 }
 
+NEDeconvolutionLayer::~NEDeconvolutionLayer() = default;
+
 Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
                                       const ITensorInfo   *weights,
                                       const ITensorInfo   *bias,
@@ -174,7 +373,28 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo   *input,
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(batches_idx) != scale_out_info.dimension(batches_idx));
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(channel_idx) != scale_out_info.dimension(channel_idx));
 
-    if (do_upsampling)
+    if (use_phase_decomposition(*weights, info))
+    {
+        TensorInfo output_info(*output);
+        if (output->total_size() == 0)
+        {
+            output_info = TensorInfo(*input);
+            output_info.set_tensor_shape(compute_deconvolution_output_shape(out_dims, *input, *weights));
+        }
+
+        TensorInfo          phase_weights_info;
+        TensorInfo          phase_bias_info;
+        TensorInfo          phase_output_info;
+        const PadStrideInfo phase_conv_info = compute_phase_tensor_infos(
+            *input, *weights, bias, output_info, info, phase_weights_info, phase_bias_info, phase_output_info);
+
+        ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(
+            input, &phase_weights_info, (bias != nullptr) ? &phase_bias_info : nullptr, &phase_output_info,
+            phase_conv_info, weights_info, Size2D(1U, 1U), ActivationLayerInfo(), enable_fast_math));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDeconvolutionPhaseInterleaveKernel::validate(
+            &phase_output_info, &output_info, stride_x, stride_y, pad_left % stride_x, pad_top % stride_y));
+    }
+    else if (do_upsampling)
     {
         const PadStrideInfo conv_info(1, 1, 0, 0, 0, 0, DimensionRoundingType::CEIL);
         ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayer::validate(&scale_out_info, weights, bias, output, conv_info,
@@ -229,6 +449,38 @@ void NEDeconvolutionLayer::configure(ITensor             *input,
     auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(),
                        input->info()->quantization_info());
 
+    _use_phase_decomposition = use_phase_decomposition(*weights->info(), info);
+    if (_use_phase_decomposition)
+    {
+        _original_bias = bias;
+        _do_upsampling = false;
+
+        TensorInfo          phase_weights_info;
+        TensorInfo          phase_bias_info;
+        TensorInfo          phase_output_info;
+        const PadStrideInfo phase_conv_info =
+            compute_phase_tensor_infos(*input->info(), *weights->info(), (bias == nullptr) ? nullptr : bias->info(),
+                                       *output->info(), info, phase_weights_info, phase_bias_info, phase_output_info);
+
+        _phase_weights.allocator()->init(phase_weights_info);
+        if (bias != nullptr)
+        {
+            _phase_bias.allocator()->init(phase_bias_info);
+        }
+        _phase_output.allocator()->init(phase_output_info);
+        _memory_group.manage(&_phase_output);
+
+        _conv_f.configure(input, &_phase_weights, (bias == nullptr) ? nullptr : &_phase_bias, &_phase_output,
+                          phase_conv_info, weights_info, Size2D(1U, 1U), ActivationLayerInfo(), enable_fast_math);
+
+        _interleave_kernel = std::make_unique<NEDeconvolutionPhaseInterleaveKernel>();
+        _interleave_kernel->configure(&_phase_output, output, stride_x, stride_y, info.pad_left() % stride_x,
+                                      info.pad_top() % stride_y);
+
+        _phase_output.allocator()->allocate();
+        return;
+    }
+
     _flip_axis.allocator()->init(TensorInfo(TensorShape(2U), 1, DataType::U32));
 
     _weights_flipped.allocator()->init(weights->info()->clone()->set_data_layout(data_layout));
@@ -285,6 +537,13 @@ void NEDeconvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if (_use_phase_decomposition)
+    {
+        _conv_f.run();
+        NEScheduler::get().schedule(_interleave_kernel.get(), _interleave_kernel->get_split_dimension());
+        return;
+    }
+
     if (_do_upsampling)
     {
         _upsample_f.run();
@@ -298,6 +557,37 @@ void NEDeconvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
+        if (_use_phase_decomposition)
+        {
+            // Split the kernel into the phase sub-kernels and mark original weights tensor as unused
+            _phase_weights.allocator()->allocate();
+            fill_phase_weights(*_original_weights, _phase_weights, _info.stride().first, _info.stride().second);
+            _original_weights->mark_as_unused();
+
+            if (_original_bias != nullptr)
+            {
+                const unsigned int num_phases = _info.stride().first * _info.stride().second;
+                const size_t       bias_size  = _original_bias->info()->total_size();
+
+                _phase_bias.allocator()->allocate();
+                for (unsigned int p = 0; p < num_phases; ++p)
+                {
+                    std::memcpy(_phase_bias.buffer() + p * bias_size, _original_bias->buffer(), bias_size);
+                }
+            }
+
+            _conv_f.prepare();
+
+            // Free the phase sub-kernels if the convolution has transformed them
+            if (!_phase_weights.is_used())
+            {
+                _phase_weights.allocator()->free();
+            }
+
+            _is_prepared = true;
+            return;
+        }
+
         // Run weights flipping and mark original weights tensor as unused
         _weights_flipped.allocator()->allocate();
         _flip_weights.run();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -68,7 +68,8 @@ void NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayerOptimizedInternal::
     const PadStrideInfo       &conv_info,
     unsigned int               depth_multiplier,
     const ActivationLayerInfo &act_info,
-    const Size2D              &dilation)
+    const Size2D              &dilation,
+    bool                       enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
 
@@ -80,7 +81,7 @@ void NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayerOptimizedInternal::
     _impl->permute = is_nhwc;
 
     _impl->op = std::make_unique<cpu::CpuDepthwiseConv2d>();
-    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation};
+    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation, enable_fast_math};
     _impl->op->configure(_impl->src->info(), _impl->weights->info(),
                          _impl->biases == nullptr ? nullptr : _impl->biases->info(), _impl->dst->info(), info);
 
@@ -94,7 +95,7 @@ void NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayerOptimizedInternal::
     {
         act_info_to_use = act_info;
     }
-    info = ConvolutionInfo{conv_info, depth_multiplier, act_info_to_use, dilation};
+    info = ConvolutionInfo{conv_info, depth_multiplier, act_info_to_use, dilation, enable_fast_math};
 
     auto dwc_optimized_func = std::make_unique<cpu::CpuDepthwiseConv2dAssemblyDispatch>();
 
@@ -157,9 +158,10 @@ NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayerOptimizedInternal::valid
                                                                                     const PadStrideInfo &conv_info,
                                                                                     unsigned int depth_multiplier,
                                                                                     const ActivationLayerInfo &act_info,
-                                                                                    const Size2D              &dilation)
+                                                                                    const Size2D              &dilation,
+                                                                                    bool enable_fast_math)
 {
-    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation};
+    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation, enable_fast_math};
     return cpu::CpuDepthwiseConv2d::validate(input, weights, biases, output, info);
 }
 
@@ -333,16 +335,18 @@ void NEDepthwiseConvolutionLayer::configure(ITensor                   *input,
                                             const PadStrideInfo       &conv_info,
                                             unsigned int               depth_multiplier,
                                             const ActivationLayerInfo &act_info,
-                                            const Size2D              &dilation)
+                                            const Size2D              &dilation,
+                                            bool                       enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
 
-    ARM_COMPUTE_LOG_PARAMS(input, weights, output, conv_info, depth_multiplier, biases, act_info, dilation);
+    ARM_COMPUTE_LOG_PARAMS(input, weights, output, conv_info, depth_multiplier, biases, act_info, dilation,
+                           enable_fast_math);
     ARM_COMPUTE_ERROR_THROW_ON(NEDepthwiseConvolutionLayer::validate(
         input->info(), weights->info(), (biases == nullptr) ? nullptr : biases->info(), output->info(), conv_info,
-        depth_multiplier, act_info, dilation));
+        depth_multiplier, act_info, dilation, enable_fast_math));
 
-    const ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation};
+    const ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation, enable_fast_math};
     _impl->op              = std::make_shared<cpu::CpuDepthwiseConv2d>();
     _impl->depth_conv_func = _impl->op->get_depthwiseconvolution_function(
         input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), info);
@@ -350,7 +354,7 @@ void NEDepthwiseConvolutionLayer::configure(ITensor                   *input,
     {
         case DepthwiseConvolutionFunction::OPTIMIZED:
             _impl->func_optimized.configure(input, weights, biases, output, conv_info, depth_multiplier, act_info,
-                                            dilation);
+                                            dilation, enable_fast_math);
             break;
         case DepthwiseConvolutionFunction::GENERIC:
             _impl->func_generic.configure(input, weights, biases, output, conv_info, depth_multiplier, act_info,
@@ -368,10 +372,11 @@ Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo         *input,
                                              const PadStrideInfo       &conv_info,
                                              unsigned int               depth_multiplier,
                                              const ActivationLayerInfo &act_info,
-                                             const Size2D              &dilation)
+                                             const Size2D              &dilation,
+                                             bool                       enable_fast_math)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, biases, output);
-    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation};
+    ConvolutionInfo info{conv_info, depth_multiplier, act_info, dilation, enable_fast_math};
     return cpu::CpuDepthwiseConv2d::validate(input, weights, biases, output, info);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,4 +88,9 @@ void NEDirectConvolutionLayer::run()
 {
     _impl->op->run(_impl->run_pack);
 }
+
+MemoryFootprint NEDirectConvolutionLayer::memory_footprint() const
+{
+    return workspace_footprint(_impl->op->workspace(), _impl->weights);
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2018-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -53,20 +53,20 @@ template <ElementWiseUnary op>
 NEElementwiseUnaryLayer<op> &NEElementwiseUnaryLayer<op>::operator=(NEElementwiseUnaryLayer &&) = default;
 
 template <ElementWiseUnary op>
-void NEElementwiseUnaryLayer<op>::configure(const ITensor *input, ITensor *output)
+void NEElementwiseUnaryLayer<op>::configure(const ITensor *input, ITensor *output, bool fast_math)
 {
-    ARM_COMPUTE_ERROR_THROW_ON(NEElementwiseUnaryLayer<op>::validate(input->info(), output->info()));
+    ARM_COMPUTE_ERROR_THROW_ON(NEElementwiseUnaryLayer<op>::validate(input->info(), output->info(), fast_math));
 
     _impl->src    = input;
     _impl->dst    = output;
     _impl->cpu_op = std::make_unique<OperatorType>();
-    _impl->cpu_op->configure(op, *_impl->src->info(), *_impl->dst->info());
+    _impl->cpu_op->configure(op, *_impl->src->info(), *_impl->dst->info(), fast_math);
 }
 
 template <ElementWiseUnary op>
-Status NEElementwiseUnaryLayer<op>::validate(const ITensorInfo *input, const ITensorInfo *output)
+Status NEElementwiseUnaryLayer<op>::validate(const ITensorInfo *input, const ITensorInfo *output, bool fast_math)
 {
-    return OperatorType::validate(op, *input, *output);
+    return OperatorType::validate(op, *input, *output, fast_math);
 }
 
 template <ElementWiseUnary op>
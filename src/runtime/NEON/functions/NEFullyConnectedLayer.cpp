@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,7 @@ struct NEFullyConnectedLayer::Impl
 
     bool is_prepared{false};
     bool dynamic_weights{false};
+    bool share_prepared_weights{false};
 };
 
 NEFullyConnectedLayer::~NEFullyConnectedLayer() = default;
@@ -96,6 +97,8 @@ void NEFullyConnectedLayer::configure(const ITensor          *input,
 
     _impl->dynamic_weights = !weights->info()->are_values_constant() && fc_info.transpose_weights &&
                              !fc_info.are_weights_reshaped && !fc_info.retain_internal_weights;
+    _impl->share_prepared_weights =
+        !_impl->dynamic_weights && (biases == nullptr || biases->info()->are_values_constant());
 }
 
 Status NEFullyConnectedLayer::has_opt_impl(arm_compute::WeightFormat     &expected_weight_format,
@@ -143,6 +146,11 @@ void NEFullyConnectedLayer::prepare()
         release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
         _impl->is_prepared = true;
 
+        if (_impl->share_prepared_weights)
+        {
+            share_persistent_tensors(_impl->aux_mem_req, _impl->workspace, _impl->weights_manager);
+        }
+
         // Handle weights managed infrastructure
         if (_impl->weights_manager != nullptr && _impl->weights_manager->are_weights_managed(_impl->original_weights))
         {
@@ -159,4 +167,9 @@ void NEFullyConnectedLayer::prepare()
         }
     }
 }
+
+MemoryFootprint NEFullyConnectedLayer::memory_footprint() const
+{
+    return workspace_footprint(_impl->aux_mem_req, _impl->original_weights);
+}
 } // namespace arm_compute
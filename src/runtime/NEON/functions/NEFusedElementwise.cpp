@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEFusedElementwise.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Validate.h"
+
+#include "src/cpu/operators/CpuFusedElementwise.h"
+
+namespace arm_compute
+{
+struct NEFusedElementwise::Impl
+{
+    std::unique_ptr<cpu::CpuFusedElementwise> op{nullptr};
+    ITensorPack                               run_pack{};
+};
+
+NEFusedElementwise::NEFusedElementwise() : _impl(std::make_unique<Impl>())
+{
+}
+NEFusedElementwise::NEFusedElementwise(NEFusedElementwise &&)            = default;
+NEFusedElementwise &NEFusedElementwise::operator=(NEFusedElementwise &&) = default;
+NEFusedElementwise::~NEFusedElementwise()                                = default;
+
+void NEFusedElementwise::configure(const std::vector<const ITensor *> &inputs,
+                                   ITensor                            *output,
+                                   const ElementwiseExpression        &expr)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+
+    std::vector<const ITensorInfo *> inputs_info;
+    for (const auto *input : inputs)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+        inputs_info.emplace_back(input->info());
+    }
+
+    _impl->op = std::make_unique<cpu::CpuFusedElementwise>();
+    _impl->op->configure(inputs_info, output->info(), expr);
+
+    _impl->run_pack = {};
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        _impl->run_pack.add_const_tensor(TensorType::ACL_SRC_VEC + i, inputs[i]);
+    }
+    _impl->run_pack.add_tensor(TensorType::ACL_DST, output);
+}
+
+Status NEFusedElementwise::validate(const std::vector<const ITensorInfo *> &inputs,
+                                    const ITensorInfo                      *output,
+                                    const ElementwiseExpression            &expr)
+{
+    for (const auto *input : inputs)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input);
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(output);
+    return cpu::CpuFusedElementwise::validate(inputs, output, expr);
+}
+
+void NEFusedElementwise::run()
+{
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, 2024-2025 Arm Limited.
+ * Copyright (c) 2020-2021, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,4 +115,9 @@ void NEGEMMConv2d::prepare()
         _impl->is_prepared = true;
     }
 }
+
+MemoryFootprint NEGEMMConv2d::memory_footprint() const
+{
+    return workspace_footprint(_impl->aux_mem_req, _impl->weights);
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -137,6 +137,17 @@ void NEGEMMConvolutionLayer::prepare()
         // Release temporary tensors that are only used in prepare stage
         release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace_tensors);
         _impl->is_prepared = true;
+
+        const ITensor *biases = _impl->run_pack.get_const_tensor(TensorType::ACL_SRC_2);
+        if (biases == nullptr || biases->info()->are_values_constant())
+        {
+            share_persistent_tensors(_impl->aux_mem_req, _impl->workspace_tensors, _impl->weights_manager);
+        }
     }
 }
+
+MemoryFootprint NEGEMMConvolutionLayer::memory_footprint() const
+{
+    return workspace_footprint(_impl->aux_mem_req, _impl->weights);
+}
 } // namespace arm_compute
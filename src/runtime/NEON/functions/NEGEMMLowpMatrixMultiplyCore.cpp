@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2025 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -178,6 +178,17 @@ void NEGEMMLowpMatrixMultiplyCore::prepare()
         // Release temporary tensors that are only used in prepare stage
         release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace_tensors);
         _impl->is_prepared = true;
+
+        const ITensor *c = _impl->prep_pack.get_const_tensor(TensorType::ACL_SRC_2);
+        if (c == nullptr || c->info()->are_values_constant())
+        {
+            share_persistent_tensors(_impl->aux_mem_req, _impl->workspace_tensors, _impl->weights_manager);
+        }
     }
 }
+
+MemoryFootprint NEGEMMLowpMatrixMultiplyCore::memory_footprint() const
+{
+    return workspace_footprint(_impl->aux_mem_req, _impl->b);
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,12 +28,59 @@
 
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
-#include "src/core/NEON/kernels/NEFillBorderKernel.h"
 #include "src/core/NEON/kernels/NEGenerateProposalsLayerKernel.h"
 #include "src/core/NEON/kernels/NEPadLayerKernel.h"
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
 namespace arm_compute
 {
+namespace
+{
+/** Gather the boxes with the highest scores, so that the non maxima suppression only processes those
+ *
+ * @param[in]  scores     Scores of all the boxes of size (1, N).
+ * @param[in]  boxes      All the boxes of size (4, N).
+ * @param[out] scores_dst Scores of the selected boxes of size (1, K).
+ * @param[out] boxes_dst  Selected boxes of size (4, K).
+ * @param[in]  indices    Scratch buffer of N indices.
+ */
+template <typename T>
+void select_top_proposals(const ITensor             *scores,
+                          const ITensor             *boxes,
+                          ITensor                   *scores_dst,
+                          ITensor                   *boxes_dst,
+                          std::vector<unsigned int> &indices)
+{
+    const size_t num_selected = scores_dst->info()->dimension(1);
+    const size_t box_size     = boxes->info()->dimension(0) * boxes->info()->element_size();
+
+    const auto score = [&](unsigned int idx)
+    { return *reinterpret_cast<const T *>(scores->ptr_to_element(Coordinates(0, idx))); };
+
+    // Partial selection only: the non maxima suppression sorts the selected boxes anyway.
+    // Ties are broken on the index, so that the selection does not depend on the standard library implementation.
+    std::iota(indices.begin(), indices.end(), 0U);
+    std::nth_element(indices.begin(), indices.begin() + num_selected, indices.end(),
+                     [&](unsigned int lhs, unsigned int rhs)
+                     {
+                         const T score_lhs = score(lhs);
+                         const T score_rhs = score(rhs);
+                         return score_lhs > score_rhs || (score_lhs == score_rhs && lhs < rhs);
+                     });
+
+    for (size_t i = 0; i < num_selected; ++i)
+    {
+        std::memcpy(scores_dst->ptr_to_element(Coordinates(0, i)), scores->ptr_to_element(Coordinates(0, indices[i])),
+                    scores->info()->element_size());
+        std::memcpy(boxes_dst->ptr_to_element(Coordinates(0, i)), boxes->ptr_to_element(Coordinates(0, indices[i])),
+                    box_size);
+    }
+}
+} // namespace
+
 NEGenerateProposalsLayer::NEGenerateProposalsLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(memory_manager),
       _permute_deltas(),
@@ -41,6 +88,7 @@ NEGenerateProposalsLayer::NEGenerateProposalsLayer(std::shared_ptr<IMemoryManage
       _permute_scores(),
       _flatten_scores(),
       _compute_anchors(nullptr),
+      _decode_proposals(nullptr),
       _bounding_box(),
       _pad(),
       _dequantize_anchors(),
@@ -49,6 +97,8 @@ NEGenerateProposalsLayer::NEGenerateProposalsLayer(std::shared_ptr<IMemoryManage
       _cpp_nms(memory_manager),
       _is_nhwc(false),
       _is_qasymm8(false),
+      _is_fused(false),
+      _select_top_proposals(false),
       _deltas_permuted(),
       _deltas_flattened(),
       _deltas_flattened_f32(),
@@ -61,6 +111,9 @@ NEGenerateProposalsLayer::NEGenerateProposalsLayer(std::shared_ptr<IMemoryManage
       _keeps_nms_unused(),
       _classes_nms_unused(),
       _proposals_4_roi_values(),
+      _scores_selected(),
+      _proposals_selected(),
+      _selection_indices(),
       _all_proposals_to_use(nullptr),
       _num_valid_proposals(nullptr),
       _scores_out(nullptr)
@@ -102,6 +155,107 @@ void NEGenerateProposalsLayer::configure(const ITensor               *scores,
     const QuantizationInfo rois_qinfo =
         (_is_qasymm8) ? QuantizationInfo(0.125f, 0) : scores->info()->quantization_info();
 
+    // Use the fused decoding whenever the data type is supported by it
+    const TensorInfo decoded_proposals_info(TensorShape(values_per_roi, total_num_anchors), 1, scores_data_type);
+    const TensorInfo decoded_scores_info(TensorShape(1, total_num_anchors), 1, scores_data_type);
+    _is_fused = bool(NEDecodeProposalsKernel::validate(scores->info(), deltas->info(), anchors->info(),
+                                                       &decoded_proposals_info, &decoded_scores_info, info));
+
+    if (_is_fused)
+    {
+        // Compute the anchors, apply the deltas and gather the scores in a single pass
+        _all_proposals.allocator()->init(decoded_proposals_info);
+        _scores_flattened.allocator()->init(decoded_scores_info);
+        _memory_group.manage(&_all_proposals);
+        _memory_group.manage(&_scores_flattened);
+        _decode_proposals = std::make_unique<NEDecodeProposalsKernel>();
+        _decode_proposals->configure(scores, deltas, anchors, &_all_proposals, &_scores_flattened, info);
+        _all_proposals_to_use = &_all_proposals;
+    }
+    else
+    {
+        configure_unfused(scores, deltas, anchors, info);
+    }
+
+    // The original layer implementation first selects the best pre_nms_topN anchors (thus having a lightweight sort)
+    // that are then transformed by bbox_transform. The boxes generated are then fed into a non-sorting NMS operation.
+    // Here all the boxes are decoded, the best pre_nms_topN of them are selected with a partial sort and the NMS does
+    // the sorting of the selected boxes and the filtering.
+    const int num_candidates = pre_nms_topN > 0 ? std::min<int>(pre_nms_topN, total_num_anchors) : total_num_anchors;
+    _select_top_proposals    = num_candidates < total_num_anchors;
+
+    Tensor *scores_to_use = &_scores_flattened;
+    if (_select_top_proposals)
+    {
+        _scores_selected.allocator()->init(
+            TensorInfo(TensorShape(1, num_candidates), 1, scores_data_type, scores_qinfo));
+        _proposals_selected.allocator()->init(
+            _all_proposals_to_use->info()->clone()->set_tensor_shape(TensorShape(values_per_roi, num_candidates)));
+        _selection_indices.resize(total_num_anchors);
+        _memory_group.manage(&_scores_selected);
+        _memory_group.manage(&_proposals_selected);
+
+        _all_proposals_to_use->allocator()->allocate();
+        _scores_flattened.allocator()->allocate();
+
+        _all_proposals_to_use = &_proposals_selected;
+        scores_to_use         = &_scores_selected;
+    }
+
+    const int   scores_nms_size = std::min<int>(std::min<int>(post_nms_topN, pre_nms_topN), total_num_anchors);
+    const float min_size_scaled = info.min_size() * info.im_scale();
+    _memory_group.manage(&_classes_nms_unused);
+    _memory_group.manage(&_keeps_nms_unused);
+
+    // Note that NMS needs outputs preinitialized.
+    auto_init_if_empty(*scores_out->info(), TensorShape(scores_nms_size), 1, scores_data_type, scores_qinfo);
+    auto_init_if_empty(*_proposals_4_roi_values.info(), TensorShape(values_per_roi, scores_nms_size), 1, rois_data_type,
+                       rois_qinfo);
+    auto_init_if_empty(*num_valid_proposals->info(), TensorShape(1), 1, DataType::U32);
+
+    // Initialize temporaries (unused) outputs
+    _classes_nms_unused.allocator()->init(TensorInfo(TensorShape(scores_nms_size), 1, scores_data_type, scores_qinfo));
+    _keeps_nms_unused.allocator()->init(*scores_out->info());
+
+    // Save the output (to map and unmap them at run)
+    _scores_out          = scores_out;
+    _num_valid_proposals = num_valid_proposals;
+
+    _memory_group.manage(&_proposals_4_roi_values);
+
+    const BoxNMSLimitInfo box_nms_info(0.0f, info.nms_thres(), scores_nms_size, false, NMSType::LINEAR, 0.5f, 0.001f,
+                                       true, min_size_scaled, info.im_width(), info.im_height());
+    _cpp_nms.configure(scores_to_use /*scores_in*/, _all_proposals_to_use /*boxes_in,*/, nullptr /* batch_splits_in*/,
+                       scores_out /* scores_out*/, &_proposals_4_roi_values /*boxes_out*/,
+                       &_classes_nms_unused /*classes*/, nullptr /*batch_splits_out*/, &_keeps_nms_unused /*keeps*/,
+                       num_valid_proposals /* keeps_size*/, box_nms_info);
+
+    _keeps_nms_unused.allocator()->allocate();
+    _classes_nms_unused.allocator()->allocate();
+    _all_proposals_to_use->allocator()->allocate();
+    scores_to_use->allocator()->allocate();
+
+    // Add the first column that represents the batch id. This will be all zeros, as we don't support multiple images
+    _pad.configure(&_proposals_4_roi_values, proposals, PaddingList{{1, 0}});
+    _proposals_4_roi_values.allocator()->allocate();
+}
+
+void NEGenerateProposalsLayer::configure_unfused(const ITensor               *scores,
+                                                 const ITensor               *deltas,
+                                                 const ITensor               *anchors,
+                                                 const GenerateProposalsInfo &info)
+{
+    const DataType         scores_data_type = scores->info()->data_type();
+    const QuantizationInfo scores_qinfo     = scores->info()->quantization_info();
+    const int              num_anchors      = scores->info()->dimension(
+                      get_data_layout_dimension_index(scores->info()->data_layout(), DataLayoutDimension::CHANNEL));
+    const int feat_width = scores->info()->dimension(
+        get_data_layout_dimension_index(scores->info()->data_layout(), DataLayoutDimension::WIDTH));
+    const int feat_height = scores->info()->dimension(
+        get_data_layout_dimension_index(scores->info()->data_layout(), DataLayoutDimension::HEIGHT));
+    const int    total_num_anchors = num_anchors * feat_width * feat_height;
+    const size_t values_per_roi    = info.values_per_roi();
+
     // Compute all the anchors
     _memory_group.manage(&_all_anchors);
     _compute_anchors = std::make_unique<NEComputeAllAnchorsKernel>();
@@ -178,46 +332,6 @@ void NEGenerateProposalsLayer::configure(const ITensor               *scores,
         _all_proposals.allocator()->allocate();
         _all_proposals_to_use = &_all_proposals_quantized;
     }
-    // The original layer implementation first selects the best pre_nms_topN anchors (thus having a lightweight sort)
-    // that are then transformed by bbox_transform. The boxes generated are then fed into a non-sorting NMS operation.
-    // Since we are reusing the NMS layer and we don't implement any CL/sort, we let NMS do the sorting (of all the input)
-    // and the filtering
-    const int   scores_nms_size = std::min<int>(std::min<int>(post_nms_topN, pre_nms_topN), total_num_anchors);
-    const float min_size_scaled = info.min_size() * info.im_scale();
-    _memory_group.manage(&_classes_nms_unused);
-    _memory_group.manage(&_keeps_nms_unused);
-
-    // Note that NMS needs outputs preinitialized.
-    auto_init_if_empty(*scores_out->info(), TensorShape(scores_nms_size), 1, scores_data_type, scores_qinfo);
-    auto_init_if_empty(*_proposals_4_roi_values.info(), TensorShape(values_per_roi, scores_nms_size), 1, rois_data_type,
-                       rois_qinfo);
-    auto_init_if_empty(*num_valid_proposals->info(), TensorShape(1), 1, DataType::U32);
-
-    // Initialize temporaries (unused) outputs
-    _classes_nms_unused.allocator()->init(TensorInfo(TensorShape(scores_nms_size), 1, scores_data_type, scores_qinfo));
-    _keeps_nms_unused.allocator()->init(*scores_out->info());
-
-    // Save the output (to map and unmap them at run)
-    _scores_out          = scores_out;
-    _num_valid_proposals = num_valid_proposals;
-
-    _memory_group.manage(&_proposals_4_roi_values);
-
-    const BoxNMSLimitInfo box_nms_info(0.0f, info.nms_thres(), scores_nms_size, false, NMSType::LINEAR, 0.5f, 0.001f,
-                                       true, min_size_scaled, info.im_width(), info.im_height());
-    _cpp_nms.configure(&_scores_flattened /*scores_in*/, _all_proposals_to_use /*boxes_in,*/,
-                       nullptr /* batch_splits_in*/, scores_out /* scores_out*/, &_proposals_4_roi_values /*boxes_out*/,
-                       &_classes_nms_unused /*classes*/, nullptr /*batch_splits_out*/, &_keeps_nms_unused /*keeps*/,
-                       num_valid_proposals /* keeps_size*/, box_nms_info);
-
-    _keeps_nms_unused.allocator()->allocate();
-    _classes_nms_unused.allocator()->allocate();
-    _all_proposals_to_use->allocator()->allocate();
-    _scores_flattened.allocator()->allocate();
-
-    // Add the first column that represents the batch id. This will be all zeros, as we don't support multiple images
-    _pad.configure(&_proposals_4_roi_values, proposals, PaddingList{{1, 0}});
-    _proposals_4_roi_values.allocator()->allocate();
 }
 
 Status NEGenerateProposalsLayer::validate(const ITensorInfo           *scores,
@@ -370,31 +484,62 @@ void NEGenerateProposalsLayer::run()
     // Acquire all the temporaries
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    // Compute all the anchors
-    NEScheduler::get().schedule(_compute_anchors.get(), Window::DimY);
-
-    // Transpose and reshape the inputs
-    if (!_is_nhwc)
+    if (_is_fused)
     {
-        _permute_deltas.run();
-        _permute_scores.run();
+        // Compute the anchors and decode the boxes
+        NEScheduler::get().schedule(_decode_proposals.get(), Window::DimY);
     }
+    else
+    {
+        // Compute all the anchors
+        NEScheduler::get().schedule(_compute_anchors.get(), Window::DimY);
 
-    _flatten_deltas.run();
-    _flatten_scores.run();
+        // Transpose and reshape the inputs
+        if (!_is_nhwc)
+        {
+            _permute_deltas.run();
+            _permute_scores.run();
+        }
 
-    if (_is_qasymm8)
-    {
-        _dequantize_anchors.run();
-        _dequantize_deltas.run();
-    }
+        _flatten_deltas.run();
+        _flatten_scores.run();
 
-    // Build the boxes
-    _bounding_box.run();
+        if (_is_qasymm8)
+        {
+            _dequantize_anchors.run();
+            _dequantize_deltas.run();
+        }
 
-    if (_is_qasymm8)
+        // Build the boxes
+        _bounding_box.run();
+
+        if (_is_qasymm8)
+        {
+            _quantize_all_proposals.run();
+        }
+    }
+
+    if (_select_top_proposals)
     {
-        _quantize_all_proposals.run();
+        // Keep the best pre_nms_topN boxes only
+        const Tensor *all_proposals = _is_qasymm8 ? &_all_proposals_quantized : &_all_proposals;
+        switch (_scores_flattened.info()->data_type())
+        {
+            case DataType::QASYMM8:
+                select_top_proposals<uint8_t>(&_scores_flattened, all_proposals, &_scores_selected,
+                                              &_proposals_selected, _selection_indices);
+                break;
+            case DataType::F16:
+                select_top_proposals<half>(&_scores_flattened, all_proposals, &_scores_selected, &_proposals_selected,
+                                           _selection_indices);
+                break;
+            case DataType::F32:
+                select_top_proposals<float>(&_scores_flattened, all_proposals, &_scores_selected, &_proposals_selected,
+                                            _selection_indices);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Data type not supported");
+        }
     }
 
     // Non maxima suppression
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGroupNormalizationLayer.h"
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/NEON/kernels/NEGroupNormalizationLayerKernel.h"
+#include "src/core/NEON/kernels/NEGroupNormalizationStatisticsKernel.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+NEGroupNormalizationLayer::~NEGroupNormalizationLayer() = default;
+
+NEGroupNormalizationLayer::NEGroupNormalizationLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)),
+      _statistics_kernel(),
+      _normalization_kernel(),
+      _statistics(),
+      _workspace(),
+      _split_dimension(Window::DimZ)
+{
+}
+
+void NEGroupNormalizationLayer::configure(ITensor       *input,
+                                          ITensor       *output,
+                                          const ITensor *gamma,
+                                          const ITensor *beta,
+                                          unsigned int   num_groups,
+                                          float          epsilon)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGroupNormalizationLayer::validate(
+        input->info(), output != nullptr ? output->info() : nullptr, gamma != nullptr ? gamma->info() : nullptr,
+        beta != nullptr ? beta->info() : nullptr, num_groups, epsilon));
+    ARM_COMPUTE_LOG_PARAMS(input, output, gamma, beta, num_groups, epsilon);
+
+    const unsigned int num_splits = NEGroupNormalizationStatisticsKernel::compute_num_splits(
+        input->info(), num_groups, NEScheduler::get().num_threads());
+
+    _statistics_kernel    = std::make_unique<NEGroupNormalizationStatisticsKernel>();
+    _normalization_kernel = std::make_unique<NEGroupNormalizationLayerKernel>();
+
+    _memory_group.manage(&_statistics);
+    _statistics_kernel->configure(input, &_statistics, &_workspace, num_groups, num_splits);
+    _normalization_kernel->configure(input, output, &_statistics, &_workspace, gamma, beta,
+                                     GroupNormalizationLayerKernelInfo{num_groups, 1.f, 0.f, epsilon});
+
+    // The kernels run one after the other, so they share a working space sized for the current number of threads
+    const size_t scratch_size = std::max(_statistics_kernel->get_scratch_size_per_thread(),
+                                         _normalization_kernel->get_scratch_size_per_thread());
+    _workspace.allocator()->init(
+        TensorInfo(TensorShape(scratch_size * NEScheduler::get().num_threads()), 1, DataType::U8));
+    _memory_group.manage(&_workspace);
+
+    _statistics.allocator()->allocate();
+    _workspace.allocator()->allocate();
+
+    _split_dimension = _normalization_kernel->split_dimension();
+}
+
+Status NEGroupNormalizationLayer::validate(const ITensorInfo *input,
+                                           const ITensorInfo *output,
+                                           const ITensorInfo *gamma,
+                                           const ITensorInfo *beta,
+                                           unsigned int       num_groups,
+                                           float              epsilon)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups == 0, "The number of groups must be greater than 0");
+
+    const unsigned int num_splits =
+        NEGroupNormalizationStatisticsKernel::compute_num_splits(input, num_groups, NEScheduler::get().num_threads());
+    const TensorInfo statistics(TensorShape(2U, num_splits, num_groups, input->dimension(3)), 1, DataType::F32);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        NEGroupNormalizationStatisticsKernel::validate(input, &statistics, num_groups, num_splits));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGroupNormalizationLayerKernel::validate(
+        input, output, &statistics, gamma, beta, GroupNormalizationLayerKernelInfo{num_groups, 1.f, 0.f, epsilon}));
+    return Status{};
+}
+
+void NEGroupNormalizationLayer::run()
+{
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    NEScheduler::get().schedule(_statistics_kernel.get(), Window::DimX);
+    NEScheduler::get().schedule(_normalization_kernel.get(), _split_dimension);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,23 +25,34 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/KernelDescriptors.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
-#include "src/core/NEON/kernels/NEInstanceNormalizationLayerKernel.h"
+#include "src/core/NEON/kernels/NEGroupNormalizationLayerKernel.h"
+#include "src/core/NEON/kernels/NEGroupNormalizationStatisticsKernel.h"
+
+#include <algorithm>
 
 namespace arm_compute
 {
+namespace
+{
+unsigned int num_channels(const ITensorInfo *input)
+{
+    return input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL));
+}
+} // namespace
+
 NEInstanceNormalizationLayer::~NEInstanceNormalizationLayer() = default;
 
 NEInstanceNormalizationLayer::NEInstanceNormalizationLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)),
+      _statistics_kernel(),
       _normalization_kernel(),
-      _is_nchw(false),
-      _permute_input(),
-      _permute_output(),
-      _permuted_input(),
-      _permuted_output()
+      _statistics(),
+      _workspace(),
+      _split_dimension(Window::DimZ)
 {
 }
 
@@ -49,61 +60,56 @@ void NEInstanceNormalizationLayer::configure(ITensor *input, ITensor *output, fl
 {
     ARM_COMPUTE_LOG_PARAMS(input, output, gamma, beta, epsilon);
 
-    const DataLayout data_layout       = input->info()->data_layout();
-    const auto       kernel_descriptor = InstanceNormalizationLayerKernelInfo{gamma, beta, epsilon, true};
+    // Each channel is a group of its own, normalized in place in the layout of the input
+    const unsigned int num_groups = num_channels(input->info());
+    const unsigned int num_splits = NEGroupNormalizationStatisticsKernel::compute_num_splits(
+        input->info(), num_groups, NEScheduler::get().num_threads());
 
-    // Configure Kernels
-    _is_nchw = data_layout == DataLayout::NCHW;
+    _statistics_kernel    = std::make_unique<NEGroupNormalizationStatisticsKernel>();
+    _normalization_kernel = std::make_unique<NEGroupNormalizationLayerKernel>();
 
-    _normalization_kernel = std::make_unique<NEInstanceNormalizationLayerKernel>();
+    _memory_group.manage(&_statistics);
+    _statistics_kernel->configure(input, &_statistics, &_workspace, num_groups, num_splits);
+    _normalization_kernel->configure(input, output, &_statistics, &_workspace, nullptr, nullptr,
+                                     GroupNormalizationLayerKernelInfo{num_groups, gamma, beta, epsilon});
 
-    if (!_is_nchw)
-    {
-        _memory_group.manage(&_permuted_input);
-        _memory_group.manage(&_permuted_output);
+    // The kernels run one after the other, so they share a working space sized for the current number of threads
+    const size_t scratch_size = std::max(_statistics_kernel->get_scratch_size_per_thread(),
+                                         _normalization_kernel->get_scratch_size_per_thread());
+    _workspace.allocator()->init(
+        TensorInfo(TensorShape(scratch_size * NEScheduler::get().num_threads()), 1, DataType::U8));
+    _memory_group.manage(&_workspace);
 
-        // Configure the function to transform the input tensor from NHWC -> NCHW
-        _permute_input.configure(input, &_permuted_input, PermutationVector(1U, 2U, 0U));
-        _permuted_input.info()->set_data_layout(DataLayout::NCHW);
+    _statistics.allocator()->allocate();
+    _workspace.allocator()->allocate();
 
-        _normalization_kernel->configure(&_permuted_input, &_permuted_output, kernel_descriptor);
-        _permuted_output.info()->set_data_layout(DataLayout::NCHW);
-
-        _permute_output.configure(&_permuted_output, output != nullptr ? output : input, PermutationVector(2U, 0U, 1U));
-        _permuted_input.allocator()->allocate();
-        _permuted_output.allocator()->allocate();
-    }
-    else
-    {
-        _normalization_kernel->configure(input, output, kernel_descriptor);
-    }
+    _split_dimension = _normalization_kernel->split_dimension();
 }
 
 Status NEInstanceNormalizationLayer::validate(
     const ITensorInfo *input, const ITensorInfo *output, float gamma, float beta, float epsilon)
 {
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, output);
-    return NEInstanceNormalizationLayerKernel::validate(
-        &input->clone()->set_data_layout(DataLayout::NCHW), &output->clone()->set_data_layout(DataLayout::NCHW),
-        InstanceNormalizationLayerKernelInfo{gamma, beta, epsilon, true});
+
+    const unsigned int num_groups = num_channels(input);
+    const unsigned int num_splits =
+        NEGroupNormalizationStatisticsKernel::compute_num_splits(input, num_groups, NEScheduler::get().num_threads());
+    const TensorInfo statistics(TensorShape(2U, num_splits, num_groups, input->dimension(3)), 1, DataType::F32);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        NEGroupNormalizationStatisticsKernel::validate(input, &statistics, num_groups, num_splits));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGroupNormalizationLayerKernel::validate(
+        input, output, &statistics, nullptr, nullptr,
+        GroupNormalizationLayerKernelInfo{num_groups, gamma, beta, epsilon}));
+    return Status{};
 }
 
 void NEInstanceNormalizationLayer::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    // Permute input
-    if (!_is_nchw)
-    {
-        _permute_input.run();
-    }
-
-    NEScheduler::get().schedule(_normalization_kernel.get(), Window::DimZ);
-
-    // Permute output
-    if (!_is_nchw)
-    {
-        _permute_output.run();
-    }
+    NEScheduler::get().schedule(_statistics_kernel.get(), Window::DimX);
+    NEScheduler::get().schedule(_normalization_kernel.get(), _split_dimension);
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, 2024 Arm Limited.
+ * Copyright (c) 2020-2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,9 +34,14 @@
 
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/WindowHelpers.h"
+#include "src/core/NEON/kernels/NEQLSTMCellKernel.h"
 #include "src/core/NEON/kernels/NEQLSTMLayerNormalizationKernel.h"
 #include "src/cpu/kernels/CpuGemmLowpMatrixReductionKernel.h"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 namespace arm_compute
 {
 using namespace arm_compute::utils::info_helpers;
@@ -57,6 +62,65 @@ Status validate_mm(GEMMLowpOutputStageInfo &gemmlowp_info,
         NEGEMMLowpOutputStage::validate(mm_res_info, bias, outstage_tensor_info, gemmlowp_info));
     return Status{};
 }
+
+/** Collect the weights of the gates in the order they are stored by @ref NEQLSTMCellKernel */
+template <typename T>
+std::vector<const T *> gate_weights(const T *forget, const T *cell, const T *input, const T *output)
+{
+    std::vector<const T *> weights{forget, cell};
+    if (input != nullptr)
+    {
+        weights.push_back(input);
+    }
+    weights.push_back(output);
+    return weights;
+}
+
+/** Check whether the weights of the gates can be concatenated to be multiplied at once
+ *
+ * The matrix multiplication of the concatenated weights only accumulates 32-bit integers, so the gates can have
+ * different scales but must share the same zero point.
+ */
+bool can_concatenate_gate_weights(const std::vector<const ITensorInfo *> &weights)
+{
+    const int32_t offset = weights.front()->quantization_info().uniform().offset;
+    return std::all_of(weights.begin(), weights.end(),
+                       [&](const ITensorInfo *w)
+                       {
+                           return (w->data_type() == DataType::QASYMM8_SIGNED || w->data_type() == DataType::QSYMM8) &&
+                                  w->quantization_info().uniform().offset == offset;
+                       });
+}
+
+/** Check whether the gates and the cell update can be computed by @ref NEQLSTMCellKernel */
+bool can_fuse_gates(bool                                    has_peephole,
+                    bool                                    has_cell_clipping,
+                    const std::vector<const ITensorInfo *> &input_weights,
+                    const std::vector<const ITensorInfo *> &recurrent_weights)
+{
+    return !has_peephole && !has_cell_clipping && can_concatenate_gate_weights(input_weights) &&
+           can_concatenate_gate_weights(recurrent_weights);
+}
+
+/** Copy the given tensors next to each other along X */
+void concatenate_along_x(const std::vector<const ITensor *> &srcs, ITensor *dst)
+{
+    size_t dst_offset = 0;
+    for (const ITensor *src : srcs)
+    {
+        const size_t row_size = src->info()->dimension(0) * src->info()->element_size();
+
+        Window win;
+        win.use_tensor_dimensions(src->info()->tensor_shape(), Window::DimY);
+        Iterator src_it(src, win);
+        Iterator dst_it(dst, win);
+        execute_window_loop(
+            win, [&](const Coordinates &) { std::memcpy(dst_it.ptr() + dst_offset, src_it.ptr(), row_size); },
+            src_it, dst_it);
+
+        dst_offset += row_size;
+    }
+}
 } // namespace
 
 Status NEQLSTMLayer::validate_layer_norm(const ITensorInfo &in, const ITensorInfo &weight, const ITensorInfo &bias)
@@ -186,6 +250,9 @@ NEQLSTMLayer::NEQLSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
       _projection_accumulate_to_output_copy(),
       _hidden_to_output_copy(),
       _layer_norms(),
+      _mm_input_to_gates(),
+      _mm_recurrent_to_gates(),
+      _qlstm_cell(),
       _copy_output(),
       _layer_norm_weights(),
       _layer_norm_bias(),
@@ -419,6 +486,34 @@ void NEQLSTMLayer::configure(const ITensor             *input,
         _transpose_projection_weights.configure(_projection_weights, &_projection_weights_transposed);
     }
 
+    _fuse_gates = can_fuse_gates(
+        _has_peephole, _has_cell_clipping,
+        gate_weights(input_to_forget_weights->info(), input_to_cell_weights->info(),
+                     _has_cifg ? nullptr : _input_to_input_weights->info(), input_to_output_weights->info()),
+        gate_weights(recurrent_to_forget_weights->info(), recurrent_to_cell_weights->info(),
+                     _has_cifg ? nullptr : _recurrent_to_input_weights->info(), recurrent_to_output_weights->info()));
+
+    if (_fuse_gates)
+    {
+        _projection_tensor_copy_required = (num_units != output_size);
+        ITensor *hidden_gate_result      = output_state_out;
+
+        _memory_group.manage(&_hidden_gate);
+
+        if (_projection_tensor_copy_required)
+        {
+            _hidden_gate.allocator()->init(*output_state_out->info());
+            _hidden_gate.info()->set_tensor_shape(TensorShape(num_units, batch_size));
+            hidden_gate_result = &_hidden_gate;
+        }
+
+        configure_fused_cell(input, cell_state_in, output_state_in, cell_state_out, hidden_gate_result, lstm_params);
+
+        // Projection.
+        configure_projection(hidden_gate_result, output_state_in, output_state_out, output, lstm_params);
+        return;
+    }
+
     GEMMLowpOutputStageInfo gemmlowp_info;
     gemmlowp_info.type               = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
     gemmlowp_info.gemmlowp_min_bound = std::numeric_limits<int16_t>::lowest();
@@ -714,6 +809,105 @@ void NEQLSTMLayer::configure(const ITensor             *input,
     _hidden_mul_res.allocator()->allocate();
 
     // Projection.
+    configure_projection(hidden_gate_result, output_state_in, output_state_out, output, lstm_params);
+}
+
+void NEQLSTMLayer::configure_fused_cell(const ITensor             *input,
+                                        const ITensor             *cell_state_in,
+                                        const ITensor             *output_state_in,
+                                        ITensor                   *cell_state_out,
+                                        ITensor                   *hidden,
+                                        const LSTMParams<ITensor> &lstm_params)
+{
+    const size_t batch_size = input->info()->dimension(1);
+    const size_t num_units  = cell_state_in->info()->dimension(0);
+    const size_t num_gates  = _has_cifg ? _layer_norm_count - 1 : _layer_norm_count;
+
+    const UniformQuantizationInfo qinput           = input->info()->quantization_info().uniform();
+    const UniformQuantizationInfo qoutput_state_in = output_state_in->info()->quantization_info().uniform();
+
+    // The weights of the gates share the same zero point, the scales are applied per gate by the cell kernel
+    const auto concatenated_weights_info = [&](const ITensor *weights_transposed)
+    {
+        return TensorInfo(TensorShape(num_gates * num_units, weights_transposed->info()->dimension(1)), 1,
+                          DataType::QASYMM8_SIGNED, weights_transposed->info()->quantization_info());
+    };
+    _input_to_gates_weights.allocator()->init(concatenated_weights_info(&_input_to_forget_weights_transposed));
+    _recurrent_to_gates_weights.allocator()->init(concatenated_weights_info(&_recurrent_to_forget_weights_transposed));
+
+    const TensorInfo eff_bias_info(TensorShape(num_gates * num_units), 1, DataType::S32);
+    _input_to_gates_eff_bias.allocator()->init(eff_bias_info);
+    _recurrent_to_gates_eff_bias.allocator()->init(eff_bias_info);
+
+    const TensorInfo mm_out_info(TensorShape(num_gates * num_units, batch_size), 1, DataType::S32);
+    _mm_input_to_gates_res.allocator()->init(mm_out_info);
+    _mm_recurrent_to_gates_res.allocator()->init(mm_out_info);
+    _memory_group.manage(&_mm_input_to_gates_res);
+    _memory_group.manage(&_mm_recurrent_to_gates_res);
+    _mm_input_to_gates.configure(input, &_input_to_gates_weights, nullptr, &_mm_input_to_gates_res);
+    _mm_recurrent_to_gates.configure(output_state_in, &_recurrent_to_gates_weights, nullptr,
+                                     &_mm_recurrent_to_gates_res);
+
+    // Requantization of each contribution to the scale of the gate pre-activations
+    const std::array<const ITensor *, _layer_norm_count> input_weights{
+        {_input_to_forget_weights, _input_to_cell_weights, _input_to_input_weights, _input_to_output_weights}};
+    const std::array<const ITensor *, _layer_norm_count> recurrent_weights{
+        {_recurrent_to_forget_weights, _recurrent_to_cell_weights, _recurrent_to_input_weights,
+         _recurrent_to_output_weights}};
+    const std::array<float, _layer_norm_count> intermediate_scales{
+        {lstm_params.forget_intermediate_scale(), lstm_params.cell_intermediate_scale(),
+         lstm_params.input_intermediate_scale(), lstm_params.output_intermediate_scale()}};
+
+    QLSTMCellKernelInfo info{};
+    info.has_cifg       = _has_cifg;
+    info.has_layer_norm = _has_layer_norm;
+    for (size_t gate = 0; gate < _layer_norm_count; ++gate)
+    {
+        if (_has_cifg && gate == getGateIndex(LayerNormGate::Input))
+        {
+            continue;
+        }
+        info.intermediate_scales[gate] = intermediate_scales[gate];
+        quantization::calculate_quantized_multiplier(input_weights[gate]->info()->quantization_info().uniform().scale *
+                                                         qinput.scale / intermediate_scales[gate],
+                                                     &info.input_multipliers[gate], &info.input_shifts[gate]);
+        quantization::calculate_quantized_multiplier(
+            recurrent_weights[gate]->info()->quantization_info().uniform().scale * qoutput_state_in.scale /
+                intermediate_scales[gate],
+            &info.recurrent_multipliers[gate], &info.recurrent_shifts[gate]);
+    }
+
+    const float hidden_state_scale = std::pow(2, -15) / lstm_params.hidden_state_scale() * std::pow(2, -15);
+    quantization::calculate_quantized_multiplier(hidden_state_scale, &info.hidden_multiplier, &info.hidden_shift,
+                                                 /* ignore_epsilon */ true);
+    info.hidden_offset = lstm_params.hidden_state_zero();
+
+    _gates_res.allocator()->init(TensorInfo(mm_out_info.tensor_shape(), 1, DataType::QSYMM16));
+    _memory_group.manage(&_gates_res);
+
+    _qlstm_cell = std::make_unique<NEQLSTMCellKernel>();
+    _qlstm_cell->configure(&_mm_input_to_gates_res, &_mm_recurrent_to_gates_res, &_input_to_gates_eff_bias,
+                           &_recurrent_to_gates_eff_bias, cell_state_in, &_gates_res, cell_state_out, hidden,
+                           _layer_norm_weights, _layer_norm_bias, info);
+    _mm_input_to_gates_res.allocator()->allocate();
+    _mm_recurrent_to_gates_res.allocator()->allocate();
+    _gates_res.allocator()->allocate();
+}
+
+void NEQLSTMLayer::configure_projection(ITensor                   *hidden,
+                                        ITensor                   *output_state_in,
+                                        ITensor                   *output_state_out,
+                                        ITensor                   *output,
+                                        const LSTMParams<ITensor> &lstm_params)
+{
+    const int batch_size  = output_state_in->info()->dimension(1);
+    const int output_size = output_state_out->info()->dimension(_out_state_output_size_dimension_idx);
+
+    const UniformQuantizationInfo qoutput_state_in = output_state_in->info()->quantization_info().uniform();
+
+    GEMMLowpOutputStageInfo gemmlowp_info;
+    gemmlowp_info.type = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+
     if (_has_projection)
     {
         const TensorInfo              projection_outstage_info(*output_state_out->info());
@@ -724,12 +918,11 @@ void NEQLSTMLayer::configure(const ITensor             *input,
         gemmlowp_info.gemmlowp_max_bound = std::numeric_limits<int8_t>::max();
         gemmlowp_info.output_data_type   = DataType::QASYMM8_SIGNED;
 
-        TensorInfo projection_mm_out_info{mm_out_info};
-        projection_mm_out_info.set_tensor_shape(TensorShape(output_size, batch_size));
+        const TensorInfo projection_mm_out_info(TensorShape(output_size, batch_size), 1, DataType::S32);
 
-        configure_mm(_mm_projection, _projection_outstage, gemmlowp_info, hidden_gate_result,
-                     &_projection_weights_transposed, &_projection_eff_bias, &_mm_projection_res,
-                     &_projection_outstage_res, projection_scale, projection_mm_out_info, projection_outstage_info);
+        configure_mm(_mm_projection, _projection_outstage, gemmlowp_info, hidden, &_projection_weights_transposed,
+                     &_projection_eff_bias, &_mm_projection_res, &_projection_outstage_res, projection_scale,
+                     projection_mm_out_info, projection_outstage_info);
 
         ITensor *accumulate_destination = output_state_out;
 
@@ -1227,6 +1420,51 @@ Status NEQLSTMLayer::validate(const ITensorInfo             *input,
     ARM_COMPUTE_RETURN_ON_ERROR(
         NEGEMMLowpOutputStage::validate(&hidden_mul_res, nullptr, &hidden_out_info, gemmlowp_info));
 
+    // Fused gates.
+    const bool has_cifg = lstm_params.has_cifg_opt();
+    if (can_fuse_gates(lstm_params.has_peephole_opt(), quantized_cell_clip > 0,
+                       gate_weights(input_to_forget_weights, input_to_cell_weights,
+                                    has_cifg ? nullptr : lstm_params.input_to_input_weights(), input_to_output_weights),
+                       gate_weights(recurrent_to_forget_weights, recurrent_to_cell_weights,
+                                    has_cifg ? nullptr : lstm_params.recurrent_to_input_weights(),
+                                    recurrent_to_output_weights)))
+    {
+        const size_t     num_gates = has_cifg ? _layer_norm_count - 1 : _layer_norm_count;
+        const TensorInfo input_to_gates_weights(TensorShape(num_gates * num_units, input_size), 1,
+                                                DataType::QASYMM8_SIGNED, input_to_forget_weights->quantization_info());
+        const TensorInfo recurrent_to_gates_weights(TensorShape(num_gates * num_units, output_size), 1,
+                                                    DataType::QASYMM8_SIGNED,
+                                                    recurrent_to_forget_weights->quantization_info());
+        const TensorInfo gates_eff_bias_info(TensorShape(num_gates * num_units), 1, DataType::S32);
+        const TensorInfo gates_mm_out_info(TensorShape(num_gates * num_units, batch_size), 1, DataType::S32);
+        const TensorInfo gates_info(gates_mm_out_info.tensor_shape(), 1, DataType::QSYMM16);
+
+        ARM_COMPUTE_RETURN_ON_ERROR(
+            NEGEMMLowpMatrixMultiplyCore::validate(input, &input_to_gates_weights, nullptr, &gates_mm_out_info));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpMatrixMultiplyCore::validate(output_state_in, &recurrent_to_gates_weights,
+                                                                           nullptr, &gates_mm_out_info));
+
+        QLSTMCellKernelInfo info{};
+        info.has_cifg            = has_cifg;
+        info.has_layer_norm      = has_layer_norm;
+        info.intermediate_scales = {{lstm_params.forget_intermediate_scale(), lstm_params.cell_intermediate_scale(),
+                                     lstm_params.input_intermediate_scale(), lstm_params.output_intermediate_scale()}};
+
+        NEQLSTMCellKernel::GateArray<const ITensorInfo> layer_norm_weights{};
+        NEQLSTMCellKernel::GateArray<const ITensorInfo> layer_norm_bias{};
+        if (has_layer_norm)
+        {
+            layer_norm_weights = {{lstm_params.forget_layer_norm_weights(), lstm_params.cell_layer_norm_weights(),
+                                   lstm_params.input_layer_norm_weights(), lstm_params.output_layer_norm_weights()}};
+            layer_norm_bias    = {{forget_gate_bias, cell_bias, lstm_params.input_gate_bias(), output_gate_bias}};
+        }
+
+        // The cell state output is checked against the cell state input below
+        ARM_COMPUTE_RETURN_ON_ERROR(NEQLSTMCellKernel::validate(
+            &gates_mm_out_info, &gates_mm_out_info, &gates_eff_bias_info, &gates_eff_bias_info, cell_state_in,
+            &gates_info, cell_state_in, &hidden_out_info, layer_norm_weights, layer_norm_bias, info));
+    }
+
     const bool projection_tensor_copy_required = num_units != output_size;
 
     // Projection.
@@ -1317,105 +1555,114 @@ void NEQLSTMLayer::run()
     // Acquire all the temporaries
     MemoryGroupResourceScope scope_mg(_memory_group);
 
-    // Forget gate.
-    _mm_input_to_forget.run();
-    _input_to_forget_outstage.run();
-
-    _mm_recurrent_to_forget.run();
-    _recurrent_to_forget_outstage.run();
-    _accumulate_input_recurrent_forget.run();
-
-    if (_has_peephole)
+    if (_fuse_gates)
     {
-        _pixelwise_mul_cell_to_forget.run();
-        _cell_to_forget_outstage.run();
-        _accumulate_cell_forget.run();
+        _mm_input_to_gates.run();
+        _mm_recurrent_to_gates.run();
+        NEScheduler::get().schedule(_qlstm_cell.get(), Window::DimY);
     }
-
-    if (_has_layer_norm)
+    else
     {
-        NEScheduler::get().schedule(get_layer_norm(LayerNormGate::Forget).get(), Window::DimY);
-    }
+        // Forget gate.
+        _mm_input_to_forget.run();
+        _input_to_forget_outstage.run();
 
-    _forget_gate_sigmoid.run();
+        _mm_recurrent_to_forget.run();
+        _recurrent_to_forget_outstage.run();
+        _accumulate_input_recurrent_forget.run();
 
-    // Modulation gate.
-    _mm_input_to_cell.run();
-    _input_to_cell_outstage.run();
+        if (_has_peephole)
+        {
+            _pixelwise_mul_cell_to_forget.run();
+            _cell_to_forget_outstage.run();
+            _accumulate_cell_forget.run();
+        }
 
-    _mm_recurrent_to_cell.run();
-    _recurrent_to_cell_outstage.run();
-    _accumulate_input_recurrent_modulation.run();
+        if (_has_layer_norm)
+        {
+            NEScheduler::get().schedule(get_layer_norm(LayerNormGate::Forget).get(), Window::DimY);
+        }
 
-    if (_has_layer_norm)
-    {
-        NEScheduler::get().schedule(get_layer_norm(LayerNormGate::Cell).get(), Window::DimY);
-    }
+        _forget_gate_sigmoid.run();
 
-    _cell_gate_tanh.run();
+        // Modulation gate.
+        _mm_input_to_cell.run();
+        _input_to_cell_outstage.run();
 
-    // Input gate
-    if (_has_cifg)
-    {
-        _input_gate_sub.run();
-    }
-    else
-    {
-        _mm_input_to_input.run();
-        _input_to_input_outstage.run();
-        _mm_recurrent_to_input.run();
-        _recurrent_to_input_outstage.run();
-        _accumulate_input_recurrent_input.run();
+        _mm_recurrent_to_cell.run();
+        _recurrent_to_cell_outstage.run();
+        _accumulate_input_recurrent_modulation.run();
 
-        if (_has_peephole)
+        if (_has_layer_norm)
         {
-            _pixelwise_mul_cell_to_input.run();
-            _cell_to_input_outstage.run();
-            _accumulate_cell_input.run();
+            NEScheduler::get().schedule(get_layer_norm(LayerNormGate::Cell).get(), Window::DimY);
         }
 
-        if (_has_layer_norm)
+        _cell_gate_tanh.run();
+
+        // Input gate
+        if (_has_cifg)
         {
-            NEScheduler::get().schedule(get_layer_norm(LayerNormGate::Input).get(), Window::DimY);
+            _input_gate_sub.run();
         }
+        else
+        {
+            _mm_input_to_input.run();
+            _input_to_input_outstage.run();
+            _mm_recurrent_to_input.run();
+            _recurrent_to_input_outstage.run();
+            _accumulate_input_recurrent_input.run();
 
-        _input_gate_sigmoid.run();
-    }
+            if (_has_peephole)
+            {
+                _pixelwise_mul_cell_to_input.run();
+                _cell_to_input_outstage.run();
+                _accumulate_cell_input.run();
+            }
 
-    // Cell.
-    _pixelwise_mul_forget_cell.run();
-    _pixelwise_mul_input_cell.run();
-    _add_forget_cell.run();
+            if (_has_layer_norm)
+            {
+                NEScheduler::get().schedule(get_layer_norm(LayerNormGate::Input).get(), Window::DimY);
+            }
 
-    if (_has_cell_clipping)
-    {
-        _cell_clip.run();
-    }
+            _input_gate_sigmoid.run();
+        }
 
-    // Output gate.
-    _mm_input_to_output.run();
-    _input_to_output_outstage.run();
-    _mm_recurrent_to_output.run();
-    _recurrent_to_output_outstage.run();
-    _accumulate_input_recurrent_output.run();
-    if (_has_peephole)
-    {
-        _pixelwise_mul_cell_to_output.run();
-        _cell_to_output_outstage.run();
-        _accumulate_cell_to_output.run();
-    }
+        // Cell.
+        _pixelwise_mul_forget_cell.run();
+        _pixelwise_mul_input_cell.run();
+        _add_forget_cell.run();
 
-    if (_has_layer_norm)
-    {
-        NEScheduler::get().schedule(get_layer_norm(LayerNormGate::Output).get(), Window::DimY);
-    }
+        if (_has_cell_clipping)
+        {
+            _cell_clip.run();
+        }
 
-    _output_gate_sigmoid.run();
+        // Output gate.
+        _mm_input_to_output.run();
+        _input_to_output_outstage.run();
+        _mm_recurrent_to_output.run();
+        _recurrent_to_output_outstage.run();
+        _accumulate_input_recurrent_output.run();
+        if (_has_peephole)
+        {
+            _pixelwise_mul_cell_to_output.run();
+            _cell_to_output_outstage.run();
+            _accumulate_cell_to_output.run();
+        }
 
-    // Hidden.
-    _hidden_tanh.run();
-    _pixelwise_mul_hidden.run();
-    _hidden_outstage.run();
+        if (_has_layer_norm)
+        {
+            NEScheduler::get().schedule(get_layer_norm(LayerNormGate::Output).get(), Window::DimY);
+        }
+
+        _output_gate_sigmoid.run();
+
+        // Hidden.
+        _hidden_tanh.run();
+        _pixelwise_mul_hidden.run();
+        _hidden_outstage.run();
+    }
 
     // Projection.
     if (_has_projection)
@@ -1481,8 +1728,11 @@ void NEQLSTMLayer::prepare()
         // Precompute effective biases
         if (_has_cifg)
         {
-            std::fill_n(reinterpret_cast<int16_t *>(_ones.buffer()),
-                        _ones.info()->total_size() / _ones.info()->element_size(), 32767);
+            if (!_fuse_gates)
+            {
+                std::fill_n(reinterpret_cast<int16_t *>(_ones.buffer()),
+                            _ones.info()->total_size() / _ones.info()->element_size(), 32767);
+            }
         }
         else
         {
@@ -1543,6 +1793,39 @@ void NEQLSTMLayer::prepare()
         NEScheduler::get().schedule_op(_recurrent_to_output_reduction.get(), Window::DimY,
                                        _recurrent_to_output_reduction->window(), packRO);
 
+        if (_fuse_gates)
+        {
+            // Concatenate the weights and effective biases of the gates and release the per-gate copies
+            const auto concatenate_gates = [&](std::vector<Tensor *> srcs, Tensor *dst)
+            {
+                if (_has_cifg)
+                {
+                    srcs.erase(srcs.begin() + getGateIndex(LayerNormGate::Input));
+                }
+
+                dst->allocator()->allocate();
+                concatenate_along_x(std::vector<const ITensor *>(srcs.begin(), srcs.end()), dst);
+
+                for (Tensor *src : srcs)
+                {
+                    src->allocator()->free();
+                }
+            };
+
+            concatenate_gates({&_input_to_forget_weights_transposed, &_input_to_cell_weights_transposed,
+                               &_input_to_input_weights_transposed, &_input_to_output_weights_transposed},
+                              &_input_to_gates_weights);
+            concatenate_gates({&_recurrent_to_forget_weights_transposed, &_recurrent_to_cell_weights_transposed,
+                               &_recurrent_to_input_weights_transposed, &_recurrent_to_output_weights_transposed},
+                              &_recurrent_to_gates_weights);
+            concatenate_gates({&_input_to_forget_eff_bias, &_input_to_cell_eff_bias, &_input_to_input_eff_bias,
+                               &_input_to_output_eff_bias},
+                              &_input_to_gates_eff_bias);
+            concatenate_gates({&_recurrent_to_forget_eff_bias, &_recurrent_to_cell_eff_bias,
+                               &_recurrent_to_input_eff_bias, &_recurrent_to_output_eff_bias},
+                              &_recurrent_to_gates_eff_bias);
+        }
+
         if (_has_projection)
         {
             _projection_eff_bias.allocator()->allocate();
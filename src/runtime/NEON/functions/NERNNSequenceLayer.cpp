@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NERNNSequenceLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/NEON/kernels/NERecurrentCellKernel.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+unsigned int num_gates(RecurrentCellType cell_type)
+{
+    return cell_type == RecurrentCellType::GRU ? 3 : 1;
+}
+
+/** Transpose the input weights of every direction and concatenate them along the output dimension
+ *
+ * dst(d * gu + n, c) = weights(c, n, d) and bias_dst(d * gu + n) = bias(n, d)
+ */
+void concatenate_weights(const ITensor *weights, const ITensor *bias, ITensor *weights_dst, ITensor *bias_dst)
+{
+    const size_t input_size     = weights->info()->dimension(0);
+    const size_t gu             = weights->info()->dimension(1);
+    const size_t num_directions = weights->info()->dimension(2);
+
+    for (size_t d = 0; d < num_directions; ++d)
+    {
+        for (size_t n = 0; n < gu; ++n)
+        {
+            const auto *src = reinterpret_cast<const float *>(weights->ptr_to_element(Coordinates(0, n, d)));
+            for (size_t c = 0; c < input_size; ++c)
+            {
+                *reinterpret_cast<float *>(weights_dst->ptr_to_element(Coordinates(d * gu + n, c))) = src[c];
+            }
+            *reinterpret_cast<float *>(bias_dst->ptr_to_element(Coordinates(d * gu + n))) =
+                *reinterpret_cast<const float *>(bias->ptr_to_element(Coordinates(n, d)));
+        }
+    }
+}
+} // namespace
+
+NERNNSequenceLayer::~NERNNSequenceLayer() = default;
+
+NERNNSequenceLayer::NERNNSequenceLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)),
+      _input_projection(),
+      _recurrent_cell(),
+      _input_2d(),
+      _weights_transposed(),
+      _bias_concatenated(),
+      _projection(),
+      _input(nullptr),
+      _weights(nullptr),
+      _bias(nullptr),
+      _hidden_state(nullptr),
+      _output(nullptr),
+      _is_prepared(false)
+{
+}
+
+Status NERNNSequenceLayer::validate(const ITensorInfo           *input,
+                                    const ITensorInfo           *weights,
+                                    const ITensorInfo           *recurrent_weights,
+                                    const ITensorInfo           *bias,
+                                    const ITensorInfo           *recurrent_bias,
+                                    const ITensorInfo           *hidden_state,
+                                    const ITensorInfo           *output,
+                                    const RecurrentSequenceInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, bias);
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->padding().empty() == false, "Padding on the input is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
+
+    const unsigned int input_size     = input->dimension(0);
+    const unsigned int batch_size     = input->dimension(1);
+    const unsigned int seq_len        = input->dimension(2);
+    const unsigned int num_units      = recurrent_weights->dimension(1);
+    const unsigned int num_directions = info.bidirectional ? 2 : 1;
+    const unsigned int gu             = num_gates(info.cell_type) * num_units;
+
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input_size);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(1) != gu);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(2) != num_directions);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != gu);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(1) != num_directions);
+
+    const TensorInfo input_2d(TensorShape(input_size, batch_size * seq_len), 1, input->data_type());
+    const TensorInfo weights_transposed(TensorShape(num_directions * gu, input_size), 1, input->data_type());
+    const TensorInfo bias_concatenated(TensorShape(num_directions * gu), 1, input->data_type());
+    const TensorInfo projection(TensorShape(num_directions * gu, batch_size * seq_len), 1, input->data_type());
+
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        NEGEMM::validate(&input_2d, &weights_transposed, &bias_concatenated, &projection, 1.f, 1.f));
+    ARM_COMPUTE_RETURN_ON_ERROR(
+        NERecurrentCellKernel::validate(&projection, recurrent_weights, recurrent_bias, hidden_state, output, info));
+
+    return Status{};
+}
+
+void NERNNSequenceLayer::configure(const ITensor               *input,
+                                   const ITensor               *weights,
+                                   const ITensor               *recurrent_weights,
+                                   const ITensor               *bias,
+                                   const ITensor               *recurrent_bias,
+                                   ITensor                     *hidden_state,
+                                   ITensor                     *output,
+                                   const RecurrentSequenceInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NERNNSequenceLayer::validate(
+        input->info(), weights->info(), recurrent_weights->info(), bias->info(),
+        recurrent_bias != nullptr ? recurrent_bias->info() : nullptr, hidden_state->info(), output->info(), info));
+    ARM_COMPUTE_LOG_PARAMS(input, weights, recurrent_weights, bias, recurrent_bias, hidden_state, output);
+
+    const unsigned int input_size     = input->info()->dimension(0);
+    const unsigned int batch_size     = input->info()->dimension(1);
+    const unsigned int seq_len        = input->info()->dimension(2);
+    const unsigned int num_directions = info.bidirectional ? 2 : 1;
+    const unsigned int gu             = num_gates(info.cell_type) * recurrent_weights->info()->dimension(1);
+    const DataType     data_type      = input->info()->data_type();
+
+    _input        = input;
+    _weights      = weights;
+    _bias         = bias;
+    _hidden_state = hidden_state;
+    _output       = output;
+    _is_prepared  = false;
+
+    // The input is viewed as a 2D matrix so that all the timesteps are projected by a single GEMM.
+    // Its memory is imported from the input tensor at run time.
+    _input_2d.allocator()->init(TensorInfo(TensorShape(input_size, batch_size * seq_len), 1, data_type));
+    _weights_transposed.allocator()->init(TensorInfo(TensorShape(num_directions * gu, input_size), 1, data_type));
+    _bias_concatenated.allocator()->init(TensorInfo(TensorShape(num_directions * gu), 1, data_type));
+    _projection.allocator()->init(TensorInfo(TensorShape(num_directions * gu, batch_size * seq_len), 1, data_type));
+
+    _memory_group.manage(&_projection);
+    _input_projection.configure(&_input_2d, &_weights_transposed, &_bias_concatenated, &_projection, 1.f, 1.f);
+
+    _recurrent_cell = std::make_unique<NERecurrentCellKernel>();
+    _recurrent_cell->configure(&_projection, recurrent_weights, recurrent_bias, hidden_state, output, info);
+
+    _projection.allocator()->allocate();
+}
+
+void NERNNSequenceLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    _input_2d.allocator()->import_memory(_input->buffer() + _input->info()->offset_first_element_in_bytes());
+    _input_projection.run();
+
+    const unsigned int seq_len = _output->info()->dimension(2);
+    for (unsigned int step = 0; step < seq_len; ++step)
+    {
+        _recurrent_cell->set_step(step);
+        NEScheduler::get().schedule(_recurrent_cell.get(), Window::DimX);
+    }
+
+    // Write back the final hidden state of each direction: the forward direction ends on the last timestep
+    // while the backward direction ends on the first one.
+    const unsigned int num_units      = _hidden_state->info()->dimension(0);
+    const unsigned int batch_size     = _hidden_state->info()->dimension(1);
+    const unsigned int num_directions = _hidden_state->info()->dimension(2);
+    const size_t       row_size       = num_units * _hidden_state->info()->element_size();
+    for (unsigned int d = 0; d < num_directions; ++d)
+    {
+        const unsigned int t = d == 0 ? seq_len - 1 : 0;
+        for (unsigned int b = 0; b < batch_size; ++b)
+        {
+            std::memcpy(_hidden_state->ptr_to_element(Coordinates(0, b, d)),
+                        _output->ptr_to_element(Coordinates(d * num_units, b, t)), row_size);
+        }
+    }
+}
+
+void NERNNSequenceLayer::prepare()
+{
+    if (!_is_prepared)
+    {
+        _weights_transposed.allocator()->allocate();
+        _bias_concatenated.allocator()->allocate();
+        concatenate_weights(_weights, _bias, &_weights_transposed, &_bias_concatenated);
+
+        _input_projection.prepare();
+
+        // Release the concatenated weights if the GEMM has reshaped them
+        if (!_weights_transposed.is_used())
+        {
+            _weights_transposed.allocator()->free();
+        }
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024 Arm Limited.
+ * Copyright (c) 2016-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,9 +23,11 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEScale.h"
 
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/ScaleUtils.h"
 #include "src/cpu/operators/CpuScale.h"
 
@@ -40,6 +42,9 @@ struct NEScale::Impl
     Tensor offsets{
         nullptr}; /**< Offset to access the element with NEAREST interpolation or the top-left element with BILINEAR interpolation in the input tensor */
     std::unique_ptr<cpu::CpuScale> op{nullptr};
+    MemoryGroup                    memory_group{};
+    ITensorPack                    run_pack{};
+    WorkspaceData<Tensor>          workspace_tensors{};
 };
 
 NEScale::NEScale() : _impl(std::make_unique<Impl>())
@@ -124,6 +129,13 @@ void NEScale::configure(ITensor *input, ITensor *output, const ScaleKernelInfo &
             ARM_COMPUTE_ERROR("Unsupported interpolation mode");
         }
     }
+
+    _impl->run_pack          = {{TensorType::ACL_SRC, _impl->src},
+                                {TensorType::ACL_DST, _impl->dst},
+                                {TensorType::ACL_INT_0, &_impl->dx},
+                                {TensorType::ACL_INT_1, &_impl->dy},
+                                {TensorType::ACL_INT_2, &_impl->offsets}};
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack);
 }
 
 Status NEScale::validate(const ITensorInfo *input, const ITensorInfo *output, const ScaleKernelInfo &info)
@@ -134,12 +146,7 @@ Status NEScale::validate(const ITensorInfo *input, const ITensorInfo *output, co
 
 void NEScale::run()
 {
-    ITensorPack pack;
-    pack.add_tensor(TensorType::ACL_SRC, _impl->src);
-    pack.add_tensor(TensorType::ACL_DST, _impl->dst);
-    pack.add_tensor(TensorType::ACL_INT_0, &_impl->dx);
-    pack.add_tensor(TensorType::ACL_INT_1, &_impl->dy);
-    pack.add_tensor(TensorType::ACL_INT_2, &_impl->offsets);
-    _impl->op->run(pack);
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
 }
 } // namespace arm_compute
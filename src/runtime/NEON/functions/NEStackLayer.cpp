@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,31 +26,71 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/ITensorPack.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include "src/common/utils/Log.h"
-#include "src/core/NEON/kernels/NEStackLayerKernel.h"
+#include "src/cpu/kernels/CpuConcatenateKernel.h"
 
 namespace arm_compute
 {
+namespace
+{
+std::vector<const ITensorInfo *> get_infos(const std::vector<ITensor *> &tensors)
+{
+    std::vector<const ITensorInfo *> infos;
+    infos.reserve(tensors.size());
+    for (const ITensor *t : tensors)
+    {
+        ARM_COMPUTE_ERROR_ON_NULLPTR(t);
+        infos.emplace_back(t->info());
+    }
+    return infos;
+}
+} // namespace
+
+struct NEStackLayer::Impl
+{
+    std::vector<ITensor *>                              srcs{};
+    ITensor                                            *dst{nullptr};
+    unsigned int                                        axis{0};
+    ITensorPack                                         pack{};
+    std::unique_ptr<cpu::kernels::CpuConcatenateKernel> kernel{nullptr};
+    bool                                                is_prepared{false};
+};
+
 NEStackLayer::~NEStackLayer() = default;
 
 NEStackLayer::NEStackLayer() // NOLINT
-    : _stack_kernel(std::make_unique<NEStackLayerKernel>()), _is_prepared(false)
+    : _impl(std::make_unique<Impl>())
 {
 }
 
 void NEStackLayer::configure(const std::vector<ITensor *> &input, int axis, ITensor *output)
 {
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_ERROR_ON(input.empty());
     ARM_COMPUTE_LOG_PARAMS(input, axis, output);
 
     // Wrap around negative values
     const unsigned int axis_u = wrap_around(axis, static_cast<int>(input[0]->info()->num_dimensions() + 1));
 
-    _stack_kernel->configure(input, axis_u, output);
+    _impl->srcs        = input;
+    _impl->dst         = output;
+    _impl->axis        = axis_u;
+    _impl->is_prepared = false;
+    _impl->kernel      = std::make_unique<cpu::kernels::CpuConcatenateKernel>();
+    _impl->kernel->configure_stack(get_infos(input), output->info(), axis_u);
+
+    _impl->pack = ITensorPack();
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        _impl->pack.add_const_tensor(TensorType::ACL_SRC_VEC + i, input[i]);
+    }
+    _impl->pack.add_tensor(TensorType::ACL_DST, output);
 }
 
 Status NEStackLayer::validate(const std::vector<ITensorInfo *> &input, int axis, const ITensorInfo *output)
@@ -60,6 +100,7 @@ Status NEStackLayer::validate(const std::vector<ITensorInfo *> &input, int axis,
 
     for (const auto &t : input)
     {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(t);
         ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(t);
     }
     ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(output);
@@ -69,19 +110,21 @@ Status NEStackLayer::validate(const std::vector<ITensorInfo *> &input, int axis,
     const unsigned int axis_u = wrap_around(axis, static_cast<int>(rank + 1));
 
     // Validate Kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(NEStackLayerKernel::validate(input, axis_u, output));
+    const std::vector<const ITensorInfo *> srcs(input.begin(), input.end());
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::kernels::CpuConcatenateKernel::validate_stack(srcs, output, axis_u));
 
     return Status{};
 }
 
 void NEStackLayer::run()
 {
-    if (!_is_prepared)
+    if (!_impl->is_prepared)
     {
-        _stack_kernel->prepare();
-        _is_prepared = true;
+        // Plan the copy at runtime, in case there is padding being added after configure()
+        _impl->kernel->configure_stack(get_infos(_impl->srcs), _impl->dst->info(), _impl->axis);
+        _impl->is_prepared = true;
     }
 
-    NEScheduler::get().schedule(_stack_kernel.get(), _stack_kernel->get_split_dimension());
+    NEScheduler::get().schedule_op(_impl->kernel.get(), Window::DimX, _impl->kernel->window(), _impl->pack);
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, 2024-2025 Arm Limited.
+ * Copyright (c) 2017-2022, 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -116,4 +116,9 @@ void NEWinogradConvolutionLayer::prepare()
         _impl->is_prepared = true;
     }
 }
+
+MemoryFootprint NEWinogradConvolutionLayer::memory_footprint() const
+{
+    return workspace_footprint(_impl->aux_mem_req, _impl->original_weights);
+}
 } // namespace arm_compute
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEYUVPreprocess.h"
+
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/function_info/YUVPreprocessInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/operators/CpuYUVPreprocess.h"
+
+namespace arm_compute
+{
+struct NEYUVPreprocess::Impl
+{
+    std::unique_ptr<cpu::CpuYUVPreprocess> op{nullptr};
+    MemoryGroup                            memory_group{};
+    ITensorPack                            run_pack{};
+    WorkspaceData<Tensor>                  workspace_tensors{};
+};
+
+NEYUVPreprocess::NEYUVPreprocess() : _impl(std::make_unique<Impl>())
+{
+}
+NEYUVPreprocess::NEYUVPreprocess(NEYUVPreprocess &&)            = default;
+NEYUVPreprocess &NEYUVPreprocess::operator=(NEYUVPreprocess &&) = default;
+NEYUVPreprocess::~NEYUVPreprocess()                             = default;
+
+void NEYUVPreprocess::configure(const ITensor           *luma,
+                                const ITensor           *chroma0,
+                                const ITensor           *chroma1,
+                                ITensor                 *dst,
+                                const YUVPreprocessInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(luma, chroma0, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(NEYUVPreprocess::validate(luma->info(), chroma0->info(),
+                                                         chroma1 != nullptr ? chroma1->info() : nullptr, dst->info(),
+                                                         info));
+    ARM_COMPUTE_LOG_PARAMS(luma, chroma0, chroma1, dst, info);
+
+    _impl->op = std::make_unique<cpu::CpuYUVPreprocess>();
+    _impl->op->configure(luma->info(), chroma0->info(), chroma1 != nullptr ? chroma1->info() : nullptr, dst->info(),
+                         info);
+
+    _impl->run_pack = {
+        {TensorType::ACL_SRC_0, luma},
+        {TensorType::ACL_SRC_1, chroma0},
+        {TensorType::ACL_SRC_2, chroma1},
+        {TensorType::ACL_DST, dst},
+    };
+    _impl->workspace_tensors = manage_workspace<Tensor>(_impl->op->workspace(), _impl->memory_group, _impl->run_pack);
+}
+
+Status NEYUVPreprocess::validate(const ITensorInfo       *luma,
+                                 const ITensorInfo       *chroma0,
+                                 const ITensorInfo       *chroma1,
+                                 const ITensorInfo       *dst,
+                                 const YUVPreprocessInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_DYNAMIC_SHAPE(luma, chroma0, chroma1, dst);
+    return cpu::CpuYUVPreprocess::validate(luma, chroma0, chroma1, dst, info);
+}
+
+void NEYUVPreprocess::run()
+{
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,7 +94,13 @@ void OMPScheduler::schedule_op(ICPPKernel *kernel, const Hints &hints, const Win
     const unsigned int candidate_num_threads = (num_iterations + mws - 1) / mws;
 
     // Cap the number of threads to be spawn with the size of the thread pool
-    const unsigned int num_threads = std::min(candidate_num_threads, _num_threads);
+    unsigned int num_threads = std::min(candidate_num_threads, _num_threads);
+
+    // Run small workloads on fewer threads according to their estimated cost
+    if (kernel->is_parallelisable() && num_threads > 1)
+    {
+        num_threads = adjust_num_of_windows_by_cost(*kernel, max_window, num_threads);
+    }
 
     if (!kernel->is_parallelisable() || num_threads == 1)
     {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,6 +63,11 @@ MappingType OffsetLifetimeManager::mapping_type() const
     return MappingType::OFFSETS;
 }
 
+size_t OffsetLifetimeManager::pool_size() const
+{
+    return _blob.size;
+}
+
 void OffsetLifetimeManager::update_blobs_and_mappings()
 {
     ARM_COMPUTE_ERROR_ON(!are_all_finalized());
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Error.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace arm_compute
@@ -78,5 +79,20 @@ std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std:
     }
 }
 #endif /* #ifndef BARE_METAL */
+
+unsigned int num_threads_from_cost(uint64_t cost, unsigned int max_threads, unsigned int previous_num_threads)
+{
+    const uint64_t     ideal_num_threads = std::min<uint64_t>(cost / min_thread_cost_ns, max_threads);
+    const unsigned int num_threads       = static_cast<unsigned int>(std::max<uint64_t>(1, ideal_num_threads));
+
+    // Do not wake more workers up than the previous dispatch did if the gain is marginal
+    if (previous_num_threads != 0 && previous_num_threads < num_threads &&
+        cost / previous_num_threads <= 2 * min_thread_cost_ns)
+    {
+        return previous_num_threads;
+    }
+
+    return num_threads;
+}
 } // namespace scheduler_utils
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 #define SRC_COMPUTE_SCHEDULER_UTILS_H
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
 namespace arm_compute
@@ -40,6 +41,26 @@ namespace scheduler_utils
  * @returns [m_nthreads, n_nthreads] A pair of the threads that should be used in each dimension
  */
 std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std::size_t n);
+
+/** Minimum estimated execution time, in nanoseconds, each thread must be given for a dispatch to be split
+ *
+ * Waking up a worker and joining it costs a few microseconds, so each thread needs several times that amount of work.
+ */
+constexpr uint64_t min_thread_cost_ns = 10000;
+
+/** Number of threads to use for a workload given its estimated execution time
+ *
+ * Each thread is given at least @ref min_thread_cost_ns of work, so workloads below twice that cost run inline on
+ * the calling thread. Consecutive small workloads are batched on the thread count of the previous dispatch: more
+ * workers are only woken up if each of the previous threads would get more than twice the minimum cost.
+ *
+ * @param[in] cost                 Estimated single-threaded execution time of the workload in nanoseconds.
+ * @param[in] max_threads          Maximum number of threads that can be used.
+ * @param[in] previous_num_threads Number of threads selected for the previous workload, 0 if unknown.
+ *
+ * @return Number of threads to use, between 1 and @p max_threads
+ */
+unsigned int num_threads_from_cost(uint64_t cost, unsigned int max_threads, unsigned int previous_num_threads);
 } // namespace scheduler_utils
 } // namespace arm_compute
 #endif /* SRC_COMPUTE_SCHEDULER_UTILS_H */
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_COMMANDLISTFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_COMMANDLISTFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CommandList.h"
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Chain of small activation layers, run either function by function or by replaying a recorded command list */
+template <typename TensorType, typename Function, typename Accessor>
+class CommandListFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, int num_layers, bool replay)
+    {
+        replay_commands = replay;
+
+        src  = create_tensor<TensorType>(shape, DataType::F32);
+        ping = create_tensor<TensorType>(shape, DataType::F32);
+        pong = create_tensor<TensorType>(shape, DataType::F32);
+
+        const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f);
+
+        // Create and configure the functions
+        TensorType *in = &src;
+        for (int i = 0; i < num_layers; ++i)
+        {
+            TensorType *out = (i % 2 == 0) ? &ping : &pong;
+            functions.emplace_back(std::make_unique<Function>());
+            functions.back()->configure(in, out, act_info);
+            in = out;
+        }
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        ping.allocator()->allocate();
+        pong.allocator()->allocate();
+
+        if (replay_commands)
+        {
+            commands.record([this]() { run_functions(); });
+        }
+    }
+
+    void run()
+    {
+        if (replay_commands)
+        {
+            commands.replay();
+        }
+        else
+        {
+            run_functions();
+        }
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(ping);
+    }
+
+    void teardown()
+    {
+        functions.clear();
+        src.allocator()->free();
+        ping.allocator()->free();
+        pong.allocator()->free();
+    }
+
+private:
+    void run_functions()
+    {
+        for (auto &f : functions)
+        {
+            f->run();
+        }
+    }
+
+    TensorType                             src{};
+    TensorType                             ping{};
+    TensorType                             pong{};
+    std::vector<std::unique_ptr<Function>> functions{};
+    CommandList                            commands{};
+    bool                                   replay_commands{false};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_COMMANDLISTFIXTURE_H
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_BENCHMARK_FIXTURES_ROIALIGNLAYERFIXTURE_H
+#define ACL_TESTS_BENCHMARK_FIXTURES_ROIALIGNLAYERFIXTURE_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include "tests/Globals.h"
+#include "tests/Utils.h"
+#include "tests/framework/Fixture.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+template <typename TensorType, typename Function, typename Accessor, typename TRois>
+class ROIAlignLayerFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape         input_shape,
+               ROIPoolingLayerInfo pool_info,
+               TensorShape         rois_shape,
+               DataType            data_type,
+               DataLayout          data_layout)
+    {
+        const bool             is_qasymm   = is_data_type_quantized_asymmetric(data_type);
+        const DataType         rois_type   = is_qasymm ? DataType::QASYMM16 : data_type;
+        const QuantizationInfo qinfo       = is_qasymm ? QuantizationInfo(1.f / 255.f, 127) : QuantizationInfo();
+        const QuantizationInfo rois_qinfo  = is_qasymm ? QuantizationInfo(0.125f, 0) : QuantizationInfo();
+        const QuantizationInfo output_info = is_qasymm ? QuantizationInfo(2.f / 255.f, 120) : QuantizationInfo();
+
+        if (data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        src  = create_tensor<TensorType>(input_shape, data_type, 1, qinfo, data_layout);
+        rois = create_tensor<TensorType>(rois_shape, rois_type, 1, rois_qinfo);
+
+        const TensorShape dst_shape =
+            misc::shape_calculator::compute_roi_align_shape(*src.info(), *rois.info(), pool_info);
+        dst = create_tensor<TensorType>(dst_shape, data_type, 1, output_info, data_layout);
+
+        // Create and configure function
+        roi_align_func.configure(&src, &rois, &dst, pool_info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        rois.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        generate_rois(Accessor(rois), input_shape, pool_info, rois_shape, data_layout);
+    }
+
+    void run()
+    {
+        roi_align_func.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        rois.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    template <typename U>
+    void generate_rois(U                        &&rois_accessor,
+                       const TensorShape         &shape,
+                       const ROIPoolingLayerInfo &pool_info,
+                       const TensorShape         &rois_shape,
+                       DataLayout                 data_layout)
+    {
+        const size_t values_per_roi = rois_shape.x();
+        const size_t num_rois       = rois_shape.y();
+
+        std::mt19937 gen(library->seed());
+        TRois       *rois_ptr = static_cast<TRois *>(rois_accessor.data());
+
+        const float pool_width  = pool_info.pooled_width();
+        const float pool_height = pool_info.pooled_height();
+        const float roi_scale   = pool_info.spatial_scale();
+
+        // Keep the regions inside the input so that every bin is sampled
+        const auto scaled_width =
+            static_cast<float>((shape[get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)] /
+                                roi_scale) /
+                               pool_width);
+        const auto scaled_height =
+            static_cast<float>((shape[get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT)] /
+                                roi_scale) /
+                               pool_height);
+        const auto min_width  = static_cast<float>(pool_width / roi_scale);
+        const auto min_height = static_cast<float>(pool_height / roi_scale);
+
+        std::uniform_int_distribution<int> dist_batch(0, shape[3] - 1);
+        std::uniform_int_distribution<>    dist_x1(0, scaled_width);
+        std::uniform_int_distribution<>    dist_y1(0, scaled_height);
+        std::uniform_int_distribution<>    dist_w(min_width, std::max(min_width, (pool_width - 2) * scaled_width));
+        std::uniform_int_distribution<>    dist_h(min_height, std::max(min_height, (pool_height - 2) * scaled_height));
+
+        for (unsigned int pw = 0; pw < num_rois; ++pw)
+        {
+            const auto batch_idx = dist_batch(gen);
+            const auto x1        = dist_x1(gen);
+            const auto y1        = dist_y1(gen);
+            const auto x2        = x1 + dist_w(gen);
+            const auto y2        = y1 + dist_h(gen);
+
+            rois_ptr[values_per_roi * pw] = batch_idx;
+            if (rois_accessor.data_type() == DataType::QASYMM16)
+            {
+                const QuantizationInfo &rois_qinfo = rois_accessor.quantization_info();
+                rois_ptr[values_per_roi * pw + 1]  = quantize_qasymm16(static_cast<float>(x1), rois_qinfo);
+                rois_ptr[values_per_roi * pw + 2]  = quantize_qasymm16(static_cast<float>(y1), rois_qinfo);
+                rois_ptr[values_per_roi * pw + 3]  = quantize_qasymm16(static_cast<float>(x2), rois_qinfo);
+                rois_ptr[values_per_roi * pw + 4]  = quantize_qasymm16(static_cast<float>(y2), rois_qinfo);
+            }
+            else
+            {
+                rois_ptr[values_per_roi * pw + 1] = static_cast<TRois>(x1);
+                rois_ptr[values_per_roi * pw + 2] = static_cast<TRois>(y1);
+                rois_ptr[values_per_roi * pw + 3] = static_cast<TRois>(x2);
+                rois_ptr[values_per_roi * pw + 4] = static_cast<TRois>(y2);
+            }
+        }
+    }
+
+    TensorType src{};
+    TensorType rois{};
+    TensorType dst{};
+    Function   roi_align_func{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_BENCHMARK_FIXTURES_ROIALIGNLAYERFIXTURE_H
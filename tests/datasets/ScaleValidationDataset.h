@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited.
+ * Copyright (c) 2020-2022, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -190,6 +190,13 @@ framework::dataset::make("AlignCorners", { true }));
                     framework::dataset::make("BorderMode", { BorderMode::CONSTANT, BorderMode::REPLICATE })), \
             samping_policy_set)
 
+/** Generating dataset for area interpolation on NHWC, which requires border mode REPLICATE */
+#define ASSEMBLE_NHWC_AREA_DATASET(shape, samping_policy_set)                                               \
+    combine(combine(combine(combine((shape), framework::dataset::make("DataLayout", DataLayout::NHWC)),     \
+                            framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::AREA })), \
+                    framework::dataset::make("BorderMode", { BorderMode::REPLICATE })),                     \
+            samping_policy_set)
+
 /** Generating dataset for quantized data tyeps with the given shapes */
 #define ASSEMBLE_QUANTIZED_DATASET(shape, sampling_policy_set, quantization_info_set) \
     combine(combine(combine(combine(combine(shape,                                    \
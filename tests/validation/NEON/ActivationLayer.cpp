@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/core/utils/StringUtils.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/RuntimeContext.h"
+#include "arm_compute/runtime/SubTensor.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "src/common/cpuinfo/CpuIsaInfo.h"
@@ -211,6 +212,88 @@ TEST_CASE(SqrtBoundaryValue, framework::DatasetMode::ALL)
 {
     test_float_sqrt_boundary_value<float>();
 }
+/** Validate that a strided view can be used as destination
+ *
+ * The destination is a sub-tensor covering only part of the rows of its parent, so the kernel
+ * must not squash its window and the elements outside of the view must be left untouched.
+ */
+TEST_CASE(SubTensorDestination, framework::DatasetMode::ALL)
+{
+    Tensor    parent = create_tensor<Tensor>(TensorShape(16U, 4U, 2U), DataType::F32);
+    Tensor    src    = create_tensor<Tensor>(TensorShape(8U, 4U, 2U), DataType::F32);
+    SubTensor dst(&parent, TensorShape(8U, 4U, 2U), Coordinates(4, 0, 0));
+
+    NEActivationLayer act;
+    act.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+
+    parent.allocator()->allocate();
+    src.allocator()->allocate();
+
+    std::fill_n(reinterpret_cast<float *>(parent.buffer()), parent.info()->tensor_shape().total_size(), -1.f);
+    for (size_t i = 0; i < src.info()->tensor_shape().total_size(); ++i)
+    {
+        reinterpret_cast<float *>(src.buffer())[i] = static_cast<float>(i) - 20.f;
+    }
+
+    act.run();
+
+    const auto *parent_ptr = reinterpret_cast<const float *>(parent.buffer());
+    const auto *src_ptr    = reinterpret_cast<const float *>(src.buffer());
+    for (size_t z = 0; z < 2; ++z)
+    {
+        for (size_t y = 0; y < 4; ++y)
+        {
+            for (size_t x = 0; x < 16; ++x)
+            {
+                const float actual   = parent_ptr[(z * 4 + y) * 16 + x];
+                const bool  in_view  = x >= 4 && x < 12;
+                const float expected = in_view ? std::max(src_ptr[(z * 4 + y) * 8 + x - 4], 0.f) : -1.f;
+                ARM_COMPUTE_EXPECT(actual == expected, framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+/** Validate the reduced accuracy approximations enabled by ActivationLayerInfo::fast_math()
+ *
+ * The input sweeps [-20, 20], which covers the saturated regions of logistic and tanh and the
+ * neighbourhood of 0 where e^x - 1 would cancel out without a dedicated approximation.
+ */
+DATA_TEST_CASE(FastMath, framework::DatasetMode::ALL, framework::dataset::make("ActivationFunction",
+{
+    ActivationLayerInfo::ActivationFunction::LOGISTIC,
+    ActivationLayerInfo::ActivationFunction::TANH,
+    ActivationLayerInfo::ActivationFunction::SOFT_RELU,
+    ActivationLayerInfo::ActivationFunction::ELU,
+    ActivationLayerInfo::ActivationFunction::SWISH,
+}),
+function)
+{
+    constexpr size_t num_elements = 4003;
+
+    const TensorShape         shape(num_elements);
+    const ActivationLayerInfo info(function, 1.f, 1.f, true);
+
+    Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst = create_tensor<Tensor>(shape, DataType::F32);
+
+    NEActivationLayer act;
+    act.configure(&src, &dst, info);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    for(size_t i = 0; i < num_elements; ++i)
+    {
+        const float value = -20.f + 40.f * static_cast<float>(i) / static_cast<float>(num_elements - 1);
+        reinterpret_cast<float *>(src.buffer())[i] = value;
+        ref_src[i]                                  = value;
+    }
+
+    act.run();
+
+    validate(Accessor(dst), reference::activation_layer<float>(ref_src, info), RelativeTolerance<float>(0.001f), 0.f, AbsoluteTolerance<float>(1e-5f));
+}
 FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerFixture<float>, framework::DatasetMode::ALL, combine(combine(datasets::SmallShapes(), ActivationDataset), framework::dataset::make("DataType",
                                                                                                        DataType::F32)))
 
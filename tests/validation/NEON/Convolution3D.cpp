@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2024 Arm Limited.
+ * Copyright (c) 2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,8 @@
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/DirectConvolution3DFixture.h"
 
+#include "src/cpu/operators/CpuGemmConv3d.h"
+
 namespace arm_compute
 {
 namespace test
@@ -72,6 +74,25 @@ const auto data_precommit = combine(combine(zip(zip(zip(zip(zip(zip(zip(zip(zip(
                                                 framework::dataset::make("NumKernels", { 2, 3, 8 })),
                                             framework::dataset::make("HasBias", { true, false })),
                                     ActivationFunctionsDataset);
+
+/** Configurations lowered to the indirect GEMM, with kernel depths above one and padded depth slices */
+const auto data_gemm = combine(zip(zip(zip(zip(zip(zip(zip(zip(zip(zip(zip(
+                                                                           framework::dataset::make("InputShape", { TensorShape(8U, 9U, 7U, 6U, 2U),
+                                                                                                                    TensorShape(5U, 11U, 6U, 5U),
+                                                                                                                    TensorShape(16U, 7U, 7U, 4U, 1U)
+                                                                                                                  }),
+                                                                           framework::dataset::make("StrideX", { 1, 2, 1 })),
+                                                                       framework::dataset::make("StrideY", { 1, 1, 2 })),
+                                                                   framework::dataset::make("StrideZ", { 1, 2, 1 })),
+                                                               framework::dataset::make("PadX", { 1, 0, 2 })),
+                                                           framework::dataset::make("PadY", { 1, 1, 0 })),
+                                                       framework::dataset::make("PadZ", { 1, 2, 1 })),
+                                                   framework::dataset::make("KernelWidth", { 3, 3, 5 })),
+                                               framework::dataset::make("KernelHeight", { 3, 2, 3 })),
+                                           framework::dataset::make("KernelDepth", { 3, 3, 2 })),
+                                       framework::dataset::make("NumKernels", { 4, 3, 8 })),
+                                   framework::dataset::make("HasBias", { true, false, true })),
+                               framework::dataset::make("Activation", ActivationLayerInfo()));
 } // namespace
 
 TEST_SUITE(NEON)
@@ -123,6 +144,33 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
         bool is_valid = bool(NEConv3D::validate(&input_info.clone()->set_is_resizable(false), &weights_info.clone()->set_is_resizable(false), &biases_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), conv3d_info));
         ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
 }
+
+DATA_TEST_CASE(ValidateGemmPath, framework::DatasetMode::ALL, data_gemm,
+               input_shape, stride_x, stride_y, stride_z, pad_x, pad_y, pad_z, kernel_w, kernel_h, kernel_d, num_kernels, has_bias, act_info)
+{
+    const TensorInfo input_info(input_shape, 1U, DataType::F32, DataLayout::NDHWC);
+    const TensorInfo weights_info(TensorShape(num_kernels, input_shape[0], kernel_w, kernel_h, kernel_d), 1U, DataType::F32);
+    const TensorInfo biases_info(TensorShape(num_kernels), 1U, DataType::F32);
+    const TensorInfo output_info;
+    const Conv3dInfo conv3d_info(Size3D(stride_x, stride_y, stride_z), Padding3D(pad_x, pad_y, pad_z), act_info, Size3D(1U, 1U, 1U), DimensionRoundingType::FLOOR, false);
+
+    // The fixtures run on this dataset must exercise the depth gather rather than the direct kernel
+    const bool is_valid = bool(cpu::CpuGemmConv3d::validate(&input_info, &weights_info, has_bias ? &biases_info : nullptr, &output_info, conv3d_info));
+    ARM_COMPUTE_EXPECT(is_valid, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FallbackOnLargeGather, framework::DatasetMode::ALL)
+{
+    // Gathering three depth slices per output slice needs about 96MB, above the limit of the indirect GEMM path
+    const TensorInfo input_info(TensorShape(32U, 64U, 64U, 64U), 1U, DataType::F32, DataLayout::NDHWC);
+    const TensorInfo weights_info(TensorShape(16U, 32U, 3U, 3U, 3U), 1U, DataType::F32);
+    const TensorInfo biases_info(TensorShape(16U), 1U, DataType::F32);
+    const TensorInfo output_info;
+    const Conv3dInfo conv3d_info(Size3D(1U, 1U, 1U), Padding3D(1U, 1U, 1U), ActivationLayerInfo(), Size3D(1U, 1U, 1U), DimensionRoundingType::FLOOR, false);
+
+    ARM_COMPUTE_EXPECT(!bool(cpu::CpuGemmConv3d::validate(&input_info, &weights_info, &biases_info, &output_info, conv3d_info)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEConv3D::validate(&input_info, &weights_info, &biases_info, &output_info, conv3d_info)), framework::LogLevel::ERRORS);
+}
 // clang-format on
 // *INDENT-ON*
 
@@ -138,6 +186,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DFixture<float>, framework:
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+
+FIXTURE_DATA_TEST_CASE(RunGemm, NEDirectConvolution3DFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(data_gemm,
+                                                                                                                framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                framework::dataset::make("DataLayout", { DataLayout::NDHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -195,6 +251,18 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DQuantizedFixture<uint8_t>,
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
 
+FIXTURE_DATA_TEST_CASE(RunGemm, NEDirectConvolution3DQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(data_gemm,
+                                                               framework::dataset::make("DataType", DataType::QASYMM8)),
+                                                       framework::dataset::make("DataLayout", DataLayout::NDHWC)),
+                                               framework::dataset::make("SrcQuantizationInfo", QuantizationInfo(0.1f, 10))),
+                                       framework::dataset::make("WeightsQuantizationInfo", QuantizationInfo(0.3f, 20))),
+                               framework::dataset::make("DstQuantizationInfo", QuantizationInfo(0.2f, 5))))
+{
+    // Padded depth slices hold the source zero point, so a non-zero offset checks the gathered padding
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -226,6 +294,18 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DQuantizedFixture<int8_t>,
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
 
+FIXTURE_DATA_TEST_CASE(RunGemm, NEDirectConvolution3DQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(data_gemm,
+                                                               framework::dataset::make("DataType", DataType::QASYMM8_SIGNED)),
+                                                       framework::dataset::make("DataLayout", DataLayout::NDHWC)),
+                                               framework::dataset::make("SrcQuantizationInfo", QuantizationInfo(0.1f, -10))),
+                                       framework::dataset::make("WeightsQuantizationInfo", QuantizationInfo(0.3f, 20))),
+                               framework::dataset::make("DstQuantizationInfo", QuantizationInfo(0.2f, 5))))
+{
+    // Padded depth slices hold the source zero point, so a non-zero offset checks the gathered padding
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+
 TEST_SUITE_END() // QASYMM8_SIGNED
 TEST_SUITE_END() // Quantized
 
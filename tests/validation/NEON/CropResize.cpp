@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 
 #include "tests/NEON/Accessor.h"
 #include "tests/datasets/CropResizeDataset.h"
+#include "tests/Globals.h"
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 #include "tests/framework/datasets/Datasets.h"
@@ -140,6 +141,46 @@ FIXTURE_DATA_TEST_CASE(RunSmall,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32, 0.01);
 }
+
+TEST_CASE(OutOfRangeBatchIndex, framework::DatasetMode::ALL)
+{
+    constexpr float     extrapolation_value = 100.f;
+    const Coordinates2D crop_size{ 5, 5 };
+    const int32_t       batch_indices[] = { -1, 2, 1000 };
+
+    Tensor src       = create_tensor<Tensor>(TensorShape(19U, 7U, 7U, 2U), DataType::U8, 1, QuantizationInfo(), DataLayout::NHWC);
+    Tensor boxes     = create_tensor<Tensor>(TensorShape(4U, 3U), DataType::F32);
+    Tensor boxes_ind = create_tensor<Tensor>(TensorShape(3U), DataType::S32);
+    Tensor dst       = create_tensor<Tensor>(TensorShape(19U, 5U, 5U, 3U), DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+
+    NECropResize crop;
+    crop.configure(&src, &boxes, &boxes_ind, &dst, crop_size, InterpolationPolicy::BILINEAR, extrapolation_value);
+
+    src.allocator()->allocate();
+    boxes.allocator()->allocate();
+    boxes_ind.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(src), 0);
+    for(unsigned int b = 0; b < 3; ++b)
+    {
+        // Boxes cover the whole image, only the batch index is invalid.
+        *reinterpret_cast<float *>(boxes.ptr_to_element(Coordinates(0, b))) = 0.f;
+        *reinterpret_cast<float *>(boxes.ptr_to_element(Coordinates(1, b))) = 0.f;
+        *reinterpret_cast<float *>(boxes.ptr_to_element(Coordinates(2, b))) = 1.f;
+        *reinterpret_cast<float *>(boxes.ptr_to_element(Coordinates(3, b))) = 1.f;
+        *reinterpret_cast<int32_t *>(boxes_ind.ptr_to_element(Coordinates(b))) = batch_indices[b];
+    }
+
+    crop.run();
+
+    Window win;
+    win.use_tensor_dimensions(dst.info()->tensor_shape());
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        ARM_COMPUTE_EXPECT(*reinterpret_cast<float *>(dst.ptr_to_element(id)) == extrapolation_value, framework::LogLevel::ERRORS);
+    });
+}
 TEST_SUITE_END() // U8
 
 TEST_SUITE(U16)
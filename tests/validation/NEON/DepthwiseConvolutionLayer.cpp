@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 #include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
+#include "src/core/NEON/kernels/assembly/depthwise.hpp"
 #include "tests/NEON/Accessor.h"
 #include "tests/PaddingCalculator.h"
 #include "tests/datasets/DepthwiseConvolutionLayerDataset.h"
@@ -54,6 +55,8 @@ namespace
 constexpr RelativeTolerance<float>   tolerance_f32(0.01f);        /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
 constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);        /**< Tolerance value for comparing reference's output against implementation's output for DataType::QASYMM8 */
 constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1); /**< Tolerance value for comparing reference's output against implementation's output for DataType::QASYMM8_SIGNED */
+constexpr AbsoluteTolerance<float>  tolerance_fast_math_f32(0.02f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 with fast math (BF16 arithmetic) */
+constexpr float                      tolerance_num_fast_math = 0.01f; /**< Tolerance number for DataType::F32 with fast math */
 #ifdef ARM_COMPUTE_ENABLE_FP16
 RelativeTolerance<half_float::half> tolerance_f16(half_float::half(0.02)); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F16 */
 constexpr float                     tolerance_num = 0.05f;                 /**< Tolerance number */
@@ -349,6 +352,8 @@ template <typename T>
 using NEDepthwiseConvolutionLayerMixedDataLayoutFixture = DepthwiseConvolutionLayerValidationFixture<Tensor, Accessor, NEDepthwiseConvolutionLayer, T, true>;
 template <typename T>
 using NEDepthwiseConvolutionLayerVariableWeightsFixture = DepthwiseConvolutionLayerValidationFixture<Tensor, Accessor, NEDepthwiseConvolutionLayer, T, false, false, true>;
+template <typename T>
+using NEDepthwiseConvolutionLayerFastMathFixture = DepthwiseConvolutionLayerValidationFastMathFixture<Tensor, Accessor, NEDepthwiseConvolutionLayer, T>;
 
 TEST_SUITE(Float)
 TEST_SUITE(F32)
@@ -531,6 +536,75 @@ FIXTURE_DATA_TEST_CASE_NEW(RunVariableWeightsLarge3x3, NEDepthwiseConvolutionLay
 {
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+TEST_SUITE(FastMath)
+FIXTURE_DATA_TEST_CASE_NEW(RunSmall3x3, NEDepthwiseConvolutionLayerFastMathFixture<float>, framework::DatasetMode::PRECOMMIT,
+                           combine(combine(combine(combine(datasets::SmallOptimizedDepthwiseConvolutionLayerDataset3x3(),
+                                                           make("DepthMultiplier", 1)),
+                                                   make("DataType",
+                                                                            DataType::F32)),
+                                           make("DataLayout", { DataLayout::NHWC })),
+                                   ActivationFunctionsDataset))
+{
+    validate(Accessor(_target), _reference, tolerance_fast_math_f32, tolerance_num_fast_math);
+}
+FIXTURE_DATA_TEST_CASE_NEW(RunSmall5x5, NEDepthwiseConvolutionLayerFastMathFixture<float>, framework::DatasetMode::PRECOMMIT,
+                           combine(combine(combine(combine(datasets::SmallOptimizedDepthwiseConvolutionLayerDataset5x5(),
+                                                           make("DepthMultiplier", 1)),
+                                                   make("DataType",
+                                                                            DataType::F32)),
+                                           make("DataLayout", { DataLayout::NHWC })),
+                                   ActivationFunctionsDataset))
+{
+    validate(Accessor(_target), _reference, tolerance_fast_math_f32, tolerance_num_fast_math);
+}
+FIXTURE_DATA_TEST_CASE_NEW(RunLarge3x3, NEDepthwiseConvolutionLayerFastMathFixture<float>, framework::DatasetMode::NIGHTLY,
+                           combine(combine(combine(combine(datasets::LargeOptimizedDepthwiseConvolutionLayerDataset3x3(),
+                                                           make("DepthMultiplier", 1)),
+                                                   make("DataType",
+                                                                            DataType::F32)),
+                                           make("DataLayout", { DataLayout::NHWC })),
+                                   make("ActivationInfo", { ActivationLayerInfo() })))
+{
+    validate(Accessor(_target), _reference, tolerance_fast_math_f32, tolerance_num_fast_math);
+}
+/** Validate that the BF16 kernels are selected when fast math is enabled and the CPU supports them */
+DATA_TEST_CASE(KernelSelection, framework::DatasetMode::ALL,
+               combine(combine(make("KernelSize", { 3U, 5U }),
+                               make("Stride", { 1U, 2U })),
+                       make("EnableFastMath", { false, true })),
+               kernel_size, stride, enable_fast_math)
+{
+    const unsigned int            pad = kernel_size / 2;
+    const arm_conv::PaddingValues padding{ pad, pad, pad, pad };
+    const unsigned int            input_size  = 32U;
+    const unsigned int            output_size = (input_size + 2 * pad - kernel_size) / stride + 1;
+
+    arm_conv::depthwise::DepthwiseArgs args(&Scheduler::get().cpu_info(), kernel_size, kernel_size, stride, stride, 1U, input_size, input_size, 64U,
+                                            output_size, output_size, 1U, padding, arm_gemm::Activation(), nullptr);
+    args.fast_mode = enable_fast_math;
+
+    const auto kernels  = arm_conv::depthwise::get_compatible_kernels<float>(args);
+    const auto selected = std::find_if(kernels.begin(), kernels.end(), [](const arm_conv::depthwise::KernelDescription & kernel)
+    {
+        return kernel.is_default;
+    });
+    ARM_COMPUTE_ASSERT(selected != kernels.end());
+
+#if defined(ARM_COMPUTE_ENABLE_BF16)
+    // SME2 planar kernels have no cycle estimate: they are picked by their position in the list whatever the precision
+    const CPUInfo &cpu_info = Scheduler::get().cpu_info();
+    if(cpu_info.has_sme2())
+    {
+        return;
+    }
+    const bool expect_bf16 = enable_fast_math && cpu_info.has_bf16();
+#else  // defined(ARM_COMPUTE_ENABLE_BF16)
+    const bool expect_bf16 = false;
+#endif // defined(ARM_COMPUTE_ENABLE_BF16)
+    const bool is_bf16 = selected->name.find("bf16") != std::string::npos;
+    ARM_COMPUTE_EXPECT(is_bf16 == expect_bf16, framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // FastMath
 TEST_SUITE_END() // Optimized
 TEST_SUITE_END() // F32
 
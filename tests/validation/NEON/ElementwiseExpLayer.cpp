@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -43,6 +43,7 @@ namespace validation
 namespace
 {
 RelativeTolerance<float> tolerance_fp32(0.000001f);
+RelativeTolerance<float> tolerance_fast_fp32(0.0002f); // The fast exponential has a relative error of about 1e-4
 #ifdef ARM_COMPUTE_ENABLE_FP16
 RelativeTolerance<float> tolerance_fp16(0.01f);
 #endif // ARM_COMPUTE_ENABLE_FP16
@@ -55,6 +56,15 @@ constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1); // There is differenc
 constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1);
 #endif // #if !defined(__aarch64__)
 
+/** Exponential function configured with the fast-math exponential */
+class NEFastMathExpLayer : public NEExpLayer
+{
+public:
+    void configure(const ITensor *input, ITensor *output)
+    {
+        NEExpLayer::configure(input, output, true /* fast_math */);
+    }
+};
 } // namespace
 TEST_SUITE(NEON)
 TEST_SUITE(ExpLayer)
@@ -62,6 +72,9 @@ TEST_SUITE(ExpLayer)
 template <typename T>
 using NEExpLayerFixture = ExpValidationFixture<Tensor, Accessor, NEExpLayer, T>;
 
+template <typename T>
+using NEFastMathExpLayerFixture = ExpValidationFixture<Tensor, Accessor, NEFastMathExpLayer, T>;
+
 template <typename T>
 using NEExpLayerQuantizedFixture = ExpQuantizedValidationFixture<Tensor, Accessor, NEExpLayer, T>;
 
@@ -97,6 +110,23 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEExpLayerFixture<half>, framework::DatasetMode
     }
 }
 
+TEST_SUITE(FastMath)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFastMathExpLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallShapes(), framework::dataset::make("DataType",
+                                                                                                             DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_fp16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FastMath
+
 TEST_SUITE_END() // FP16
 #endif           // ARM_COMPUTE_ENABLE_FP16
 
@@ -107,6 +137,15 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEExpLayerFixture<float>, framework::DatasetMod
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+
+TEST_SUITE(FastMath)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFastMathExpLayerFixture<float>, framework::DatasetMode::ALL, combine(datasets::SmallShapes(), framework::dataset::make("DataType",
+                                                                                                        DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fast_fp32);
+}
+TEST_SUITE_END() // FastMath
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
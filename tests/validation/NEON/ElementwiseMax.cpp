@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2024 Arm Limited.
+ * Copyright (c) 2018-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEElementwiseOperations.h"
+#include "arm_compute/runtime/SubTensor.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
@@ -112,6 +113,53 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
 // clang-format on
 // *INDENT-ON*
 
+/** Validate that a strided view can be used as destination
+ *
+ * The destination is a sub-tensor covering only part of the rows of its parent, so the kernel
+ * must not squash its window and the elements outside of the view must be left untouched.
+ */
+TEST_CASE(SubTensorDestination, framework::DatasetMode::ALL)
+{
+    Tensor    parent = create_tensor<Tensor>(TensorShape(16U, 4U, 2U), DataType::S32);
+    Tensor    src0   = create_tensor<Tensor>(TensorShape(8U, 4U, 2U), DataType::S32);
+    Tensor    src1   = create_tensor<Tensor>(TensorShape(8U, 4U, 2U), DataType::S32);
+    SubTensor dst(&parent, TensorShape(8U, 4U, 2U), Coordinates(4, 0, 0));
+
+    NEElementwiseMax max;
+    max.configure(&src0, &src1, &dst);
+
+    parent.allocator()->allocate();
+    src0.allocator()->allocate();
+    src1.allocator()->allocate();
+
+    std::fill_n(reinterpret_cast<int32_t *>(parent.buffer()), parent.info()->tensor_shape().total_size(), -100);
+    for(size_t i = 0; i < src0.info()->tensor_shape().total_size(); ++i)
+    {
+        reinterpret_cast<int32_t *>(src0.buffer())[i] = static_cast<int32_t>(i) - 20;
+        reinterpret_cast<int32_t *>(src1.buffer())[i] = 20 - static_cast<int32_t>(i);
+    }
+
+    max.run();
+
+    const auto *parent_ptr = reinterpret_cast<const int32_t *>(parent.buffer());
+    const auto *src0_ptr   = reinterpret_cast<const int32_t *>(src0.buffer());
+    const auto *src1_ptr   = reinterpret_cast<const int32_t *>(src1.buffer());
+    for(size_t z = 0; z < 2; ++z)
+    {
+        for(size_t y = 0; y < 4; ++y)
+        {
+            for(size_t x = 0; x < 16; ++x)
+            {
+                const size_t  src_idx  = (z * 4 + y) * 8 + x - 4;
+                const int32_t actual   = parent_ptr[(z * 4 + y) * 16 + x];
+                const bool    in_view  = x >= 4 && x < 12;
+                const int32_t expected = in_view ? std::max(src0_ptr[src_idx], src1_ptr[src_idx]) : -100;
+                ARM_COMPUTE_EXPECT(actual == expected, framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+
 TEST_SUITE(S32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEElementwiseMaxFixture<int32_t>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallShapes(), ElementwiseMaxS32Dataset),
                                                                                                               InPlaceDataSet))
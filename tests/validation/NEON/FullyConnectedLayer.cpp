@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -197,6 +198,63 @@ TEST_CASE(MultipleExecutionWithConfigure, framework::DatasetMode::ALL)
     }
 }
 
+/** Test case for @ref NEFullyConnectedLayer replicas sharing their prepared weights.
+ *
+ * Two functions with identical weights held by different tensors are prepared with the same weights manager.
+ *
+ * Checks performed in order:
+ * - The prepared weights are shared
+ * - Both functions compute the same output
+ * - The remaining function still runs once the other one is destroyed
+ */
+TEST_CASE(SharedPreparedWeights, framework::DatasetMode::ALL)
+{
+    const auto src_info    = TensorInfo(TensorShape(16U), 1, DataType::F32);
+    const auto weight_info = TensorInfo(TensorShape(16U, 8U), 1, DataType::F32);
+    const auto bias_info   = TensorInfo(TensorShape(8U), 1, DataType::F32);
+    const auto dst_info    = TensorInfo(TensorShape(8U), 1, DataType::F32);
+
+    IWeightsManager wm;
+    auto            src     = create_tensor<Tensor>(src_info);
+    auto            weights = std::vector<Tensor>(2);
+    auto            biases  = std::vector<Tensor>(2);
+    auto            dst     = std::vector<Tensor>(2);
+    auto            fc      = std::vector<std::unique_ptr<NEFullyConnectedLayer>>(2);
+    for(size_t i = 0; i < fc.size(); ++i)
+    {
+        weights[i].allocator()->init(weight_info);
+        biases[i].allocator()->init(bias_info);
+        dst[i].allocator()->init(dst_info);
+        fc[i] = std::make_unique<NEFullyConnectedLayer>(nullptr, &wm);
+        fc[i]->configure(&src, &weights[i], &biases[i], &dst[i]);
+        weights[i].allocator()->allocate();
+        biases[i].allocator()->allocate();
+        dst[i].allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(weights[i]), 0);
+        library->fill_tensor_uniform(Accessor(biases[i]), 1);
+    }
+    src.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 2);
+
+    fc[0]->run();
+    fc[1]->run();
+    ARM_COMPUTE_EXPECT(wm.num_shared_prepared_weights() > 0, framework::LogLevel::ERRORS);
+
+    const auto compare_outputs = [&]()
+    {
+        for(size_t i = 0; i < dst_info.tensor_shape().total_size(); ++i)
+        {
+            ARM_COMPUTE_EXPECT(((float *)dst[0].buffer())[i] == ((float *)dst[1].buffer())[i], framework::LogLevel::ERRORS);
+        }
+    };
+    compare_outputs();
+
+    fc[0].reset();
+    library->fill_tensor_value(Accessor(dst[1]), 0.f);
+    fc[1]->run();
+    compare_outputs();
+}
+
 /** Unit test for @ref cpu::CpuFullyConnected with quantized multipler > 1
  *
  * Tests output correctness.
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/FusedElementwiseInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEFusedElementwise.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/FusedElementwiseFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr float                    abs_tolerance_f32(0.0001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for F32 */
+constexpr RelativeTolerance<float> rel_tolerance_f32(0.0001f); /**< Relative tolerance value for comparing reference's output against implementation's output for F32 */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+constexpr float                    abs_tolerance_f16(0.02f); /**< Absolute tolerance value for comparing reference's output against implementation's output for F16 */
+constexpr RelativeTolerance<float> rel_tolerance_f16(0.01f); /**< Relative tolerance value for comparing reference's output against implementation's output for F16 */
+#endif // ARM_COMPUTE_ENABLE_FP16
+
+/** relu(in0 * in1 + in2) + in0, the tail of a convolution block with a residual connection */
+ElementwiseExpression scale_bias_relu_residual()
+{
+    ElementwiseExpression expr;
+    const auto x   = expr.input(0);
+    const auto mul = expr.binary(ElementwiseExpressionOp::MUL, x, expr.input(1));
+    const auto add = expr.binary(ElementwiseExpressionOp::ADD, mul, expr.input(2));
+    const auto act = expr.activation(add, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    expr.binary(ElementwiseExpressionOp::ADD, act, x);
+    return expr;
+}
+
+/** bounded_relu((in0 - in1) * rsqrt(in2)), a normalisation followed by a clamp */
+ElementwiseExpression normalize_clamp()
+{
+    ElementwiseExpression expr;
+    const auto sub  = expr.binary(ElementwiseExpressionOp::SUB, expr.input(0), expr.input(1));
+    const auto norm = expr.binary(ElementwiseExpressionOp::MUL, sub,
+                                  expr.unary(ElementwiseExpressionOp::RSQRT, expr.input(2)));
+    expr.activation(norm, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 1.5f));
+    return expr;
+}
+
+/** hard_swish(min(max(exp(-|in0|), (in1 - in0)^2) / in2, in1)), every operation kind at least once */
+ElementwiseExpression mixed_operations()
+{
+    ElementwiseExpression expr;
+    const auto x   = expr.input(0);
+    const auto y   = expr.input(1);
+    const auto e   = expr.unary(ElementwiseExpressionOp::EXP,
+                                expr.unary(ElementwiseExpressionOp::NEG, expr.unary(ElementwiseExpressionOp::ABS, x)));
+    const auto sq  = expr.binary(ElementwiseExpressionOp::SQUARED_DIFF, y, x);
+    const auto max = expr.binary(ElementwiseExpressionOp::MAX, e, sq);
+    const auto div = expr.binary(ElementwiseExpressionOp::DIV, max, expr.input(2));
+    const auto min = expr.binary(ElementwiseExpressionOp::MIN, div, y);
+    expr.activation(min, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::HARD_SWISH));
+    return expr;
+}
+
+const auto ExpressionDataset = make("Expression", { scale_bias_relu_residual(), normalize_clamp(), mixed_operations() });
+
+/** Same shapes, a per-channel and a per-row broadcast, and broadcasting along X */
+const auto ShapesDataset = zip(make("Shape0", { TensorShape(27U, 13U, 2U), TensorShape(9U, 9U, 5U), TensorShape(1U, 16U, 3U) }),
+                               make("Shape1", { TensorShape(27U, 13U, 2U), TensorShape(9U, 1U, 5U), TensorShape(33U, 16U, 3U) }),
+                               make("Shape2", { TensorShape(27U, 13U, 2U), TensorShape(1U, 9U, 5U), TensorShape(33U, 1U, 1U) }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(FusedElementwise)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("Input0Info", { TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),    // Mismatching data types
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::S32),    // Unsupported data type
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),    // Shapes cannot be broadcast
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),    // Wrong output shape
+                       }),
+    make("Input1Info", { TensorInfo(TensorShape(16U, 1U), 1, DataType::F32),
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::F16),
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::S32),
+                         TensorInfo(TensorShape(15U, 8U), 1, DataType::F32),
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                       }),
+    make("OutputInfo", { TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::S32),
+                         TensorInfo(TensorShape(16U, 8U), 1, DataType::F32),
+                         TensorInfo(TensorShape(16U, 4U), 1, DataType::F32),
+                       }),
+    make("Expected", { true, false, false, false, false })),
+    input0_info, input1_info, output_info, expected)
+{
+    ElementwiseExpression expr;
+    expr.binary(ElementwiseExpressionOp::ADD, expr.input(0), expr.input(1));
+
+    const Status status = NEFusedElementwise::validate({ &input0_info.clone()->set_is_resizable(false),
+                                                         &input1_info.clone()->set_is_resizable(false) },
+                                                       &output_info.clone()->set_is_resizable(false),
+                                                       expr);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_CASE(InvalidExpression, framework::DatasetMode::ALL)
+{
+    const TensorInfo info(TensorShape(16U, 8U), 1, DataType::F32);
+
+    // Operand referring to a node that is added later
+    ElementwiseExpression forward_ref;
+    forward_ref.binary(ElementwiseExpressionOp::ADD, forward_ref.input(0), 2);
+    forward_ref.input(1);
+    ARM_COMPUTE_EXPECT(!bool(NEFusedElementwise::validate({ &info, &info }, &info, forward_ref)), framework::LogLevel::ERRORS);
+
+    // Number of inputs not matching the expression
+    ElementwiseExpression unary;
+    unary.unary(ElementwiseExpressionOp::EXP, unary.input(0));
+    ARM_COMPUTE_EXPECT(!bool(NEFusedElementwise::validate({ &info, &info }, &info, unary)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEFusedElementwise::validate({ &info }, &info, unary)), framework::LogLevel::ERRORS);
+}
+
+template <typename T>
+using NEFusedElementwiseFixture = FusedElementwiseValidationFixture<Tensor, Accessor, NEFusedElementwise, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedElementwiseFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset, ExpressionDataset, make("DataType", DataType::F32)))
+{
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedElementwiseFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(ShapesDataset, ExpressionDataset, make("DataType", DataType::F16)))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, rel_tolerance_f16, 0.f, abs_tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // FusedElementwise
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
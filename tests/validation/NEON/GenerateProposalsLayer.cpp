@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -222,11 +222,13 @@ DATA_TEST_CASE(IntegrationTestCaseAllAnchors, framework::DatasetMode::ALL, frame
 }
 
 DATA_TEST_CASE(IntegrationTestCaseGenerateProposals, framework::DatasetMode::ALL, combine(framework::dataset::make("DataType", { DataType::F32 }),
-                                                                                          framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
-               data_type, data_layout)
+                                                                                          framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC }),
+                                                                                          framework::dataset::make("NumAnchors", { 2, 4 }),
+                                                                                          zip(framework::dataset::make("PreNmsTopN", { 6000, 15 }),
+                                                                                              framework::dataset::make("NumExpectedProposals", { 9U, 8U }))),
+               data_type, data_layout, num_anchors, pre_nms_topN, num_expected_proposals)
 {
     const int values_per_roi = 4;
-    const int num_anchors    = 2;
     const int feature_height = 4;
     const int feature_width  = 5;
 
@@ -288,9 +290,19 @@ DATA_TEST_CASE(IntegrationTestCaseGenerateProposals, framework::DatasetMode::ALL
         -2.071168373801788e-03, 8.613893943683627e-03, 9.411190295341036e-03, -6.129018930548372e-03
     };
 
-    const std::vector<float> anchors_vector{ -26, -19, 87, 86, -81, -27, 58, 63 };
-    SimpleTensor<float>      proposals_expected(TensorShape(5, 9), DataType::F32);
-    fill_tensor(proposals_expected, std::vector<float>
+    std::vector<float> anchors_vector{ -26, -19, 87, 86, -81, -27, 58, 63 };
+
+    // The extra anchors score lower than every other box and are too small to survive the minimum size filter, so the
+    // expected proposals do not change. With 4 anchors the NHWC decoding is vectorized across the anchors.
+    const int num_extra_anchors = num_anchors - 2;
+    scores_vector.resize(scores_vector.size() + num_extra_anchors * feature_width * feature_height, 0.f);
+    bbx_vector.resize(bbx_vector.size() + values_per_roi * num_extra_anchors * feature_width * feature_height, 0.f);
+    for(int a = 0; a < num_extra_anchors; ++a)
+    {
+        anchors_vector.insert(anchors_vector.end(), { 0, 0, 1, 1 });
+    }
+    // When only the best 15 boxes are kept before the non maxima suppression, the last proposal is dropped
+    std::vector<float> proposals_expected_vector
     {
         0, 0, 0, 75.269, 64.4388,
         0, 21.9579, 13.0535, 119, 99,
@@ -302,10 +314,12 @@ DATA_TEST_CASE(IntegrationTestCaseGenerateProposals, framework::DatasetMode::ALL
         0, 0, 13.4405, 104.799, 99,
         0, 38.9066, 28.2434, 119, 99,
 
-    });
+    };
+    proposals_expected_vector.resize((values_per_roi + 1) * num_expected_proposals);
+    SimpleTensor<float> proposals_expected(TensorShape(values_per_roi + 1, num_expected_proposals), DataType::F32);
+    fill_tensor(proposals_expected, proposals_expected_vector);
 
-    SimpleTensor<float> scores_expected(TensorShape(9), DataType::F32);
-    fill_tensor(scores_expected, std::vector<float>
+    std::vector<float> scores_expected_vector
     {
         0.00986536,
         0.00876435,
@@ -316,7 +330,10 @@ DATA_TEST_CASE(IntegrationTestCaseGenerateProposals, framework::DatasetMode::ALL
         0.00672044,
         0.00631324,
         3.15769e-05
-    });
+    };
+    scores_expected_vector.resize(num_expected_proposals);
+    SimpleTensor<float> scores_expected(TensorShape(num_expected_proposals), DataType::F32);
+    fill_tensor(scores_expected, scores_expected_vector);
 
     TensorShape scores_shape = TensorShape(feature_width, feature_height, num_anchors);
     TensorShape deltas_shape = TensorShape(feature_width, feature_height, values_per_roi * num_anchors);
@@ -338,7 +355,7 @@ DATA_TEST_CASE(IntegrationTestCaseGenerateProposals, framework::DatasetMode::ALL
 
     NEGenerateProposalsLayer generate_proposals;
     generate_proposals.configure(&scores, &bbox_deltas, &anchors, &proposals, &scores_out, &num_valid_proposals,
-                                 GenerateProposalsInfo(120, 100, 0.166667f, 1 / 16.0, 6000, 300, 0.7f, 16.0f));
+                                 GenerateProposalsInfo(120, 100, 0.166667f, 1 / 16.0, pre_nms_topN, 300, 0.7f, 16.0f));
 
     // Allocate memory for input/output tensors
     scores.allocator()->allocate();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2018 Arm Limited.
+ * Copyright (c) 2017-2018, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
@@ -34,6 +35,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/PoolingLayerFixture.h"
+#include "tests/validation/reference/PoolingLayer.h"
 
 namespace arm_compute
 {
@@ -60,11 +62,48 @@ TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunGlobalPooling, NEGlobalPoolingLayerFixture<float>, framework::DatasetMode::ALL, combine(combine(GlobalPoolingLayerDataset, framework::dataset::make("DataType",
                                                                                                                   DataType::F32)),
-                                                                                                                  framework::dataset::make("DataLayout", DataLayout::NCHW)))
+                                                                                                                  framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
 {
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+DATA_TEST_CASE(RunSplitAcrossThreads, framework::DatasetMode::ALL,
+               framework::dataset::make("PoolingType", { PoolingType::AVG, PoolingType::MAX }),
+               pool_type)
+{
+    // With few channels the rows are split between workloads whose partial results are combined by the last one.
+    // The function is run repeatedly with fewer and more threads than it is configured for, which must neither
+    // change the partitioning nor leave a stale count of finished workloads.
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    const TensorShape  shape(32U, 24U, 3U, 2U);
+    TensorShape        target_shape(shape);
+    permute(target_shape, PermutationVector(2U, 0U, 1U));
+
+    Tensor src = create_tensor<Tensor>(target_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+    Tensor dst;
+
+    NEScheduler::get().set_num_threads(4);
+    NEPoolingLayer pool;
+    pool.configure(&src, &dst, PoolingLayerInfo(pool_type, DataLayout::NHWC));
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    library->fill(Accessor(src), distribution, 0);
+
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    library->fill(ref_src, distribution, 0);
+    const SimpleTensor<float> reference = reference::pooling_layer<float>(ref_src, PoolingLayerInfo(pool_type, DataLayout::NCHW), QuantizationInfo(), nullptr);
+
+    for(unsigned int run_threads : { 2U, 8U, 1U, 4U })
+    {
+        NEScheduler::get().set_num_threads(run_threads);
+        pool.run();
+        validate(Accessor(dst), reference, tolerance_f32);
+    }
+    NEScheduler::get().set_num_threads(num_threads);
+}
 TEST_SUITE_END()
 TEST_SUITE_END()
 
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEGroupNormalizationLayer.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "src/core/NEON/kernels/NEGroupNormalizationStatisticsKernel.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/GroupNormalizationLayerFixture.h"
+#include "tests/validation/reference/GroupNormalizationLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Tolerance for float operations */
+AbsoluteTolerance<float> tolerance_f32(0.0015f);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+AbsoluteTolerance<half> tolerance_f16(static_cast<half>(0.03125f));
+#endif // ARM_COMPUTE_ENABLE_FP16
+
+/** Shapes in NCHW order with the number of groups their channels are divided into, from layer (1 group)
+ *  to instance normalization (1 group per channel) */
+const auto SmallGroupNormalizationDataset = zip(
+    framework::dataset::make("Shape", { TensorShape(7U, 5U, 16U, 2U),
+                                        TensorShape(13U, 9U, 8U),
+                                        TensorShape(33U, 3U, 12U, 3U),
+                                        TensorShape(9U, 11U, 6U, 2U),
+                                        TensorShape(64U, 64U, 3U) }),
+    framework::dataset::make("NumGroups", { 4U, 1U, 3U, 6U, 1U }));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(GroupNormalizationLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    framework::dataset::make("InputInfo",  { TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::F32), // Mismatching data type input/output
+                                             TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::F32), // Mismatching shape input/output
+                                             TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::S16), // DataType not supported
+                                             TensorInfo(TensorShape(16U, 8U, 30U, 2U), 1, DataType::F32), // Channels not a multiple of the groups
+                                             TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::F32), // Gamma of the wrong size
+                                             TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::F32, DataLayout::NCHW),
+                                             TensorInfo(TensorShape(32U, 16U, 8U, 2U), 1, DataType::F32, DataLayout::NHWC),
+                                           }),
+    framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::F16),
+                                             TensorInfo(TensorShape(16U, 8U, 16U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::S16),
+                                             TensorInfo(TensorShape(16U, 8U, 30U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::F32),
+                                             TensorInfo(TensorShape(16U, 8U, 32U, 2U), 1, DataType::F32, DataLayout::NCHW),
+                                             TensorInfo(TensorShape(32U, 16U, 8U, 2U), 1, DataType::F32, DataLayout::NHWC),
+                                           }),
+    framework::dataset::make("GammaSize",  { 32U, 32U, 32U, 30U, 16U, 32U, 32U }),
+    framework::dataset::make("Expected",   { false, false, false, false, false, true, true })),
+    input_info, output_info, gamma_size, expected)
+{
+    const TensorInfo gamma_info(TensorShape(gamma_size), 1, input_info.data_type());
+    const TensorInfo beta_info(TensorShape(32U), 1, input_info.data_type());
+
+    bool is_valid = bool(NEGroupNormalizationLayer::validate(&input_info.clone()->set_is_resizable(false),
+                                                             &output_info.clone()->set_is_resizable(false),
+                                                             &gamma_info, (gamma_size == 32U ? &beta_info : nullptr), 8U));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEGroupNormalizationLayerFixture = GroupNormalizationLayerValidationFixture<Tensor, Accessor, NEGroupNormalizationLayer, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGroupNormalizationLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(SmallGroupNormalizationDataset,
+                               framework::dataset::make("DataType", DataType::F32),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC }),
+                               framework::dataset::make("InPlace", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+DATA_TEST_CASE(RunSplitAcrossThreads, framework::DatasetMode::ALL,
+               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC }),
+               data_layout)
+{
+    // Groups of 16384 elements are large enough to be reduced in several splits whose statistics are then merged.
+    // The function is run with more threads than it is configured for, so that some threads use their own
+    // working space instead of the one of the function.
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+    const unsigned int num_groups  = 2U;
+    const TensorShape  shape(64U, 64U, 8U);
+    const TensorShape  param_shape(shape[2]);
+    TensorShape        target_shape(shape);
+    if(data_layout == DataLayout::NHWC)
+    {
+        permute(target_shape, PermutationVector(2U, 0U, 1U));
+    }
+
+    Tensor src   = create_tensor<Tensor>(target_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+    Tensor dst   = create_tensor<Tensor>(target_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+    Tensor gamma = create_tensor<Tensor>(param_shape, DataType::F32);
+    Tensor beta  = create_tensor<Tensor>(param_shape, DataType::F32);
+
+    NEScheduler::get().set_num_threads(4);
+    ARM_COMPUTE_EXPECT(NEGroupNormalizationStatisticsKernel::compute_num_splits(src.info(), num_groups, 4) > 1, framework::LogLevel::ERRORS);
+
+    NEGroupNormalizationLayer group_norm;
+    group_norm.configure(&src, &dst, &gamma, &beta, num_groups);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    gamma.allocator()->allocate();
+    beta.allocator()->allocate();
+
+    std::uniform_real_distribution<float> src_distribution(1.f, 2.f);
+    std::uniform_real_distribution<float> gamma_distribution(0.5f, 2.f);
+    std::uniform_real_distribution<float> beta_distribution(-1.f, 1.f);
+    library->fill(Accessor(src), src_distribution, 0);
+    library->fill(Accessor(gamma), gamma_distribution, 1);
+    library->fill(Accessor(beta), beta_distribution, 2);
+
+    NEScheduler::get().set_num_threads(8);
+    group_norm.run();
+    NEScheduler::get().set_num_threads(num_threads);
+
+    SimpleTensor<float> ref_src{ shape, DataType::F32 };
+    SimpleTensor<float> ref_gamma{ param_shape, DataType::F32 };
+    SimpleTensor<float> ref_beta{ param_shape, DataType::F32 };
+    library->fill(ref_src, src_distribution, 0);
+    library->fill(ref_gamma, gamma_distribution, 1);
+    library->fill(ref_beta, beta_distribution, 2);
+
+    validate(Accessor(dst), reference::group_normalization<float>(ref_src, ref_gamma, ref_beta, num_groups, 1e-5f), tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGroupNormalizationLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(SmallGroupNormalizationDataset,
+                               framework::dataset::make("DataType", DataType::F16),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC }),
+                               framework::dataset::make("InPlace", { false, true })))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+
+TEST_SUITE_END() // GroupNormalizationLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
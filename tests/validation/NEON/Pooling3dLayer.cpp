@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, 2024 Arm Limited.
+ * Copyright (c) 2022, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,6 +55,18 @@ const auto Pooling3dLayerDatasetFPSmall = combine(combine(combine(combine(datase
                                                           framework::dataset::make("Padding", { Padding3D(0, 0, 0), Padding3D(1, 1, 1), Padding3D(1, 0, 0) })),
                                                   framework::dataset::make("ExcludePadding", { true, false }));
 
+/** Overlapping windows with asymmetric padding, exercising the row-separable reduction of the float NDHWC kernel */
+const auto Pooling3dLayerDatasetFPSeparable = combine(combine(combine(combine(datasets::PoolingTypes(), framework::dataset::make("PoolingSize", { Size3D(3, 3, 3), Size3D(4, 2, 3) })),
+                                                                      framework::dataset::make("Stride", { Size3D(1, 1, 1), Size3D(2, 1, 2) })),
+                                                              framework::dataset::make("Padding", { Padding3D(1, 2, 0, 1, 2, 1), Padding3D(1, 1, 1) })),
+                                                      framework::dataset::make("ExcludePadding", { true, false }));
+
+/** Channel counts that leave a left-over after the vector loop of the separable kernel */
+const auto Pooling3dLayerSeparableShapes = framework::dataset::make("InputShape", { TensorShape(3U, 9U, 7U, 6U),
+                                                                                   TensorShape(5U, 8U, 9U, 5U, 2U),
+                                                                                   TensorShape(17U, 7U, 6U, 5U)
+                                                                                 });
+
 const auto Pooling3dLayerDatasetQASYMM8Small = combine(combine(combine(combine(framework::dataset::make("PoolingType", { PoolingType::MAX, PoolingType::AVG }),
                                                                                framework::dataset::make("PoolingSize", { Size3D(3, 3, 3) })),
                                                                        framework::dataset::make("Stride", { Size3D(1, 1, 1), Size3D(2, 1, 1), Size3D(1, 2, 1), Size3D(2, 2, 1) })),
@@ -223,6 +235,13 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPoolingLayer3dFixture<float>, framework::Data
     validate(Accessor(_target), _reference, tolerance_f32);
 }
 
+FIXTURE_DATA_TEST_CASE(RunSeparable, NEPoolingLayer3dFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(Pooling3dLayerSeparableShapes, combine(Pooling3dLayerDatasetFPSeparable, framework::dataset::make("DataType", DataType::F32))))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
 TEST_SUITE(GlobalPooling)
 // *INDENT-OFF*
 // clang-format off
@@ -291,6 +310,20 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEPoolingLayer3dFixture<half>, framework::Datas
     }
 }
 
+FIXTURE_DATA_TEST_CASE(RunSeparable, NEPoolingLayer3dFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(Pooling3dLayerSeparableShapes, combine(Pooling3dLayerDatasetFPSeparable, framework::dataset::make("DataType", DataType::F16))))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        // Validate output
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
 
 FIXTURE_DATA_TEST_CASE(RunLarge, NEPoolingLayer3dFixture<half>, framework::DatasetMode::NIGHTLY, combine(datasets::Large5dShapes(), combine(Pooling3dLayerDatasetFP,
                                                                                                            framework::dataset::make("DataType",
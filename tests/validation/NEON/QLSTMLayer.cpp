@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEQLSTMLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+
+#include <array>
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+/** The fused and the unfused paths can take the vector and the scalar code paths on different elements, which may
+ * round the last bit differently
+ */
+constexpr AbsoluteTolerance<int16_t> tolerance_qsymm16(1);
+constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1);
+
+/** The number of units covers the scalar tail only, the vector body and the scalar tail, and the vector body only */
+const auto QLSTMConfigurationDataset = combine(make("NumUnits", {5, 19, 32}),
+                                               make("CIFG", {false, true}),
+                                               make("LayerNorm", {false, true}),
+                                               make("Projection", {false, true}));
+
+/** Copy the content of a tensor to a @ref SimpleTensor */
+template <typename T>
+SimpleTensor<T> to_simple_tensor(const Tensor &tensor)
+{
+    const TensorShape &shape = tensor.info()->tensor_shape();
+    SimpleTensor<T>    dst{shape, tensor.info()->data_type(), 1, tensor.info()->quantization_info()};
+
+    Window window;
+    window.use_tensor_dimensions(shape);
+    Iterator it(&tensor, window);
+    execute_window_loop(
+        window, [&](const Coordinates &id) { dst[coord2index(shape, id)] = *reinterpret_cast<const T *>(it.ptr()); },
+        it);
+    return dst;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(QLSTMLayer)
+
+/** Compare the fused gates of @ref NEQLSTMLayer against the separate functions
+ *
+ * Peephole connections are not fused, so configuring them with zero weights makes the function take the unfused
+ * path while leaving the results unchanged.
+ */
+DATA_TEST_CASE(FusedGates,
+               framework::DatasetMode::PRECOMMIT,
+               QLSTMConfigurationDataset,
+               num_units,
+               has_cifg,
+               has_layer_norm,
+               has_projection)
+{
+    constexpr size_t input_size         = 7;
+    constexpr size_t batch_size         = 2;
+    constexpr float  intermediate_scale = 1.f / 4096.f;
+    const size_t     output_size        = has_projection ? 6 : num_units;
+
+    const QuantizationInfo qinput(1.f / 128.f, 5);
+    const QuantizationInfo qoutput_state(1.f / 128.f, 0);
+    const QuantizationInfo qweights(1.f / 64.f);
+    const QuantizationInfo qcell_state(1.f / 2048.f);
+    const QuantizationInfo qsymm16_weights(1.f / 8192.f);
+
+    // Gates are indexed in the order forget, cell, input and output
+    std::array<Tensor, 4> input_weights{};
+    std::array<Tensor, 4> recurrent_weights{};
+    std::array<Tensor, 4> biases{};
+    std::array<Tensor, 4> layer_norm_weights{};
+    std::array<Tensor, 4> peephole_weights{};
+    for (size_t gate = 0; gate < 4; ++gate)
+    {
+        input_weights[gate] = create_tensor<Tensor>(TensorShape(input_size, num_units), DataType::QSYMM8, 1, qweights);
+        recurrent_weights[gate] =
+            create_tensor<Tensor>(TensorShape(output_size, num_units), DataType::QSYMM8, 1, qweights);
+        biases[gate] = create_tensor<Tensor>(TensorShape(num_units), DataType::S32);
+        layer_norm_weights[gate] =
+            create_tensor<Tensor>(TensorShape(num_units), DataType::QSYMM16, 1, qsymm16_weights);
+        peephole_weights[gate] = create_tensor<Tensor>(TensorShape(num_units), DataType::QSYMM16, 1, qsymm16_weights);
+    }
+    Tensor projection_weights =
+        create_tensor<Tensor>(TensorShape(num_units, output_size), DataType::QSYMM8, 1, qweights);
+    Tensor projection_bias = create_tensor<Tensor>(TensorShape(output_size), DataType::S32);
+
+    Tensor input = create_tensor<Tensor>(TensorShape(input_size, batch_size), DataType::QASYMM8_SIGNED, 1, qinput);
+    Tensor cell_state_in =
+        create_tensor<Tensor>(TensorShape(num_units, batch_size), DataType::QSYMM16, 1, qcell_state);
+    Tensor output_state_in =
+        create_tensor<Tensor>(TensorShape(output_size, batch_size), DataType::QASYMM8_SIGNED, 1, qoutput_state);
+
+    // Index 0 holds the fused function, index 1 the unfused one
+    std::array<Tensor, 2>       cell_state_out{};
+    std::array<Tensor, 2>       output_state_out{};
+    std::array<Tensor, 2>       output{};
+    std::array<NEQLSTMLayer, 2> qlstm{};
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const bool has_peephole = i == 1;
+
+        cell_state_out[i] =
+            create_tensor<Tensor>(TensorShape(num_units, batch_size), DataType::QSYMM16, 1, qcell_state);
+        output_state_out[i] =
+            create_tensor<Tensor>(TensorShape(output_size, batch_size), DataType::QASYMM8_SIGNED, 1, qoutput_state);
+        output[i] =
+            create_tensor<Tensor>(TensorShape(output_size, batch_size), DataType::QASYMM8_SIGNED, 1, qoutput_state);
+
+        LSTMParams<ITensor> lstm_params;
+        lstm_params.set_matmul_scale_params(intermediate_scale, intermediate_scale, intermediate_scale,
+                                            intermediate_scale);
+        lstm_params.set_hidden_state_params(qoutput_state.uniform().offset, qoutput_state.uniform().scale);
+        if (!has_cifg)
+        {
+            lstm_params.set_cifg_params(&input_weights[2], &recurrent_weights[2],
+                                        has_peephole ? &peephole_weights[2] : nullptr, &biases[2]);
+        }
+        if (has_peephole)
+        {
+            lstm_params.set_peephole_params(&peephole_weights[0], &peephole_weights[3]);
+        }
+        if (has_projection)
+        {
+            lstm_params.set_projection_params(&projection_weights, &projection_bias);
+        }
+        if (has_layer_norm)
+        {
+            lstm_params.set_layer_normalization_params(has_cifg ? nullptr : &layer_norm_weights[2],
+                                                       &layer_norm_weights[0], &layer_norm_weights[1],
+                                                       &layer_norm_weights[3]);
+        }
+
+        qlstm[i].configure(&input, &input_weights[0], &input_weights[1], &input_weights[3], &recurrent_weights[0],
+                           &recurrent_weights[1], &recurrent_weights[3], &biases[0], &biases[1], &biases[3],
+                           &cell_state_in, &output_state_in, &cell_state_out[i], &output_state_out[i], &output[i],
+                           lstm_params);
+
+        cell_state_out[i].allocator()->allocate();
+        output_state_out[i].allocator()->allocate();
+        output[i].allocator()->allocate();
+    }
+
+    std::random_device::result_type seed = 0;
+    const auto fill = [&](Tensor &tensor, int32_t min, int32_t max)
+    {
+        tensor.allocator()->allocate();
+        library->fill(Accessor(tensor), std::uniform_int_distribution<int32_t>(min, max), seed++);
+    };
+
+    for (size_t gate = 0; gate < 4; ++gate)
+    {
+        fill(input_weights[gate], -16, 16);
+        fill(recurrent_weights[gate], -16, 16);
+        fill(biases[gate], -1000, 1000);
+        fill(layer_norm_weights[gate], -8192, 8192);
+        fill(peephole_weights[gate], 0, 0);
+    }
+    fill(projection_weights, -16, 16);
+    fill(projection_bias, -100, 100);
+    fill(input, -128, 127);
+    fill(cell_state_in, -8192, 8192);
+    fill(output_state_in, -128, 127);
+
+    qlstm[0].run();
+    qlstm[1].run();
+
+    validate(Accessor(cell_state_out[0]), to_simple_tensor<int16_t>(cell_state_out[1]), tolerance_qsymm16);
+    validate(Accessor(output_state_out[0]), to_simple_tensor<int8_t>(output_state_out[1]), tolerance_qasymm8_signed);
+    validate(Accessor(output[0]), to_simple_tensor<int8_t>(output[1]), tolerance_qasymm8_signed);
+}
+
+TEST_SUITE_END() // QLSTMLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NERNNSequenceLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/RNNSequenceLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float> tolerance_f32(0.001f); /**< Relative tolerance value for comparing reference's output against implementation's output for DataType:F32 */
+constexpr float          abs_tolerance_f32(0.0001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType:F32 */
+
+const auto RNNSequenceLayerSmallDataset = zip(framework::dataset::make("InputSize", { 7U, 16U, 33U }),
+                                              framework::dataset::make("NumUnits", { 5U, 16U, 21U }),
+                                              framework::dataset::make("BatchSize", { 1U, 3U, 2U }),
+                                              framework::dataset::make("SeqLen", { 4U, 1U, 6U }));
+
+const auto RNNSequenceLayerInfoDataset = framework::dataset::make("Info",
+{
+    RecurrentSequenceInfo(RecurrentCellType::RNN, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::TANH, 1.f, 1.f), false),
+    RecurrentSequenceInfo(RecurrentCellType::RNN, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU), true),
+    RecurrentSequenceInfo(RecurrentCellType::GRU, ActivationLayerInfo(), false),
+    RecurrentSequenceInfo(RecurrentCellType::GRU, ActivationLayerInfo(), true),
+});
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(RNNSequenceLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+               framework::dataset::make("InputInfo", { TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F16),  // Unsupported data type
+                                                       TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32),  // Wrong weights size
+                                                       TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32),  // Missing backward direction
+                                                       TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32),  // Wrong output size
+                                                       TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32),
+               }),
+               framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(8U, 12U, 2U), 1, DataType::F16),
+                                                         TensorInfo(TensorShape(8U, 4U, 2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(8U, 12U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(8U, 12U, 2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(8U, 12U, 2U), 1, DataType::F32),
+                                                         TensorInfo(TensorShape(8U, 4U), 1, DataType::F32),
+               }),
+               framework::dataset::make("RecurrentWeightsInfo", { TensorInfo(TensorShape(12U, 4U, 2U), 1, DataType::F16),
+                                                                  TensorInfo(TensorShape(12U, 4U, 2U), 1, DataType::F32),
+                                                                  TensorInfo(TensorShape(12U, 4U), 1, DataType::F32),
+                                                                  TensorInfo(TensorShape(12U, 4U, 2U), 1, DataType::F32),
+                                                                  TensorInfo(TensorShape(12U, 4U, 2U), 1, DataType::F32),
+                                                                  TensorInfo(TensorShape(4U, 4U), 1, DataType::F32),
+               }),
+               framework::dataset::make("BiasInfo", { TensorInfo(TensorShape(12U, 2U), 1, DataType::F16),
+                                                      TensorInfo(TensorShape(12U, 2U), 1, DataType::F32),
+                                                      TensorInfo(TensorShape(12U), 1, DataType::F32),
+                                                      TensorInfo(TensorShape(12U, 2U), 1, DataType::F32),
+                                                      TensorInfo(TensorShape(12U, 2U), 1, DataType::F32),
+                                                      TensorInfo(TensorShape(4U), 1, DataType::F32),
+               }),
+               framework::dataset::make("HiddenStateInfo", { TensorInfo(TensorShape(4U, 2U, 2U), 1, DataType::F16),
+                                                             TensorInfo(TensorShape(4U, 2U, 2U), 1, DataType::F32),
+                                                             TensorInfo(TensorShape(4U, 2U), 1, DataType::F32),
+                                                             TensorInfo(TensorShape(4U, 2U, 2U), 1, DataType::F32),
+                                                             TensorInfo(TensorShape(4U, 2U, 2U), 1, DataType::F32),
+                                                             TensorInfo(TensorShape(4U, 2U), 1, DataType::F32),
+               }),
+               framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F16),
+                                                        TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(4U, 2U, 5U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(4U, 2U, 5U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(8U, 2U, 5U), 1, DataType::F32),
+                                                        TensorInfo(TensorShape(4U, 2U, 5U), 1, DataType::F32),
+               }),
+               framework::dataset::make("Info", { RecurrentSequenceInfo(RecurrentCellType::GRU, ActivationLayerInfo(), true),
+                                                  RecurrentSequenceInfo(RecurrentCellType::GRU, ActivationLayerInfo(), true),
+                                                  RecurrentSequenceInfo(RecurrentCellType::GRU, ActivationLayerInfo(), true),
+                                                  RecurrentSequenceInfo(RecurrentCellType::GRU, ActivationLayerInfo(), true),
+                                                  RecurrentSequenceInfo(RecurrentCellType::GRU, ActivationLayerInfo(), true),
+                                                  RecurrentSequenceInfo(),
+               }),
+               framework::dataset::make("Expected", { false, false, false, false, true, true })),
+               input_info, weights_info, recurrent_weights_info, bias_info, hidden_state_info, output_info, info, expected)
+{
+    ARM_COMPUTE_EXPECT(bool(NERNNSequenceLayer::validate(&input_info.clone()->set_is_resizable(false), &weights_info.clone()->set_is_resizable(false), &recurrent_weights_info.clone()->set_is_resizable(false), &bias_info.clone()->set_is_resizable(false), nullptr, &hidden_state_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), info)) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NERNNSequenceLayerFixture = RNNSequenceLayerValidationFixture<Tensor, Accessor, NERNNSequenceLayer, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NERNNSequenceLayerFixture<float>, framework::DatasetMode::ALL, combine(RNNSequenceLayerSmallDataset,
+                                                                                                        RNNSequenceLayerInfoDataset,
+                                                                                                        framework::dataset::make("HasRecurrentBias", { true, false }),
+                                                                                                        framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output and final hidden state
+    validate(Accessor(_target), _reference, tolerance_f32, 0.f, abs_tolerance_f32);
+    validate(Accessor(_target_hidden_state), _reference_hidden_state, tolerance_f32, 0.f, abs_tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // RNNSequenceLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, 2024 Arm Limited.
+ * Copyright (c) 2019-2021, 2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,6 +115,44 @@ FIXTURE_DATA_TEST_CASE(SmallROIAlignLayerFloat, NEROIAlignLayerFloatFixture, fra
     // Validate output
     validate(Accessor(_target), _reference, relative_tolerance_f32, .02f, absolute_tolerance_f32);
 }
+/** Validate the samples falling in the last row and column of an unpadded input
+ *
+ * The ROI covers the whole 4x4 image, so the samples at x = 3.5 or y = 3.5 lie between the last pixel and the
+ * image edge. They must interpolate the edge pixel only, i.e. for an input holding x + 4 * y the samples of the
+ * bottom-right bin are 12.5, 13, 14.5 and 15.
+ */
+TEST_CASE(EdgeSamples, framework::DatasetMode::ALL)
+{
+    const ROIPoolingLayerInfo pool_info(2U, 2U, 1.f, 2U);
+
+    Tensor src  = create_tensor<Tensor>(TensorShape(4U, 4U, 1U), DataType::F32);
+    Tensor rois = create_tensor<Tensor>(TensorShape(5U, 1U), DataType::F32);
+    Tensor dst  = create_tensor<Tensor>(TensorShape(2U, 2U, 1U, 1U), DataType::F32);
+
+    NEROIAlignLayer roi_align;
+    roi_align.configure(&src, &rois, &dst, pool_info);
+
+    src.allocator()->allocate();
+    rois.allocator()->allocate();
+    dst.allocator()->allocate();
+    ARM_COMPUTE_EXPECT(src.info()->padding().empty(), framework::LogLevel::ERRORS);
+
+    for(int i = 0; i < 16; ++i)
+    {
+        reinterpret_cast<float *>(src.buffer())[i] = static_cast<float>(i);
+    }
+    const float roi[] = { 0.f, 0.f, 0.f, 4.f, 4.f };
+    std::copy(std::begin(roi), std::end(roi), reinterpret_cast<float *>(rois.buffer()));
+
+    roi_align.run();
+
+    const float expected[] = { 5.f, 6.75f, 12.f, 13.75f };
+    for(size_t i = 0; i < 4; ++i)
+    {
+        const float actual = reinterpret_cast<const float *>(dst.buffer())[i];
+        ARM_COMPUTE_EXPECT(std::abs(actual - expected[i]) < 1e-5f, framework::LogLevel::ERRORS);
+    }
+}
 #ifdef ARM_COMPUTE_ENABLE_FP16
 using NEROIAlignLayerHalfFixture = ROIAlignLayerFixture<Tensor, Accessor, NEROIAlignLayer, half, half>;
 FIXTURE_DATA_TEST_CASE(SmallROIAlignLayerHalf, NEROIAlignLayerHalfFixture, framework::DatasetMode::ALL,
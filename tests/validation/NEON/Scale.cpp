@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/runtime/NEON/functions/NEScale.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/datasets/ScaleValidationDataset.h"
 #include "tests/framework/Macros.h"
@@ -80,6 +81,7 @@ constexpr AbsoluteTolerance<uint8_t> tolerance_u8(1);
 constexpr AbsoluteTolerance<int8_t>  tolerance_s8(1);
 constexpr AbsoluteTolerance<int16_t> tolerance_s16(1);
 RelativeTolerance<float>             tolerance_f32(0.05);
+constexpr AbsoluteTolerance<float>   tolerance_normalized(0.01f);
 #ifdef ARM_COMPUTE_ENABLE_FP16
 constexpr float         abs_tolerance_f16(0.01f);
 RelativeTolerance<half> tolerance_f16(half(0.1));
@@ -214,7 +216,7 @@ TEST_CASE(UsePadding, framework::DatasetMode::ALL)
 
 TEST_CASE(AreaWithNHWC, framework::DatasetMode::ALL)
 {
-    // InterpolationPolicy::AREA is not supported for NHWC
+    // InterpolationPolicy::AREA on NHWC requires BorderMode::REPLICATE
     constexpr auto interpolation_policy = InterpolationPolicy::AREA;
     constexpr auto data_layout          = DataLayout::NHWC;
 
@@ -241,6 +243,27 @@ TEST_CASE(AreaWithNonU8, framework::DatasetMode::ALL)
     ARM_COMPUTE_EXPECT(bool(result) == false, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(Normalization, framework::DatasetMode::ALL)
+{
+    // Normalisation is applied when resizing a U8 NHWC tensor into F32 with border mode REPLICATE
+    const auto input     = TensorInfo{ input_shape, 1, DataType::U8, DataLayout::NHWC };
+    const auto output    = TensorInfo{ TensorShape{ 2, 6, 5, 2 }, 1, DataType::F32, DataLayout::NHWC };
+    const auto output_u8 = TensorInfo{ TensorShape{ 2, 6, 5, 2 }, 1, DataType::U8, DataLayout::NHWC };
+    const auto make_info = [](std::vector<float> mean, std::vector<float> std)
+    {
+        ScaleKernelInfo info{ InterpolationPolicy::BILINEAR, BorderMode::REPLICATE, PixelValue(), SamplingPolicy::CENTER, false };
+        info.norm_mean = std::move(mean);
+        info.norm_std  = std::move(std);
+        return info;
+    };
+
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output, make_info({ 120.f, 110.f }, { 58.f, 57.f }))) == true, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output, make_info({ 120.f }, { 58.f }))) == true, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output, make_info({ 1.f, 2.f, 3.f }, {}))) == false, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output, make_info({}, { 0.f }))) == false, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(bool(NEScale::validate(&input, &output_u8, make_info({ 120.f }, { 58.f }))) == false, framework::LogLevel::ERRORS);
+}
+
 TEST_CASE(AlignedCornerNotSupported, framework::DatasetMode::ALL)
 {
     // Aligned corners require sampling policy to be TOP_LEFT.
@@ -331,6 +354,8 @@ using NEScaleFixture = ScaleValidationFixture<Tensor, Accessor, NEScale, T>;
 template <typename T>
 using NEScaleMixedDataLayoutFixture = ScaleValidationFixture<Tensor, Accessor, NEScale, T, true>;
 template <typename T>
+using NEScaleNormalizationFixture = ScaleNormalizationValidationFixture<Tensor, Accessor, NEScale, T>;
+template <typename T>
 using NEScaleQuantizedFixture = ScaleValidationQuantizedFixture<Tensor, Accessor, NEScale, T>;
 template <typename T>
 using NEScaleDifferentOutputQuantizedFixture = ScaleValidationDifferentOutputQuantizedFixture<Tensor, Accessor, NEScale, T>;
@@ -395,6 +420,62 @@ FIXTURE_DATA_TEST_CASE(RunMediumAlignCornersNHWC, NEScaleFixture<float>, framewo
     // Validate output
     validate(Accessor(_target), _reference, valid_region, tolerance_f32, tolerance_num_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunMediumAreaNHWC, NEScaleFixture<float>, framework::DatasetMode::ALL, ASSEMBLE_NHWC_AREA_DATASET(f32_shape_nhwc, ScaleSamplingPolicySet))
+{
+    //Create valid region
+    TensorInfo  src_info(_shape, 1, _data_type);
+    ValidRegion valid_region = calculate_valid_region_scale(src_info, _reference.shape(), _policy, _sampling_policy, (_border_mode == BorderMode::UNDEFINED));
+
+    // Validate output
+    validate(Accessor(_target), _reference, valid_region, tolerance_f32, tolerance_num_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallNormalizedFromU8, NEScaleNormalizationFixture<float>, framework::DatasetMode::ALL,
+                       combine(combine(combine(datasets::Small3DShapes(), framework::dataset::make("DataType", DataType::F32)),
+                                       framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::BILINEAR, InterpolationPolicy::AREA })),
+                               datasets::SamplingPolicies()))
+{
+    //Create valid region
+    TensorInfo  src_info(_shape, 1, DataType::U8);
+    ValidRegion valid_region = calculate_valid_region_scale(src_info, _reference.shape(), _policy, _sampling_policy, false);
+
+    // Validate output
+    validate(Accessor(_target), _reference, valid_region, tolerance_normalized, tolerance_num_f32);
+}
+TEST_CASE(RunWithMoreThreadsThanConfigured, framework::DatasetMode::ALL)
+{
+    // The separable NHWC path keeps a working space per thread: running with more threads than at configure time
+    // must give the same result as a function configured with them
+    const unsigned int    num_threads = NEScheduler::get().num_threads();
+    const ScaleKernelInfo info{ InterpolationPolicy::BILINEAR, BorderMode::REPLICATE, PixelValue(), SamplingPolicy::CENTER, false };
+
+    Tensor src = create_tensor<Tensor>(TensorShape(3U, 33U, 17U), DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+    Tensor dst = create_tensor<Tensor>(TensorShape(3U, 20U, 40U), DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+    Tensor ref = create_tensor<Tensor>(TensorShape(3U, 20U, 40U), DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+
+    NEScheduler::get().set_num_threads(1);
+    NEScale scale;
+    scale.configure(&src, &dst, info);
+
+    NEScheduler::get().set_num_threads(4);
+    NEScale scale_ref;
+    scale_ref.configure(&src, &ref, info);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    ref.allocator()->allocate();
+    library->fill_tensor_uniform(Accessor(src), 0);
+
+    scale.run();
+    scale_ref.run();
+    NEScheduler::get().set_num_threads(num_threads);
+
+    const auto *out      = reinterpret_cast<const float *>(dst.buffer());
+    const auto *expected = reinterpret_cast<const float *>(ref.buffer());
+    for (size_t i = 0; i < ref.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(out[i] == expected[i], framework::LogLevel::ERRORS);
+    }
+}
 TEST_SUITE_END() // FP32
 #ifdef ARM_COMPUTE_ENABLE_FP16
 TEST_SUITE(FP16)
@@ -510,6 +591,15 @@ FIXTURE_DATA_TEST_CASE(RunSmallAlignCorners, NEScaleFixture<uint8_t>, framework:
     // Validate output
     validate(Accessor(_target), _reference, valid_region, tolerance_u8);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallAreaNHWC, NEScaleFixture<uint8_t>, framework::DatasetMode::ALL, ASSEMBLE_NHWC_AREA_DATASET(u8_shape, ScaleSamplingPolicySet))
+{
+    //Create valid region
+    TensorInfo  src_info(_shape, 1, _data_type);
+    ValidRegion valid_region = calculate_valid_region_scale(src_info, _reference.shape(), _policy, _sampling_policy, (_border_mode == BorderMode::UNDEFINED));
+
+    // Validate output
+    validate(Accessor(_target), _reference, valid_region, tolerance_u8);
+}
 TEST_SUITE_END() // U8
 TEST_SUITE(S8)
 const auto s8_shape = combine((SCALE_SHAPE_DATASET(num_elements_per_vector<int8_t>())), framework::dataset::make("DataType", DataType::S8));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Arm Limited.
+ * Copyright (c) 2024-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -244,6 +244,57 @@ FIXTURE_DATA_TEST_CASE(RunSmallScatterScalar, NEScatterLayerFixture<float>, fram
     validate(Accessor(_target), _reference, tolerance_f32);
 }
 
+// Indices declared unique are applied without being partitioned by destination row.
+TEST_CASE(RunUniqueIndices, framework::DatasetMode::ALL)
+{
+    constexpr unsigned int row_len     = 37U;
+    constexpr unsigned int num_rows    = 64U;
+    constexpr unsigned int num_updates = 30U;
+
+    Tensor src     = create_tensor<Tensor>(TensorShape(row_len, num_rows), DataType::F32);
+    Tensor updates = create_tensor<Tensor>(TensorShape(row_len, num_updates), DataType::F32);
+    Tensor indices = create_tensor<Tensor>(TensorShape(1U, num_updates), DataType::S32);
+    Tensor dst     = create_tensor<Tensor>(TensorShape(row_len, num_rows), DataType::F32);
+
+    NEScatter scatter;
+    scatter.configure(&src, &updates, &indices, &dst, ScatterInfo(ScatterFunction::Add, false, true));
+
+    src.allocator()->allocate();
+    updates.allocator()->allocate();
+    indices.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    // Update every other row, in reverse order
+    for(unsigned int i = 0; i < num_updates; ++i)
+    {
+        *reinterpret_cast<int32_t *>(indices.ptr_to_element(Coordinates(0, i))) = 2 * (num_updates - 1 - i);
+        for(unsigned int px = 0; px < row_len; ++px)
+        {
+            *reinterpret_cast<float *>(updates.ptr_to_element(Coordinates(px, i))) = static_cast<float>(i);
+        }
+    }
+    for(unsigned int py = 0; py < num_rows; ++py)
+    {
+        for(unsigned int px = 0; px < row_len; ++px)
+        {
+            *reinterpret_cast<float *>(src.ptr_to_element(Coordinates(px, py))) = static_cast<float>(px);
+        }
+    }
+
+    scatter.run();
+
+    for(unsigned int py = 0; py < num_rows; ++py)
+    {
+        const bool  updated = (py % 2 == 0) && (py / 2 < num_updates);
+        const float offset  = updated ? static_cast<float>(num_updates - 1 - py / 2) : 0.f;
+        for(unsigned int px = 0; px < row_len; ++px)
+        {
+            const float value = *reinterpret_cast<float *>(dst.ptr_to_element(Coordinates(px, py)));
+            ARM_COMPUTE_EXPECT(value == static_cast<float>(px) + offset, framework::LogLevel::ERRORS);
+        }
+    }
+}
+
 TEST_SUITE_END() // FP32
 
 
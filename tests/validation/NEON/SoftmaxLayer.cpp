@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022-2024 Arm Limited.
+ * Copyright (c) 2017-2020, 2022-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,6 +45,7 @@ namespace
 {
 /** Tolerance for float operations */
 constexpr AbsoluteTolerance<float> tolerance_f32(0.000001f);
+constexpr AbsoluteTolerance<float> tolerance_fast_f32(0.0001f); // The fast exponential has a relative error of about 1e-4
 RelativeTolerance<half>            tolerance_f16(half(0.2));
 
 /** Tolerance for quantized operations */
@@ -59,6 +60,16 @@ const auto CNNDataTypes = make("DataType",
 #endif /* ARM_COMPUTE_ENABLE_FP16 */
     DataType::F32,
 });
+
+/** Softmax function configured with the fast-math exponential */
+class NEFastMathSoftmaxLayer : public NESoftmaxLayer
+{
+public:
+    void configure(ITensor *input, ITensor *output, float beta, int32_t axis)
+    {
+        NESoftmaxLayer::configure(input, output, beta, axis, true /* fast_math */);
+    }
+};
 } // namespace
 
 TEST_SUITE(NEON)
@@ -121,6 +132,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
 template <typename T>
 using NESoftmaxLayerFixture = SoftmaxValidationFixture<Tensor, Accessor, NESoftmaxLayer, T>;
 
+template <typename T>
+using NEFastMathSoftmaxLayerFixture = SoftmaxValidationFixture<Tensor, Accessor, NEFastMathSoftmaxLayer, T>;
+
 DATA_TEST_CASE(KernelSelection, framework::DatasetMode::ALL,
     concat(
         combine(
@@ -145,7 +159,7 @@ DATA_TEST_CASE(KernelSelection, framework::DatasetMode::ALL,
     cpu_isa.fp16 = (data_type == DataType::F16);
 
     const auto *selected_impl = CpuSoftmaxKernel::get_implementation(
-        SoftmaxKernelDataTypeISASelectorData{ data_type, cpu_isa, false /* is_log */, 0 /* axis */, CPUInfo::get().get_sme2_vector_length_in_bits()},
+        SoftmaxKernelDataTypeISASelectorData{ data_type, cpu_isa, false /* is_log */, 0 /* axis */, CPUInfo::get().get_sme2_vector_length_in_bits(), false /* fast_math */},
         cpu::KernelSelectionType::Preferred);
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(selected_impl);
@@ -230,6 +244,25 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NESoftmaxLayerFixture<half>, framework::Dataset
         framework::ARM_COMPUTE_PRINT_INFO();
     }
 }
+TEST_SUITE(FastMath)
+FIXTURE_DATA_TEST_CASE(RunSmall2D, NEFastMathSoftmaxLayerFixture<half>, framework::DatasetMode::PRECOMMIT,
+    combine(
+        datasets::SoftmaxLayerSmallShapes(),
+        make("DataType", DataType::F16),
+        make("Beta", { 1.0f, 2.0f }),
+        make("Axis", { 0, -1 })))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() //FastMath
 TEST_SUITE_END() //FP16
 #endif           /* ARM_COMPUTE_ENABLE_FP16 */
 #ifdef ARM_COMPUTE_ENABLE_BF16
@@ -287,6 +320,27 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NESoftmaxLayerFixture<float>, framework::Datase
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+TEST_SUITE(FastMath)
+FIXTURE_DATA_TEST_CASE(RunSmall2D, NEFastMathSoftmaxLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+    combine(
+        datasets::SoftmaxLayerSmallShapes(),
+        make("DataType", DataType::F32),
+        make("Beta", { 1.0f, 2.0f }),
+        make("Axis", { 0, -1 })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fast_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmall4D, NEFastMathSoftmaxLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+    combine(datasets::Small4DShapes(),
+        make("DataType", DataType::F32),
+        make("Beta", { 1.0f, 2.0f }),
+        make("Axis", { 0, -2, 3 })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fast_f32);
+}
+TEST_SUITE_END() //FastMath
 TEST_SUITE_END() //FP32
 TEST_SUITE_END() //Float
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, 2023 Arm Limited.
+ * Copyright (c) 2018-2021, 2023, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,8 +25,11 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/functions/NEStackLayer.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
+#include "src/cpu/kernels/CpuConcatenateKernel.h"
+#include "tests/Globals.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/PaddingCalculator.h"
 #include "tests/datasets/ShapeDatasets.h"
@@ -36,6 +39,7 @@
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/StackLayerFixture.h"
 
+#include <cstring>
 #include <vector>
 
 namespace arm_compute
@@ -123,6 +127,50 @@ input_info, output_info, axis, expected)
     ARM_COMPUTE_EXPECT(bool(NEStackLayer::validate(vec, axis, &output_info)) == expected, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(ReconfigureKernel, framework::DatasetMode::ALL)
+{
+    // NEStackLayer configures its kernel again on the first run: the plan must not accumulate over configurations
+    std::vector<Tensor>              srcs(3);
+    std::vector<const ITensorInfo *> infos;
+    for(auto &src : srcs)
+    {
+        src.allocator()->init(TensorInfo(TensorShape(8U, 4U), 1, DataType::S32));
+        src.allocator()->allocate();
+        infos.push_back(src.info());
+    }
+    for(size_t i = 0; i < srcs.size(); ++i)
+    {
+        library->fill_tensor_uniform(Accessor(srcs[i]), i);
+    }
+
+    Tensor dst_once{};
+    Tensor dst_twice{};
+    cpu::kernels::CpuConcatenateKernel kernel_once{};
+    cpu::kernels::CpuConcatenateKernel kernel_twice{};
+    kernel_once.configure_stack(infos, dst_once.info(), 1);
+    kernel_twice.configure_stack(infos, dst_twice.info(), 1);
+    kernel_twice.configure_stack(infos, dst_twice.info(), 1);
+    dst_once.allocator()->allocate();
+    dst_twice.allocator()->allocate();
+
+    ARM_COMPUTE_EXPECT(kernel_twice.window().x().end() == kernel_once.window().x().end(), framework::LogLevel::ERRORS);
+
+    ITensorPack pack_once{};
+    ITensorPack pack_twice{};
+    for(size_t i = 0; i < srcs.size(); ++i)
+    {
+        pack_once.add_const_tensor(ACL_SRC_VEC + i, &srcs[i]);
+        pack_twice.add_const_tensor(ACL_SRC_VEC + i, &srcs[i]);
+    }
+    pack_once.add_tensor(ACL_DST, &dst_once);
+    pack_twice.add_tensor(ACL_DST, &dst_twice);
+    NEScheduler::get().schedule_op(&kernel_once, Window::DimX, kernel_once.window(), pack_once);
+    NEScheduler::get().schedule_op(&kernel_twice, Window::DimX, kernel_twice.window(), pack_twice);
+
+    ARM_COMPUTE_EXPECT(std::memcmp(dst_once.buffer(), dst_twice.buffer(), dst_once.info()->total_size()) == 0,
+                       framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE(Shapes1D)
 TEST_SUITE(S32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEStackLayerFixture<int>, framework::DatasetMode::ALL,
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CommandList.h"
+
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
+#include "arm_compute/runtime/NEON/functions/NEScale.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ArithmeticOperations.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(CommandList)
+
+/** Record a small chain of functions, then replay it on new input values and check the result against the reference */
+TEST_CASE(RecordReplay, framework::DatasetMode::ALL)
+{
+    const TensorShape         shape(17U, 13U, 3U);
+    const ActivationLayerInfo act_info(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 1.f);
+
+    Tensor src  = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor tmp0 = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor tmp1 = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst  = create_tensor<Tensor>(shape, DataType::F32);
+
+    NEActivationLayer    act0;
+    NEActivationLayer    act1;
+    NEArithmeticAddition add;
+    act0.configure(&src, &tmp0, act_info);
+    act1.configure(&tmp0, &tmp1, act_info);
+    add.configure(&tmp1, &src, &dst, ConvertPolicy::WRAP);
+
+    src.allocator()->allocate();
+    tmp0.allocator()->allocate();
+    tmp1.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    std::uniform_real_distribution<float> distribution(-2.f, 2.f);
+    library->fill(Accessor(src), distribution, 0);
+
+    const Scheduler::Type type = Scheduler::get_type();
+
+    CommandList commands;
+    commands.record(
+        [&]()
+        {
+            act0.run();
+            act1.run();
+            add.run();
+        });
+
+    ARM_COMPUTE_EXPECT(Scheduler::get_type() == type, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(commands.is_replayable(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(commands.size() == 3, framework::LogLevel::ERRORS);
+
+    // Replay on new input values
+    library->fill(Accessor(src), distribution, 1);
+    commands.replay();
+
+    SimpleTensor<float> ref_src{shape, DataType::F32};
+    library->fill(ref_src, distribution, 1);
+    const SimpleTensor<float> ref_tmp = reference::activation_layer(reference::activation_layer(ref_src, act_info), act_info);
+    SimpleTensor<float>       ref_dst{shape, DataType::F32};
+    reference::arithmetic_operation(reference::ArithmeticOperation::ADD, ref_tmp, ref_src, ref_dst, ConvertPolicy::WRAP);
+
+    validate(Accessor(dst), ref_dst);
+}
+
+/** Record a resize whose working space is allocated while running and check that the list is not replayed over it */
+TEST_CASE(TemporaryWorkspace, framework::DatasetMode::ALL)
+{
+    // Bilinear NHWC resizes with border mode REPLICATE keep resampled rows in a per-thread working space. Running with
+    // more threads than at configure time makes the operator allocate a bigger one, which is freed once it returns
+    const unsigned int    num_threads = Scheduler::get().num_threads();
+    const ScaleKernelInfo info{InterpolationPolicy::BILINEAR, BorderMode::REPLICATE, PixelValue(), SamplingPolicy::CENTER, false};
+
+    Tensor src = create_tensor<Tensor>(TensorShape(3U, 33U, 17U), DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+    Tensor dst = create_tensor<Tensor>(TensorShape(3U, 20U, 40U), DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+    Tensor ref = create_tensor<Tensor>(TensorShape(3U, 20U, 40U), DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC);
+
+    Scheduler::get().set_num_threads(1);
+    NEScale scale;
+    NEScale scale_ref;
+    scale.configure(&src, &dst, info);
+    scale_ref.configure(&src, &ref, info);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+    ref.allocator()->allocate();
+
+    std::uniform_real_distribution<float> distribution(-2.f, 2.f);
+    library->fill(Accessor(src), distribution, 0);
+
+    // The working space allocated at configure time is used: the list can be replayed
+    CommandList commands;
+    commands.record([&]() { scale.run(); });
+    ARM_COMPUTE_EXPECT(commands.is_replayable(), framework::LogLevel::ERRORS);
+
+    // A temporary working space is freed while recording: the replay must run the functions again
+    Scheduler::get().set_num_threads(4);
+    commands.record([&]() { scale.run(); });
+    ARM_COMPUTE_EXPECT(!commands.is_replayable(), framework::LogLevel::ERRORS);
+
+    library->fill(Accessor(src), distribution, 1);
+    commands.replay();
+    scale_ref.run();
+    Scheduler::get().set_num_threads(num_threads);
+
+    const auto *out      = reinterpret_cast<const float *>(dst.buffer());
+    const auto *expected = reinterpret_cast<const float *>(ref.buffer());
+    for (size_t i = 0; i < ref.info()->tensor_shape().total_size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(out[i] == expected[i], framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // CommandList
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
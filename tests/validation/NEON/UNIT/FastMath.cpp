@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/CPPTypes.h"
+
+#include "src/core/NEON/NEMath.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Distance in units in the last place between two finite values of the same floating point format */
+template <typename Int>
+uint32_t ulp_distance(Int a_bits, Int b_bits)
+{
+    // Map the sign-magnitude encodings to a monotonic integer scale
+    const int64_t sign_mask = static_cast<int64_t>(1) << (8 * sizeof(Int) - 1);
+    const int64_t a = a_bits < 0 ? -(static_cast<int64_t>(a_bits) + sign_mask) : static_cast<int64_t>(a_bits);
+    const int64_t b = b_bits < 0 ? -(static_cast<int64_t>(b_bits) + sign_mask) : static_cast<int64_t>(b_bits);
+    return static_cast<uint32_t>(a > b ? a - b : b - a);
+}
+
+uint32_t ulp_distance(float a, float b)
+{
+    int32_t a_bits = 0;
+    int32_t b_bits = 0;
+    std::memcpy(&a_bits, &a, sizeof(a));
+    std::memcpy(&b_bits, &b, sizeof(b));
+    return ulp_distance(a_bits, b_bits);
+}
+
+/** Maximum ULP error of a fast F32 function over [min, max], ignoring results below the normal range */
+template <typename F, typename Ref>
+uint32_t max_ulp_error_f32(F &&func, Ref &&ref, float min, float max)
+{
+    constexpr int num_steps = 1 << 20;
+
+    uint32_t max_error = 0;
+    for (int i = 0; i < num_steps; i += 4)
+    {
+        float in[4];
+        float out[4];
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            in[lane] = min + (max - min) * static_cast<float>(i + lane) / static_cast<float>(num_steps - 1);
+        }
+        vst1q_f32(out, func(vld1q_f32(in)));
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const float expected = static_cast<float>(ref(static_cast<double>(in[lane])));
+            if (std::abs(expected) >= std::numeric_limits<float>::min())
+            {
+                max_error = std::max(max_error, ulp_distance(out[lane], expected));
+            }
+        }
+    }
+    return max_error;
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+/** Maximum ULP error of a fast F16 function over every finite F16 input, ignoring results outside the normal range */
+template <typename F, typename Ref>
+uint32_t max_ulp_error_f16(F &&func, Ref &&ref)
+{
+    constexpr float f16_min = 6.103515625e-05f; // 2^-14
+    constexpr float f16_max = 65504.f;
+
+    uint32_t max_error = 0;
+    for (uint32_t bits = 0; bits < 0x10000; bits += 8)
+    {
+        uint16_t in_bits[8];
+        for (uint32_t lane = 0; lane < 8; ++lane)
+        {
+            in_bits[lane] = static_cast<uint16_t>(bits + lane);
+        }
+        float16_t in[8];
+        float16_t out[8];
+        std::memcpy(in, in_bits, sizeof(in));
+        vst1q_f16(out, func(vld1q_f16(in)));
+        for (uint32_t lane = 0; lane < 8; ++lane)
+        {
+            const float value = static_cast<float>(in[lane]);
+            if (!std::isfinite(value))
+            {
+                continue;
+            }
+            const double expected = ref(static_cast<double>(value));
+            if (std::abs(expected) < f16_min || std::abs(expected) > f16_max)
+            {
+                continue;
+            }
+            const float16_t expected_f16 = static_cast<float16_t>(expected);
+            int16_t         out_bits     = 0;
+            int16_t         ref_bits     = 0;
+            std::memcpy(&out_bits, &out[lane], sizeof(out_bits));
+            std::memcpy(&ref_bits, &expected_f16, sizeof(ref_bits));
+            max_error = std::max(max_error, ulp_distance(out_bits, ref_bits));
+        }
+    }
+    return max_error;
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(FastMath)
+
+TEST_CASE(ExpF32, framework::DatasetMode::ALL)
+{
+    // The degree-3 polynomial of the fast tier has a relative error of about 1e-4, i.e. about 1400 F32 ULP
+    const uint32_t fast_error = max_ulp_error_f32([](float32x4_t x) { return vexpq_fast_f32(x); },
+                                                  [](double x) { return std::exp(x); }, -87.f, 88.f);
+    ARM_COMPUTE_EXPECT(fast_error <= 2048U, framework::LogLevel::ERRORS);
+
+    const uint32_t default_error = max_ulp_error_f32([](float32x4_t x) { return vexpq_f32(x); },
+                                                     [](double x) { return std::exp(x); }, -87.f, 88.f);
+    ARM_COMPUTE_EXPECT(default_error <= fast_error, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Expm1F32, framework::DatasetMode::ALL)
+{
+    const uint32_t error = max_ulp_error_f32([](float32x4_t x) { return vexpm1q_fast_f32(x); },
+                                             [](double x) { return std::expm1(x); }, -20.f, 20.f);
+    ARM_COMPUTE_EXPECT(error <= 2048U, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TanhF32, framework::DatasetMode::ALL)
+{
+    // A single Newton-Raphson step on the reciprocal limits the fast tanh to a relative error of about 1e-3
+    const uint32_t error = max_ulp_error_f32([](float32x4_t x) { return vtanhq_fast_f32(x); },
+                                             [](double x) { return std::tanh(x); }, -10.f, 10.f);
+    ARM_COMPUTE_EXPECT(error <= 16384U, framework::LogLevel::ERRORS);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_CASE(ExpF16, framework::DatasetMode::ALL)
+{
+    if (!CPUInfo::get().has_fp16())
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+        return;
+    }
+
+    const uint32_t error =
+        max_ulp_error_f16([](float16x8_t x) { return vexpq_fast_f16(x); }, [](double x) { return std::exp(x); });
+    ARM_COMPUTE_EXPECT(error <= 1U, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(Expm1F16, framework::DatasetMode::ALL)
+{
+    if (!CPUInfo::get().has_fp16())
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+        return;
+    }
+
+    const uint32_t error =
+        max_ulp_error_f16([](float16x8_t x) { return vexpm1q_fast_f16(x); }, [](double x) { return std::expm1(x); });
+    ARM_COMPUTE_EXPECT(error <= 2U, framework::LogLevel::ERRORS);
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+TEST_SUITE_END() // FastMath
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/MemoryFootprint.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(MemoryFootprint)
+
+TEST_CASE(HostAllocations, framework::DatasetMode::ALL)
+{
+    Tensor tensor = create_tensor<Tensor>(TensorShape(64U, 32U), DataType::F32, 1);
+
+    const AllocationCounters before = allocation_counters();
+    tensor.allocator()->allocate();
+    const AllocationCounters allocated = allocation_counters();
+
+    ARM_COMPUTE_EXPECT(allocated.live_bytes - before.live_bytes >= tensor.info()->total_size(),
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(allocated.live_allocations == before.live_allocations + 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(allocated.total_allocations == before.total_allocations + 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(allocated.peak_bytes >= allocated.live_bytes, framework::LogLevel::ERRORS);
+
+    tensor.allocator()->free();
+    const AllocationCounters after = allocation_counters();
+
+    ARM_COMPUTE_EXPECT(after.live_bytes == before.live_bytes, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(after.live_allocations == before.live_allocations, framework::LogLevel::ERRORS);
+
+    reset_allocation_peak();
+    ARM_COMPUTE_EXPECT(allocation_counters().peak_bytes == after.live_bytes, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FullyConnectedLayer, framework::DatasetMode::ALL)
+{
+    Tensor src     = create_tensor<Tensor>(TensorShape(64U, 2U), DataType::F32, 1);
+    Tensor weights = create_tensor<Tensor>(TensorShape(64U, 32U), DataType::F32, 1);
+    Tensor bias    = create_tensor<Tensor>(TensorShape(32U), DataType::F32, 1);
+    Tensor dst     = create_tensor<Tensor>(TensorShape(32U, 2U), DataType::F32, 1);
+
+    NEFullyConnectedLayer fc{};
+    fc.configure(&src, &weights, &bias, &dst);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    bias.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(Accessor(weights), 1);
+    library->fill_tensor_uniform(Accessor(bias), 2);
+
+    // Before preparing, the original weights are resident
+    const MemoryFootprint configured = fc.memory_footprint();
+    ARM_COMPUTE_EXPECT(configured.const_weights == weights.info()->total_size(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(configured.peak() >= configured.total(), framework::LogLevel::ERRORS);
+
+    fc.run();
+
+    // Once prepared, only the transformed copy is left
+    const MemoryFootprint prepared = fc.memory_footprint();
+    ARM_COMPUTE_EXPECT(!weights.is_used(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(prepared.const_weights == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(prepared.prepared_weights != 0, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(GraphReleasesSharedWeights, framework::DatasetMode::ALL)
+{
+    // Two fully connected layers consume the same constant weights: they must stay resident until both prepared
+    for (bool use_weights_manager : {false, true})
+    {
+        graph::Graph      g(0, "SharedWeights");
+        graph::NodeParams params{"", graph::Target::NEON};
+
+        const graph::NodeID input = graph::GraphBuilder::add_input_node(
+            g, params, graph::TensorDescriptor(TensorShape(64U, 2U), DataType::F32));
+        const graph::NodeID weights = graph::GraphBuilder::add_const_node(
+            g, params, graph::TensorDescriptor(TensorShape(64U, 32U), DataType::F32));
+        const graph::NodeID fc0 = graph::GraphBuilder::add_fully_connected_layer(g, params, {input, 0}, 32U, weights);
+        const graph::NodeID fc1 = graph::GraphBuilder::add_fully_connected_layer(g, params, {input, 0}, 32U, weights);
+        graph::GraphBuilder::add_output_node(g, params, {fc0, 0});
+        graph::GraphBuilder::add_output_node(g, params, {fc1, 0});
+
+        graph::GraphConfig config{};
+        config.use_function_weights_manager = use_weights_manager;
+
+        graph::GraphContext ctx{};
+        graph::GraphManager manager{};
+        graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+        ctx.set_config(config);
+        manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+
+        const ITensor &weights_tensor = g.node(weights)->output(0)->handle()->tensor();
+        ARM_COMPUTE_EXPECT(!weights_tensor.is_used(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(weights_tensor.buffer() == nullptr, framework::LogLevel::ERRORS);
+
+        const MemoryFootprint footprint = manager.memory_footprint(g);
+        ARM_COMPUTE_EXPECT(footprint.const_weights == 0, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(footprint.prepared_weights != 0, framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
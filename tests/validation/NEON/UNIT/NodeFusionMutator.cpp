@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/mutators/NodeFusionMutator.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Assign every node of the graph to Neon, as the graph manager does before running the mutators */
+void force_neon_target(graph::Graph &g)
+{
+    for (auto &node : g.nodes())
+    {
+        if (node != nullptr)
+        {
+            node->set_assigned_target(graph::Target::NEON);
+        }
+    }
+}
+
+/** Node producing the input @p idx of @p node */
+graph::NodeID producer_of(const graph::INode &node, size_t idx)
+{
+    const graph::Edge *edge = node.input_edge(idx);
+    ARM_COMPUTE_ASSERT(edge != nullptr);
+    return edge->producer_id();
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(NodeFusionMutator)
+
+/** Validates that an add, a relu and a residual multiplication are replaced by a single fused node
+ *
+ * in0 ---+-> Add -> Relu -> Mul -> out
+ * in1 ---'                   ^
+ * in0 -----------------------'
+ */
+TEST_CASE(FuseElementwiseChain, framework::DatasetMode::ALL)
+{
+    graph::Graph                  g(0, "FuseElementwiseChain");
+    const graph::NodeParams       params{"", graph::Target::NEON};
+    const graph::TensorDescriptor desc(TensorShape(16U, 4U), DataType::F32);
+
+    const graph::NodeID in0 = graph::GraphBuilder::add_input_node(g, params, desc);
+    const graph::NodeID in1 = graph::GraphBuilder::add_input_node(g, params, desc);
+    const graph::NodeID add =
+        graph::GraphBuilder::add_elementwise_node(g, params, {in0, 0}, {in1, 0}, graph::EltwiseOperation::Add);
+    const graph::NodeID act = graph::GraphBuilder::add_activation_node(
+        g, params, {add, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const graph::NodeID mul =
+        graph::GraphBuilder::add_elementwise_node(g, params, {act, 0}, {in0, 0}, graph::EltwiseOperation::Mul);
+    const graph::NodeID out = graph::GraphBuilder::add_output_node(g, params, {mul, 0});
+    force_neon_target(g);
+
+    graph::NodeFusionMutator mutator;
+    mutator.mutate(g);
+
+    // The chain is gone, replaced by a single fused node
+    ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::EltwiseLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+    const std::vector<graph::NodeID> fused_ids = g.nodes(graph::NodeType::FusedElementwiseLayer);
+    ARM_COMPUTE_ASSERT(fused_ids.size() == 1);
+
+    const auto *fused = arm_compute::utils::cast::polymorphic_downcast<const graph::FusedElementwiseLayerNode *>(
+        g.node(fused_ids[0]));
+    ARM_COMPUTE_EXPECT(fused->assigned_target() == graph::Target::NEON, framework::LogLevel::ERRORS);
+
+    // in0 is read twice by the chain but is a single input of the fused node
+    ARM_COMPUTE_ASSERT(fused->num_inputs() == 2);
+    ARM_COMPUTE_EXPECT(producer_of(*fused, 0) == in0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(producer_of(*fused, 1) == in1, framework::LogLevel::ERRORS);
+
+    // The fused node drives the output of the chain
+    ARM_COMPUTE_EXPECT(producer_of(*g.node(out), 0) == fused_ids[0], framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(fused->output(0)->desc().shape == desc.shape, framework::LogLevel::ERRORS);
+
+    // ((in0 + in1) -> relu) * in0
+    const std::vector<ElementwiseExpressionNode> &nodes = fused->expression().nodes();
+    ARM_COMPUTE_EXPECT(fused->expression().num_inputs() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(nodes.size() == 5);
+    ARM_COMPUTE_EXPECT(nodes[0].op == ElementwiseExpressionOp::INPUT && nodes[0].lhs == 0,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(nodes[1].op == ElementwiseExpressionOp::INPUT && nodes[1].lhs == 1,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(nodes[2].op == ElementwiseExpressionOp::ADD && nodes[2].lhs == 0 && nodes[2].rhs == 1,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(nodes[3].op == ElementwiseExpressionOp::ACTIVATION && nodes[3].lhs == 2 &&
+                           nodes[3].act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU,
+                       framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(nodes[4].op == ElementwiseExpressionOp::MUL && nodes[4].lhs == 3 && nodes[4].rhs == 0,
+                       framework::LogLevel::ERRORS);
+}
+
+/** Validates that a node whose output is read outside of the chain ends the chain
+ *
+ * in0 ---+-> Add -> Relu -> Mul -> out0
+ * in1 ---'    |              ^
+ *             +--------------'
+ *             '-> out1
+ */
+TEST_CASE(StopAtSharedOutput, framework::DatasetMode::ALL)
+{
+    graph::Graph                  g(0, "StopAtSharedOutput");
+    const graph::NodeParams       params{"", graph::Target::NEON};
+    const graph::TensorDescriptor desc(TensorShape(16U, 4U), DataType::F32);
+
+    const graph::NodeID in0 = graph::GraphBuilder::add_input_node(g, params, desc);
+    const graph::NodeID in1 = graph::GraphBuilder::add_input_node(g, params, desc);
+    const graph::NodeID add =
+        graph::GraphBuilder::add_elementwise_node(g, params, {in0, 0}, {in1, 0}, graph::EltwiseOperation::Add);
+    const graph::NodeID act = graph::GraphBuilder::add_activation_node(
+        g, params, {add, 0}, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    const graph::NodeID mul =
+        graph::GraphBuilder::add_elementwise_node(g, params, {act, 0}, {add, 0}, graph::EltwiseOperation::Mul);
+    graph::GraphBuilder::add_output_node(g, params, {mul, 0});
+    const graph::NodeID out1 = graph::GraphBuilder::add_output_node(g, params, {add, 0});
+    force_neon_target(g);
+
+    graph::NodeFusionMutator mutator;
+    mutator.mutate(g);
+
+    // The add is kept, the relu and the multiplication are fused
+    ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::EltwiseLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.node(add) != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+    const std::vector<graph::NodeID> fused_ids = g.nodes(graph::NodeType::FusedElementwiseLayer);
+    ARM_COMPUTE_ASSERT(fused_ids.size() == 1);
+
+    // The output of the add is a single input of the fused node and still feeds out1
+    const graph::INode *fused = g.node(fused_ids[0]);
+    ARM_COMPUTE_ASSERT(fused->num_inputs() == 1);
+    ARM_COMPUTE_EXPECT(producer_of(*fused, 0) == add, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(producer_of(*g.node(out1), 0) == add, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // NodeFusionMutator
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -81,6 +81,52 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
 }
 // clang-format on
 // *INDENT-ON*
+
+TEST_CASE(PaddingAfterConfigure, framework::DatasetMode::ALL)
+{
+    // The copy plan must follow the strides of the tensors at run time, not the ones seen by configure()
+    std::vector<Tensor> srcs(2);
+    srcs[0].allocator()->init(TensorInfo(TensorShape(5U, 3U, 2U), 1, DataType::F32));
+    srcs[1].allocator()->init(TensorInfo(TensorShape(7U, 3U, 2U), 1, DataType::F32));
+    Tensor dst{};
+
+    NEConcatenateLayer concat{};
+    concat.configure({ &srcs[0], &srcs[1] }, &dst, 0);
+
+    srcs[0].info()->extend_padding(PaddingSize(1U, 2U, 1U, 3U));
+    srcs[1].info()->extend_padding(PaddingSize(2U, 1U, 3U, 1U));
+    dst.info()->extend_padding(PaddingSize(3U, 4U, 1U, 2U));
+
+    for(size_t i = 0; i < srcs.size(); ++i)
+    {
+        srcs[i].allocator()->allocate();
+        library->fill_tensor_uniform(Accessor(srcs[i]), i);
+    }
+    dst.allocator()->allocate();
+
+    concat.run();
+
+    bool     is_valid = true;
+    Accessor dst_accessor(dst);
+    for(size_t z = 0; z < dst.info()->dimension(2); ++z)
+    {
+        for(size_t row = 0; row < dst.info()->dimension(1); ++row)
+        {
+            for(size_t col = 0; col < dst.info()->dimension(0); ++col)
+            {
+                const size_t src_idx = col < 5U ? 0U : 1U;
+                const size_t src_col = col < 5U ? col : col - 5U;
+                Accessor     src_accessor(srcs[src_idx]);
+
+                const float expected = *reinterpret_cast<const float *>(src_accessor(Coordinates(src_col, row, z)));
+                const float actual   = *reinterpret_cast<const float *>(dst_accessor(Coordinates(col, row, z)));
+                is_valid &= expected == actual;
+            }
+        }
+    }
+    ARM_COMPUTE_EXPECT(is_valid, framework::LogLevel::ERRORS);
+}
+
 template <typename T>
 using NEWidthConcatenateLayerFixture = ConcatenateLayerValidationFixture<Tensor, ITensor, Accessor, NEConcatenateLayer, T>;
 
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/YUVPreprocessInfo.h"
+#include "arm_compute/runtime/NEON/functions/NEYUVPreprocess.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/YUVPreprocessFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using framework::dataset::make;
+
+namespace
+{
+constexpr AbsoluteTolerance<float>   tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for F32 */
+#ifdef ARM_COMPUTE_ENABLE_FP16
+constexpr AbsoluteTolerance<float>   tolerance_f16(0.01f);  /**< Tolerance value for comparing reference's output against implementation's output for F16 */
+#endif // ARM_COMPUTE_ENABLE_FP16
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);  /**< Tolerance value for comparing reference's output against implementation's output for QASYMM8 */
+constexpr AbsoluteTolerance<int8_t>  tolerance_qasymm8_signed(1); /**< Tolerance value for comparing reference's output against implementation's output for QASYMM8_SIGNED */
+
+/** Frames with odd and even sizes, and the destination each is resized to */
+const auto FrameDataset = zip(make("FrameShape", { TensorShape(33U, 27U), TensorShape(64U, 48U, 2U) }),
+                              make("DstShape", { TensorShape(3U, 20U, 17U), TensorShape(3U, 37U, 29U, 2U) }));
+
+const auto FormatDataset = make("Format", { Format::NV12, Format::NV21, Format::IYUV });
+
+/** The first crop keeps the whole frame, the second starts on odd coordinates */
+const auto CropDataset = make("Crop", { Rectangle{ 0, 0, 0, 0 }, Rectangle{ 3, 5, 20, 12 } });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(YUVPreprocess)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(
+    make("LumaInfo", { TensorInfo(TensorShape(32U, 16U), 1, DataType::U8),
+                       TensorInfo(TensorShape(32U, 16U), 1, DataType::U8),
+                       TensorInfo(TensorShape(32U, 16U), 1, DataType::U8),
+                       TensorInfo(TensorShape(32U, 16U), 1, DataType::U8),
+                       TensorInfo(TensorShape(32U, 16U), 1, DataType::U8),
+                       TensorInfo(TensorShape(32U, 16U), 1, DataType::U8),
+                       TensorInfo(TensorShape(32U, 16U), 1, DataType::F32),
+                       TensorInfo(TensorShape(32U, 16U), 1, DataType::U8),
+                     }),
+    make("Chroma0Info", { TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),
+                          TensorInfo(TensorShape(16U, 8U), 1, DataType::U8),  // Interleaved chroma plane too narrow
+                          TensorInfo(TensorShape(16U, 8U), 1, DataType::U8),  // IYUV without Cr plane
+                          TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),  // NCHW destination
+                          TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),  // Four channels destination
+                          TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),  // U8 destination
+                          TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),  // F32 luma plane
+                          TensorInfo(TensorShape(32U, 8U), 1, DataType::U8),  // Crop out of the frame
+                        }),
+    make("DstInfo", { TensorInfo(TensorShape(3U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                      TensorInfo(TensorShape(3U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                      TensorInfo(TensorShape(3U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                      TensorInfo(TensorShape(3U, 8U, 8U), 1, DataType::F32, DataLayout::NCHW),
+                      TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                      TensorInfo(TensorShape(3U, 8U, 8U), 1, DataType::U8, DataLayout::NHWC),
+                      TensorInfo(TensorShape(3U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                      TensorInfo(TensorShape(3U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                    }),
+    make("Info", { YUVPreprocessInfo(Format::NV12),
+                   YUVPreprocessInfo(Format::NV12),
+                   YUVPreprocessInfo(Format::IYUV),
+                   YUVPreprocessInfo(Format::NV12),
+                   YUVPreprocessInfo(Format::NV12),
+                   YUVPreprocessInfo(Format::NV12),
+                   YUVPreprocessInfo(Format::NV12),
+                   YUVPreprocessInfo(Format::NV12, YUVColorStandard::BT601, false, Rectangle{ 20, 4, 16, 8 }),
+                 }),
+    make("Expected", { true, false, false, false, false, false, false, false })),
+    luma_info, chroma0_info, dst_info, info, expected)
+{
+    const Status status = NEYUVPreprocess::validate(&luma_info.clone()->set_is_resizable(false),
+                                                    &chroma0_info.clone()->set_is_resizable(false),
+                                                    nullptr,
+                                                    &dst_info.clone()->set_is_resizable(false),
+                                                    info);
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEYUVPreprocessFixture = YUVPreprocessValidationFixture<Tensor, Accessor, NEYUVPreprocess, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEYUVPreprocessFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(FrameDataset,
+                               FormatDataset,
+                               make("ColorStandard", { YUVColorStandard::BT601, YUVColorStandard::BT709 }),
+                               make("FullRange", { false, true }),
+                               CropDataset,
+                               make("BGR", { false }),
+                               make("DataType", DataType::F32),
+                               make("QuantizationInfo", QuantizationInfo())))
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunBGR, NEYUVPreprocessFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(FrameDataset,
+                               FormatDataset,
+                               make("ColorStandard", YUVColorStandard::BT709),
+                               make("FullRange", false),
+                               CropDataset,
+                               make("BGR", true),
+                               make("DataType", DataType::F32),
+                               make("QuantizationInfo", QuantizationInfo())))
+{
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END() // FP32
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEYUVPreprocessFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(FrameDataset,
+                               FormatDataset,
+                               make("ColorStandard", YUVColorStandard::BT601),
+                               make("FullRange", false),
+                               CropDataset,
+                               make("BGR", false),
+                               make("DataType", DataType::F16),
+                               make("QuantizationInfo", QuantizationInfo())))
+{
+    if(CPUInfo::get().has_fp16())
+    {
+        validate(Accessor(_target), _reference, tolerance_f16);
+    }
+    else
+    {
+        ARM_COMPUTE_TEST_INFO("Device does not support fp16 vector operations. Test SKIPPED.");
+        framework::ARM_COMPUTE_PRINT_INFO();
+    }
+}
+TEST_SUITE_END() // FP16
+#endif           // ARM_COMPUTE_ENABLE_FP16
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEYUVPreprocessFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(FrameDataset,
+                               FormatDataset,
+                               make("ColorStandard", YUVColorStandard::BT601),
+                               make("FullRange", false),
+                               CropDataset,
+                               make("BGR", false),
+                               make("DataType", DataType::QASYMM8),
+                               make("QuantizationInfo", QuantizationInfo(1.f / 128.f, 128))))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEYUVPreprocessFixture<int8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(FrameDataset,
+                               FormatDataset,
+                               make("ColorStandard", YUVColorStandard::BT709),
+                               make("FullRange", true),
+                               CropDataset,
+                               make("BGR", true),
+                               make("DataType", DataType::QASYMM8_SIGNED),
+                               make("QuantizationInfo", QuantizationInfo(1.f / 128.f, 0))))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8_signed);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // YUVPreprocess
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Arm Limited.
+ * Copyright (c) 2023-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
 
+#include <atomic>
 #include <stdexcept>
 
 using namespace arm_compute;
@@ -64,6 +65,38 @@ public:
     }
 
 };
+
+class CostedKernel: public ICPPKernel
+{
+public:
+    explicit CostedKernel(uint64_t cost)
+        : _cost(cost)
+    {
+        Window window;
+        window.set(0, Window::Dimension(0, 64));
+        configure(window);
+    }
+
+    const char* name() const override
+    {
+        return "CostedKernel";
+    }
+
+    uint64_t estimate_cost(const CPUInfo &, const Window &) const override
+    {
+        return _cost;
+    }
+
+    void run(const Window &, const ThreadInfo &) override
+    {
+        ++num_runs;
+    }
+
+    std::atomic<unsigned int> num_runs{ 0 };
+
+private:
+    uint64_t _cost;
+};
 }
 
 TEST_SUITE(UNIT)
@@ -86,6 +119,38 @@ TEST_CASE(RethrowException, framework::DatasetMode::ALL)
     }
     ARM_COMPUTE_EXPECT_FAIL("Expected exception not caught", framework::LogLevel::ERRORS);
 }
+
+TEST_CASE(CostModel, framework::DatasetMode::ALL)
+{
+    CPPScheduler        scheduler;
+    CPPScheduler::Hints hints(0);
+    scheduler.set_num_threads(4);
+
+    // Tiny kernels run inline
+    CostedKernel tiny(1000);
+    scheduler.schedule(&tiny, hints);
+    ARM_COMPUTE_EXPECT(tiny.num_runs == 1, framework::LogLevel::ERRORS);
+
+    // Large kernels use the whole pool
+    CostedKernel large(1000000);
+    scheduler.schedule(&large, hints);
+    ARM_COMPUTE_EXPECT(large.num_runs == 4, framework::LogLevel::ERRORS);
+
+    // Small kernels use a subset of the threads
+    CostedKernel small(25000);
+    scheduler.schedule(&small, hints);
+    ARM_COMPUTE_EXPECT(small.num_runs == 2, framework::LogLevel::ERRORS);
+
+    // A slightly bigger kernel following a small one keeps its thread count
+    CostedKernel medium(35000);
+    scheduler.schedule(&medium, hints);
+    ARM_COMPUTE_EXPECT(medium.num_runs == 2, framework::LogLevel::ERRORS);
+
+    // Unless the gain of using more threads is significant
+    CostedKernel bigger(45000);
+    scheduler.schedule(&bigger, hints);
+    ARM_COMPUTE_EXPECT(bigger.num_runs == 4, framework::LogLevel::ERRORS);
+}
 #endif // defined(ARM_COMPUTE_CPP_SCHEDULER) &&  !defined(BARE_METAL)
 TEST_SUITE_END()
 TEST_SUITE_END()
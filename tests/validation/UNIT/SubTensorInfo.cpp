@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023, 2025 Arm Limited.
+ * Copyright (c) 2020-2023, 2025-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -106,6 +106,27 @@ TEST_CASE(SubTensorPaddingExpansion, framework::DatasetMode::ALL)
     }
 }
 
+/** Validate that sub-tensors with gaps between their elements report padding
+ *
+ * Kernels use has_padding() to decide whether a tensor can be processed as a contiguous buffer.
+ */
+TEST_CASE(StridedViewHasPadding, framework::DatasetMode::ALL)
+{
+    TensorInfo tensor_info(TensorShape(23U, 17U, 3U), 1, DataType::F32);
+
+    // Whole planes of the parent are contiguous
+    SubTensorInfo planes(&tensor_info, TensorShape(23U, 17U, 2U), Coordinates(0, 0, 1));
+    ARM_COMPUTE_EXPECT(!planes.has_padding(), framework::LogLevel::ERRORS);
+
+    // Partial rows are strided
+    SubTensorInfo columns(&tensor_info, TensorShape(4U, 17U, 3U), Coordinates(5, 0, 0));
+    ARM_COMPUTE_EXPECT(columns.has_padding(), framework::LogLevel::ERRORS);
+
+    // Partial planes are strided across the outer dimension
+    SubTensorInfo rows(&tensor_info, TensorShape(23U, 3U, 3U), Coordinates(0, 2, 0));
+    ARM_COMPUTE_EXPECT(rows.has_padding(), framework::LogLevel::ERRORS);
+}
+
 TEST_CASE(DynamicShapesNotSupported, framework::DatasetMode::ALL)
 {
     // Static shape at init time
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/IWeightsManager.h"
+#include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/Validation.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Mock transformation doubling the values of F32 weights */
+class MockDoubleWeightsTransform : public ITransformWeights
+{
+public:
+    void configure(const ITensor *input)
+    {
+        _input = input;
+        _output.allocator()->init(*input->info());
+    }
+
+    void run() override
+    {
+        _output.allocator()->allocate();
+        const auto *src = reinterpret_cast<const float *>(_input->buffer());
+        auto       *dst = reinterpret_cast<float *>(_output.buffer());
+        for (size_t i = 0; i < _input->info()->tensor_shape().total_size(); ++i)
+        {
+            dst[i] = 2.f * src[i];
+        }
+        ++num_runs;
+        _reshape_run = true;
+    }
+
+    void release() override
+    {
+        _output.allocator()->free();
+    }
+
+    ITensor *get_weights() override
+    {
+        return &_output;
+    }
+
+    uint32_t uid() override
+    {
+        return 0x1f;
+    }
+
+    static std::atomic<int> num_runs;
+
+private:
+    const ITensor *_input{nullptr};
+    Tensor         _output{};
+};
+
+std::atomic<int> MockDoubleWeightsTransform::num_runs{0};
+
+/** Weights of a model replica, filled with values starting from @p first */
+void init_weights(Tensor &weights, float first)
+{
+    weights.allocator()->init(TensorInfo(TensorShape(7U, 5U), 1, DataType::F32));
+    weights.allocator()->allocate();
+    auto *data = reinterpret_cast<float *>(weights.buffer());
+    for (size_t i = 0; i < weights.info()->tensor_shape().total_size(); ++i)
+    {
+        data[i] = first + static_cast<float>(i);
+    }
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsManager)
+
+/** Validate that replicas can transform their weights concurrently through a shared manager */
+TEST_CASE(ConcurrentReplicas, framework::DatasetMode::ALL)
+{
+    MockDoubleWeightsTransform::num_runs = 0;
+
+    constexpr size_t num_replicas = 4;
+
+    IWeightsManager                         wm;
+    std::vector<Tensor>                     weights(num_replicas);
+    std::vector<MockDoubleWeightsTransform> transforms(num_replicas);
+    std::vector<const ITensor *>            results(num_replicas, nullptr);
+    std::vector<std::thread>                threads;
+
+    for (size_t i = 0; i < num_replicas; ++i)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                init_weights(weights[i], 1.f);
+                transforms[i].configure(&weights[i]);
+                wm.manage(&weights[i]);
+                wm.acquire(&weights[i], &transforms[i]);
+                results[i] = wm.run(&weights[i], &transforms[i]);
+            });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    ARM_COMPUTE_EXPECT(MockDoubleWeightsTransform::num_runs == num_replicas, framework::LogLevel::ERRORS);
+    for (size_t i = 0; i < num_replicas; ++i)
+    {
+        ARM_COMPUTE_EXPECT(results[i] == transforms[i].get_weights(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(wm.are_weights_managed(results[i]), framework::LogLevel::ERRORS);
+
+        const auto *values = reinterpret_cast<const float *>(results[i]->buffer());
+        ARM_COMPUTE_EXPECT(values[0] == 2.f && values[34] == 70.f, framework::LogLevel::ERRORS);
+    }
+}
+
+/** Validate that prepared weights of identical content share a single copy while in use */
+TEST_CASE(SharePreparedWeights, framework::DatasetMode::ALL)
+{
+    IWeightsManager wm;
+    Tensor          weights_a{};
+    Tensor          weights_b{};
+    Tensor          weights_c{};
+    init_weights(weights_a, 1.f);
+    init_weights(weights_b, 1.f);
+    init_weights(weights_c, 3.f);
+
+    auto shared_a = wm.share_prepared_weights(&weights_a, 64);
+    auto shared_b = wm.share_prepared_weights(&weights_b, 64);
+    auto shared_c = wm.share_prepared_weights(&weights_c, 64);
+
+    ARM_COMPUTE_EXPECT(shared_a == shared_b, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(shared_a != shared_c, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(shared_a->buffer() != weights_a.buffer(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reinterpret_cast<uintptr_t>(shared_a->buffer()) % 64 == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(wm.num_shared_prepared_weights() == 2, framework::LogLevel::ERRORS);
+
+    const auto *values = reinterpret_cast<const float *>(shared_b->buffer());
+    ARM_COMPUTE_EXPECT(values[0] == 1.f && values[34] == 35.f, framework::LogLevel::ERRORS);
+
+    // Shared copies are freed when their last user drops them
+    shared_a.reset();
+    ARM_COMPUTE_EXPECT(wm.num_shared_prepared_weights() == 2, framework::LogLevel::ERRORS);
+    shared_b.reset();
+    ARM_COMPUTE_EXPECT(wm.num_shared_prepared_weights() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(wm.share_prepared_weights(&weights_a) != shared_c, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // WeightsManager
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,7 +88,8 @@ public:
     void setup(TensorShape in_shape, Size2D kernel_size, PadStrideInfo pad_stride_info, Size2D dilation,
                unsigned int depth_multiplier, DataType input_data_type, DataType weights_data_type,
                QuantizationInfo input_quantization_info, QuantizationInfo weights_quantization_info, QuantizationInfo output_quantization_info,
-               DataLayout data_layout, ActivationLayerInfo act_info, bool mixed_layout = false, bool in_place = false, bool run_twice = false)
+               DataLayout data_layout, ActivationLayerInfo act_info, bool mixed_layout = false, bool in_place = false, bool run_twice = false,
+               bool enable_fast_math = false)
     {
         ARM_COMPUTE_ERROR_ON(mixed_layout && in_place);
 
@@ -119,6 +120,7 @@ public:
         _dilation                  = dilation;
         _in_place                  = in_place;
         _run_twice                 = run_twice;
+        _enable_fast_math          = enable_fast_math;
 
         _bias_data_type = is_data_type_quantized(_input_data_type) ? DataType::S32 : _input_data_type;
 
@@ -178,7 +180,7 @@ public:
         }
 
         // Create Depthwise Convolution configure function
-        _dwc.configure(&_src, &_weights, &_biases, target_to_use, _pad_stride_info, _depth_multiplier, _act_info, _dilation);
+        configure_function(target_to_use, std::integral_constant<bool, std::is_same<TensorType, Tensor>::value>());
 
         ARM_COMPUTE_ASSERT(_src.info()->is_resizable());
         ARM_COMPUTE_ASSERT(_weights.info()->is_resizable());
@@ -356,6 +358,17 @@ protected:
         }
     }
 
+    // Only the CPU function takes the fast math flag
+    void configure_function(TensorType *target, std::true_type)
+    {
+        _dwc.configure(&_src, &_weights, &_biases, target, _pad_stride_info, _depth_multiplier, _act_info, _dilation, _enable_fast_math);
+    }
+
+    void configure_function(TensorType *target, std::false_type)
+    {
+        _dwc.configure(&_src, &_weights, &_biases, target, _pad_stride_info, _depth_multiplier, _act_info, _dilation);
+    }
+
     TensorType      _target{};
     SimpleTensor<T> _reference{};
 
@@ -382,6 +395,7 @@ protected:
     bool                _mixed_layout{ false };
     bool                _in_place{ false };
     bool                _run_twice{ false };
+    bool                _enable_fast_math{ false };
     bool                _use_dynamic_output_quant{false};
     bool                _skip_test{false};
 
@@ -410,6 +424,19 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class DepthwiseConvolutionLayerValidationFastMathFixture : public DepthwiseConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
+{
+public:
+    void setup(TensorShape in_shape, Size2D kernel_size, PadStrideInfo pad_stride_info, Size2D dilation, unsigned int depth_multiplier, DataType data_type, DataLayout data_layout,
+               ActivationLayerInfo act_info)
+    {
+        DepthwiseConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>::setup(in_shape, kernel_size, pad_stride_info, dilation, depth_multiplier,
+                                                                                                               data_type, data_type, QuantizationInfo(), QuantizationInfo(), QuantizationInfo(),
+                                                                                                               data_layout, act_info, false, false, false, true);
+    }
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class DepthwiseConvolutionLayerNativeValidationFixture : public DepthwiseConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
 {
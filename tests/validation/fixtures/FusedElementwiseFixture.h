@@ -0,0 +1,114 @@
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_FUSEDELEMENTWISEFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_FUSEDELEMENTWISEFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/FusedElementwiseInfo.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/FusedElementwise.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FusedElementwiseValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape0, TensorShape shape1, TensorShape shape2, ElementwiseExpression expr, DataType data_type)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        const std::vector<TensorShape> shapes{ shape0, shape1, shape2 };
+
+        _target    = compute_target(shapes, expr, data_type);
+        _reference = compute_reference(shapes, expr, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        // The last input is kept positive as it is used as a divisor and under square roots
+        if(i == 2)
+        {
+            library->fill_tensor_uniform(tensor, i, 0.5f, 2.f);
+        }
+        else
+        {
+            library->fill_tensor_uniform(tensor, i, -2.f, 2.f);
+        }
+    }
+
+    TensorType compute_target(const std::vector<TensorShape> &shapes, const ElementwiseExpression &expr, DataType data_type)
+    {
+        std::vector<TensorType>      srcs(shapes.size());
+        std::vector<const ITensor *> src_ptrs;
+        for(size_t i = 0; i < shapes.size(); ++i)
+        {
+            srcs[i] = create_tensor<TensorType>(shapes[i], data_type);
+            src_ptrs.push_back(&srcs[i]);
+        }
+        TensorType dst;
+
+        FunctionType fused;
+        fused.configure(src_ptrs, &dst, expr);
+
+        for(auto &src : srcs)
+        {
+            ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        }
+
+        // Padded rows make the kernel walk the tensors row by row instead of as one contiguous block
+        add_padding_x({ &srcs[0] });
+
+        for(auto &src : srcs)
+        {
+            src.allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        }
+        dst.allocator()->allocate();
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        for(size_t i = 0; i < srcs.size(); ++i)
+        {
+            fill(AccessorType(srcs[i]), i);
+        }
+
+        fused.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const std::vector<TensorShape> &shapes, const ElementwiseExpression &expr, DataType data_type)
+    {
+        std::vector<SimpleTensor<T>> srcs;
+        for(size_t i = 0; i < shapes.size(); ++i)
+        {
+            srcs.emplace_back(shapes[i], data_type);
+            fill(srcs.back(), i);
+        }
+
+        return reference::fused_elementwise<T>(srcs, expr);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_FUSEDELEMENTWISEFIXTURE_H
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_GROUPNORMALIZATIONLAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_GROUPNORMALIZATIONLAYERFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/reference/GroupNormalizationLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class GroupNormalizationLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, unsigned int num_groups, DataType data_type, DataLayout data_layout, bool in_place)
+    {
+        if(std::is_same<TensorType, Tensor>::value &&  // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _target    = compute_target(shape, num_groups, data_type, data_layout, in_place);
+        _reference = compute_reference(shape, num_groups, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i, float min, float max)
+    {
+        static_assert(std::is_floating_point<T>::value || std::is_same<T, half>::value, "Only floating point data types supported.");
+        using DistributionType = typename std::conditional<std::is_same<T, half>::value, arm_compute::utils::uniform_real_distribution_16bit<T>, std::uniform_real_distribution<T>>::type;
+
+        DistributionType distribution{ T(min), T(max) };
+        library->fill(tensor, distribution, i);
+    }
+
+    TensorType compute_target(TensorShape shape, unsigned int num_groups, DataType data_type, DataLayout data_layout, bool in_place)
+    {
+        const TensorShape param_shape(shape[2]);
+
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src   = create_tensor<TensorType>(shape, data_type, 1, QuantizationInfo(), data_layout);
+        TensorType dst   = create_tensor<TensorType>(shape, data_type, 1, QuantizationInfo(), data_layout);
+        TensorType gamma = create_tensor<TensorType>(param_shape, data_type);
+        TensorType beta  = create_tensor<TensorType>(param_shape, data_type);
+
+        // Create and configure function
+        FunctionType group_norm_func;
+        group_norm_func.configure(&src, in_place ? nullptr : &dst, &gamma, &beta, num_groups, _epsilon);
+
+        ARM_COMPUTE_ASSERT(src.info()->is_resizable());
+        if(!in_place)
+        {
+            ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+        }
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        gamma.allocator()->allocate();
+        beta.allocator()->allocate();
+        if(!in_place)
+        {
+            dst.allocator()->allocate();
+        }
+
+        ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
+        if(!in_place)
+        {
+            ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+        }
+
+        // Fill tensors
+        fill(AccessorType(src), 0, 1.f, 2.f);
+        fill(AccessorType(gamma), 1, 0.5f, 2.f);
+        fill(AccessorType(beta), 2, -1.f, 1.f);
+
+        // Compute function
+        group_norm_func.run();
+
+        if(in_place)
+        {
+            return src;
+        }
+        else
+        {
+            return dst;
+        }
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, unsigned int num_groups, DataType data_type)
+    {
+        const TensorShape param_shape(shape[2]);
+
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type };
+        SimpleTensor<T> gamma{ param_shape, data_type };
+        SimpleTensor<T> beta{ param_shape, data_type };
+
+        // Fill reference
+        fill(src, 0, 1.f, 2.f);
+        fill(gamma, 1, 0.5f, 2.f);
+        fill(beta, 2, -1.f, 1.f);
+
+        return reference::group_normalization<T>(src, gamma, beta, num_groups, _epsilon);
+    }
+
+    static constexpr float _epsilon{ 1e-5f };
+    TensorType             _target{};
+    SimpleTensor<T>        _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_GROUPNORMALIZATIONLAYERFIXTURE_H
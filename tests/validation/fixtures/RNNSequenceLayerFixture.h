@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_RNNSEQUENCELAYERFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_RNNSEQUENCELAYERFIXTURE_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "tests/Globals.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/reference/RNNSequenceLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class RNNSequenceLayerValidationFixture : public framework::Fixture
+{
+public:
+    void setup(unsigned int          input_size,
+               unsigned int          num_units,
+               unsigned int          batch_size,
+               unsigned int          seq_len,
+               RecurrentSequenceInfo info,
+               bool                  has_recurrent_bias,
+               DataType              data_type)
+    {
+        const unsigned int num_gates      = info.cell_type == RecurrentCellType::GRU ? 3 : 1;
+        const unsigned int num_directions = info.bidirectional ? 2 : 1;
+
+        _input_shape             = TensorShape(input_size, batch_size, seq_len);
+        _weights_shape           = TensorShape(input_size, num_gates * num_units, num_directions);
+        _recurrent_weights_shape = TensorShape(num_gates * num_units, num_units, num_directions);
+        _bias_shape              = TensorShape(num_gates * num_units, num_directions);
+        _hidden_state_shape      = TensorShape(num_units, batch_size, num_directions);
+        _output_shape            = TensorShape(num_directions * num_units, batch_size, seq_len);
+
+        compute_target(info, has_recurrent_bias, data_type);
+        compute_reference(info, has_recurrent_bias, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        std::uniform_real_distribution<T> distribution(T(-1.0f), T(1.0f));
+        library->fill(tensor, distribution, i);
+    }
+
+    void compute_target(const RecurrentSequenceInfo &info, bool has_recurrent_bias, DataType data_type)
+    {
+        // Create tensors
+        TensorType input             = create_tensor<TensorType>(_input_shape, data_type);
+        TensorType weights           = create_tensor<TensorType>(_weights_shape, data_type);
+        TensorType recurrent_weights = create_tensor<TensorType>(_recurrent_weights_shape, data_type);
+        TensorType bias              = create_tensor<TensorType>(_bias_shape, data_type);
+        TensorType recurrent_bias    = create_tensor<TensorType>(_bias_shape, data_type);
+        TensorType hidden_state      = create_tensor<TensorType>(_hidden_state_shape, data_type);
+        _target                      = create_tensor<TensorType>(_output_shape, data_type);
+
+        // Create and configure function
+        FunctionType rnn;
+        rnn.configure(&input, &weights, &recurrent_weights, &bias, has_recurrent_bias ? &recurrent_bias : nullptr,
+                      &hidden_state, &_target, info);
+
+        // Allocate tensors
+        input.allocator()->allocate();
+        weights.allocator()->allocate();
+        recurrent_weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        recurrent_bias.allocator()->allocate();
+        hidden_state.allocator()->allocate();
+        _target.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!input.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!hidden_state.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!_target.info()->is_resizable());
+
+        // Fill tensors
+        fill(AccessorType(input), 0);
+        fill(AccessorType(weights), 1);
+        fill(AccessorType(recurrent_weights), 2);
+        fill(AccessorType(bias), 3);
+        fill(AccessorType(recurrent_bias), 4);
+        fill(AccessorType(hidden_state), 5);
+
+        // Compute function
+        rnn.run();
+
+        // Keep the final hidden state of every direction
+        _target_hidden_state = std::move(hidden_state);
+    }
+
+    void compute_reference(const RecurrentSequenceInfo &info, bool has_recurrent_bias, DataType data_type)
+    {
+        SimpleTensor<T> input{_input_shape, data_type};
+        SimpleTensor<T> weights{_weights_shape, data_type};
+        SimpleTensor<T> recurrent_weights{_recurrent_weights_shape, data_type};
+        SimpleTensor<T> bias{_bias_shape, data_type};
+        SimpleTensor<T> recurrent_bias{_bias_shape, data_type};
+        SimpleTensor<T> hidden_state{_hidden_state_shape, data_type};
+
+        fill(input, 0);
+        fill(weights, 1);
+        fill(recurrent_weights, 2);
+        fill(bias, 3);
+        fill(recurrent_bias, 4);
+        fill(hidden_state, 5);
+
+        _reference_hidden_state = hidden_state;
+        _reference              = reference::rnn_sequence_layer(input, weights, recurrent_weights, bias, recurrent_bias,
+                                                                has_recurrent_bias, _reference_hidden_state, info);
+    }
+
+    TensorShape     _input_shape{};
+    TensorShape     _weights_shape{};
+    TensorShape     _recurrent_weights_shape{};
+    TensorShape     _bias_shape{};
+    TensorShape     _hidden_state_shape{};
+    TensorShape     _output_shape{};
+    TensorType      _target{};
+    TensorType      _target_hidden_state{};
+    SimpleTensor<T> _reference{};
+    SimpleTensor<T> _reference_hidden_state{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_RNNSEQUENCELAYERFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024 Arm Limited.
+ * Copyright (c) 2017-2024, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -270,6 +270,102 @@ public:
                                                                                         QuantizationInfo());
     }
 };
+
+/** Resizes a U8 NHWC tensor into a normalised F16/F32 tensor, as done when preparing a network input */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ScaleNormalizationValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape shape, DataType data_type, InterpolationPolicy policy, SamplingPolicy sampling_policy)
+    {
+        if(std::is_same<TensorType, Tensor>::value &&  // Cpu
+            data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        _shape           = shape;
+        _policy          = policy;
+        _sampling_policy = sampling_policy;
+
+        // Input shape is always given in NCHW layout
+        for(size_t c = 0; c < shape[2]; ++c)
+        {
+            _mean.push_back(100.f + 5.f * c);
+            _std.push_back(50.f + 2.f * c);
+        }
+
+        std::mt19937                          generator(library->seed());
+        std::uniform_real_distribution<float> distribution_float(0.25f, 3.f);
+        _scale_x = std::max(1.f, std::round(shape[0] * distribution_float(generator))) / shape[0];
+        _scale_y = std::max(1.f, std::round(shape[1] * distribution_float(generator))) / shape[1];
+
+        _target    = compute_target(shape, data_type);
+        _reference = compute_reference(shape);
+    }
+
+protected:
+    TensorType compute_target(TensorShape shape, DataType data_type)
+    {
+        permute(shape, PermutationVector(2U, 0U, 1U));
+
+        TensorType  src = create_tensor<TensorType>(shape, DataType::U8, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorShape shape_scaled(shape);
+        shape_scaled.set(1, shape[1] * _scale_x, /* apply_dim_correction = */ false);
+        shape_scaled.set(2, shape[2] * _scale_y, /* apply_dim_correction = */ false);
+        TensorType dst = create_tensor<TensorType>(shape_scaled, data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+
+        ScaleKernelInfo info{ _policy, BorderMode::REPLICATE, PixelValue(), _sampling_policy, /* use_padding */ false };
+        info.norm_mean = _mean;
+        info.norm_std  = _std;
+
+        FunctionType scale;
+        scale.configure(&src, &dst, info);
+
+        add_padding_x({ &src, &dst }, DataLayout::NHWC);
+
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        library->fill_tensor_uniform(AccessorType(src), 0);
+
+        scale.run();
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape)
+    {
+        SimpleTensor<uint8_t> src{ shape, DataType::U8 };
+        library->fill_tensor_uniform(src, 0);
+
+        SimpleTensor<float> src_f{ shape, DataType::F32 };
+        for(int i = 0; i < src.num_elements(); ++i)
+        {
+            src_f[i] = src[i];
+        }
+
+        const SimpleTensor<float> dst_f = reference::scale<float>(src_f, _scale_x, _scale_y, _policy, BorderMode::REPLICATE, 0.f, _sampling_policy, /* ceil_policy_scale */ false,
+                                                                  /* align_corners */ false, QuantizationInfo());
+
+        SimpleTensor<T> dst{ dst_f.shape(), std::is_same<T, float>::value ? DataType::F32 : DataType::F16 };
+        for(int i = 0; i < dst_f.num_elements(); ++i)
+        {
+            const size_t c = index2coord(dst_f.shape(), i)[2];
+            dst[i]         = static_cast<T>((dst_f[i] - _mean[c]) / _std[c]);
+        }
+        return dst;
+    }
+
+    TensorType          _target{};
+    SimpleTensor<T>     _reference{};
+    TensorShape         _shape{};
+    InterpolationPolicy _policy{};
+    SamplingPolicy      _sampling_policy{};
+    std::vector<float>  _mean{};
+    std::vector<float>  _std{};
+    float               _scale_x{ 1.f };
+    float               _scale_y{ 1.f };
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_FIXTURES_YUVPREPROCESSFIXTURE_H
+#define ACL_TESTS_VALIDATION_FIXTURES_YUVPREPROCESSFIXTURE_H
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/function_info/YUVPreprocessInfo.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/YUVPreprocess.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class YUVPreprocessValidationFixture : public framework::Fixture
+{
+public:
+    void setup(TensorShape frame_shape, TensorShape dst_shape, Format format, YUVColorStandard color_standard,
+               bool full_range, Rectangle crop, bool bgr, DataType data_type, QuantizationInfo qinfo)
+    {
+        if(std::is_same<TensorType, Tensor>::value && // Cpu
+           data_type == DataType::F16 && !CPUInfo::get().has_fp16())
+        {
+            return;
+        }
+
+        // Quantized destinations are normalised to [-1, 1], float ones with the usual image statistics
+        const bool               is_quantized = is_data_type_quantized(data_type);
+        const std::vector<float> norm_mean    = is_quantized ? std::vector<float>{ 127.5f } : std::vector<float>{ 123.675f, 116.28f, 103.53f };
+        const std::vector<float> norm_std     = is_quantized ? std::vector<float>{ 127.5f } : std::vector<float>{ 58.395f, 57.12f, 57.375f };
+
+        const YUVPreprocessInfo info(format, color_standard, full_range, crop, SamplingPolicy::CENTER, bgr, norm_mean, norm_std);
+
+        // Chroma planes are subsampled by two in both directions
+        const size_t chroma_width = (frame_shape[0] + 1) / 2;
+        TensorShape  chroma0_shape(frame_shape);
+        chroma0_shape.set(0, format == Format::IYUV ? chroma_width : 2 * chroma_width);
+        chroma0_shape.set(1, (frame_shape[1] + 1) / 2);
+        TensorShape chroma1_shape(chroma0_shape);
+        chroma1_shape.set(0, chroma_width);
+
+        _target    = compute_target(frame_shape, chroma0_shape, chroma1_shape, dst_shape, data_type, qinfo, info);
+        _reference = compute_reference(frame_shape, chroma0_shape, chroma1_shape, dst_shape, data_type, qinfo, info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i);
+    }
+
+    TensorType compute_target(const TensorShape &frame_shape, const TensorShape &chroma0_shape, const TensorShape &chroma1_shape,
+                              const TensorShape &dst_shape, DataType data_type, QuantizationInfo qinfo, const YUVPreprocessInfo &info)
+    {
+        const bool is_planar = info.format == Format::IYUV;
+
+        TensorType luma    = create_tensor<TensorType>(frame_shape, DataType::U8);
+        TensorType chroma0 = create_tensor<TensorType>(chroma0_shape, DataType::U8);
+        TensorType chroma1 = create_tensor<TensorType>(chroma1_shape, DataType::U8);
+        TensorType dst     = create_tensor<TensorType>(dst_shape, data_type, 1, qinfo, DataLayout::NHWC);
+
+        FunctionType preprocess;
+        preprocess.configure(&luma, &chroma0, is_planar ? &chroma1 : nullptr, &dst, info);
+
+        ARM_COMPUTE_ASSERT(luma.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(chroma0.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(chroma1.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
+
+        // The planes of a camera frame often have a row stride larger than their width
+        add_padding_x({ &luma, &chroma0, &chroma1 });
+
+        luma.allocator()->allocate();
+        chroma0.allocator()->allocate();
+        chroma1.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_ASSERT(!luma.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!chroma0.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!chroma1.info()->is_resizable());
+        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        fill(AccessorType(luma), 0);
+        fill(AccessorType(chroma0), 1);
+        fill(AccessorType(chroma1), 2);
+
+        preprocess.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &frame_shape, const TensorShape &chroma0_shape, const TensorShape &chroma1_shape,
+                                      const TensorShape &dst_shape, DataType data_type, QuantizationInfo qinfo, const YUVPreprocessInfo &info)
+    {
+        SimpleTensor<uint8_t> luma{ frame_shape, DataType::U8 };
+        SimpleTensor<uint8_t> chroma0{ chroma0_shape, DataType::U8 };
+        SimpleTensor<uint8_t> chroma1{ chroma1_shape, DataType::U8 };
+
+        fill(luma, 0);
+        fill(chroma0, 1);
+        fill(chroma1, 2);
+
+        return reference::yuv_preprocess<T>(luma, chroma0, chroma1, dst_shape, data_type, qinfo, info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_FIXTURES_YUVPREPROCESSFIXTURE_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -131,9 +131,9 @@ SimpleTensor<float> crop_image(const SimpleTensor<T> &src, Coordinates start, Co
     win.use_tensor_dimensions(out_shape);
     execute_window_loop(win, [&](const Coordinates & id)
     {
-        bool        out_of_bounds = false;
+        bool        out_of_bounds = batch_index < 0 || static_cast<uint32_t>(batch_index) >= src.shape()[3];
         Coordinates offset(id[0], 0, 0, batch_index);
-        for(uint32_t i = 1; i < 3; ++i)
+        for(uint32_t i = 1; i < 3 && !out_of_bounds; ++i)
         {
             offset.set(i, end[i - 1] < start[i - 1] ? start[i - 1] - id[i] : start[i - 1] + id[i]);
             if(offset[i] < 0 || static_cast<uint32_t>(offset[i]) > src.shape()[i] - 1)
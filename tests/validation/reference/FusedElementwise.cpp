@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "FusedElementwise.h"
+
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+float evaluate_node(const ElementwiseExpressionNode &node, const std::vector<float> &values)
+{
+    const float a = node.lhs >= 0 ? values[node.lhs] : 0.f;
+    const float b = node.rhs >= 0 ? values[node.rhs] : 0.f;
+
+    switch (node.op)
+    {
+        case ElementwiseExpressionOp::ADD:
+            return a + b;
+        case ElementwiseExpressionOp::SUB:
+            return a - b;
+        case ElementwiseExpressionOp::MUL:
+            return a * b;
+        case ElementwiseExpressionOp::DIV:
+            return a / b;
+        case ElementwiseExpressionOp::MAX:
+            return std::max(a, b);
+        case ElementwiseExpressionOp::MIN:
+            return std::min(a, b);
+        case ElementwiseExpressionOp::SQUARED_DIFF:
+            return (a - b) * (a - b);
+        case ElementwiseExpressionOp::NEG:
+            return -a;
+        case ElementwiseExpressionOp::ABS:
+            return std::abs(a);
+        case ElementwiseExpressionOp::EXP:
+            return std::exp(a);
+        case ElementwiseExpressionOp::RSQRT:
+            return 1.f / std::sqrt(a);
+        case ElementwiseExpressionOp::ACTIVATION:
+            return activate_float<float>(a, node.act_info.a(), node.act_info.b(), node.act_info.activation());
+        default:
+            ARM_COMPUTE_ERROR("Unsupported operation");
+    }
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> fused_elementwise(const std::vector<SimpleTensor<T>> &srcs, const ElementwiseExpression &expr)
+{
+    ARM_COMPUTE_ERROR_ON(srcs.empty());
+
+    TensorShape dst_shape = srcs[0].shape();
+    for (const auto &src : srcs)
+    {
+        dst_shape = TensorShape::broadcast_shape(dst_shape, src.shape());
+    }
+
+    SimpleTensor<T>    dst{dst_shape, srcs[0].data_type()};
+    std::vector<float> values(expr.nodes().size());
+
+#if defined(_OPENMP)
+    #pragma omp parallel for firstprivate(values)
+#endif /* _OPENMP */
+    for (int i = 0; i < dst.num_elements(); ++i)
+    {
+        const Coordinates dst_coord = index2coord(dst_shape, i);
+
+        for (size_t n = 0; n < expr.nodes().size(); ++n)
+        {
+            const auto &node = expr.nodes()[n];
+            if (node.op == ElementwiseExpressionOp::INPUT)
+            {
+                // Broadcast dimensions always read their first element
+                const auto &src       = srcs[node.lhs];
+                Coordinates src_coord = dst_coord;
+                for (size_t d = 0; d < src.shape().num_dimensions(); ++d)
+                {
+                    if (src.shape()[d] == 1)
+                    {
+                        src_coord.set(d, 0);
+                    }
+                }
+                for (size_t d = src.shape().num_dimensions(); d < dst_shape.num_dimensions(); ++d)
+                {
+                    src_coord.set(d, 0);
+                }
+                values[n] = static_cast<float>(src[coord2index(src.shape(), src_coord)]);
+            }
+            else
+            {
+                values[n] = evaluate_node(node, values);
+            }
+        }
+
+        dst[i] = static_cast<T>(values.back());
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> fused_elementwise(const std::vector<SimpleTensor<float>> &srcs,
+                                               const ElementwiseExpression            &expr);
+template SimpleTensor<half>  fused_elementwise(const std::vector<SimpleTensor<half>> &srcs,
+                                               const ElementwiseExpression           &expr);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "GroupNormalizationLayer.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> group_normalization(const SimpleTensor<T> &src,
+                                    const SimpleTensor<T> &gamma,
+                                    const SimpleTensor<T> &beta,
+                                    unsigned int           num_groups,
+                                    float                  epsilon)
+{
+    SimpleTensor<T> dst{ src.shape(), src.data_type() };
+
+    //NCHW
+    const size_t w_size             = src.shape()[0];
+    const size_t h_size             = src.shape()[1];
+    const size_t c_size             = src.shape()[2];
+    const size_t n_size             = src.shape()[3];
+    const size_t channels_per_group = c_size / num_groups;
+    const size_t group_size         = channels_per_group * h_size * w_size;
+
+    for(size_t n_i = 0; n_i < n_size; ++n_i)
+    {
+        for(size_t g_i = 0; g_i < num_groups; ++g_i)
+        {
+            const size_t first_channel = g_i * channels_per_group;
+
+            // Two passes over the group, to keep the reference independent of the single pass statistics of the target
+            double sum = 0;
+            for(size_t c_i = first_channel; c_i < first_channel + channels_per_group; ++c_i)
+            {
+                for(size_t h_i = 0; h_i < h_size; ++h_i)
+                {
+                    for(size_t w_i = 0; w_i < w_size; ++w_i)
+                    {
+                        sum += static_cast<double>(src[coord2index(src.shape(), Coordinates(w_i, h_i, c_i, n_i))]);
+                    }
+                }
+            }
+            const double mean = sum / group_size;
+
+            double sum_sq = 0;
+            for(size_t c_i = first_channel; c_i < first_channel + channels_per_group; ++c_i)
+            {
+                for(size_t h_i = 0; h_i < h_size; ++h_i)
+                {
+                    for(size_t w_i = 0; w_i < w_size; ++w_i)
+                    {
+                        const double delta = static_cast<double>(src[coord2index(src.shape(), Coordinates(w_i, h_i, c_i, n_i))]) - mean;
+                        sum_sq += delta * delta;
+                    }
+                }
+            }
+            const double inv_std_dev = 1.0 / std::sqrt(sum_sq / group_size + epsilon);
+
+            for(size_t c_i = first_channel; c_i < first_channel + channels_per_group; ++c_i)
+            {
+                const double gamma_c = static_cast<double>(gamma[c_i]);
+                const double beta_c  = static_cast<double>(beta[c_i]);
+                for(size_t h_i = 0; h_i < h_size; ++h_i)
+                {
+                    for(size_t w_i = 0; w_i < w_size; ++w_i)
+                    {
+                        const size_t index = coord2index(src.shape(), Coordinates(w_i, h_i, c_i, n_i));
+                        dst[index]         = static_cast<T>((static_cast<double>(src[index]) - mean) * inv_std_dev * gamma_c + beta_c);
+                    }
+                }
+            }
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> group_normalization(const SimpleTensor<float> &src, const SimpleTensor<float> &gamma, const SimpleTensor<float> &beta,
+                                                 unsigned int num_groups, float epsilon);
+template SimpleTensor<half> group_normalization(const SimpleTensor<half> &src, const SimpleTensor<half> &gamma, const SimpleTensor<half> &beta,
+                                                unsigned int num_groups, float epsilon);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Arm Limited.
+ * Copyright (c) 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,26 +21,28 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#ifndef SRC_CORE_SVE_KERNELS_INSTANCENORM_IMPL_H
-#define SRC_CORE_SVE_KERNELS_INSTANCENORM_IMPL_H
-#include "arm_compute/core/Helpers.h"
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_GROUPNORMALIZATIONLAYER_H
+#define ACL_TESTS_VALIDATION_REFERENCE_GROUPNORMALIZATIONLAYER_H
 
-#include "arm_neon.h"
+#include "tests/SimpleTensor.h"
+#include "tests/validation/Helpers.h"
 
 namespace arm_compute
 {
-namespace cpu
+namespace test
 {
-template <typename T, typename AccType = T>
-void instance_normalization_nchw(
-    ITensor *input, ITensor *output, float gamma, float beta, float epsilon, const Window &window);
-
-template <typename InputType, typename AccType = InputType>
-void vector_float_sum(AccType &result, AccType &result_square, const InputType &inputs);
-
-template <typename InputType, typename AccType = InputType>
-InputType
-vector_float_norm(const InputType &inputs, const AccType &vec_mean, const AccType &vec_multip, const AccType &vec_beta);
-} // namespace cpu
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> group_normalization(const SimpleTensor<T> &src,
+                                    const SimpleTensor<T> &gamma,
+                                    const SimpleTensor<T> &beta,
+                                    unsigned int           num_groups,
+                                    float                  epsilon);
+} // namespace reference
+} // namespace validation
+} // namespace test
 } // namespace arm_compute
-#endif //define SRC_CORE_SVE_KERNELS_INSTANCENORM_IMPL_H
+#endif // ACL_TESTS_VALIDATION_REFERENCE_GROUPNORMALIZATIONLAYER_H
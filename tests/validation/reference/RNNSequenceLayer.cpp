@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "RNNSequenceLayer.h"
+
+#include "tests/validation/reference/ActivationLayer.h"
+
+#include <cmath>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> rnn_sequence_layer(const SimpleTensor<T>       &input,
+                                   const SimpleTensor<T>       &weights,
+                                   const SimpleTensor<T>       &recurrent_weights,
+                                   const SimpleTensor<T>       &bias,
+                                   const SimpleTensor<T>       &recurrent_bias,
+                                   bool                         has_recurrent_bias,
+                                   SimpleTensor<T>             &hidden_state,
+                                   const RecurrentSequenceInfo &info)
+{
+    const bool         is_gru         = info.cell_type == RecurrentCellType::GRU;
+    const unsigned int input_size     = input.shape()[0];
+    const unsigned int batch_size     = input.shape()[1];
+    const unsigned int seq_len        = input.shape()[2];
+    const unsigned int num_units      = hidden_state.shape()[0];
+    const unsigned int num_directions = hidden_state.shape()[2];
+    const unsigned int gu             = bias.shape()[0];
+
+    SimpleTensor<T> dst{TensorShape(num_directions * num_units, batch_size, seq_len), input.data_type()};
+
+    const auto sigmoid = [](T x) { return T(1) / (T(1) + std::exp(-x)); };
+
+    std::vector<T> x(gu);
+    std::vector<T> acc(gu);
+    for (unsigned int d = 0; d < num_directions; ++d)
+    {
+        for (unsigned int b = 0; b < batch_size; ++b)
+        {
+            T *h = &hidden_state[(d * batch_size + b) * num_units];
+            for (unsigned int step = 0; step < seq_len; ++step)
+            {
+                const unsigned int t = d == 0 ? step : seq_len - 1 - step;
+
+                // Input and recurrent contributions of every gate
+                for (unsigned int n = 0; n < gu; ++n)
+                {
+                    x[n]   = bias[d * gu + n];
+                    acc[n] = has_recurrent_bias ? recurrent_bias[d * gu + n] : T(0);
+                    for (unsigned int c = 0; c < input_size; ++c)
+                    {
+                        x[n] += input[(t * batch_size + b) * input_size + c] * weights[(d * gu + n) * input_size + c];
+                    }
+                    for (unsigned int k = 0; k < num_units; ++k)
+                    {
+                        acc[n] += h[k] * recurrent_weights[(d * num_units + k) * gu + n];
+                    }
+                }
+
+                for (unsigned int u = 0; u < num_units; ++u)
+                {
+                    if (is_gru)
+                    {
+                        const T z = sigmoid(x[u] + acc[u]);
+                        const T r = sigmoid(x[num_units + u] + acc[num_units + u]);
+                        const T c = std::tanh(x[2 * num_units + u] + r * acc[2 * num_units + u]);
+                        h[u]      = (T(1) - z) * c + z * h[u];
+                    }
+                    else
+                    {
+                        h[u] = activate_float<T>(x[u] + acc[u], info.act_info.a(), info.act_info.b(),
+                                                 info.act_info.activation());
+                    }
+                    dst[(t * batch_size + b) * num_directions * num_units + d * num_units + u] = h[u];
+                }
+            }
+        }
+    }
+    return dst;
+}
+
+template SimpleTensor<float> rnn_sequence_layer(const SimpleTensor<float>   &input,
+                                                const SimpleTensor<float>   &weights,
+                                                const SimpleTensor<float>   &recurrent_weights,
+                                                const SimpleTensor<float>   &bias,
+                                                const SimpleTensor<float>   &recurrent_bias,
+                                                bool                         has_recurrent_bias,
+                                                SimpleTensor<float>         &hidden_state,
+                                                const RecurrentSequenceInfo &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_RNNSEQUENCELAYER_H
+#define ACL_TESTS_VALIDATION_REFERENCE_RNNSEQUENCELAYER_H
+
+#include "arm_compute/runtime/FunctionDescriptors.h"
+
+#include "tests/SimpleTensor.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Run a recurrent layer over a whole sequence
+ *
+ * @param[in]     input              Input sequence of shape [input_size, batch_size, seq_len]
+ * @param[in]     weights            Input weights of shape [input_size, num_gates * num_units, num_directions]
+ * @param[in]     recurrent_weights  Recurrent weights of shape [num_gates * num_units, num_units, num_directions]
+ * @param[in]     bias               Input bias of shape [num_gates * num_units, num_directions]
+ * @param[in]     recurrent_bias     Recurrent bias, same shape as @p bias. Ignored if @p has_recurrent_bias is false
+ * @param[in]     has_recurrent_bias True if @p recurrent_bias is added to the recurrent contribution
+ * @param[in,out] hidden_state       Initial hidden state [num_units, batch_size, num_directions], updated in place
+ * @param[in]     info               Cell type, activation and direction of the layer
+ *
+ * @return The hidden state of every step, of shape [num_directions * num_units, batch_size, seq_len]
+ */
+template <typename T>
+SimpleTensor<T> rnn_sequence_layer(const SimpleTensor<T>       &input,
+                                   const SimpleTensor<T>       &weights,
+                                   const SimpleTensor<T>       &recurrent_weights,
+                                   const SimpleTensor<T>       &bias,
+                                   const SimpleTensor<T>       &recurrent_bias,
+                                   bool                         has_recurrent_bias,
+                                   SimpleTensor<T>             &hidden_state,
+                                   const RecurrentSequenceInfo &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_RNNSEQUENCELAYER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,11 +67,11 @@ inline float roi_align_1x1(const float *input, TensorShape input_shape,
                 float y = region_start_y + (iy + 0.5) * bin_size_y / float(grid_size_y);
                 float x = region_start_x + (ix + 0.5) * bin_size_x / float(grid_size_x);
 
-                // Interpolation in the [0,0] [0,1] [1,0] [1,1] square
-                const int y_low  = y;
-                const int x_low  = x;
-                const int y_high = y_low + 1;
-                const int x_high = x_low + 1;
+                // Interpolation in the [0,0] [0,1] [1,0] [1,1] square, clamped to the last row and column
+                const int y_low  = std::min(static_cast<int>(y), static_cast<int>(input_shape[1]) - 1);
+                const int x_low  = std::min(static_cast<int>(x), static_cast<int>(input_shape[0]) - 1);
+                const int y_high = std::min(y_low + 1, static_cast<int>(input_shape[1]) - 1);
+                const int x_high = std::min(x_low + 1, static_cast<int>(input_shape[0]) - 1);
 
                 const float ly = y - y_low;
                 const float lx = x - x_low;
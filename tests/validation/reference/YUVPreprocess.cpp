@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "YUVPreprocess.h"
+
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+/** Samples a plane bilinearly, clamping the coordinates to [x_min, x_max] x [y_min, y_max] */
+template <typename F>
+float sample_bilinear(F &&at, float x, float y, int x_min, int x_max, int y_min, int y_max)
+{
+    const int   xi = static_cast<int>(std::floor(x));
+    const int   yi = static_cast<int>(std::floor(y));
+    const float dx = x - xi;
+    const float dy = y - yi;
+
+    const int x0 = utility::clamp<int>(xi, x_min, x_max);
+    const int x1 = utility::clamp<int>(xi + 1, x_min, x_max);
+    const int y0 = utility::clamp<int>(yi, y_min, y_max);
+    const int y1 = utility::clamp<int>(yi + 1, y_min, y_max);
+
+    const float top    = at(x0, y0) * (1.f - dx) + at(x1, y0) * dx;
+    const float bottom = at(x0, y1) * (1.f - dx) + at(x1, y1) * dx;
+    return top * (1.f - dy) + bottom * dy;
+}
+
+template <typename T>
+T convert_value(float value, const UniformQuantizationInfo &qinfo)
+{
+    ARM_COMPUTE_UNUSED(qinfo);
+    return static_cast<T>(value);
+}
+
+template <>
+uint8_t convert_value(float value, const UniformQuantizationInfo &qinfo)
+{
+    return quantize_qasymm8(value, qinfo);
+}
+
+template <>
+int8_t convert_value(float value, const UniformQuantizationInfo &qinfo)
+{
+    return quantize_qasymm8_signed(value, qinfo);
+}
+
+SimpleTensor<float> yuv_preprocess_float(const SimpleTensor<uint8_t> &luma,
+                                         const SimpleTensor<uint8_t> &chroma0,
+                                         const SimpleTensor<uint8_t> &chroma1,
+                                         const TensorShape           &dst_shape,
+                                         const YUVPreprocessInfo     &info)
+{
+    SimpleTensor<float> dst{dst_shape, DataType::F32, 1, QuantizationInfo(), DataLayout::NHWC};
+
+    const int width       = luma.shape()[0];
+    const int height      = luma.shape()[1];
+    const int crop_x      = info.crop.x;
+    const int crop_y      = info.crop.y;
+    const int crop_width  = info.crop.width == 0 ? width - crop_x : info.crop.width;
+    const int crop_height = info.crop.height == 0 ? height - crop_y : info.crop.height;
+    const int dst_width   = dst_shape[1];
+    const int dst_height  = dst_shape[2];
+    const int batches     = dst_shape[3];
+
+    const float ratio_x = static_cast<float>(crop_width) / dst_width;
+    const float ratio_y = static_cast<float>(crop_height) / dst_height;
+    const float offset  = info.sampling_policy == SamplingPolicy::CENTER ? 0.5f : 0.f;
+
+    // Conversion matrix from the luma weights of red and blue
+    const float kr           = info.color_standard == YUVColorStandard::BT709 ? 0.2126f : 0.299f;
+    const float kb           = info.color_standard == YUVColorStandard::BT709 ? 0.0722f : 0.114f;
+    const float kg           = 1.f - kr - kb;
+    const float chroma_scale = info.full_range ? 1.f : 255.f / 224.f;
+
+    for (int b = 0; b < batches; ++b)
+    {
+        const auto luma_at = [&](int x, int y) { return static_cast<float>(luma[coord2index(luma.shape(), Coordinates(x, y, b))]); };
+        const auto plane_at = [&](const SimpleTensor<uint8_t> &plane, int x, int y)
+        { return static_cast<float>(plane[coord2index(plane.shape(), Coordinates(x, y, b))]); };
+
+        const auto cb_at = [&](int x, int y)
+        {
+            return info.format == Format::IYUV ? plane_at(chroma0, x, y)
+                                               : plane_at(chroma0, 2 * x + (info.format == Format::NV21 ? 1 : 0), y);
+        };
+        const auto cr_at = [&](int x, int y)
+        {
+            return info.format == Format::IYUV ? plane_at(chroma1, x, y)
+                                               : plane_at(chroma0, 2 * x + (info.format == Format::NV21 ? 0 : 1), y);
+        };
+
+        for (int out_y = 0; out_y < dst_height; ++out_y)
+        {
+            for (int out_x = 0; out_x < dst_width; ++out_x)
+            {
+                // Chroma is sited at the centre of each 2x2 block of luma samples and limited to the crop region
+                const float luma_x   = crop_x + (out_x + offset) * ratio_x - offset;
+                const float luma_y   = crop_y + (out_y + offset) * ratio_y - offset;
+                const float chroma_x = (luma_x + 0.5f) * 0.5f - 0.5f;
+                const float chroma_y = (luma_y + 0.5f) * 0.5f - 0.5f;
+
+                float y = sample_bilinear(luma_at, luma_x, luma_y, crop_x, crop_x + crop_width - 1, crop_y,
+                                          crop_y + crop_height - 1);
+                const float cb = sample_bilinear(cb_at, chroma_x, chroma_y, crop_x / 2, (crop_x + crop_width - 1) / 2,
+                                                 crop_y / 2, (crop_y + crop_height - 1) / 2) - 128.f;
+                const float cr = sample_bilinear(cr_at, chroma_x, chroma_y, crop_x / 2, (crop_x + crop_width - 1) / 2,
+                                                 crop_y / 2, (crop_y + crop_height - 1) / 2) - 128.f;
+                y = info.full_range ? y : (y - 16.f) * 255.f / 219.f;
+
+                float rgb[3] = {y + 2.f * (1.f - kr) * chroma_scale * cr,
+                                y - 2.f * kb * (1.f - kb) / kg * chroma_scale * cb - 2.f * kr * (1.f - kr) / kg * chroma_scale * cr,
+                                y + 2.f * (1.f - kb) * chroma_scale * cb};
+                if (info.bgr)
+                {
+                    std::swap(rgb[0], rgb[2]);
+                }
+
+                for (int c = 0; c < 3; ++c)
+                {
+                    const float mean   = info.norm_mean.empty() ? 0.f : info.norm_mean[info.norm_mean.size() == 1 ? 0 : c];
+                    const float stddev = info.norm_std.empty() ? 1.f : info.norm_std[info.norm_std.size() == 1 ? 0 : c];
+                    const float value  = utility::clamp<float>(rgb[c], 0.f, 255.f);
+                    dst[coord2index(dst_shape, Coordinates(c, out_x, out_y, b))] = (value - mean) / stddev;
+                }
+            }
+        }
+    }
+    return dst;
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> yuv_preprocess(const SimpleTensor<uint8_t> &luma,
+                               const SimpleTensor<uint8_t> &chroma0,
+                               const SimpleTensor<uint8_t> &chroma1,
+                               const TensorShape           &dst_shape,
+                               DataType                     dst_data_type,
+                               const QuantizationInfo      &dst_qinfo,
+                               const YUVPreprocessInfo     &info)
+{
+    const SimpleTensor<float>     dst_f32 = yuv_preprocess_float(luma, chroma0, chroma1, dst_shape, info);
+    const UniformQuantizationInfo qinfo   = dst_qinfo.uniform();
+
+    SimpleTensor<T> dst{dst_shape, dst_data_type, 1, dst_qinfo, DataLayout::NHWC};
+    for (int i = 0; i < dst.num_elements(); ++i)
+    {
+        dst[i] = convert_value<T>(dst_f32[i], qinfo);
+    }
+    return dst;
+}
+
+template SimpleTensor<float> yuv_preprocess(const SimpleTensor<uint8_t> &luma,
+                                             const SimpleTensor<uint8_t> &chroma0,
+                                             const SimpleTensor<uint8_t> &chroma1,
+                                             const TensorShape           &dst_shape,
+                                             DataType                     dst_data_type,
+                                             const QuantizationInfo      &dst_qinfo,
+                                             const YUVPreprocessInfo     &info);
+template SimpleTensor<half> yuv_preprocess(const SimpleTensor<uint8_t> &luma,
+                                             const SimpleTensor<uint8_t> &chroma0,
+                                             const SimpleTensor<uint8_t> &chroma1,
+                                             const TensorShape           &dst_shape,
+                                             DataType                     dst_data_type,
+                                             const QuantizationInfo      &dst_qinfo,
+                                             const YUVPreprocessInfo     &info);
+template SimpleTensor<uint8_t> yuv_preprocess(const SimpleTensor<uint8_t> &luma,
+                                             const SimpleTensor<uint8_t> &chroma0,
+                                             const SimpleTensor<uint8_t> &chroma1,
+                                             const TensorShape           &dst_shape,
+                                             DataType                     dst_data_type,
+                                             const QuantizationInfo      &dst_qinfo,
+                                             const YUVPreprocessInfo     &info);
+template SimpleTensor<int8_t> yuv_preprocess(const SimpleTensor<uint8_t> &luma,
+                                             const SimpleTensor<uint8_t> &chroma0,
+                                             const SimpleTensor<uint8_t> &chroma1,
+                                             const TensorShape           &dst_shape,
+                                             DataType                     dst_data_type,
+                                             const QuantizationInfo      &dst_qinfo,
+                                             const YUVPreprocessInfo     &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
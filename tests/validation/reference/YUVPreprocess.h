@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ACL_TESTS_VALIDATION_REFERENCE_YUVPREPROCESS_H
+#define ACL_TESTS_VALIDATION_REFERENCE_YUVPREPROCESS_H
+
+#include "arm_compute/function_info/YUVPreprocessInfo.h"
+#include "tests/SimpleTensor.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+/** Reference of the fused YUV preprocessing
+ *
+ * @param[in] luma            Luma plane of shape [W, H, N]
+ * @param[in] chroma0         Interleaved chroma plane for NV12/NV21, Cb plane for IYUV
+ * @param[in] chroma1         Cr plane for IYUV, ignored otherwise
+ * @param[in] dst_shape       Destination shape [3, W_out, H_out, N]
+ * @param[in] dst_data_type   Destination data type
+ * @param[in] dst_qinfo       Quantization of quantized destinations
+ * @param[in] info            Preprocessing information
+ *
+ * @return The NHWC destination
+ */
+template <typename T>
+SimpleTensor<T> yuv_preprocess(const SimpleTensor<uint8_t> &luma,
+                               const SimpleTensor<uint8_t> &chroma0,
+                               const SimpleTensor<uint8_t> &chroma1,
+                               const TensorShape           &dst_shape,
+                               DataType                     dst_data_type,
+                               const QuantizationInfo      &dst_qinfo,
+                               const YUVPreprocessInfo     &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif // ACL_TESTS_VALIDATION_REFERENCE_YUVPREPROCESS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2025 Arm Limited.
+ * Copyright (c) 2017-2026 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,9 +39,11 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/function_info/ConvolutionInfo.h"
 #include "arm_compute/function_info/FullyConnectedLayerInfo.h"
+#include "arm_compute/function_info/FusedElementwiseInfo.h"
 #include "arm_compute/function_info/GEMMInfo.h"
 #include "arm_compute/function_info/MatMulInfo.h"
 #include "arm_compute/function_info/ScatterInfo.h"
+#include "arm_compute/function_info/YUVPreprocessInfo.h"
 #include "arm_compute/runtime/CL/CLTunerTypes.h"
 #include "arm_compute/runtime/CL/CLTypes.h"
 #include "arm_compute/runtime/common/LSTMParams.h"
@@ -1550,6 +1552,19 @@ inline ::std::ostream &operator<<(::std::ostream &os, const Rectangle &rect)
     return os;
 }
 
+/** Formatted output of the Rectangle type.
+ *
+ * @param[in] rect Type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const Rectangle &rect)
+{
+    std::stringstream str;
+    str << rect;
+    return str.str();
+}
+
 /** Formatted output of the PaddingMode type.
  *
  * @param[out] os   Output stream.
@@ -2783,7 +2798,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const ScaleKernelInfo &sca
        << "SamplingPolicy=" << scale_info.sampling_policy << ", "
        << "use_padding=" << scale_info.use_padding << ", "
        << "align_corners=" << scale_info.align_corners << ", "
-       << "data_layout=" << scale_info.data_layout << "}";
+       << "data_layout=" << scale_info.data_layout << ", "
+       << "norm_mean=" << scale_info.norm_mean << ", "
+       << "norm_std=" << scale_info.norm_std << "}";
     return os;
 }
 
@@ -3169,6 +3186,61 @@ inline std::string to_string(const Conv3dInfo &conv3d_info)
     return str.str();
 }
 
+/** Formatted output of the RecurrentCellType type.
+ *
+ * @param[out] os        Output stream.
+ * @param[in]  cell_type Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const RecurrentCellType &cell_type)
+{
+    switch (cell_type)
+    {
+        case RecurrentCellType::RNN:
+            os << "RNN";
+            break;
+        case RecurrentCellType::GRU:
+            os << "GRU";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+
+    return os;
+}
+
+/** Formatted output of the RecurrentSequenceInfo type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  info Type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const RecurrentSequenceInfo &info)
+{
+    os << info.cell_type;
+    os << ";";
+    os << to_string(info.act_info);
+    os << ";";
+    os << (info.bidirectional ? "Bidirectional" : "Unidirectional");
+
+    return os;
+}
+
+/** Formatted output of the RecurrentSequenceInfo type.
+ *
+ * @param[in] info Type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const RecurrentSequenceInfo &info)
+{
+    std::stringstream str;
+    str << info;
+    return str.str();
+}
+
 /** Formatted output of the arm_compute::WeightFormat type.
  *
  * @param[in] wf arm_compute::WeightFormat Type to output.
@@ -3425,7 +3497,8 @@ inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::Scatter
     os << "ScatterInfo="
        << "["
        << "Function=" << info.func << ", "
-       << "InitialiseZero=" << info.zero_initialization << "] ";
+       << "InitialiseZero=" << info.zero_initialization << ", "
+       << "UniqueIndices=" << info.unique_indices << "] ";
     return os;
 }
 /** Formatted output of the arm_compute::ScatterInfo type.
@@ -3441,6 +3514,184 @@ inline std::string to_string(const arm_compute::ScatterInfo &info)
     return str.str();
 }
 
+/** Formatted output of the arm_compute::YUVColorStandard type.
+ *
+ * @param[out] os       Output stream.
+ * @param[in]  standard arm_compute::YUVColorStandard type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const YUVColorStandard &standard)
+{
+    switch (standard)
+    {
+        case YUVColorStandard::BT601:
+            os << "BT601";
+            break;
+        case YUVColorStandard::BT709:
+            os << "BT709";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+/** Formatted output of the arm_compute::YUVColorStandard type.
+ *
+ * @param[in] standard arm_compute::YUVColorStandard type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::YUVColorStandard &standard)
+{
+    std::stringstream str;
+    str << standard;
+    return str.str();
+}
+/** Formatted output of the arm_compute::YUVPreprocessInfo type.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  info arm_compute::YUVPreprocessInfo type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::YUVPreprocessInfo &info)
+{
+    os << "YUVPreprocessInfo="
+       << "["
+       << "Format=" << info.format << ", "
+       << "ColorStandard=" << info.color_standard << ", "
+       << "FullRange=" << info.full_range << ", "
+       << "Crop=" << info.crop << ", "
+       << "SamplingPolicy=" << info.sampling_policy << ", "
+       << "BGR=" << info.bgr << ", "
+       << "NormMean=" << info.norm_mean << ", "
+       << "NormStd=" << info.norm_std << "] ";
+    return os;
+}
+/** Formatted output of the arm_compute::YUVPreprocessInfo type.
+ *
+ * @param[in] info arm_compute::YUVPreprocessInfo type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::YUVPreprocessInfo &info)
+{
+    std::stringstream str;
+    str << info;
+    return str.str();
+}
+
+/** Formatted output of the arm_compute::ElementwiseExpressionOp type.
+ *
+ * @param[out] os Output stream.
+ * @param[in]  op arm_compute::ElementwiseExpressionOp type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const ElementwiseExpressionOp &op)
+{
+    switch (op)
+    {
+        case ElementwiseExpressionOp::INPUT:
+            os << "INPUT";
+            break;
+        case ElementwiseExpressionOp::ADD:
+            os << "ADD";
+            break;
+        case ElementwiseExpressionOp::SUB:
+            os << "SUB";
+            break;
+        case ElementwiseExpressionOp::MUL:
+            os << "MUL";
+            break;
+        case ElementwiseExpressionOp::DIV:
+            os << "DIV";
+            break;
+        case ElementwiseExpressionOp::MAX:
+            os << "MAX";
+            break;
+        case ElementwiseExpressionOp::MIN:
+            os << "MIN";
+            break;
+        case ElementwiseExpressionOp::SQUARED_DIFF:
+            os << "SQUARED_DIFF";
+            break;
+        case ElementwiseExpressionOp::NEG:
+            os << "NEG";
+            break;
+        case ElementwiseExpressionOp::ABS:
+            os << "ABS";
+            break;
+        case ElementwiseExpressionOp::EXP:
+            os << "EXP";
+            break;
+        case ElementwiseExpressionOp::RSQRT:
+            os << "RSQRT";
+            break;
+        case ElementwiseExpressionOp::ACTIVATION:
+            os << "ACTIVATION";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("NOT_SUPPORTED!");
+    }
+    return os;
+}
+/** Formatted output of the arm_compute::ElementwiseExpressionOp type.
+ *
+ * @param[in] op arm_compute::ElementwiseExpressionOp type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::ElementwiseExpressionOp &op)
+{
+    std::stringstream str;
+    str << op;
+    return str.str();
+}
+/** Formatted output of the arm_compute::ElementwiseExpression type.
+ *
+ * Each node is printed as its index, its operation and its operands.
+ *
+ * @param[out] os   Output stream.
+ * @param[in]  expr arm_compute::ElementwiseExpression type to output.
+ *
+ * @return Modified output stream.
+ */
+inline ::std::ostream &operator<<(::std::ostream &os, const arm_compute::ElementwiseExpression &expr)
+{
+    os << "ElementwiseExpression=[";
+    const auto &nodes = expr.nodes();
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        const auto &node = nodes[i];
+        os << (i == 0 ? "" : ", ") << "%" << i << "=" << node.op << "(" << node.lhs;
+        if (node.rhs >= 0)
+        {
+            os << "," << node.rhs;
+        }
+        if (node.op == ElementwiseExpressionOp::ACTIVATION)
+        {
+            os << "," << node.act_info.activation();
+        }
+        os << ")";
+    }
+    os << "] ";
+    return os;
+}
+/** Formatted output of the arm_compute::ElementwiseExpression type.
+ *
+ * @param[in] expr arm_compute::ElementwiseExpression type to output.
+ *
+ * @return Formatted string.
+ */
+inline std::string to_string(const arm_compute::ElementwiseExpression &expr)
+{
+    std::stringstream str;
+    str << expr;
+    return str.str();
+}
+
 /** Formatted output of the bool data type.
  *
  * @param[in] info bool type to output.